@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/network-module.h>
+#include <ns3/point-to-point-module.h>
+#include <ns3/psc-module.h>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+using namespace psc;
+
+/*
+ * Scaling benchmark of the population mode of the Intel HTTP Model.
+ *
+ * The scenario has two nodes connected with a point-to-point link: an
+ * HTTP server and a node with the web load of a population of users. For
+ * each number of users requested, the scenario is run twice: once with an
+ * IntelHttpClient application per user, and once with a single
+ * IntelHttpPopulationClient application emulating all the users.
+ *
+ * For each run, the script reports the pages served, the mean number of
+ * embedded objects per page, the mean size of the main and embedded
+ * objects, the mean page load time, the number of simulator events
+ * executed, and the time taken to run the simulation. The traffic
+ * statistics of both modes should match (within the statistical noise),
+ * while the population mode should require fewer events and less time.
+ *
+ * There are two parameters to this scenario:
+ * - clients: comma separated list with the numbers of users (default: 10,100,1000)
+ * - duration: time the users are active (default: 300 s)
+ */
+
+NS_LOG_COMPONENT_DEFINE("ExampleIntelHttpPopulation");
+
+/**
+ * Statistics of a run of the scenario
+ */
+struct RunStats
+{
+    uint64_t mainObjects = 0;     //!< Main objects sent by the server
+    uint64_t mainBytes = 0;       //!< Bytes of the main objects sent
+    uint64_t embeddedObjects = 0; //!< Embedded objects sent by the server
+    uint64_t embeddedBytes = 0;   //!< Bytes of the embedded objects sent
+    uint64_t pageLoads = 0;       //!< Pages loaded by the clients
+    double pageLoadTimeSum = 0;   //!< Sum of the page load times, in seconds
+};
+
+void
+ServerTxMain(RunStats* stats, Ptr<const Packet> p)
+{
+    stats->mainObjects++;
+    stats->mainBytes += p->GetSize();
+}
+
+void
+ServerTxEmbedded(RunStats* stats, Ptr<const Packet> p)
+{
+    stats->embeddedObjects++;
+    stats->embeddedBytes += p->GetSize();
+}
+
+void
+ClientPageLoadTime(RunStats* stats, Time oldValue, Time newValue)
+{
+    stats->pageLoads++;
+    stats->pageLoadTimeSum += newValue.GetSeconds();
+}
+
+void
+PopulationPageLoad(RunStats* stats, uint32_t client, Time loadTime)
+{
+    stats->pageLoads++;
+    stats->pageLoadTimeSum += loadTime.GetSeconds();
+}
+
+/**
+ * Runs the scenario once
+ *
+ * \param clients The number of users
+ * \param population True to use a population client, false for an application per user
+ * \param duration The time the users are active
+ */
+void
+RunScenario(uint32_t clients, bool population, Time duration)
+{
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("10Gbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("1ms"));
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+    Ipv4AddressHelper address("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    RunStats stats;
+
+    IntelHttpServerHelper serverHelper;
+    ApplicationContainer serverApps = serverHelper.Install(nodes.Get(0));
+    serverApps.Start(Seconds(0));
+    serverApps.Get(0)->TraceConnectWithoutContext("TxMainObject",
+                                                  MakeBoundCallback(&ServerTxMain, &stats));
+    serverApps.Get(0)->TraceConnectWithoutContext("TxEmbeddedObject",
+                                                  MakeBoundCallback(&ServerTxEmbedded, &stats));
+
+    // The users start their first page during the first second
+    ApplicationContainer clientApps;
+    if (population)
+    {
+        IntelHttpPopulationClientHelper clientHelper(interfaces.GetAddress(0), clients);
+        clientHelper.Set("StartWindow", TimeValue(Seconds(1)));
+        clientApps = clientHelper.Install(nodes.Get(1));
+        clientApps.Get(0)->TraceConnectWithoutContext(
+            "PageLoad",
+            MakeBoundCallback(&PopulationPageLoad, &stats));
+        clientApps.Start(Seconds(1));
+    }
+    else
+    {
+        Ptr<UniformRandomVariable> startRv = CreateObject<UniformRandomVariable>();
+        IntelHttpClientHelper clientHelper(interfaces.GetAddress(0));
+        for (uint32_t i = 0; i < clients; i++)
+        {
+            ApplicationContainer app = clientHelper.Install(nodes.Get(1));
+            app.Start(Seconds(1 + startRv->GetValue(0, 1)));
+            app.Get(0)->TraceConnectWithoutContext(
+                "PageLoadTime",
+                MakeBoundCallback(&ClientPageLoadTime, &stats));
+            clientApps.Add(app);
+        }
+    }
+    clientApps.Stop(Seconds(1) + duration);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Stop(Seconds(1) + duration);
+    Simulator::Run();
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << std::setw(10) << (population ? "population" : "apps") << std::setw(8) << clients
+              << std::setw(10) << stats.mainObjects << std::setw(10)
+              << (stats.mainObjects ? 1.0 * stats.embeddedObjects / stats.mainObjects : 0)
+              << std::setw(12) << (stats.mainObjects ? stats.mainBytes / stats.mainObjects : 0)
+              << std::setw(12)
+              << (stats.embeddedObjects ? stats.embeddedBytes / stats.embeddedObjects : 0)
+              << std::setw(12) << (stats.pageLoads ? stats.pageLoadTimeSum / stats.pageLoads : 0)
+              << std::setw(12) << events << std::setw(10)
+              << std::chrono::duration<double>(end - start).count() << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string clientCounts = "10,100,1000";
+    Time duration = Seconds(300);
+
+    CommandLine cmd;
+    cmd.AddValue("clients", "Comma separated list with the numbers of users", clientCounts);
+    cmd.AddValue("duration", "Time the users are active", duration);
+    cmd.Parse(argc, argv);
+
+    std::vector<uint32_t> counts;
+    std::istringstream list(clientCounts);
+    std::string count;
+    while (std::getline(list, count, ','))
+    {
+        counts.push_back(std::stoul(count));
+    }
+
+    std::cout << std::setprecision(4);
+    std::cout << std::setw(10) << "mode" << std::setw(8) << "users" << std::setw(10) << "pages"
+              << std::setw(10) << "obj/page" << std::setw(12) << "main (B)" << std::setw(12)
+              << "embed (B)" << std::setw(12) << "load (s)" << std::setw(12) << "events"
+              << std::setw(10) << "wall (s)" << std::endl;
+    for (auto clients : counts)
+    {
+        RunScenario(clients, false, duration);
+        RunScenario(clients, true, duration);
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/network-module.h>
+#include <ns3/point-to-point-layout-module.h>
+#include <ns3/point-to-point-module.h>
+#include <ns3/psc-module.h>
+
+#include <chrono>
+
+using namespace ns3;
+using namespace psc;
+
+/*
+ * Stress example for the Intel HTTP Models, with many clients served by a
+ * single HTTP server application.
+ *
+ * The scenario is a star topology, with the HTTP server in the hub node and
+ * an HTTP client in each one of the leaf nodes, all of them connecting to the
+ * same server port. The clients are started at random times during the first
+ * second of the simulation, and stopped at the end of the requested duration.
+ * The server is kept running for some time afterwards, so that it can answer
+ * all the requests received from the clients.
+ *
+ * At the end of the simulation, the script checks that every request sent by
+ * the clients was received and answered by the server, and reports the
+ * throughput of the server and the time taken to run the simulation. The
+ * script returns an error if any request was lost or not answered.
+ *
+ * There are two parameters to this scenario:
+ * - numClients: number of HTTP clients (default: 200)
+ * - duration: time the clients are active (default: 300 s)
+ */
+
+NS_LOG_COMPONENT_DEFINE("ExampleIntelHttpStress");
+
+/**
+ * Counters of the requests and responses of the scenario
+ */
+struct HttpCounters
+{
+    uint64_t clientRequests = 0;  //!< Requests sent by the clients
+    uint64_t clientResponses = 0; //!< Responses received by the clients
+    uint64_t serverRequests = 0;  //!< Requests received by the server
+    uint64_t serverResponses = 0; //!< Responses sent by the server
+    uint64_t serverBytes = 0;     //!< Bytes sent by the server
+};
+
+void
+ClientTx(HttpCounters* counters, Ptr<const Packet> p)
+{
+    counters->clientRequests++;
+}
+
+void
+ClientRx(HttpCounters* counters, Ptr<const Packet> p, const Address& from)
+{
+    counters->clientResponses++;
+}
+
+void
+ServerRx(HttpCounters* counters, Ptr<const Packet> p, const Address& from)
+{
+    counters->serverRequests++;
+}
+
+void
+ServerTx(HttpCounters* counters, Ptr<const Packet> p)
+{
+    counters->serverResponses++;
+    counters->serverBytes += p->GetSize();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numClients = 200;
+    Time duration = Seconds(300);
+
+    CommandLine cmd;
+    cmd.AddValue("numClients", "Number of HTTP clients", numClients);
+    cmd.AddValue("duration", "Time the clients are active", duration);
+    cmd.Parse(argc, argv);
+
+    // Time for the server to answer the pending requests once the clients
+    // stop, larger than the maximum embedded object inter-arrival time
+    const Time drainTime = Seconds(60);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("1Gbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("2ms"));
+    PointToPointStarHelper star(numClients, pointToPoint);
+
+    InternetStackHelper stack;
+    star.InstallStack(stack);
+    star.AssignIpv4Addresses(Ipv4AddressHelper("10.1.0.0", "255.255.255.0"));
+
+    HttpCounters counters;
+
+    // HTTP Server (hub node)
+    IntelHttpServerHelper serverHelper;
+    ApplicationContainer serverApps = serverHelper.Install(star.GetHub());
+    serverApps.Start(Seconds(0));
+    serverApps.Stop(duration + drainTime);
+    serverApps.Get(0)->TraceConnectWithoutContext("Rx", MakeBoundCallback(&ServerRx, &counters));
+    serverApps.Get(0)->TraceConnectWithoutContext("Tx", MakeBoundCallback(&ServerTx, &counters));
+
+    // HTTP Clients (leaf nodes)
+    Ptr<UniformRandomVariable> startRv = CreateObject<UniformRandomVariable>();
+    ApplicationContainer clientApps;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        IntelHttpClientHelper clientHelper(star.GetHubIpv4Address(i));
+        ApplicationContainer app = clientHelper.Install(star.GetSpokeNode(i));
+        app.Start(Seconds(startRv->GetValue(0, 1)));
+        app.Get(0)->TraceConnectWithoutContext("Tx", MakeBoundCallback(&ClientTx, &counters));
+        app.Get(0)->TraceConnectWithoutContext("Rx", MakeBoundCallback(&ClientRx, &counters));
+        clientApps.Add(app);
+    }
+    clientApps.Stop(duration);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Stop(duration + drainTime);
+    Simulator::Run();
+    Simulator::Destroy();
+    auto end = std::chrono::steady_clock::now();
+
+    double throughput = counters.serverBytes * 8.0 / (duration + drainTime).GetSeconds() / 1e6;
+    std::cout << "Clients: " << numClients << std::endl;
+    std::cout << "Requests sent by the clients: " << counters.clientRequests << std::endl;
+    std::cout << "Requests received by the server: " << counters.serverRequests << std::endl;
+    std::cout << "Responses sent by the server: " << counters.serverResponses << std::endl;
+    std::cout << "Responses received by the clients before stopping: "
+              << counters.clientResponses << std::endl;
+    std::cout << "Server throughput: " << throughput << " Mbps" << std::endl;
+    std::cout << "Wall-clock time: " << std::chrono::duration<double>(end - start).count()
+              << " s" << std::endl;
+
+    if (counters.serverRequests != counters.clientRequests ||
+        counters.serverResponses != counters.serverRequests)
+    {
+        std::cerr << "Error, not all the requests were received and answered" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,382 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/csma-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/psc-module.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// On-network MCPTT scenario run with the distributed (MPI) simulator.
+//
+// Each group of users is on its own CSMA LAN behind a router, and each router
+// is connected to the MCPTT server with a point-to-point link. The LANs are
+// spread round-robin between the ranks (a CSMA channel cannot span ranks),
+// and the server is simulated by rank 0. Each group has one prearranged group
+// call, with the users pushing and releasing the PTT button automatically.
+//
+// Every rank builds the whole scenario: the MCPTT helpers create the
+// applications of the nodes simulated by the other ranks as mirrors, so that
+// the user IDs, ports and call IDs are the same on every rank, and in the
+// serial run.
+//
+// At the end, the access time and mouth-to-ear latency KPIs are summed over
+// the ranks and reported by rank 0. To check the distributed run against the
+// serial one:
+//
+//   ./ns3 run "example-mcptt-mpi --distributed=false --kpi-file=serial.txt"
+//   mpirun -np 4 ./ns3-dev-example-mcptt-mpi-default --reference=serial.txt
+//
+// The second command exits with an error if any KPI differs.
+//
+// Network Topology
+//
+//    users (LAN 0)                              users (LAN n-1)
+//   ===============                              ===============
+//          |                                            |
+//       router 0 ---------- server ---------- ... -- router n-1
+//                   point-to-point
+
+using namespace ns3;
+using namespace psc;
+
+NS_LOG_COMPONENT_DEFINE("McpttMpiExample");
+
+/**
+ * KPIs of the users simulated by this rank
+ */
+struct McpttKpis
+{
+    std::map<std::string, int64_t> accessCount; //!< Access time samples per result
+    std::map<std::string, int64_t> accessSumNs; //!< Sum of the access times per result
+    int64_t m2eCount = 0;                       //!< Mouth-to-ear latency samples
+    int64_t m2eSumNs = 0;                       //!< Sum of the mouth-to-ear latencies
+    int64_t m2eMaxNs = 0;                       //!< Maximum mouth-to-ear latency
+};
+
+void
+AccessTimeTrace(McpttKpis* kpis,
+                Time t,
+                uint32_t userId,
+                uint16_t callId,
+                std::string result,
+                Time latency)
+{
+    kpis->accessCount[result]++;
+    kpis->accessSumNs[result] += latency.GetNanoSeconds();
+}
+
+void
+M2eLatencyTrace(McpttKpis* kpis,
+                Time t,
+                uint32_t ssrc,
+                uint64_t nodeId,
+                uint16_t callId,
+                Time latency)
+{
+    kpis->m2eCount++;
+    kpis->m2eSumNs += latency.GetNanoSeconds();
+    kpis->m2eMaxNs = std::max(kpis->m2eMaxNs, latency.GetNanoSeconds());
+}
+
+/**
+ * Sums (or takes the maximum of) a KPI over the ranks
+ * \param value The KPI of this rank
+ * \param op The reduction operation
+ * \param distributed Whether the simulation is distributed
+ * \returns The reduced KPI on rank 0
+ */
+int64_t
+Reduce(int64_t value, MPI_Op op, bool distributed)
+{
+    if (!distributed)
+    {
+        return value;
+    }
+    int64_t result = 0;
+    MPI_Reduce(&value, &result, 1, MPI_INT64_T, op, 0, MpiInterface::GetCommunicator());
+    return result;
+}
+
+int
+main(int argc, char* argv[])
+{
+    bool distributed = true;
+    bool nullmsg = false;
+    uint32_t groups = 8;
+    uint32_t usersPerGroup = 10;
+    double startSec = 2.0;
+    double stopSec = 60.0;
+    std::string kpiFile;
+    std::string reference;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("distributed", "Run with the distributed simulator.", distributed);
+    cmd.AddValue("nullmsg", "Use the null message synchronization algorithm.", nullmsg);
+    cmd.AddValue("groups", "The number of groups (and LANs).", groups);
+    cmd.AddValue("users", "The number of users per group.", usersPerGroup);
+    cmd.AddValue("start-time",
+                 "The number of seconds into the simulation that the applications should start.",
+                 startSec);
+    cmd.AddValue("stop-time",
+                 "The number of seconds into the simulation that the applications should stop.",
+                 stopSec);
+    cmd.AddValue("kpi-file", "The file to write the KPIs to (rank 0).", kpiFile);
+    cmd.AddValue("reference", "The KPI file of a reference (e.g. serial) run.", reference);
+    cmd.Parse(argc, argv);
+
+    uint32_t rank = 0;
+    uint32_t ranks = 1;
+    if (distributed)
+    {
+        GlobalValue::Bind("SimulatorImplementationType",
+                          StringValue(nullmsg ? "ns3::NullMessageSimulatorImpl"
+                                              : "ns3::DistributedSimulatorImpl"));
+        MpiInterface::Enable(&argc, &argv);
+        rank = MpiInterface::GetSystemId();
+        ranks = MpiInterface::GetSize();
+    }
+    // Keep the ports allocated during the simulation unique across the ranks
+    McpttPttApp::SetPortAllocationStride(ranks);
+
+    Config::SetDefault("ns3::psc::McpttOnNetworkFloorParticipant::GenMedia", BooleanValue(true));
+
+    Time start = Seconds(startSec);
+    Time stop = Seconds(stopSec);
+
+    NS_LOG_INFO("Building topology on rank " << rank << " of " << ranks << "...");
+    NodeContainer server;
+    server.Create(1, 0);
+
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("1Gbps"));
+    // Also the lookahead of the distributed simulator
+    p2p.SetChannelAttribute("Delay", StringValue("5ms"));
+
+    CsmaHelper csma;
+    csma.SetChannelAttribute("DataRate", StringValue("100Mbps"));
+    csma.SetChannelAttribute("Delay", TimeValue(MicroSeconds(1)));
+
+    InternetStackHelper stack;
+    stack.Install(server);
+
+    Ipv4AddressHelper backboneAddress("10.1.0.0", "255.255.255.252");
+    Ipv4AddressHelper lanAddress("10.2.0.0", "255.255.255.0");
+
+    std::vector<NodeContainer> users(groups);
+    std::vector<Ipv4InterfaceContainer> userInterfaces(groups);
+    Ipv4Address serverAddress;
+    for (uint32_t g = 0; g < groups; g++)
+    {
+        uint32_t systemId = g % ranks;
+        NodeContainer router;
+        router.Create(1, systemId);
+        users[g].Create(usersPerGroup, systemId);
+        stack.Install(router);
+        stack.Install(users[g]);
+
+        NetDeviceContainer backbone = p2p.Install(server.Get(0), router.Get(0));
+        Ipv4InterfaceContainer backboneInterfaces = backboneAddress.Assign(backbone);
+        backboneAddress.NewNetwork();
+        if (g == 0)
+        {
+            serverAddress = backboneInterfaces.GetAddress(0);
+        }
+
+        NetDeviceContainer lan = csma.Install(NodeContainer(router, users[g]));
+        Ipv4InterfaceContainer lanInterfaces = lanAddress.Assign(lan);
+        lanAddress.NewNetwork();
+        for (uint32_t u = 0; u < usersPerGroup; u++)
+        {
+            userInterfaces[g].Add(lanInterfaces.Get(u + 1));
+        }
+    }
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    NS_LOG_INFO("Creating applications...");
+    McpttServerHelper serverHelper;
+    Ptr<McpttServerApp> serverApp = serverHelper.Install(server.Get(0));
+    serverApp->SetLocalAddress(serverAddress);
+    serverApp->SetStartTime(start);
+    serverApp->SetStopTime(stop);
+
+    McpttHelper clientHelper;
+    clientHelper.SetPttApp("ns3::psc::McpttPttApp", "PushOnStart", BooleanValue(true));
+    clientHelper.SetMediaSrc("ns3::psc::McpttMediaSrc",
+                             "Bytes",
+                             UintegerValue(60),
+                             "DataRate",
+                             DataRateValue(DataRate("24kb/s")));
+    clientHelper.SetPusher("ns3::psc::McpttPusher", "Automatic", BooleanValue(true));
+    clientHelper.SetPusherPttInterarrivalTimeVariable("ns3::NormalRandomVariable",
+                                                      "Mean",
+                                                      DoubleValue(5.0),
+                                                      "Variance",
+                                                      DoubleValue(2.0));
+    clientHelper.SetPusherPttDurationVariable("ns3::NormalRandomVariable",
+                                              "Mean",
+                                              DoubleValue(5.0),
+                                              "Variance",
+                                              DoubleValue(2.0));
+
+    McpttCallHelper callHelper;
+    callHelper.SetArbitrator("ns3::psc::McpttOnNetworkFloorArbitrator",
+                             "AckRequired",
+                             BooleanValue(false),
+                             "AudioCutIn",
+                             BooleanValue(false),
+                             "DualFloorSupported",
+                             BooleanValue(false),
+                             "TxSsrc",
+                             UintegerValue(100),
+                             "QueueingSupported",
+                             BooleanValue(true));
+    callHelper.SetTowardsParticipant("ns3::psc::McpttOnNetworkFloorTowardsParticipant",
+                                     "ReceiveOnly",
+                                     BooleanValue(false));
+    callHelper.SetParticipant("ns3::psc::McpttOnNetworkFloorParticipant",
+                              "AckRequired",
+                              BooleanValue(false),
+                              "GenMedia",
+                              BooleanValue(true));
+    callHelper.SetServerCall("ns3::psc::McpttServerCall",
+                             "AmbientListening",
+                             BooleanValue(false),
+                             "TemporaryGroup",
+                             BooleanValue(false));
+
+    // Every rank configures all the groups, in the same order
+    for (uint32_t g = 0; g < groups; g++)
+    {
+        ApplicationContainer clientApps = clientHelper.Install(users[g]);
+        clientApps.Start(start);
+        clientApps.Stop(stop);
+        for (uint32_t u = 0; u < clientApps.GetN(); u++)
+        {
+            DynamicCast<McpttPttApp>(clientApps.Get(u))
+                ->SetLocalAddress(userInterfaces[g].GetAddress(u));
+        }
+        callHelper.AddCall(clientApps,
+                           serverApp,
+                           g + 1,
+                           McpttCallMsgFieldCallType::BASIC_GROUP,
+                           start,
+                           stop);
+    }
+
+    McpttKpis kpis;
+    Ptr<McpttTraceHelper> traceHelper = CreateObject<McpttTraceHelper>();
+    traceHelper->EnableAccessTimeTrace();
+    traceHelper->EnableMouthToEarLatencyTrace();
+    traceHelper->TraceConnectWithoutContext("AccessTimeTrace",
+                                            MakeBoundCallback(&AccessTimeTrace, &kpis));
+    traceHelper->TraceConnectWithoutContext("MouthToEarLatencyTrace",
+                                            MakeBoundCallback(&M2eLatencyTrace, &kpis));
+
+    NS_LOG_INFO("Starting simulation...");
+    Simulator::Stop(stop + Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // The access time results are a small fixed set, reduce them by name so
+    // that every rank takes part in the same reductions
+    std::map<std::string, int64_t> results;
+    for (const std::string result : {"I", "Q", "A", "D", "F"})
+    {
+        results["access-count-" + result] =
+            Reduce(kpis.accessCount[result], MPI_SUM, distributed);
+        results["access-sum-ns-" + result] =
+            Reduce(kpis.accessSumNs[result], MPI_SUM, distributed);
+    }
+    results["m2e-count"] = Reduce(kpis.m2eCount, MPI_SUM, distributed);
+    results["m2e-sum-ns"] = Reduce(kpis.m2eSumNs, MPI_SUM, distributed);
+    results["m2e-max-ns"] = Reduce(kpis.m2eMaxNs, MPI_MAX, distributed);
+
+    int status = 0;
+    if (rank == 0)
+    {
+        for (const auto& [name, value] : results)
+        {
+            std::cout << name << " " << value << std::endl;
+        }
+
+        if (!kpiFile.empty())
+        {
+            std::ofstream out(kpiFile);
+            for (const auto& [name, value] : results)
+            {
+                out << name << " " << value << std::endl;
+            }
+        }
+
+        if (!reference.empty())
+        {
+            std::ifstream in(reference);
+            NS_ABORT_MSG_UNLESS(in.is_open(), "Cannot open the reference file " << reference);
+            std::string name;
+            int64_t value;
+            uint32_t mismatches = 0;
+            while (in >> name >> value)
+            {
+                if (results[name] != value)
+                {
+                    std::cout << "Mismatch for " << name << ": " << results[name]
+                              << " instead of " << value << std::endl;
+                    mismatches++;
+                }
+            }
+            std::cout << (mismatches ? "KPIs differ from " : "KPIs identical to ") << reference
+                      << std::endl;
+            status = mismatches ? 1 : 0;
+        }
+    }
+
+    if (distributed)
+    {
+        MpiInterface::Disable();
+    }
+
+    return status;
+}
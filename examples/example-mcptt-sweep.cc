@@ -0,0 +1,512 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/psc-module.h"
+#include "ns3/wifi-module.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Replication and parameter sweep driver for MCPTT scenarios.
+//
+// The driver runs a registered scenario for every point of a parameter grid,
+// 'replications' times each, in a pool of forked worker processes (one per
+// core by default). Each run is an independent ns-3 simulation in its own
+// process, so the runs scale with the number of cores without changing the
+// simulator.
+//
+// The grid is given as "name=value,value;name=value,...", e.g.
+//
+//   ./ns3 run "example-mcptt-sweep --grid=users=2,4,8;vaf=0.5,1 --replications=100"
+//
+// runs the 6 configurations 100 times each. Replication r of every
+// configuration uses RNG run 'run-base' + r, so the configurations are
+// compared with common random numbers, and the scenarios assign their
+// streams explicitly, so each run is reproducible on its own with the same
+// parameters and run number.
+//
+// Each worker reports the access time and mouth-to-ear latency KPIs of its
+// run to the driver through a pipe. The driver merges them per configuration
+// and writes one summary line per configuration to 'output': the pooled mean
+// of the samples, and the 95% confidence interval of the per-run means.
+//
+// The "pusher-orchestrator" scenario is the one of the
+// example-mcptt-pusher-orchestrator example: an off-network group call over
+// Wi-Fi whose users are driven by the talk spurt, contention and session
+// orchestrators. Its parameters are "users", "vaf", "saf", "cp" and
+// "duration" (in seconds). Other scenarios can be added to the registry in
+// main().
+
+using namespace ns3;
+using namespace psc;
+
+NS_LOG_COMPONENT_DEFINE("McpttSweepExample");
+
+/**
+ * Parameters of one run of a scenario, by name
+ */
+using SweepParams = std::map<std::string, std::string>;
+
+/**
+ * KPIs of one run of a scenario
+ */
+struct RunKpis
+{
+    uint64_t accessCount = 0; //!< Number of access time samples (immediate or queued)
+    double accessSumMs = 0;   //!< Sum of the access times
+    uint64_t m2eCount = 0;    //!< Number of mouth-to-ear latency samples
+    double m2eSumMs = 0;      //!< Sum of the mouth-to-ear latencies
+};
+
+/**
+ * A scenario: builds and runs one simulation, and returns its KPIs
+ */
+using Scenario = std::function<RunKpis(const SweepParams&)>;
+
+/**
+ * Gets a parameter of a run, or its default value
+ * \param params The parameters
+ * \param name The parameter name
+ * \param defaultValue The default value
+ * \returns The value of the parameter
+ */
+double
+GetParam(const SweepParams& params, const std::string& name, double defaultValue)
+{
+    auto it = params.find(name);
+    return it == params.end() ? defaultValue : std::stod(it->second);
+}
+
+void
+AccessTimeTrace(RunKpis* kpis,
+                Time t,
+                uint32_t userId,
+                uint16_t callId,
+                std::string result,
+                Time latency)
+{
+    if (result == "I" || result == "Q")
+    {
+        kpis->accessCount++;
+        kpis->accessSumMs += latency.GetSeconds() * 1000.0;
+    }
+}
+
+void
+M2eLatencyTrace(RunKpis* kpis,
+                Time t,
+                uint32_t ssrc,
+                uint64_t nodeId,
+                uint16_t callId,
+                Time latency)
+{
+    kpis->m2eCount++;
+    kpis->m2eSumMs += latency.GetSeconds() * 1000.0;
+}
+
+/**
+ * The scenario of example-mcptt-pusher-orchestrator, without its traces
+ * \param params The parameters of the run
+ * \returns The KPIs of the run
+ */
+RunKpis
+PusherOrchestratorScenario(const SweepParams& params)
+{
+    auto appCount = static_cast<uint32_t>(GetParam(params, "users", 4));
+    double vaf = GetParam(params, "vaf", 1.0);
+    double saf = GetParam(params, "saf", 0.5);
+    double cp = GetParam(params, "cp", 0.0);
+    Time startTime = Seconds(2.0);
+    Time stopTime = startTime + Seconds(GetParam(params, "duration", 60.0));
+
+    NodeContainer nodes;
+    nodes.Create(appCount);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211g);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("ErpOfdmRate6Mbps"));
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    YansWifiChannelHelper wifiChannel;
+    wifiChannel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
+    wifiChannel.AddPropagationLoss("ns3::FriisPropagationLossModel",
+                                   "Frequency",
+                                   DoubleValue(2.407e9));
+    YansWifiPhyHelper phy;
+    phy.SetChannel(wifiChannel.Create());
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes);
+
+    Ptr<RandomBoxPositionAllocator> positionAlloc = CreateObject<RandomBoxPositionAllocator>();
+    positionAlloc->SetX(CreateObjectWithAttributes<UniformRandomVariable>("Min",
+                                                                          DoubleValue(0.0),
+                                                                          "Max",
+                                                                          DoubleValue(5.0)));
+    positionAlloc->SetY(CreateObjectWithAttributes<UniformRandomVariable>("Min",
+                                                                          DoubleValue(0.0),
+                                                                          "Max",
+                                                                          DoubleValue(5.0)));
+    positionAlloc->SetZ(
+        CreateObjectWithAttributes<ConstantRandomVariable>("Constant", DoubleValue(1.5)));
+
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    ipv4.Assign(devices);
+
+    McpttHelper mcpttHelper;
+    mcpttHelper.SetPttApp("ns3::psc::McpttPttApp", "PushOnStart", BooleanValue(true));
+    mcpttHelper.SetMediaSrc("ns3::psc::McpttMediaSrc",
+                            "Bytes",
+                            UintegerValue(60),
+                            "DataRate",
+                            DataRateValue(DataRate("24kb/s")));
+    mcpttHelper.SetPusher("ns3::psc::McpttPusher", "Automatic", BooleanValue(false));
+    ApplicationContainer clientApps = mcpttHelper.Install(nodes);
+    clientApps.Start(startTime);
+    clientApps.Stop(stopTime);
+
+    McpttCallHelper callHelper;
+    callHelper.ConfigureOffNetworkBasicGrpCall(clientApps,
+                                               Ipv4Address("255.255.255.255"),
+                                               appCount);
+
+    Ptr<McpttPusherOrchestratorSpurtCdf> spurtOrchestrator =
+        CreateObject<McpttPusherOrchestratorSpurtCdf>();
+    spurtOrchestrator->SetAttribute("ActivityFactor", DoubleValue(vaf));
+    Ptr<McpttPusherOrchestratorContention> contentionOrchestrator =
+        CreateObject<McpttPusherOrchestratorContention>();
+    contentionOrchestrator->SetAttribute("ContentionProbability", DoubleValue(cp));
+    contentionOrchestrator->SetAttribute("Orchestrator", PointerValue(spurtOrchestrator));
+    Ptr<McpttPusherOrchestratorSessionCdf> sessionOrchestrator =
+        CreateObject<McpttPusherOrchestratorSessionCdf>();
+    sessionOrchestrator->SetAttribute("ActivityFactor", DoubleValue(saf));
+    sessionOrchestrator->SetAttribute("Orchestrator", PointerValue(contentionOrchestrator));
+    sessionOrchestrator->StartAt(startTime);
+    sessionOrchestrator->StopAt(stopTime);
+    mcpttHelper.AddPushersToOrchestrator(sessionOrchestrator, clientApps);
+
+    // Fixed streams, so that a run only depends on its parameters and run number
+    int64_t stream = 1;
+    stream += positionAlloc->AssignStreams(stream);
+    stream += wifi.AssignStreams(devices, stream);
+    stream += sessionOrchestrator->AssignStreams(stream);
+
+    RunKpis kpis;
+    Ptr<McpttTraceHelper> traceHelper = CreateObject<McpttTraceHelper>();
+    traceHelper->EnableAccessTimeTrace();
+    traceHelper->EnableMouthToEarLatencyTrace();
+    traceHelper->TraceConnectWithoutContext("AccessTimeTrace",
+                                            MakeBoundCallback(&AccessTimeTrace, &kpis));
+    traceHelper->TraceConnectWithoutContext("MouthToEarLatencyTrace",
+                                            MakeBoundCallback(&M2eLatencyTrace, &kpis));
+
+    Simulator::Stop(stopTime + Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    return kpis;
+}
+
+/**
+ * Expands a grid specification ("name=v1,v2;name=v1") into its points
+ * \param grid The grid specification
+ * \returns The parameters of every point of the grid
+ */
+std::vector<SweepParams>
+ExpandGrid(const std::string& grid)
+{
+    std::vector<SweepParams> points{SweepParams()};
+    std::istringstream dimensions(grid);
+    std::string dimension;
+    while (std::getline(dimensions, dimension, ';'))
+    {
+        if (dimension.empty())
+        {
+            continue;
+        }
+        auto equal = dimension.find('=');
+        NS_ABORT_MSG_IF(equal == std::string::npos, "Invalid grid dimension " << dimension);
+        std::string name = dimension.substr(0, equal);
+        std::istringstream values(dimension.substr(equal + 1));
+        std::string value;
+        std::vector<SweepParams> expanded;
+        while (std::getline(values, value, ','))
+        {
+            for (auto point : points)
+            {
+                point[name] = value;
+                expanded.push_back(point);
+            }
+        }
+        points = expanded;
+    }
+    return points;
+}
+
+/**
+ * A run of the sweep
+ */
+struct SweepJob
+{
+    uint32_t config;      //!< Index of the configuration (grid point)
+    uint32_t replication; //!< Replication number
+};
+
+/**
+ * Runs a job in the current (worker) process and writes its KPIs to a pipe
+ * \param scenario The scenario
+ * \param params The parameters of the configuration
+ * \param run The RNG run number
+ * \param fd The write end of the pipe
+ */
+void
+RunWorker(const Scenario& scenario, const SweepParams& params, uint64_t run, int fd)
+{
+    RngSeedManager::SetRun(run);
+    RunKpis kpis = scenario(params);
+
+    std::ostringstream out;
+    out.precision(17);
+    out << kpis.accessCount << " " << kpis.accessSumMs << " " << kpis.m2eCount << " "
+        << kpis.m2eSumMs;
+    std::string line = out.str();
+    ssize_t written = write(fd, line.data(), line.size());
+    close(fd);
+    // Skip the destructors of the state inherited from the driver
+    _exit(written == static_cast<ssize_t>(line.size()) ? 0 : 1);
+}
+
+/**
+ * Merged KPIs of the replications of one configuration
+ */
+struct ConfigSummary
+{
+    uint32_t runs = 0;              //!< Successful runs
+    uint32_t failures = 0;          //!< Failed runs
+    RunKpis total;                  //!< Sum of the KPIs of the runs
+    std::vector<double> accessMean; //!< Mean access time of each run
+    std::vector<double> m2eMean;    //!< Mean mouth-to-ear latency of each run
+};
+
+/**
+ * Computes the half width of the 95% confidence interval of a mean
+ * \param values The samples
+ * \returns The half width, 0 with less than two samples
+ */
+double
+ConfidenceHalfWidth(const std::vector<double>& values)
+{
+    if (values.size() < 2)
+    {
+        return 0;
+    }
+    double mean = 0;
+    for (auto value : values)
+    {
+        mean += value;
+    }
+    mean /= values.size();
+    double variance = 0;
+    for (auto value : values)
+    {
+        variance += (value - mean) * (value - mean);
+    }
+    variance /= values.size() - 1;
+    // Normal approximation, fine for the usual number of replications
+    return 1.96 * std::sqrt(variance / values.size());
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string scenarioName = "pusher-orchestrator";
+    std::string grid = "users=2,4;vaf=0.5,1";
+    uint32_t replications = 10;
+    uint32_t workers = 0;
+    uint64_t runBase = 1;
+    std::string output = "mcptt-sweep-summary.csv";
+
+    std::map<std::string, Scenario> scenarios;
+    scenarios["pusher-orchestrator"] = &PusherOrchestratorScenario;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("scenario", "The scenario to run.", scenarioName);
+    cmd.AddValue("grid", "The parameter grid (name=v1,v2;name=v1,...).", grid);
+    cmd.AddValue("replications", "The number of replications per configuration.", replications);
+    cmd.AddValue("workers", "The number of worker processes (0 for one per core).", workers);
+    cmd.AddValue("run-base", "The RNG run number of the first replication.", runBase);
+    cmd.AddValue("output", "The summary file.", output);
+    cmd.Parse(argc, argv);
+
+    auto scenarioIt = scenarios.find(scenarioName);
+    NS_ABORT_MSG_IF(scenarioIt == scenarios.end(), "Unknown scenario " << scenarioName);
+    const Scenario& scenario = scenarioIt->second;
+
+    if (workers == 0)
+    {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<SweepParams> configs = ExpandGrid(grid);
+    std::vector<SweepJob> jobs;
+    for (uint32_t r = 0; r < replications; r++)
+    {
+        for (uint32_t c = 0; c < configs.size(); c++)
+        {
+            jobs.push_back({c, r});
+        }
+    }
+    std::cout << "Running " << jobs.size() << " runs (" << configs.size()
+              << " configurations) on " << workers << " workers" << std::endl;
+
+    // Make sure the workers do not inherit unflushed output
+    std::cout.flush();
+
+    std::vector<ConfigSummary> summaries(configs.size());
+    std::map<pid_t, std::pair<SweepJob, int>> running; // worker -> (job, read end of its pipe)
+    size_t next = 0;
+    while (next < jobs.size() || !running.empty())
+    {
+        while (next < jobs.size() && running.size() < workers)
+        {
+            const SweepJob& job = jobs[next++];
+            int fds[2];
+            NS_ABORT_MSG_IF(pipe(fds) != 0, "Cannot create a pipe");
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid < 0, "Cannot fork a worker");
+            if (pid == 0)
+            {
+                close(fds[0]);
+                RunWorker(scenario, configs[job.config], runBase + job.replication, fds[1]);
+            }
+            close(fds[1]);
+            running[pid] = {job, fds[0]};
+        }
+
+        int status = 0;
+        pid_t pid = wait(&status);
+        NS_ABORT_MSG_IF(pid < 0, "Lost track of the workers");
+        auto it = running.find(pid);
+        if (it == running.end())
+        {
+            continue;
+        }
+        auto [job, fd] = it->second;
+        running.erase(it);
+
+        // The KPIs fit in the pipe buffer, so the worker never blocks on them
+        std::string result;
+        char buffer[256];
+        ssize_t n;
+        while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+        {
+            result.append(buffer, n);
+        }
+        close(fd);
+
+        ConfigSummary& summary = summaries[job.config];
+        RunKpis kpis;
+        std::istringstream in(result);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 ||
+            !(in >> kpis.accessCount >> kpis.accessSumMs >> kpis.m2eCount >> kpis.m2eSumMs))
+        {
+            std::cerr << "Run " << runBase + job.replication << " of configuration "
+                      << job.config << " failed" << std::endl;
+            summary.failures++;
+            continue;
+        }
+        summary.runs++;
+        summary.total.accessCount += kpis.accessCount;
+        summary.total.accessSumMs += kpis.accessSumMs;
+        summary.total.m2eCount += kpis.m2eCount;
+        summary.total.m2eSumMs += kpis.m2eSumMs;
+        if (kpis.accessCount)
+        {
+            summary.accessMean.push_back(kpis.accessSumMs / kpis.accessCount);
+        }
+        if (kpis.m2eCount)
+        {
+            summary.m2eMean.push_back(kpis.m2eSumMs / kpis.m2eCount);
+        }
+    }
+
+    std::ofstream out(output);
+    out << "config,params,runs,failures,access_samples,access_mean_ms,access_ci95_ms,"
+           "m2e_samples,m2e_mean_ms,m2e_ci95_ms"
+        << std::endl;
+    for (uint32_t c = 0; c < configs.size(); c++)
+    {
+        const ConfigSummary& summary = summaries[c];
+        std::string params;
+        for (const auto& [name, value] : configs[c])
+        {
+            params += (params.empty() ? "" : ";") + name + "=" + value;
+        }
+        double accessMean = summary.total.accessCount
+                                ? summary.total.accessSumMs / summary.total.accessCount
+                                : 0;
+        double m2eMean =
+            summary.total.m2eCount ? summary.total.m2eSumMs / summary.total.m2eCount : 0;
+        out << c << "," << params << "," << summary.runs << "," << summary.failures << ","
+            << summary.total.accessCount << "," << accessMean << ","
+            << ConfidenceHalfWidth(summary.accessMean) << "," << summary.total.m2eCount << ","
+            << m2eMean << "," << ConfidenceHalfWidth(summary.m2eMean) << std::endl;
+        std::cout << params << ": access time " << accessMean << " ms, M2E latency " << m2eMean
+                  << " ms (" << summary.runs << " runs, " << summary.failures << " failed)"
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/psc-module.h"
+
+#include <chrono>
+
+// Benchmark of the udp group echo server with many clients.
+//
+// A node with many UDP echo clients (each one with its own socket, and thus
+// a different port) is connected to the server node with a point-to-point
+// link. Each client sends a packet every 'interval', starting at a random
+// time during the first interval. In TimeoutLimited mode, only the clients
+// that sent a packet within the last 'timeout' are active and receive the
+// echoes, so the group is much larger than the set of recipients of each
+// packet.
+//
+// With 'groups' larger than one, the clients are spread between the groups
+// hosted by the server, each one on its own port. With 'multicast' enabled,
+// the server sends the echoes for the clients of each group as a single
+// datagram to a multicast address, which is received by a packet sink per
+// group in the client node.
+//
+// At the end, the script reports the number of packets received by the
+// server, the echoes received by the clients, the mean number of recipients
+// per packet, and the time taken to run the simulation.
+//
+// Network Topology
+//
+//  clients             server
+//    n0 ---------------- n1
+//         point-to-point
+
+using namespace ns3;
+using namespace psc;
+
+NS_LOG_COMPONENT_DEFINE("UdpGroupEchoBenchmark");
+
+/**
+ * Counters of the packets of the benchmark
+ */
+struct EchoCounters
+{
+    uint64_t serverRx = 0; //!< Packets received by the server
+    uint64_t clientRx = 0; //!< Echoes received by the clients
+    uint64_t sinkRx = 0;   //!< Multicast echoes received by the client node
+};
+
+void
+ServerRx(EchoCounters* counters, Ptr<const Packet> packet, const Address& from)
+{
+    counters->serverRx++;
+}
+
+void
+ClientRx(EchoCounters* counters, Ptr<const Packet> packet)
+{
+    counters->clientRx++;
+}
+
+void
+SinkRx(EchoCounters* counters, Ptr<const Packet> packet, const Address& from)
+{
+    counters->sinkRx++;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numClients = 2000;
+    Time interval = Seconds(20);
+    Time timeout = Seconds(0.5);
+    std::string mode("TimeoutLimited");
+    Time duration = Seconds(60);
+    uint32_t groups = 1;
+    bool multicast = false;
+
+    CommandLine cmd;
+    cmd.AddValue("numClients", "Number of UDP echo clients", numClients);
+    cmd.AddValue("interval", "Time between the packets of each client", interval);
+    cmd.AddValue("timeout", "Set Timeout attribute", timeout);
+    cmd.AddValue("mode", "Set Mode attribute (InfSession|NoGroupSession|TimeoutLimited)", mode);
+    cmd.AddValue("duration", "Time the clients are active", duration);
+    cmd.AddValue("groups", "Number of groups hosted by the server", groups);
+    cmd.AddValue("multicast", "Send the echoes of each group to a multicast address", multicast);
+    cmd.Parse(argc, argv);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("100Gbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("1ms"));
+    // Large enough for the bursts of echoes of a packet
+    pointToPoint.SetQueue("ns3::DropTailQueue<Packet>", "MaxSize", StringValue("1000000p"));
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    EchoCounters counters;
+
+    // Server
+    uint16_t serverPort = 9;
+    uint16_t multicastPort = 5000;
+    Ipv4Address multicastBase("225.1.0.0");
+    UdpGroupEchoServerHelper echoServer(serverPort);
+    echoServer.SetAttribute("Timeout", TimeValue(timeout));
+    echoServer.SetAttribute("Mode", StringValue(mode));
+    echoServer.SetAttribute("Groups", UintegerValue(groups));
+    if (multicast)
+    {
+        echoServer.SetAttribute("MulticastBase", Ipv4AddressValue(multicastBase));
+        echoServer.SetAttribute("EchoPort", UintegerValue(multicastPort));
+
+        // Route the multicast echoes through the link to the clients
+        Ipv4StaticRoutingHelper multicastRouting;
+        multicastRouting.SetDefaultMulticastRoute(nodes.Get(1), devices.Get(1));
+
+        PacketSinkHelper sink("ns3::UdpSocketFactory", Address());
+        for (uint32_t g = 0; g < groups; g++)
+        {
+            InetSocketAddress groupAddress(Ipv4Address(multicastBase.Get() + g), multicastPort);
+            sink.SetAttribute("Local", AddressValue(groupAddress));
+            ApplicationContainer sinkApp = sink.Install(nodes.Get(0));
+            sinkApp.Get(0)->TraceConnectWithoutContext("Rx",
+                                                       MakeBoundCallback(&SinkRx, &counters));
+        }
+    }
+    ApplicationContainer serverApps = echoServer.Install(nodes.Get(1));
+    serverApps.Start(Seconds(0));
+    serverApps.Get(0)->TraceConnectWithoutContext("Rx", MakeBoundCallback(&ServerRx, &counters));
+
+    // Clients
+    UdpEchoClientHelper echoClient(interfaces.GetAddress(1), serverPort);
+    echoClient.SetAttribute("MaxPackets", UintegerValue(0));
+    echoClient.SetAttribute("Interval", TimeValue(interval));
+    echoClient.SetAttribute("PacketSize", UintegerValue(41));
+
+    Ptr<UniformRandomVariable> startRv = CreateObject<UniformRandomVariable>();
+    ApplicationContainer clientApps;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        echoClient.SetAttribute("RemotePort", UintegerValue(serverPort + i % groups));
+        ApplicationContainer app = echoClient.Install(nodes.Get(0));
+        app.Start(Seconds(1 + startRv->GetValue(0, interval.GetSeconds())));
+        app.Get(0)->TraceConnectWithoutContext("Rx", MakeBoundCallback(&ClientRx, &counters));
+        clientApps.Add(app);
+    }
+    clientApps.Stop(Seconds(1) + duration);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Stop(Seconds(2) + duration);
+    Simulator::Run();
+    Simulator::Destroy();
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Clients: " << numClients << " in " << groups << " group(s)" << std::endl;
+    std::cout << "Packets received by the server: " << counters.serverRx << std::endl;
+    std::cout << "Echoes received by the clients: " << counters.clientRx << std::endl;
+    if (multicast)
+    {
+        std::cout << "Multicast echoes received by the client node: " << counters.sinkRx
+                  << std::endl;
+    }
+    std::cout << "Mean recipients per packet: "
+              << (counters.serverRx ? 1.0 * counters.clientRx / counters.serverRx : 0)
+              << std::endl;
+    std::cout << "Wall-clock time: " << std::chrono::duration<double>(end - start).count()
+              << " s" << std::endl;
+
+    return 0;
+}
@@ -77,6 +77,10 @@ using namespace psc;
  * manner, the model will use the full distributions for new packet sizes and
  * inter-packet intervals.
  *
+ * The client receives the stream with a PscVideoStreamingReceiver, which
+ * measures the packet loss, reordering, delay, jitter and frame completeness
+ * of the stream. These metrics are printed at the end of the simulation.
+ *
  * There are five parameters to this scenario:
  * - distribution: type of video, which can be '720p-bright' (default), '720p-dark', '1080p-bright',
  * or '1080p-dark'
@@ -196,9 +200,10 @@ main(int argc, char* argv[])
 
     nodes.Get(0)->AddApplication(streamingServer);
 
-    PacketSinkHelper packetSinkHelper("ns3::UdpSocketFactory",
-                                      InetSocketAddress(Ipv4Address::GetAny(), 5554));
-    apps.Add(packetSinkHelper.Install(nodes.Get(1)));
+    Ptr<PscVideoStreamingReceiver> streamingClient = CreateObject<PscVideoStreamingReceiver>();
+    apps.Add(streamingClient);
+    streamingClient->SetAttribute("Port", UintegerValue(5554));
+    nodes.Get(1)->AddApplication(streamingClient);
 
     apps.Start(Seconds(10));
     apps.Stop(simTime);
@@ -219,6 +224,15 @@ main(int argc, char* argv[])
                               MakeBoundCallback(&RxPacketTrace, packetOutputStream));
 
     Simulator::Run();
+
+    PscVideoStreamingReceiver::Stats stats = streamingClient->GetTotalStats();
+    std::cout << "Packets received: " << stats.rxPackets << std::endl;
+    std::cout << "Packet loss ratio: " << stats.GetLossRatio() << std::endl;
+    std::cout << "Packets reordered: " << stats.reorderedPackets << std::endl;
+    std::cout << "Mean delay: " << stats.GetMeanDelay().As(Time::MS) << std::endl;
+    std::cout << "Jitter: " << stats.jitter.As(Time::MS) << std::endl;
+    std::cout << "Complete frames: " << stats.completeFrames << "/" << stats.rxFrames << std::endl;
+
     Simulator::Destroy();
 
     return 0;
@@ -1812,10 +1812,9 @@ main(int argc, char* argv[])
 
             bool hasOnNetworkCall = false;
             bool hasOffNetworkCall = false;
-            std::map<uint16_t, Ptr<McpttCall>>::iterator ueCallsIt;
             Ptr<McpttPttApp> pttApp = clientApps.Get(ueNodeIdx)->GetObject<McpttPttApp>();
-            std::map<uint16_t, Ptr<McpttCall>> ueCalls = pttApp->GetCalls();
-            for (ueCallsIt = ueCalls.begin(); ueCallsIt != ueCalls.end(); ueCallsIt++)
+            const McpttPttApp::CallTable& ueCalls = pttApp->GetCalls();
+            for (auto ueCallsIt = ueCalls.begin(); ueCallsIt != ueCalls.end(); ueCallsIt++)
             {
                 Ptr<McpttCall> ueCall = ueCallsIt->second;
                 Ptr<McpttFloorParticipant> ueFloorParticipant = ueCall->GetFloorMachine();
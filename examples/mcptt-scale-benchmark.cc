@@ -0,0 +1,416 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/csma-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/psc-module.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Scalability benchmark of the MCPTT models.
+//
+// The benchmark builds 'ues' MCPTT users over an ideal core network (no
+// losses, ample capacity), puts every user in 'groups-per-ue' groups of
+// 'group-size' users, and runs one group call per group with automatic
+// pushers, either on-network (through an MCPTT server) or off-network. It
+// reports:
+//
+// - the setup time (wall clock, building the scenario),
+// - the run time (wall clock, Simulator::Run),
+// - the number of events processed and the events per second,
+// - the peak resident set size of the process, and
+// - the memory per call, from the growth of the resident set size while
+//   configuring the calls (Linux only, as the peak RSS).
+//
+// The users are split into clusters of 'cluster-size' users, and the groups
+// are formed inside each cluster, 'groups-per-ue' layers of groups each
+// shifted by a fraction of a group (group-size / groups-per-ue users) so
+// that the groups of a user overlap different users. With the "csma" core,
+// each cluster is a CSMA LAN, to which the server is also attached in
+// on-network mode. With the "p2p" core, each user has a point-to-point link
+// to the server, and only on-network mode is supported, as the off-network
+// calls need a broadcast medium.
+//
+// To locate the scaling knee, sweep 'ues' and append the results to a file:
+//
+//   for n in 100 1000 5000 20000; do
+//     ./ns3 run "mcptt-scale-benchmark --ues=$n --output=scale.csv"
+//   done
+//
+// 'tracing' enables the message, state machine, access time and mouth-to-ear
+// latency traces of McpttTraceHelper, to measure their cost.
+
+using namespace ns3;
+using namespace psc;
+
+NS_LOG_COMPONENT_DEFINE("McpttScaleBenchmark");
+
+/**
+ * Reads a field of /proc/self/status
+ * \param field The field, e.g. "VmRSS:"
+ * \returns The value of the field in kB, or 0 if it is not available
+ */
+uint64_t
+ReadProcStatusKb(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind(field, 0) == 0)
+        {
+            return std::strtoull(line.c_str() + field.size(), nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t ues = 100;
+    uint32_t groupsPerUe = 1;
+    uint32_t groupSize = 10;
+    uint32_t clusterSize = 50;
+    std::string mode = "on";
+    std::string core = "csma";
+    bool tracing = false;
+    double startSec = 2.0;
+    double stopSec = 32.0;
+    std::string output;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("ues", "The number of users.", ues);
+    cmd.AddValue("groups-per-ue", "The number of groups of each user.", groupsPerUe);
+    cmd.AddValue("group-size", "The number of users in each group.", groupSize);
+    cmd.AddValue("cluster-size",
+                 "The number of users of each cluster (LAN) the groups are formed in.",
+                 clusterSize);
+    cmd.AddValue("mode", "The calls, on-network (\"on\") or off-network (\"off\").", mode);
+    cmd.AddValue("core", "The core network (\"csma\" or \"p2p\").", core);
+    cmd.AddValue("tracing", "Enable the MCPTT traces.", tracing);
+    cmd.AddValue("start-time",
+                 "The number of seconds into the simulation that the applications should start.",
+                 startSec);
+    cmd.AddValue("stop-time",
+                 "The number of seconds into the simulation that the applications should stop.",
+                 stopSec);
+    cmd.AddValue("output", "A CSV file to append the results to.", output);
+    cmd.Parse(argc, argv);
+
+    bool onNetwork = (mode == "on");
+    NS_ABORT_MSG_UNLESS(mode == "on" || mode == "off", "Unknown mode " << mode);
+    NS_ABORT_MSG_UNLESS(core == "csma" || core == "p2p", "Unknown core " << core);
+    NS_ABORT_MSG_IF(!onNetwork && core == "p2p", "Off-network calls need the csma core");
+    NS_ABORT_MSG_IF(groupSize == 0 || groupsPerUe == 0, "Empty groups");
+    NS_ABORT_MSG_IF(clusterSize % groupSize != 0 || ues % clusterSize != 0,
+                    "The cluster size must be a multiple of the group size, and the number of "
+                    "users a multiple of the cluster size");
+    uint32_t groupsPerLayer = clusterSize / groupSize;
+    // Otherwise, some layers would repeat the groups of another
+    NS_ABORT_MSG_IF(groupsPerUe > 1 && (groupsPerLayer == 1 || groupSize < groupsPerUe),
+                    "The groups of the layers would coincide; use a cluster size of at least "
+                    "two groups, and at least as many users per group as groups per user");
+    uint32_t clusters = ues / clusterSize;
+    uint32_t groups = clusters * groupsPerLayer * groupsPerUe;
+    // Call IDs and the ports of the on-network calls are 16-bit counters
+    NS_ABORT_MSG_IF(groups >= 65535, "Too many groups (" << groups << ")");
+    NS_ABORT_MSG_IF(onNetwork && static_cast<uint64_t>(ues) * groupsPerUe > 54000,
+                    "Too many on-network calls for the port numbers available");
+
+    Time start = Seconds(startSec);
+    Time stop = Seconds(stopSec);
+
+    SystemWallClockMs setupClock;
+    setupClock.Start();
+
+    NS_LOG_INFO("Building topology...");
+    NodeContainer server;
+    if (onNetwork)
+    {
+        server.Create(1);
+    }
+    NodeContainer users;
+    users.Create(ues);
+
+    InternetStackHelper stack;
+    stack.Install(server);
+    stack.Install(users);
+
+    Ipv4AddressHelper address("10.0.0.0", core == "csma" ? "255.255.255.0" : "255.255.255.252");
+    Ipv4StaticRoutingHelper staticRouting;
+    Ipv4Address serverAddress;
+    std::vector<Ipv4Address> userAddresses(ues);
+    if (core == "csma")
+    {
+        CsmaHelper csma;
+        csma.SetChannelAttribute("DataRate", StringValue("10Gbps"));
+        csma.SetChannelAttribute("Delay", TimeValue(MicroSeconds(1)));
+        for (uint32_t c = 0; c < clusters; c++)
+        {
+            NodeContainer lan;
+            for (uint32_t u = c * clusterSize; u < (c + 1) * clusterSize; u++)
+            {
+                lan.Add(users.Get(u));
+            }
+            if (onNetwork)
+            {
+                lan.Add(server.Get(0));
+            }
+            Ipv4InterfaceContainer interfaces = address.Assign(csma.Install(lan));
+            address.NewNetwork();
+            for (uint32_t i = 0; i < clusterSize; i++)
+            {
+                Ptr<Node> user = users.Get(c * clusterSize + i);
+                userAddresses[c * clusterSize + i] = interfaces.GetAddress(i);
+                if (onNetwork)
+                {
+                    // The server is the gateway to the users of the other clusters
+                    staticRouting.GetStaticRouting(user->GetObject<Ipv4>())
+                        ->SetDefaultRoute(interfaces.GetAddress(clusterSize), 1);
+                }
+            }
+            if (c == 0 && onNetwork)
+            {
+                serverAddress = interfaces.GetAddress(clusterSize);
+            }
+        }
+    }
+    else
+    {
+        PointToPointHelper p2p;
+        p2p.SetDeviceAttribute("DataRate", StringValue("10Gbps"));
+        p2p.SetChannelAttribute("Delay", StringValue("1ms"));
+        for (uint32_t u = 0; u < ues; u++)
+        {
+            Ipv4InterfaceContainer interfaces =
+                address.Assign(p2p.Install(server.Get(0), users.Get(u)));
+            address.NewNetwork();
+            userAddresses[u] = interfaces.GetAddress(1);
+            staticRouting.GetStaticRouting(users.Get(u)->GetObject<Ipv4>())
+                ->SetDefaultRoute(interfaces.GetAddress(0), 1);
+            if (u == 0)
+            {
+                serverAddress = interfaces.GetAddress(0);
+            }
+        }
+    }
+
+    NS_LOG_INFO("Creating applications...");
+    Ptr<McpttServerApp> serverApp;
+    if (onNetwork)
+    {
+        McpttServerHelper serverHelper;
+        serverApp = serverHelper.Install(server.Get(0));
+        serverApp->SetLocalAddress(serverAddress);
+        serverApp->SetStartTime(start);
+        serverApp->SetStopTime(stop);
+    }
+
+    McpttHelper clientHelper;
+    clientHelper.SetPttApp("ns3::psc::McpttPttApp", "PushOnStart", BooleanValue(false));
+    clientHelper.SetMediaSrc("ns3::psc::McpttMediaSrc",
+                             "Bytes",
+                             UintegerValue(60),
+                             "DataRate",
+                             DataRateValue(DataRate("24kb/s")));
+    clientHelper.SetPusher("ns3::psc::McpttPusher", "Automatic", BooleanValue(true));
+    clientHelper.SetPusherPttInterarrivalTimeVariable("ns3::NormalRandomVariable",
+                                                      "Mean",
+                                                      DoubleValue(5.0),
+                                                      "Variance",
+                                                      DoubleValue(2.0));
+    clientHelper.SetPusherPttDurationVariable("ns3::NormalRandomVariable",
+                                              "Mean",
+                                              DoubleValue(5.0),
+                                              "Variance",
+                                              DoubleValue(2.0));
+    ApplicationContainer clientApps = clientHelper.Install(users);
+    clientApps.Start(start);
+    clientApps.Stop(stop);
+    for (uint32_t u = 0; u < ues; u++)
+    {
+        DynamicCast<McpttPttApp>(clientApps.Get(u))->SetLocalAddress(userAddresses[u]);
+    }
+
+    NS_LOG_INFO("Configuring " << groups << " group calls...");
+    uint64_t rssBeforeCallsKb = ReadProcStatusKb("VmRSS:");
+
+    McpttCallHelper callHelper;
+    if (onNetwork)
+    {
+        callHelper.SetArbitrator("ns3::psc::McpttOnNetworkFloorArbitrator",
+                                 "AckRequired",
+                                 BooleanValue(false),
+                                 "AudioCutIn",
+                                 BooleanValue(false),
+                                 "DualFloorSupported",
+                                 BooleanValue(false),
+                                 "QueueingSupported",
+                                 BooleanValue(true));
+        callHelper.SetTowardsParticipant("ns3::psc::McpttOnNetworkFloorTowardsParticipant",
+                                         "ReceiveOnly",
+                                         BooleanValue(false));
+        callHelper.SetParticipant("ns3::psc::McpttOnNetworkFloorParticipant",
+                                  "AckRequired",
+                                  BooleanValue(false),
+                                  "GenMedia",
+                                  BooleanValue(true));
+        callHelper.SetServerCall("ns3::psc::McpttServerCall",
+                                 "AmbientListening",
+                                 BooleanValue(false),
+                                 "TemporaryGroup",
+                                 BooleanValue(false));
+    }
+
+    std::vector<ApplicationContainer> groupMembers;
+    groupMembers.reserve(groups);
+    for (uint32_t c = 0; c < clusters; c++)
+    {
+        for (uint32_t layer = 0; layer < groupsPerUe; layer++)
+        {
+            // Shift each layer by a distinct fraction of a group, so the
+            // groups of a user differ
+            uint32_t shift = layer * groupSize / groupsPerUe;
+            for (uint32_t g = 0; g < groupsPerLayer; g++)
+            {
+                ApplicationContainer members;
+                for (uint32_t i = 0; i < groupSize; i++)
+                {
+                    uint32_t member = (g * groupSize + i + shift) % clusterSize;
+                    members.Add(clientApps.Get(c * clusterSize + member));
+                }
+                groupMembers.push_back(members);
+            }
+        }
+    }
+    uint64_t calls = static_cast<uint64_t>(groupMembers.size()) * groupSize;
+    // Group IDs start at 1
+    if (onNetwork)
+    {
+        callHelper.AddCalls(groupMembers,
+                            serverApp,
+                            1,
+                            McpttCallMsgFieldCallType::BASIC_GROUP,
+                            start,
+                            stop);
+    }
+    else
+    {
+        for (uint32_t groupId = 1; groupId <= groupMembers.size(); groupId++)
+        {
+            callHelper.AddCallOffNetwork(groupMembers[groupId - 1],
+                                         groupId,
+                                         Ipv4Address("255.255.255.255"),
+                                         groupId,
+                                         McpttCallMsgFieldCallType::BASIC_GROUP,
+                                         start,
+                                         stop);
+        }
+    }
+
+    uint64_t rssAfterCallsKb = ReadProcStatusKb("VmRSS:");
+
+    Ptr<McpttTraceHelper> traceHelper;
+    if (tracing)
+    {
+        traceHelper = CreateObject<McpttTraceHelper>();
+        traceHelper->EnableMsgTraces();
+        traceHelper->EnableStateMachineTraces();
+        traceHelper->EnableAccessTimeTrace();
+        traceHelper->EnableMouthToEarLatencyTrace();
+    }
+
+    int64_t setupMs = setupClock.End();
+
+    NS_LOG_INFO("Starting simulation...");
+    SystemWallClockMs runClock;
+    runClock.Start();
+    Simulator::Stop(stop + Seconds(2));
+    Simulator::Run();
+    int64_t runMs = runClock.End();
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    double eventsPerSecond = events / std::max(runMs / 1000.0, 0.001);
+    uint64_t peakRssKb = ReadProcStatusKb("VmHWM:");
+    double callKb = 0;
+    if (calls && rssAfterCallsKb > rssBeforeCallsKb)
+    {
+        callKb = static_cast<double>(rssAfterCallsKb - rssBeforeCallsKb) / calls;
+    }
+
+    std::cout << "UEs:               " << ues << std::endl
+              << "Groups:            " << groups << " (" << groupsPerUe << " per UE, "
+              << groupSize << " UEs each)" << std::endl
+              << "Mode:              " << mode << "-network, " << core << " core, tracing "
+              << (tracing ? "on" : "off") << std::endl
+              << "Setup time:        " << setupMs / 1000.0 << " s" << std::endl
+              << "Run time:          " << runMs / 1000.0 << " s" << std::endl
+              << "Events:            " << events << std::endl
+              << "Events per second: " << eventsPerSecond << std::endl
+              << "Peak RSS:          " << peakRssKb << " kB" << std::endl
+              << "Memory per call:   " << callKb << " kB" << std::endl;
+    if (onNetwork)
+    {
+        std::cout << "Call provisioning: " << callHelper.GetProvisioningTime() / 1000.0 << " s"
+                  << std::endl;
+    }
+
+    if (!output.empty())
+    {
+        bool header = !std::ifstream(output).good();
+        std::ofstream out(output, std::ios::app);
+        if (header)
+        {
+            out << "ues,groups_per_ue,group_size,mode,core,tracing,setup_s,run_s,events,"
+                   "events_per_s,peak_rss_kb,call_kb"
+                << std::endl;
+        }
+        out << ues << "," << groupsPerUe << "," << groupSize << "," << mode << "," << core
+            << "," << tracing << "," << setupMs / 1000.0 << "," << runMs / 1000.0 << ","
+            << events << "," << eventsPerSecond << "," << peakRssKb << "," << callKb
+            << std::endl;
+    }
+
+    return 0;
+}
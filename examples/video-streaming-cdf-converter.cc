@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/psc-module.h"
+
+using namespace ns3;
+using namespace psc;
+
+/**
+ * This program converts CDF files for the video streaming model from the
+ * text format (the first line with the fixed probability step, and the
+ * following lines with the values for each probability) into the compact
+ * binary format, which PscVideoStreaming loads by mapping the file into memory
+ * instead of parsing it. The format of the files is detected automatically
+ * by PscVideoStreaming::ReadCustomDistribution, so the binary files can be
+ * used in place of the text ones.
+ *
+ * With the 'frameTrace' parameter, the program converts instead a frame trace
+ * in text format (a line for each frame with its timestamp, in seconds, and
+ * its size, in bytes) into the binary format that PscVideoStreaming replays
+ * through the FrameTrace attribute.
+ *
+ * There are three parameters:
+ * - input: path to the CDF file in text format
+ * - output: path to the CDF file to write in binary format (default: input
+ *   with the '.bin' extension appended)
+ * - frameTrace: whether the input is a frame trace instead of a CDF (default: false)
+ *
+ * For example:
+ *
+ * ./ns3 run "video-streaming-cdf-converter
+ *     --input=contrib/psc/examples/video_cdf/CdfVideoStreaming-h264-1280x720-30-25-true_packetsize.txt_90_90"
+ */
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+    bool frameTrace = false;
+
+    CommandLine cmd;
+    cmd.AddValue("input", "Path to the CDF file in text format", input);
+    cmd.AddValue("output", "Path to the CDF file to write in binary format", output);
+    cmd.AddValue("frameTrace", "Whether the input is a frame trace instead of a CDF", frameTrace);
+    cmd.Parse(argc, argv);
+
+    if (input.empty())
+    {
+        std::cerr << "Error, the path to the input file must be provided with '--input'."
+                  << std::endl;
+        return -1;
+    }
+
+    if (output.empty())
+    {
+        output = input + ".bin";
+    }
+
+    if (frameTrace ? PscVideoFrameTrace::IsBinaryFile(input)
+                   : PscVideoStreamingDistributions::IsBinaryFile(input))
+    {
+        std::cerr << "Error, file '" << input << "' is already in binary format." << std::endl;
+        return -1;
+    }
+
+    if (frameTrace)
+    {
+        PscVideoFrameTrace::ConvertFromText(input, output);
+    }
+    else
+    {
+        PscVideoStreamingDistributions::ConvertToBinary(input, output);
+    }
+
+    std::cout << "Converted '" << input << "' into '" << output << "'" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+# NIST-developed software is provided by NIST as a public service. You may use,
+# copy and distribute copies of the software in any medium, provided that you
+# keep intact this entire notice. You may improve,modify and create derivative
+# works of the software or any portion of the software, and you may copy and
+# distribute such modifications or works. Modified works should carry a notice
+# stating that you changed the software and should note the date and nature of
+# any such change. Please explicitly acknowledge the National Institute of
+# Standards and Technology as the source of the software.
+#
+# NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+# WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+# LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+# AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+# OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+# ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+# REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+# INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+# OR USEFULNESS OF THE SOFTWARE.
+#
+# You are solely responsible for determining the appropriateness of using and
+# distributing the software and you assume all risks associated with its use,
+# including but not limited to the risks and costs of program errors,
+# compliance with applicable laws, damage to or loss of data, programs or
+# equipment, and the unavailability or interruption of operation. This
+# software is not intended to be used in any situation where a failure could
+# cause risk of injury or damage to property. The software developed by NIST
+# employees is not subject to copyright protection within the United States.
+
+"""
+Converts a pair of video streaming CDF files (packet size and packet interval)
+into the built-in form used by psc-video-streaming-distributions.cc.
+
+The CDF files have the format read by PscVideoStreaming::ReadCustomDistribution:
+the first line contains the fixed probability step, and the following lines the
+values for each probability in ascending order, from 0 to 1. The built-in form
+only stores the values, as constexpr arrays, since the probability of the i-th
+value of an array of N values is implied by the fixed step: i / (N - 1).
+
+The script prints the two arrays and the entry to add to BUILT_IN_DISTRIBUTIONS.
+For example, to convert the 720p 30 fps profile from this directory:
+
+    python3 generate-builtin-distribution.py 720p-30fps \\
+        CdfVideoStreaming-h264-1280x720-30-25-true_packetsize.txt_90_90 \\
+        CdfVideoStreaming-h264-1280x720-30-25-true_packetinterval.txt_90_90
+"""
+
+import argparse
+import os
+import re
+import sys
+
+LINE_WIDTH = 100
+INDENT = "    "
+
+
+def read_cdf(path):
+    """Reads a CDF file and returns the probability step and the value tokens."""
+    with open(path) as f:
+        tokens = f.read().split()
+    if len(tokens) < 2:
+        sys.exit("File %s does not contain a CDF" % path)
+    step = float(tokens[0])
+    values = tokens[1:]
+    intervals = round(1 / step)
+    if abs(intervals * step - 1) > 1e-9:
+        sys.exit("Step %s of file %s does not divide [0, 1] evenly" % (tokens[0], path))
+    if len(values) != intervals + 1:
+        sys.exit(
+            "File %s has %d values, but step %s requires %d"
+            % (path, len(values), tokens[0], intervals + 1)
+        )
+    numbers = [float(v) for v in values]
+    if any(b < a for a, b in zip(numbers, numbers[1:])):
+        sys.exit("Values of file %s are not sorted" % path)
+    return step, values
+
+
+def array_name(prefix, name):
+    """Builds the C++ array name for a distribution name (e.g., SIZE_720P_DARK)."""
+    return prefix + "_" + re.sub(r"[^A-Za-z0-9]+", "_", name).upper()
+
+
+def format_array(ctype, cname, values, comment):
+    """Formats a constexpr C++ array, packing as many values per line as fit."""
+    lines = ["/// " + comment, "constexpr %s %s[] = {" % (ctype, cname)]
+    line = INDENT
+    for i, value in enumerate(values):
+        token = value + ("," if i < len(values) - 1 else "};")
+        if len(line) + len(token) + 1 > LINE_WIDTH:
+            lines.append(line.rstrip())
+            line = INDENT
+        line += token + " "
+    lines.append(line.rstrip())
+    return "\n".join(lines)
+
+
+def format_distribution(name, sizes, intervals):
+    """Formats the arrays and the BUILT_IN_DISTRIBUTIONS entry for a distribution."""
+    size_name = array_name("SIZE", name)
+    interval_name = array_name("INTERVAL", name)
+    arrays = "\n\n".join(
+        [
+            format_array("uint32_t", size_name, sizes, "Packet sizes of " + name),
+            format_array("double", interval_name, intervals, "Packet intervals (ms) of " + name),
+        ]
+    )
+    entry = '%sMakeBuiltIn("%s", %s, %s),' % (INDENT, name, size_name, interval_name)
+    return arrays, entry
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("name", help="Name of the distribution (e.g., 720p-30fps)")
+    parser.add_argument("size_file", help="Path to the packet size CDF file")
+    parser.add_argument("interval_file", help="Path to the packet interval CDF file")
+    args = parser.parse_args()
+
+    _, sizes = read_cdf(args.size_file)
+    _, intervals = read_cdf(args.interval_file)
+    for value in sizes:
+        if not value.isdigit():
+            sys.exit("Packet size %s is not an unsigned integer" % value)
+
+    arrays, entry = format_distribution(args.name, sizes, intervals)
+    print("// Generated from %s" % os.path.basename(args.size_file))
+    print("// and %s" % os.path.basename(args.interval_file))
+    print(arrays)
+    print()
+    print("// Entry for BUILT_IN_DISTRIBUTIONS")
+    print(entry)
+
+
+if __name__ == "__main__":
+    main()
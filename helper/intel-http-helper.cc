@@ -33,6 +33,7 @@
 
 #include <ns3/log.h>
 #include <ns3/names.h>
+#include <ns3/uinteger.h>
 
 namespace ns3
 {
@@ -97,6 +98,55 @@ IntelHttpClientHelper::DoInstall(Ptr<Node> node) const
     return app;
 }
 
+// -- IntelHttpPopulationClientHelper --
+
+IntelHttpPopulationClientHelper::IntelHttpPopulationClientHelper(const Address& remoteAddress,
+                                                                 uint32_t clients)
+{
+    NS_LOG_FUNCTION(this << remoteAddress << clients);
+    m_factory.SetTypeId("ns3::psc::IntelHttpPopulationClient");
+    m_factory.Set("RemoteAddress", AddressValue(remoteAddress));
+    m_factory.Set("Clients", UintegerValue(clients));
+}
+
+void
+IntelHttpPopulationClientHelper::Set(const std::string& name, const AttributeValue& value)
+{
+    NS_LOG_FUNCTION(this);
+    m_factory.Set(name, value);
+}
+
+ApplicationContainer
+IntelHttpPopulationClientHelper::Install(Ptr<Node> node) const
+{
+    NS_LOG_FUNCTION(this << node);
+    return ApplicationContainer(DoInstall(node));
+}
+
+ApplicationContainer
+IntelHttpPopulationClientHelper::Install(NodeContainer& nodes) const
+{
+    NS_LOG_FUNCTION(this);
+    ApplicationContainer applications;
+    for (auto node = nodes.Begin(); node != nodes.End(); node++)
+    {
+        applications.Add(DoInstall(*node));
+    }
+
+    return applications;
+}
+
+Ptr<Application>
+IntelHttpPopulationClientHelper::DoInstall(Ptr<Node> node) const
+{
+    NS_LOG_FUNCTION(this << node);
+    NS_ABORT_MSG_IF(node == nullptr, "Cannot install on a NULL node");
+
+    auto app = m_factory.Create<Application>();
+    node->AddApplication(app);
+    return app;
+}
+
 // -- IntelHttpServerHelper --
 
 IntelHttpServerHelper::IntelHttpServerHelper()
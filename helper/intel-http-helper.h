@@ -35,6 +35,7 @@
 #include <ns3/address.h>
 #include <ns3/application-container.h>
 #include <ns3/intel-http-client.h>
+#include <ns3/intel-http-population-client.h>
 #include <ns3/node-container.h>
 #include <ns3/object-factory.h>
 
@@ -125,6 +126,78 @@ class IntelHttpClientHelper
     Ptr<Application> DoInstall(Ptr<Node> node) const;
 };
 
+// -- IntelHttpPopulationClientHelper --
+
+/**
+ * \ingroup psc
+ * \brief Creates IntelHttpPopulationClients
+ */
+class IntelHttpPopulationClientHelper
+{
+  public:
+    /**
+     * Create a new helper used to configure, create, & install
+     * one to many IntelHttpPopulationClient applications
+     *
+     * \param remoteAddress
+     * The address of the node bearing the IntelHttpServer
+     * that we wish to communicate with
+     * \param clients
+     * The number of clients emulated by each application
+     */
+    IntelHttpPopulationClientHelper(const Address& remoteAddress, uint32_t clients);
+
+    /**
+     * Sets one of the attributes of underlying IntelHttpPopulationClient
+     *
+     * \param name
+     * Name of attribute to set.
+     * \param value
+     * Value of the attribute.
+     */
+    void Set(const std::string& name, const AttributeValue& value);
+
+    /**
+     * \brief Install the configured IntelHttpPopulationClient on a node
+     *
+     * Installs and adds the configured application to a single node
+     *
+     * \param node
+     * Pointer to the node to install the application on.
+     * \return ApplicationContainer
+     * A container with the newly added application
+     */
+    ApplicationContainer Install(Ptr<Node> node) const;
+
+    /**
+     * \brief Install the configured application on many nodes
+     *
+     * Installs & adds the configured application to many nodes.
+     *
+     * \param nodes
+     * The collection of nodes to add the model to
+     *
+     * \return ApplicationContainer
+     * A container with the new applications.
+     * In order in which they were installed
+     */
+    ApplicationContainer Install(NodeContainer& nodes) const;
+
+  private:
+    ObjectFactory m_factory; //!< object factory for creating the application model
+
+    /**
+     * \brief Creates an application, installs and adds that application on the passed node
+     *
+     * \param node
+     * The node to install the new application on.
+     *
+     * \return Ptr<Application>
+     * A pointer ot the newly created model
+     */
+    Ptr<Application> DoInstall(Ptr<Node> node) const;
+};
+
 // -- IntelHttpServerHelper --
 
 /**
@@ -23,7 +23,6 @@
 #include "ns3/log.h"
 #include "ns3/mcptt-call-msg-field.h"
 #include "ns3/mcptt-call.h"
-#include "ns3/mcptt-channel.h"
 #include "ns3/mcptt-on-network-call-machine-client.h"
 #include "ns3/mcptt-on-network-floor-arbitrator.h"
 #include "ns3/mcptt-on-network-floor-participant.h"
@@ -35,6 +34,7 @@
 #include "ns3/mcptt-server-call.h"
 #include "ns3/nstime.h"
 #include "ns3/object-factory.h"
+#include "ns3/system-wall-clock-ms.h"
 
 namespace ns3
 {
@@ -45,6 +45,7 @@ namespace psc
 {
 
 McpttCallHelper::McpttCallHelper()
+    : m_provisioningTime(0)
 {
     m_arbitratorFactory.SetTypeId(McpttOnNetworkFloorArbitrator::GetTypeId());
     m_towardsParticipantFactory.SetTypeId(McpttOnNetworkFloorTowardsParticipant::GetTypeId());
@@ -195,41 +196,93 @@ McpttCallHelper::AddCall(ApplicationContainer clients,
     NS_LOG_FUNCTION(this << clients.GetN() << server->GetNode()->GetId() << groupId
                          << +callType.GetType() << startTime.GetSeconds() << stopTime.GetSeconds());
     // callType not presently used
+    SystemWallClockMs clock;
+    clock.Start();
+    uint16_t callId = ProvisionOnNetworkCall(clients, server, groupId, startTime, stopTime);
+    m_provisioningTime += clock.End();
+    return callId;
+}
+
+std::vector<uint16_t>
+McpttCallHelper::AddCalls(const std::vector<ApplicationContainer>& groups,
+                          Ptr<McpttServerApp> server,
+                          uint32_t baseGroupId,
+                          McpttCallMsgFieldCallType callType,
+                          Time startTime,
+                          Time stopTime)
+{
+    NS_LOG_FUNCTION(this << groups.size() << server->GetNode()->GetId() << baseGroupId
+                         << +callType.GetType() << startTime.GetSeconds() << stopTime.GetSeconds());
+    // callType not presently used
+    SystemWallClockMs clock;
+    clock.Start();
+    std::vector<uint16_t> callIds;
+    callIds.reserve(groups.size());
+    uint32_t groupId = baseGroupId;
+    for (const auto& clients : groups)
+    {
+        callIds.push_back(ProvisionOnNetworkCall(clients, server, groupId++, startTime, stopTime));
+    }
+    int64_t elapsed = clock.End();
+    m_provisioningTime += elapsed;
+    NS_LOG_INFO("Configured " << callIds.size() << " calls in " << elapsed << " ms");
+    return callIds;
+}
+
+int64_t
+McpttCallHelper::GetProvisioningTime() const
+{
+    return m_provisioningTime;
+}
+
+uint16_t
+McpttCallHelper::ProvisionOnNetworkCall(const ApplicationContainer& clients,
+                                        Ptr<McpttServerApp> server,
+                                        uint32_t groupId,
+                                        Time startTime,
+                                        Time stopTime)
+{
+    NS_LOG_FUNCTION(this << clients.GetN() << groupId);
+
     uint16_t callId = server->AllocateCallId();
     Ptr<McpttOnNetworkFloorArbitrator> arbitrator =
         m_arbitratorFactory.Create<McpttOnNetworkFloorArbitrator>();
     NS_LOG_DEBUG("Creating call with callID " << callId);
+    const uint32_t clientCount = clients.GetN();
+    arbitrator->ReserveParticipants(clientCount);
     std::vector<uint32_t> clientUserIds;
+    clientUserIds.reserve(clientCount);
+    // The values shared by the objects of every client are resolved once, and
+    // the per-client objects are then configured through their typed setters
+    const Address serverAddress = server->GetLocalAddress();
 
-    for (uint32_t i = 0; i < clients.GetN(); i++)
+    for (uint32_t i = 0; i < clientCount; i++)
     {
-        Ptr<McpttPttApp> app = clients.Get(i)->GetObject<McpttPttApp>();
+        Ptr<McpttPttApp> app = DynamicCast<McpttPttApp>(clients.Get(i));
+        NS_ABORT_MSG_UNLESS(app, "Application " << i << " is not a McpttPttApp");
         clientUserIds.push_back(app->GetUserId());
         // McpttPttApp uses a static integer for allocating unique port numbers
         uint16_t floorPort = McpttPttApp::AllocateNextFloorPortNumber();
         uint16_t mediaPort = McpttPttApp::AllocateNextMediaPortNumber();
         NS_LOG_DEBUG("Port from " << app->GetNode()->GetId() << " to server:  floor " << floorPort
                                   << " media " << mediaPort);
-        // Each application gets its own instance of a McpttCall object
-        Ptr<McpttCall> call = CreateObject<McpttCall>(McpttCall::NetworkCallType::ON_NETWORK);
-        call->SetAttribute("PeerAddress", AddressValue(server->GetLocalAddress()));
-        call->SetStartTime(startTime);
-        call->SetStopTime(stopTime);
         // XXX TODO: configure call machine type from call type
-        Ptr<McpttCallMachine> callMachine =
-            CreateObjectWithAttributes<McpttOnNetworkCallMachineClient>("GroupId",
-                                                                        UintegerValue(groupId));
-        call->SetCallMachine(callMachine);
-        call->SetCallId(callId);
-        Ptr<McpttChannel> floorChannel = CreateObject<McpttChannel>();
-        call->SetFloorChannel(floorChannel);
-        call->GetCallMachine()->SetAttribute("FloorPort", UintegerValue(floorPort));
-        Ptr<McpttChannel> mediaChannel = CreateObject<McpttChannel>();
-        call->SetMediaChannel(mediaChannel);
-        call->GetCallMachine()->SetAttribute("MediaPort", UintegerValue(mediaPort));
+        Ptr<McpttOnNetworkCallMachineClient> callMachine =
+            CreateObject<McpttOnNetworkCallMachineClient>();
+        callMachine->SetGrpId(groupId);
+        callMachine->SetFloorPort(floorPort);
+        callMachine->SetMediaPort(mediaPort);
         Ptr<McpttOnNetworkFloorParticipant> clientFloorControl =
             m_participantFactory.Create<McpttOnNetworkFloorParticipant>();
-        call->SetFloorMachine(clientFloorControl);
+        // Each application gets its own instance of a McpttCall object,
+        // possibly one of its released calls
+        Ptr<McpttCall> call = app->AllocateCall(McpttCall::NetworkCallType::ON_NETWORK,
+                                                callMachine,
+                                                clientFloorControl);
+        call->SetPeerAddress(serverAddress);
+        call->SetStartTime(startTime);
+        call->SetStopTime(stopTime);
+        call->SetCallId(callId);
         call->SetPushOnSelect(true);
         app->AddCall(call);
 
@@ -294,19 +347,15 @@ McpttCallHelper::AddCallOffNetwork(ApplicationContainer clients,
     {
         Ptr<McpttPttApp> pttApp = DynamicCast<McpttPttApp>(clients.Get(idx));
 
-        Ptr<McpttCall> call = CreateObject<McpttCall>(McpttCall::NetworkCallType::OFF_NETWORK);
-        Ptr<McpttChannel> floorChannel = CreateObject<McpttChannel>();
-        Ptr<McpttChannel> mediaChannel = CreateObject<McpttChannel>();
         Ptr<McpttCallMachine> callMachine = callFac.Create<McpttCallMachine>();
         Ptr<McpttFloorParticipant> floorMachine = floorFac.Create<McpttFloorParticipant>();
 
         callMachine->SetAttribute("GroupId", UintegerValue(groupId));
 
+        Ptr<McpttCall> call = pttApp->AllocateCall(McpttCall::NetworkCallType::OFF_NETWORK,
+                                                   callMachine,
+                                                   floorMachine);
         call->SetAttribute("PeerAddress", AddressValue(peerAddress));
-        call->SetCallMachine(callMachine);
-        call->SetFloorChannel(floorChannel);
-        call->SetFloorMachine(floorMachine);
-        call->SetMediaChannel(mediaChannel);
         call->SetCallId(callId);
         call->SetStartTime(startTime);
         call->SetStopTime(stopTime);
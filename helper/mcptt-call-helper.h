@@ -25,6 +25,7 @@
 #include "ns3/ptr.h"
 
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -71,6 +72,33 @@ class McpttCallHelper
                      McpttCallMsgFieldCallType callType,
                      Time startTime,
                      Time stopTime);
+    /**
+     * Configure one call per group for sets of on-network clients and a
+     * server, as AddCall does for each group, with the group IDs allocated
+     * from baseGroupId. Meant for large calls and many groups: the values
+     * common to every client of a call are resolved once, and each client
+     * gets its own copy of the client call objects through typed setters,
+     * rather than through attribute lookups by name.
+     * \param groups container of client applications of each group
+     * \param server pointer to the server application
+     * \param baseGroupId the group ID of the first group
+     * \param callType type of call to configure
+     * \param startTime start time of the calls
+     * \param stopTime stop time of the calls
+     * \return the call IDs of the calls, in the order of the groups
+     */
+    std::vector<uint16_t> AddCalls(const std::vector<ApplicationContainer>& groups,
+                                   Ptr<McpttServerApp> server,
+                                   uint32_t baseGroupId,
+                                   McpttCallMsgFieldCallType callType,
+                                   Time startTime,
+                                   Time stopTime);
+    /**
+     * Gets the wall-clock time spent configuring on-network calls (with
+     * AddCall and AddCalls) by this helper so far.
+     * \return the wall-clock time, in milliseconds
+     */
+    int64_t GetProvisioningTime() const;
     /**
      * Configure a call for a set of off-network clients.
      * \param clients container of client applications
@@ -249,10 +277,26 @@ class McpttCallHelper
                                const AttributeValue& v7 = EmptyAttributeValue());
 
   private:
+    /**
+     * Configures an on-network call for a set of clients and a server.
+     * \param clients container of client applications
+     * \param server pointer to the server application
+     * \param groupId GroupId to assign
+     * \param startTime start time of the call
+     * \param stopTime stop time of the call
+     * \return the call ID of the call
+     */
+    uint16_t ProvisionOnNetworkCall(const ApplicationContainer& clients,
+                                    Ptr<McpttServerApp> server,
+                                    uint32_t groupId,
+                                    Time startTime,
+                                    Time stopTime);
+
     ObjectFactory m_arbitratorFactory;         //!< The floor arbitrator factory
     ObjectFactory m_towardsParticipantFactory; //!< The towards participant factory
     ObjectFactory m_participantFactory;        //!< The participant factory
     ObjectFactory m_serverCallFactory;         //!< The server call factory
+    int64_t m_provisioningTime;                //!< Wall-clock time configuring calls (ms)
 };
 
 } // namespace psc
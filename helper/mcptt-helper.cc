@@ -44,6 +44,7 @@
 #include <ns3/names.h>
 #include <ns3/pointer.h>
 #include <ns3/ptr.h>
+#include <ns3/simulator.h>
 #include <ns3/string.h>
 
 #include <stdint.h>
@@ -144,7 +145,13 @@ McpttHelper::AddPushersToOrchestrator(Ptr<McpttPusherOrchestratorInterface> orch
 {
     for (uint32_t i = 0; i < apps.GetN(); i++)
     {
-        orchestrator->AddPusher(apps.Get(i)->GetObject<McpttPttApp>()->GetPusher());
+        Ptr<McpttPttApp> app = apps.Get(i)->GetObject<McpttPttApp>();
+        // The orchestrators react to the floor outcomes of their pushers,
+        // which are only known by the rank that simulates the pusher's node
+        NS_ABORT_MSG_UNLESS(app->IsLocal(),
+                            "Pusher orchestrators cannot span the ranks of a distributed "
+                            "simulation");
+        orchestrator->AddPusher(app->GetPusher());
     }
 }
 
@@ -361,7 +368,19 @@ McpttHelper::InstallPriv(const Ptr<Node>& node)
     app->SetMediaSrc(requester);
     app->SetPusher(pusher);
 
-    node->AddApplication(app);
+    if (node->GetSystemId() == Simulator::GetSystemId())
+    {
+        node->AddApplication(app);
+    }
+    else
+    {
+        // In a distributed simulation, every rank creates the applications
+        // of all the nodes, so that the user IDs, ports and call IDs
+        // allocated while configuring the scenario are the same on every
+        // rank. The application of a node simulated by another rank is only
+        // bound to its node, and is never started.
+        app->SetNode(node);
+    }
 
     return app;
 }
@@ -91,6 +91,13 @@ class McpttHelper
     /**
      * \brief Install an ns3::psc::McpttPttApp on each node of the input container.
      *
+     * In a distributed (MPI) simulation, an application is created for every
+     * node, but only the ones of the nodes simulated by this rank are added
+     * to their node. The others mirror the applications of the other ranks,
+     * so that the user IDs, ports and call IDs allocated by the helpers are
+     * the same on every rank; they are never started. The scenario must thus
+     * be configured identically on every rank.
+     *
      * \param c NodeContainer of the set of nodes on which an McpttPttApp
      * will be installed.
      * \returns Container of Ptr to the applications installed.
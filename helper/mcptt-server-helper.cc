@@ -39,6 +39,8 @@
 #include <ns3/mcptt-ptt-app.h>
 #include <ns3/mcptt-server-app.h>
 #include <ns3/names.h>
+#include <ns3/node.h>
+#include <ns3/simulator.h>
 
 #include <string>
 
@@ -102,7 +104,15 @@ Ptr<McpttServerApp>
 McpttServerHelper::InstallPriv(Ptr<Node> node)
 {
     Ptr<McpttServerApp> app = m_serverFactory.Create<McpttServerApp>();
-    node->AddApplication(app);
+    if (node->GetSystemId() == Simulator::GetSystemId())
+    {
+        node->AddApplication(app);
+    }
+    else
+    {
+        // Mirror of a server simulated by another rank (see McpttHelper)
+        app->SetNode(node);
+    }
     return app;
 }
 
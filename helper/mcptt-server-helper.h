@@ -66,6 +66,10 @@ class McpttServerHelper
     /**
      * \brief Install an ns3::psc::McpttServerApp on the node.
      *
+     * In a distributed (MPI) simulation, the application is only added to the
+     * node if this rank simulates it; otherwise it is a mirror that is
+     * never started (see McpttHelper::Install).
+     *
      * \param node The node on which an McpttServerApp will be installed.
      * \returns Ptr to the McpttServerApp app
      */
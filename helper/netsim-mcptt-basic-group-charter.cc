@@ -39,7 +39,12 @@
 
 #include "netsim-mcptt-basic-group-charter.h"
 
+#include <ns3/abort.h>
 #include <ns3/boolean.h>
+#include <ns3/simulator.h>
+
+#include <algorithm>
+#include <cmath>
 
 namespace ns3
 {
@@ -68,10 +73,32 @@ NetSimMcpttPttBasicGroupCharter::SetUp(Ptr<netsimulyzer::Orchestrator> orchestra
 
     m_orchestrator = orchestrator;
     LinkTraces();
+    Simulator::ScheduleDestroy(&NetSimMcpttPttBasicGroupCharter::FlushCharts, this);
     m_isSetUp = true;
     return 1;
 }
 
+void
+NetSimMcpttPttBasicGroupCharter::SetTimelineBucket(Time bucket)
+{
+    NS_ABORT_MSG_IF(bucket.IsStrictlyNegative(), "The timeline bucket cannot be negative");
+    NS_ABORT_MSG_IF(!m_allGrpIds.empty(), "The timeline bucket must be set before adding groups");
+    m_timelineBucket = bucket;
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::SetEcdfRelativeAccuracy(double relativeAccuracy,
+                                                         uint32_t maxPoints)
+{
+    NS_ABORT_MSG_IF(relativeAccuracy < 0 || relativeAccuracy >= 1,
+                    "The relative accuracy must be in [0, 1)");
+    NS_ABORT_MSG_IF(maxPoints == 0, "The sketches need at least one point");
+    NS_ABORT_MSG_IF(!m_allGrpIds.empty(),
+                    "The relative accuracy must be set before adding groups");
+    m_ecdfRelativeAccuracy = relativeAccuracy;
+    m_ecdfMaxPoints = maxPoints;
+}
+
 void
 NetSimMcpttPttBasicGroupCharter::SetUpGraphCollections()
 {
@@ -162,60 +189,20 @@ NetSimMcpttPttBasicGroupCharter::AddGroup(ApplicationContainer pttApps,
         m_areGraphsSetUp = true;
     }
 
-    // ECDFs for Access time
-    auto groupAccessTimeEcdf =
-        CreateObject<netsimulyzer::EcdfSink>(m_orchestrator,
-                                             "Access time - eCDF - " + std::to_string(grpId));
-    groupAccessTimeEcdf->GetXAxis()->SetAttribute("Name", StringValue("Access time (ms)"));
-    groupAccessTimeEcdf->GetYAxis()->SetAttribute("Name", StringValue("Emperical CDF"));
-    groupAccessTimeEcdf->GetSeries()->SetAttribute("Color", nextColor);
-    // groupAccessTimeEcdf->SetConnectionType(netsimulyzer::XYSeries::ConnectionType::None);
-    groupAccessTimeEcdf->GetSeries()->SetAttribute("Visible", BooleanValue(false));
-    m_accessTimeEcdfCollection->Add(groupAccessTimeEcdf->GetSeries());
-
-    // ECDFs for M2E latency
-    auto groupM2eLatencyEcdfs =
-        CreateObject<netsimulyzer::EcdfSink>(m_orchestrator,
-                                             "M2E latency - eCDF - " + std::to_string(grpId));
-    groupM2eLatencyEcdfs->GetXAxis()->SetAttribute("Name", StringValue("M2E latency (ms)"));
-    groupM2eLatencyEcdfs->GetYAxis()->SetAttribute("Name", StringValue("Emperical CDF"));
-    groupM2eLatencyEcdfs->GetSeries()->SetAttribute("Color", nextColor);
-    // groupM2eLatencyEcdfs->SetConnectionType(netsimulyzer::XYSeries::ConnectionType::None);
-    groupM2eLatencyEcdfs->GetSeries()->SetAttribute("Visible", BooleanValue(false));
-    m_m2eLatencyEcdfCollection->Add(groupM2eLatencyEcdfs->GetSeries());
-
-    // Timeline for Access time
-    auto groupAccessTimeTimeline = CreateObject<netsimulyzer::XYSeries>(m_orchestrator);
-    groupAccessTimeTimeline->SetAttribute(
-        "Name",
-        StringValue("Access time - Timeline - " + std::to_string(grpId)));
-    groupAccessTimeTimeline->SetAttribute("Color", nextColor);
-    groupAccessTimeTimeline->SetAttribute("Connection", StringValue("None"));
-    groupAccessTimeTimeline->GetXAxis()->SetAttribute("Name", StringValue("Time (s)"));
-    groupAccessTimeTimeline->GetYAxis()->SetAttribute("Name", StringValue("Access time (ms)"));
-    groupAccessTimeTimeline->SetAttribute("Visible", BooleanValue(false));
-    m_accessTimeTimelineCollection->Add(groupAccessTimeTimeline);
-
-    // Timeline for M2E latency
-    auto groupM2eLatencyTimeline = CreateObject<netsimulyzer::XYSeries>(m_orchestrator);
-    groupM2eLatencyTimeline->SetAttribute(
-        "Name",
-        StringValue("M2E latency - Timeline - " + std::to_string(grpId)));
-    groupM2eLatencyTimeline->SetAttribute("Color", nextColor);
-    groupM2eLatencyTimeline->SetAttribute("Connection", StringValue("None"));
-    groupM2eLatencyTimeline->GetXAxis()->SetAttribute("Name", StringValue("Time (s)"));
-    groupM2eLatencyTimeline->GetYAxis()->SetAttribute("Name", StringValue("M2E latency (ms)"));
-    groupM2eLatencyTimeline->SetAttribute("Visible", BooleanValue(false));
-    m_m2eLatencyTimelineCollection->Add(groupM2eLatencyTimeline);
-
-    m_grpIdToAccessTimeTimelineSeries.insert(
-        std::pair<uint32_t, Ptr<netsimulyzer::XYSeries>>(grpId, groupAccessTimeTimeline));
-    m_grpIdToAccessTimeEcdf.insert(
-        std::pair<uint32_t, Ptr<netsimulyzer::EcdfSink>>(grpId, groupAccessTimeEcdf));
-    m_grpIdToM2eLatencyTimelineSeries.insert(
-        std::pair<uint32_t, Ptr<netsimulyzer::XYSeries>>(grpId, groupM2eLatencyTimeline));
-    m_grpIdToM2eLatencyEcdf.insert(
-        std::pair<uint32_t, Ptr<netsimulyzer::EcdfSink>>(grpId, groupM2eLatencyEcdfs));
+    SetUpMetricChart(grpId,
+                     "Access time",
+                     "Access time (ms)",
+                     nextColor,
+                     m_accessTimeEcdfCollection,
+                     m_accessTimeTimelineCollection,
+                     m_grpIdToAccessTimeChart[grpId]);
+    SetUpMetricChart(grpId,
+                     "M2E latency",
+                     "M2E latency (ms)",
+                     nextColor,
+                     m_m2eLatencyEcdfCollection,
+                     m_m2eLatencyTimelineCollection,
+                     m_grpIdToM2eLatencyChart[grpId]);
 
     for (uint32_t i = 0; i < pttApps.GetN(); i++)
     {
@@ -233,6 +220,179 @@ NetSimMcpttPttBasicGroupCharter::AddGroup(ApplicationContainer pttApps,
     return 0;
 }
 
+void
+NetSimMcpttPttBasicGroupCharter::SetUpMetricChart(
+    uint32_t grpId,
+    const std::string& metric,
+    const std::string& unit,
+    netsimulyzer::Color3Value color,
+    Ptr<netsimulyzer::SeriesCollection> ecdfCollection,
+    Ptr<netsimulyzer::SeriesCollection> timelineCollection,
+    MetricChart& chart)
+{
+    // ECDF
+    if (m_ecdfRelativeAccuracy > 0)
+    {
+        // Written from the bins of the sketch, so it holds one point per bin
+        chart.ecdfSeries = CreateObject<netsimulyzer::XYSeries>(m_orchestrator);
+        chart.ecdfSeries->SetAttribute("Name",
+                                       StringValue(metric + " - eCDF - " + std::to_string(grpId)));
+        chart.ecdfSeries->GetXAxis()->SetAttribute("Name", StringValue(unit));
+        chart.ecdfSeries->GetYAxis()->SetAttribute("Name", StringValue("Emperical CDF"));
+        chart.ecdfSeries->SetAttribute("Color", color);
+        chart.ecdfSeries->SetAttribute("Visible", BooleanValue(false));
+        ecdfCollection->Add(chart.ecdfSeries);
+
+        chart.ecdfSketch = QuantileSketch(m_ecdfRelativeAccuracy, m_ecdfMaxPoints);
+        chart.bucketSketch = QuantileSketch(m_ecdfRelativeAccuracy, m_ecdfMaxPoints);
+    }
+    else
+    {
+        chart.ecdf =
+            CreateObject<netsimulyzer::EcdfSink>(m_orchestrator,
+                                                 metric + " - eCDF - " + std::to_string(grpId));
+        chart.ecdf->GetXAxis()->SetAttribute("Name", StringValue(unit));
+        chart.ecdf->GetYAxis()->SetAttribute("Name", StringValue("Emperical CDF"));
+        chart.ecdf->GetSeries()->SetAttribute("Color", color);
+        chart.ecdf->GetSeries()->SetAttribute("Visible", BooleanValue(false));
+        ecdfCollection->Add(chart.ecdf->GetSeries());
+    }
+
+    // Timeline(s)
+    auto createTimeline = [&](const std::string& name) {
+        auto timeline = CreateObject<netsimulyzer::XYSeries>(m_orchestrator);
+        timeline->SetAttribute("Name", StringValue(name + std::to_string(grpId)));
+        timeline->SetAttribute("Color", color);
+        timeline->SetAttribute("Connection", StringValue("None"));
+        timeline->GetXAxis()->SetAttribute("Name", StringValue("Time (s)"));
+        timeline->GetYAxis()->SetAttribute("Name", StringValue(unit));
+        timeline->SetAttribute("Visible", BooleanValue(false));
+        timelineCollection->Add(timeline);
+        return timeline;
+    };
+
+    if (m_timelineBucket.IsZero())
+    {
+        chart.timeline = createTimeline(metric + " - Timeline - ");
+    }
+    else
+    {
+        chart.timeline = createTimeline(metric + " - Timeline (mean) - ");
+        chart.minTimeline = createTimeline(metric + " - Timeline (min) - ");
+        chart.maxTimeline = createTimeline(metric + " - Timeline (max) - ");
+        chart.p95Timeline = createTimeline(metric + " - Timeline (p95) - ");
+    }
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::AddSample(MetricChart& chart, double value)
+{
+    if (m_ecdfRelativeAccuracy > 0)
+    {
+        chart.ecdfSketch.Add(value);
+        chart.ecdfChanged = true;
+    }
+    else
+    {
+        chart.ecdf->Append(value);
+    }
+
+    if (m_timelineBucket.IsZero())
+    {
+        chart.timeline->Append(Simulator::Now().GetSeconds(), value);
+        return;
+    }
+
+    if (chart.bucketCount == 0)
+    {
+        // Open the bucket holding the current time, and write it out when it ends
+        int64_t bucket = m_timelineBucket.GetTimeStep();
+        chart.bucketStart = TimeStep(Simulator::Now().GetTimeStep() / bucket * bucket);
+        chart.bucketMin = value;
+        chart.bucketMax = value;
+        chart.bucketSum = 0;
+        Simulator::Schedule(chart.bucketStart + m_timelineBucket - Simulator::Now(),
+                            &NetSimMcpttPttBasicGroupCharter::FlushBucket,
+                            this,
+                            &chart);
+    }
+    chart.bucketCount++;
+    chart.bucketMin = std::min(chart.bucketMin, value);
+    chart.bucketMax = std::max(chart.bucketMax, value);
+    chart.bucketSum += value;
+    if (m_ecdfRelativeAccuracy > 0)
+    {
+        chart.bucketSketch.Add(value);
+    }
+    else
+    {
+        chart.bucketSamples.push_back(value);
+    }
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::FlushBucket(MetricChart* chart)
+{
+    double p95;
+    if (m_ecdfRelativeAccuracy > 0)
+    {
+        p95 = chart->bucketSketch.GetQuantile(0.95);
+        chart->bucketSketch.Reset();
+    }
+    else
+    {
+        // Nearest rank, as the sketch does
+        auto& samples = chart->bucketSamples;
+        auto rank = static_cast<size_t>(std::ceil(0.95 * samples.size())) - 1;
+        std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+        p95 = samples[rank];
+        samples.clear();
+    }
+
+    double x = chart->bucketStart.GetSeconds();
+    chart->timeline->Append(x, chart->bucketSum / chart->bucketCount);
+    chart->minTimeline->Append(x, chart->bucketMin);
+    chart->maxTimeline->Append(x, chart->bucketMax);
+    chart->p95Timeline->Append(x, p95);
+    chart->bucketCount = 0;
+
+    WriteEcdf(*chart);
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::WriteEcdf(MetricChart& chart)
+{
+    if (!chart.ecdfChanged)
+    {
+        return;
+    }
+
+    std::vector<std::pair<double, double>> points;
+    chart.ecdfSketch.GetCdf(points);
+    chart.ecdfSeries->Clear();
+    for (const auto& [value, fraction] : points)
+    {
+        chart.ecdfSeries->Append(value, fraction);
+    }
+    chart.ecdfChanged = false;
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::FlushCharts()
+{
+    for (auto* charts : {&m_grpIdToAccessTimeChart, &m_grpIdToM2eLatencyChart})
+    {
+        for (auto& [grpId, chart] : *charts)
+        {
+            if (chart.bucketCount > 0)
+            {
+                FlushBucket(&chart);
+            }
+            WriteEcdf(chart);
+        }
+    }
+}
+
 void
 NetSimMcpttPttBasicGroupCharter::AccessTimeTrace(Time t,
                                                  uint32_t userId,
@@ -248,9 +408,7 @@ NetSimMcpttPttBasicGroupCharter::AccessTimeTrace(Time t,
     int grpId = GetGroupId(userId, callId);
     if (grpId != -1)
     {
-        m_grpIdToAccessTimeTimelineSeries[grpId]->Append(Simulator::Now().GetSeconds(),
-                                                         latency.GetMilliSeconds());
-        m_grpIdToAccessTimeEcdf[grpId]->Append(latency.GetMilliSeconds());
+        AddSample(m_grpIdToAccessTimeChart[grpId], latency.GetMilliSeconds());
     }
 }
 
@@ -269,9 +427,7 @@ NetSimMcpttPttBasicGroupCharter::M2eLatencyTrace(Time t,
     int grpId = GetGroupId(nodeId, callId);
     if (grpId != -1)
     {
-        m_grpIdToM2eLatencyTimelineSeries[grpId]->Append(Simulator::Now().GetSeconds(),
-                                                         latency.GetMilliSeconds());
-        m_grpIdToM2eLatencyEcdf[grpId]->Append(latency.GetMilliSeconds());
+        AddSample(m_grpIdToM2eLatencyChart[grpId], latency.GetMilliSeconds());
     }
 }
 
@@ -317,6 +473,110 @@ NetSimMcpttPttBasicGroupCharter::GetGroupId(uint32_t id, uint16_t callId)
                    std::to_string(id));
 }
 
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::QuantileSketch(double relativeAccuracy,
+                                                                uint32_t maxBins)
+    : m_logGamma(std::log((1 + relativeAccuracy) / (1 - relativeAccuracy))),
+      m_maxBins(maxBins)
+{
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::Add(double value)
+{
+    m_count++;
+    if (value <= 0)
+    {
+        m_zeroCount++;
+        return;
+    }
+
+    // Bin i holds the values in (gamma^(i-1), gamma^i]
+    auto index = static_cast<int32_t>(std::ceil(std::log(value) / m_logGamma));
+    auto [it, inserted] = m_bins.emplace(index, 0);
+    it->second++;
+    if (!inserted || m_bins.size() <= m_maxBins)
+    {
+        return;
+    }
+
+    // Too many bins: merge the two lowest ones, which keeps the upper
+    // quantiles (the ones of interest for latencies) accurate
+    auto lowest = m_bins.begin();
+    std::next(lowest)->second += lowest->second;
+    m_bins.erase(lowest);
+}
+
+double
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::GetQuantile(double q) const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    // Nearest rank
+    auto rank = static_cast<uint64_t>(std::ceil(q * m_count));
+    uint64_t seen = m_zeroCount;
+    if (rank <= seen)
+    {
+        return 0;
+    }
+    for (const auto& [index, count] : m_bins)
+    {
+        seen += count;
+        if (rank <= seen)
+        {
+            return GetBinValue(index);
+        }
+    }
+    return GetBinValue(m_bins.rbegin()->first);
+}
+
+uint64_t
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::GetCount() const
+{
+    return m_count;
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::GetCdf(
+    std::vector<std::pair<double, double>>& points) const
+{
+    points.clear();
+    if (m_count == 0)
+    {
+        return;
+    }
+
+    uint64_t seen = m_zeroCount;
+    if (seen > 0)
+    {
+        points.emplace_back(0, static_cast<double>(seen) / m_count);
+    }
+    for (const auto& [index, count] : m_bins)
+    {
+        seen += count;
+        points.emplace_back(GetBinValue(index), static_cast<double>(seen) / m_count);
+    }
+}
+
+void
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::Reset()
+{
+    m_zeroCount = 0;
+    m_count = 0;
+    m_bins.clear();
+}
+
+double
+NetSimMcpttPttBasicGroupCharter::QuantileSketch::GetBinValue(int32_t index) const
+{
+    // Center of the bin, whose relative distance to any value in the bin is
+    // at most the relative accuracy
+    double gamma = std::exp(m_logGamma);
+    return 2 * std::exp(index * m_logGamma) / (gamma + 1);
+}
+
 } /* namespace psc */
 
 } /* namespace ns3 */
@@ -46,6 +46,7 @@
 #include <ns3/application-container.h>
 #include <ns3/color.h>
 #include <ns3/ecdf-sink.h>
+#include <ns3/nstime.h>
 #include <ns3/object-map.h>
 #include <ns3/orchestrator.h>
 #include <ns3/packet.h>
@@ -53,6 +54,12 @@
 #include <ns3/type-id.h>
 #include <ns3/xy-series.h>
 
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -72,6 +79,14 @@ using namespace std;
  *                                            and iterate through that in GetGrpId() method)
  * ASSUMPTION: call ids are globally unique (ensured by McpttServerApp::AllocateId in
  * McpttCallHelper) ASSUMPTION: user ids are unique per app (ensured by McpttHelper)
+ *
+ * By default every sample is written to the graphs. For long runs, SetTimelineBucket and
+ * SetEcdfRelativeAccuracy bound the size of the output (call them before AddGroup):
+ * - the timelines then show the min, mean, max and p95 of the samples of each time bucket
+ * - the eCDFs are written from the bins of a quantile sketch, so they hold a bounded number
+ *   of points
+ * The open buckets and the eCDFs of the sketches are written out when the simulator is
+ * destroyed, so the charter must outlive Simulator::Destroy
  */
 class NetSimMcpttPttBasicGroupCharter
 {
@@ -96,7 +111,106 @@ class NetSimMcpttPttBasicGroupCharter
      */
     int AddGroup(ApplicationContainer pttApps, uint32_t grpId, netsimulyzer::Color3Value nextColor);
 
+    /*
+     * Method to aggregate the timeline samples into buckets of fixed duration
+     * Each bucket adds one point to the min, mean, max and p95 series of the group,
+     * placed at the start of the bucket. A bucket still open when the simulation
+     * stops is written when the simulator is destroyed
+     * \param bucket - the bucket duration, zero (the default) to plot every sample
+     */
+    void SetTimelineBucket(Time bucket);
+
+    /*
+     * Method to feed the eCDFs (and the timeline p95) from a quantile sketch
+     * Samples are counted in logarithmic bins, so the quantiles are accurate to
+     * within the given relative error. Each eCDF is rewritten from the bins of its
+     * sketch, with one point per bin, at the end of each timeline bucket (if any)
+     * and when the simulator is destroyed
+     * \param relativeAccuracy - the relative accuracy in (0, 1), zero (the default) to
+     *                           plot every sample in the eCDFs
+     * \param maxPoints - the maximum number of bins kept by each sketch, and so of
+     *                    points of each eCDF; the lowest bins are merged beyond that
+     */
+    void SetEcdfRelativeAccuracy(double relativeAccuracy, uint32_t maxPoints = 1024);
+
   private:
+    /*
+     * Streaming quantile sketch with bounded relative error (log-bucketed histogram)
+     * Non-positive samples are counted in a dedicated zero bin
+     */
+    class QuantileSketch
+    {
+      public:
+        /*
+         * \param relativeAccuracy - the relative accuracy in (0, 1)
+         * \param maxBins - the maximum number of bins (excluding the zero bin)
+         */
+        QuantileSketch(double relativeAccuracy = 0.01, uint32_t maxBins = 1024);
+
+        /*
+         * Adds a sample
+         * \param value - the sample
+         */
+        void Add(double value);
+
+        /*
+         * \param q - the quantile in [0, 1]
+         * \returns the estimated quantile, 0 if the sketch is empty
+         */
+        double GetQuantile(double q) const;
+
+        /*
+         * \returns the number of samples added since the last reset
+         */
+        uint64_t GetCount() const;
+
+        /*
+         * \param points - filled with the value representing each non-empty bin (the
+         *                 center of the bin) and the fraction of the samples up to it
+         */
+        void GetCdf(std::vector<std::pair<double, double>>& points) const;
+
+        /*
+         * Removes all the samples
+         */
+        void Reset();
+
+      private:
+        /*
+         * \param index - a bin index
+         * \returns the value representing the samples of the bin
+         */
+        double GetBinValue(int32_t index) const;
+
+        double m_logGamma;                  //!< Logarithm of the bin growth factor
+        uint32_t m_maxBins;                 //!< Maximum number of bins
+        uint64_t m_zeroCount{0};            //!< Number of non-positive samples
+        uint64_t m_count{0};                //!< Total number of samples
+        std::map<int32_t, uint64_t> m_bins; //!< Number of samples per bin index
+    };
+
+    /*
+     * Graphs and aggregation state of one metric of one group
+     */
+    struct MetricChart
+    {
+        Ptr<netsimulyzer::XYSeries> timeline;    //!< Every sample, or the bucket means
+        Ptr<netsimulyzer::XYSeries> minTimeline; //!< Bucket minimums (bucketed only)
+        Ptr<netsimulyzer::XYSeries> maxTimeline; //!< Bucket maximums (bucketed only)
+        Ptr<netsimulyzer::XYSeries> p95Timeline; //!< Bucket 95th percentiles (bucketed only)
+        Ptr<netsimulyzer::EcdfSink> ecdf;        //!< eCDF of all the samples (without sketch)
+        Ptr<netsimulyzer::XYSeries> ecdfSeries;  //!< eCDF of the sketch bins (sketch only)
+        QuantileSketch ecdfSketch;               //!< Sketch feeding the eCDF
+        bool ecdfChanged{false};                 //!< Samples added since the eCDF was written
+        QuantileSketch bucketSketch;             //!< Sketch of the current bucket samples
+        std::vector<double> bucketSamples;       //!< Current bucket samples (without sketch)
+        uint64_t bucketCount{0};                 //!< Number of samples in the current bucket
+        double bucketMin{0};                     //!< Minimum of the current bucket
+        double bucketMax{0};                     //!< Maximum of the current bucket
+        double bucketSum{0};                     //!< Sum of the current bucket
+        Time bucketStart;                        //!< Start of the current bucket
+    };
+
     /*
      * Links to AccessTime and M2eLatency trace sources of McpttTraceSources
      * This links to all nodes in the simulation
@@ -116,6 +230,45 @@ class NetSimMcpttPttBasicGroupCharter
      */
     int GetGroupId(uint32_t id, uint16_t callId);
 
+    /*
+     * Method to create the graphs of one metric of a group
+     * \param grpId - the group id
+     * \param metric - the name of the metric
+     * \param unit - the axis label of the metric values
+     * \param color - the color of the graphs
+     * \param ecdfCollection - the collection to add the eCDF to
+     * \param timelineCollection - the collection to add the timelines to
+     * \param chart - the chart to set up
+     */
+    void SetUpMetricChart(uint32_t grpId,
+                          const std::string& metric,
+                          const std::string& unit,
+                          netsimulyzer::Color3Value color,
+                          Ptr<netsimulyzer::SeriesCollection> ecdfCollection,
+                          Ptr<netsimulyzer::SeriesCollection> timelineCollection,
+                          MetricChart& chart);
+
+    /*
+     * Method to add a sample to the graphs of one metric of a group
+     */
+    void AddSample(MetricChart& chart, double value);
+
+    /*
+     * Method to write out the points of the current bucket of a chart
+     */
+    void FlushBucket(MetricChart* chart);
+
+    /*
+     * Method to rewrite the eCDF of a chart from the bins of its sketch, if it changed
+     */
+    void WriteEcdf(MetricChart& chart);
+
+    /*
+     * Method to write out the open buckets and the eCDFs of all the charts,
+     * called when the simulator is destroyed
+     */
+    void FlushCharts();
+
     /*
      * Trace sink to update AccessTime related graphs
      */
@@ -156,21 +309,25 @@ class NetSimMcpttPttBasicGroupCharter
      */
     std::set<uint32_t> m_allGrpIds;
     /*
-     * Maps a grpId to its AccessTime Timeline graph
+     * Maps a grpId to its AccessTime graphs
+     */
+    std::map<uint32_t, MetricChart> m_grpIdToAccessTimeChart;
+    /*
+     * Maps a grpId to its M2eLatency graphs
      */
-    std::map<uint32_t, Ptr<netsimulyzer::XYSeries>> m_grpIdToAccessTimeTimelineSeries;
+    std::map<uint32_t, MetricChart> m_grpIdToM2eLatencyChart;
     /*
-     * Maps a grpId to its AccessTime Ecdf graph
+     * Duration of the timeline buckets, zero to plot every sample
      */
-    std::map<uint32_t, Ptr<netsimulyzer::EcdfSink>> m_grpIdToAccessTimeEcdf;
+    Time m_timelineBucket{0};
     /*
-     * Maps a grpId to its M2eLatency Timeline graph
+     * Relative accuracy of the quantile sketches, zero to plot every sample in the eCDFs
      */
-    std::map<uint32_t, Ptr<netsimulyzer::XYSeries>> m_grpIdToM2eLatencyTimelineSeries;
+    double m_ecdfRelativeAccuracy = 0;
     /*
-     * Maps a grpId to its M2eLatency Ecdf graph
+     * Maximum number of distinct values kept by each quantile sketch
      */
-    std::map<uint32_t, Ptr<netsimulyzer::EcdfSink>> m_grpIdToM2eLatencyEcdf;
+    uint32_t m_ecdfMaxPoints = 1024;
     /*
      * Collection of AccessTime Ecdf graphs for each grp
      */
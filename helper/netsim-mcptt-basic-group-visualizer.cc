@@ -44,6 +44,9 @@
 #include "ns3/mcptt-ptt-app.h"
 
 #include <ns3/node-configuration.h>
+#include <ns3/simulator.h>
+
+#include <map>
 
 namespace ns3
 {
@@ -71,65 +74,131 @@ NetSimMcpttPttBasicGroupVisualizer::EnableVisualizations(
 
     m_orchestrator = orchestrator;
     m_highlightColor = highlightColor;
+    m_mediaMsgTypeId = McpttMediaMsg::GetTypeId();
+    m_floorReleaseTypeId = McpttFloorMsgRelease::GetTypeId();
+    m_floorTakenTypeId = McpttFloorMsgTaken::GetTypeId();
     LinkTraces(pttApps);
     m_isSetUp = true;
     return 1;
 }
 
+void
+NetSimMcpttPttBasicGroupVisualizer::SetUpdateResolution(Time resolution)
+{
+    NS_ABORT_MSG_IF(resolution.IsStrictlyNegative(), "The update resolution cannot be negative");
+    m_updateResolution = resolution;
+}
+
+Time
+NetSimMcpttPttBasicGroupVisualizer::GetUpdateResolution() const
+{
+    return m_updateResolution;
+}
+
 void
 NetSimMcpttPttBasicGroupVisualizer::LinkTraces(ApplicationContainer pttApps)
 {
+    // Maps a node Id to its index in m_nodes, so apps on the same node share
+    // one highlight state
+    std::map<uint32_t, uint32_t> nodeIndices;
+
     for (uint32_t i = 0; i < pttApps.GetN(); i++)
     {
         auto node = pttApps.Get(i)->GetNode();
-        auto nodeConfig = node->GetObject<netsimulyzer::NodeConfiguration>();
-
-        m_nodeToColor.insert(
-            std::pair<uint32_t, netsimulyzer::Color3>{node->GetId(),
-                                                      nodeConfig->GetHighlightColor().value()});
+        auto it = nodeIndices.find(node->GetId());
+        if (it == nodeIndices.end())
+        {
+            auto nodeConfig = node->GetObject<netsimulyzer::NodeConfiguration>();
+
+            NodeHighlight nodeHighlight;
+            nodeHighlight.config = nodeConfig;
+            nodeHighlight.originalColor = nodeConfig->GetHighlightColor().value();
+            it = nodeIndices.emplace(node->GetId(), m_nodes.size()).first;
+            m_nodes.push_back(nodeHighlight);
+        }
 
         Ptr<McpttPttApp> app = DynamicCast<McpttPttApp>(pttApps.Get(i));
         app->TraceConnectWithoutContext(
             "TxTrace",
-            MakeCallback(&NetSimMcpttPttBasicGroupVisualizer::McpttPttAppTxRxTraceCallback,
+            MakeCallback(&NetSimMcpttPttBasicGroupVisualizer::McpttPttAppTxTraceCallback,
                          this,
-                         true));
+                         it->second));
     }
 }
 
 void
-NetSimMcpttPttBasicGroupVisualizer::McpttPttAppTxRxTraceCallback(bool isTx,
-                                                                 Ptr<const Application> app,
-                                                                 uint16_t callId,
-                                                                 Ptr<const Packet> packet,
-                                                                 const TypeId& headerType)
+NetSimMcpttPttBasicGroupVisualizer::McpttPttAppTxTraceCallback(uint32_t nodeIndex,
+                                                               Ptr<const Application> app,
+                                                               uint16_t callId,
+                                                               Ptr<const Packet> packet,
+                                                               const TypeId& headerType)
 {
-    if (!isTx)
+    NodeHighlight& node = m_nodes[nodeIndex];
+
+    // TODO: Support additional cases (e.g.: floor revoke)
+    bool isTalking = node.isTalking;
+    // Node has relinquished the floor - highlight in original color
+    if (headerType == m_floorReleaseTypeId)
+    {
+        isTalking = false;
+    }
+    // Node took the floor/started transmitting messages - turn on highlight
+    else if (headerType == m_mediaMsgTypeId || headerType == m_floorTakenTypeId)
+    {
+        isTalking = true;
+    }
+
+    if (isTalking == node.isTalking)
     {
         return;
     }
+    node.isTalking = isTalking;
 
-    auto node = app->GetNode();
-    auto nodeConfig = node->GetObject<netsimulyzer::NodeConfiguration>();
-    auto it = m_nodeToColor.find(node->GetId());
-    NS_ABORT_MSG_IF((it == m_nodeToColor.end()),
-                    "Node with id" + std::to_string(node->GetId()) +
-                        "not found. Possibly due to unadded app during setup.");
+    if (m_updateResolution.IsZero())
+    {
+        UpdateHighlight(node);
+        return;
+    }
 
-    // TODO: Support additional cases (e.g.: floor revoke)
-    // Node has relinquished the floor - highlight in original color
-    if ((headerType.IsChildOf(McpttFloorMsg::GetTypeId())) &&
-        (headerType.GetName().find("McpttFloorMsgRelease") != std::string::npos))
+    if (!node.isPending)
     {
-        nodeConfig->SetHighlightColor(it->second);
+        node.isPending = true;
+        m_pendingNodes.push_back(nodeIndex);
     }
-    // Node took the floor/started transmitting messages - turn on highlight
-    else if ((headerType == McpttMediaMsg::GetTypeId()) ||
-             ((headerType.IsChildOf(McpttFloorMsg::GetTypeId())) &&
-              (headerType.GetName().find("McpttFloorMsgTaken") != std::string::npos)))
+    if (!m_updateEvent.IsPending())
     {
-        nodeConfig->SetHighlightColor(m_highlightColor);
+        // Align the updates on multiples of the resolution
+        int64_t resolution = m_updateResolution.GetTimeStep();
+        int64_t now = Simulator::Now().GetTimeStep();
+        Time delay = TimeStep(resolution - now % resolution);
+        m_updateEvent =
+            Simulator::Schedule(delay, &NetSimMcpttPttBasicGroupVisualizer::UpdateHighlights, this);
+    }
+}
+
+void
+NetSimMcpttPttBasicGroupVisualizer::UpdateHighlights()
+{
+    for (auto nodeIndex : m_pendingNodes)
+    {
+        NodeHighlight& node = m_nodes[nodeIndex];
+        node.isPending = false;
+        UpdateHighlight(node);
+    }
+    m_pendingNodes.clear();
+}
+
+void
+NetSimMcpttPttBasicGroupVisualizer::UpdateHighlight(NodeHighlight& node)
+{
+    // A node that stopped and started talking again within one update
+    // interval needs no change
+    if (node.isHighlighted == node.isTalking)
+    {
+        return;
     }
+    node.isHighlighted = node.isTalking;
+    node.config->SetHighlightColor(node.isTalking ? m_highlightColor : node.originalColor);
 }
 
 } /* namespace psc */
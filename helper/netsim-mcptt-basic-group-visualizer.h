@@ -42,10 +42,15 @@
 
 #include <ns3/application-container.h>
 #include <ns3/color.h>
+#include <ns3/event-id.h>
+#include <ns3/node-configuration.h>
+#include <ns3/nstime.h>
 #include <ns3/orchestrator.h>
 #include <ns3/packet.h>
 #include <ns3/type-id.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -83,7 +88,49 @@ class NetSimMcpttPttBasicGroupVisualizer
                              ApplicationContainer pttApps,
                              netsimulyzer::Color3 highlightColor = netsimulyzer::RED);
 
+    /*
+     * Method to set the time resolution of the highlight updates. Talker changes
+     * are collected and written out at most once per resolution interval,
+     * on multiples of the interval. A resolution of zero (the default) writes
+     * each talker change as soon as it happens.
+     * \param resolution the update resolution
+     */
+    void SetUpdateResolution(Time resolution);
+
+    /*
+     * Method to get the time resolution of the highlight updates
+     * \return the update resolution
+     */
+    Time GetUpdateResolution() const;
+
   private:
+    /*
+     * Highlight state of a node with (at least) one of the ptt apps
+     */
+    struct NodeHighlight
+    {
+        /*
+         * Configuration of the node, cached to avoid a lookup per message
+         */
+        Ptr<netsimulyzer::NodeConfiguration> config;
+        /*
+         * Original highlight color of the node
+         */
+        netsimulyzer::Color3 originalColor;
+        /*
+         * Whether the node is currently talking (i.e. should be highlighted)
+         */
+        bool isTalking = false;
+        /*
+         * Whether the node is highlighted in the NetSimulyzer output
+         */
+        bool isHighlighted = false;
+        /*
+         * Whether the node is waiting for the next update
+         */
+        bool isPending = false;
+    };
+
     /*
      * Method to link to rx/tx traces of the mcptt-ptt app to keep track of mcptt msgs
      * Msgs used to toggle highlighting of nodes
@@ -91,15 +138,26 @@ class NetSimMcpttPttBasicGroupVisualizer
     void LinkTraces(ApplicationContainer pttApps);
 
     /*
-     * Trace sink for McptPttApp tx trace to toggle logical links
-     * McpttPttApp have same callback signature for Tx and Rx (first parameter used to
-     * differentiate)
+     * Trace sink for McptPttApp tx trace to toggle node highlights
+     * The first parameter is the index of the sending node in m_nodes, bound
+     * when connecting the trace
+     */
+    void McpttPttAppTxTraceCallback(uint32_t nodeIndex,
+                                    Ptr<const Application> app,
+                                    uint16_t callId,
+                                    Ptr<const Packet> packet,
+                                    const TypeId& headerType);
+
+    /*
+     * Method to write out the highlight of the nodes whose talker state has
+     * changed since the last update
+     */
+    void UpdateHighlights();
+
+    /*
+     * Method to write out the highlight of a node if it differs from its talker state
      */
-    void McpttPttAppTxRxTraceCallback(bool isTx,
-                                      Ptr<const Application> app,
-                                      uint16_t callId,
-                                      Ptr<const Packet> packet,
-                                      const TypeId& headerType);
+    void UpdateHighlight(NodeHighlight& node);
 
     /*
      * Boolean flag to denote successful setup
@@ -110,13 +168,32 @@ class NetSimMcpttPttBasicGroupVisualizer
      */
     Ptr<netsimulyzer::Orchestrator> m_orchestrator;
     /*
-     * Maps a node Id to its original highlight color
+     * Highlight state of the nodes with ptt apps
+     */
+    std::vector<NodeHighlight> m_nodes;
+    /*
+     * Indices in m_nodes of the nodes waiting for the next update
      */
-    std::map<uint32_t, netsimulyzer::Color3> m_nodeToColor;
+    std::vector<uint32_t> m_pendingNodes;
     /*
      * Highlight color to denote node as transmitting/taken floor
      */
     netsimulyzer::Color3 m_highlightColor;
+    /*
+     * Time resolution of the highlight updates
+     */
+    Time m_updateResolution{0};
+    /*
+     * Next update of the highlights
+     */
+    EventId m_updateEvent;
+    /*
+     * Type Ids of the messages that change the talker state, cached to
+     * classify the messages by Type Id equality
+     */
+    TypeId m_mediaMsgTypeId;
+    TypeId m_floorReleaseTypeId;
+    TypeId m_floorTakenTypeId;
 };
 
 } /* namespace psc */
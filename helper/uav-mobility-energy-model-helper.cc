@@ -185,6 +185,13 @@ UavMobilityEnergyModelHelper::SetEnergySource(std::string name,
     m_energySource = factory;
 }
 
+void
+UavMobilityEnergyModelHelper::SetFleetEnergyManager(Ptr<UavFleetEnergyManager> fleet)
+{
+    NS_LOG_FUNCTION(this << fleet);
+    m_fleet = fleet;
+}
+
 Ptr<MobilityModel>
 UavMobilityEnergyModelHelper::CheckInstallMobilityModel(Ptr<Node> node) const
 {
@@ -248,6 +255,10 @@ UavMobilityEnergyModelHelper::DoInstall(Ptr<Node> node, Ptr<energy::EnergySource
     auto createdModel = m_energyModel.Create()->GetObject<UavMobilityEnergyModel>();
 
     createdModel->Init(node, source);
+    if (m_fleet)
+    {
+        createdModel->SetFleetEnergyManager(m_fleet);
+    }
     node->AggregateObject(createdModel);
     return createdModel;
 }
@@ -41,6 +41,7 @@
 #include <ns3/node-container.h>
 #include <ns3/object-factory.h>
 #include <ns3/ptr.h>
+#include <ns3/uav-fleet-energy-manager.h>
 #include <ns3/uav-mobility-energy-model.h>
 
 namespace ns3
@@ -259,10 +260,20 @@ class UavMobilityEnergyModelHelper
                          std::string n7 = "",
                          const AttributeValue& v7 = EmptyAttributeValue());
 
+    /**
+     * Sets the fleet energy manager to add the installed models to.
+     * If not called (or called with nullptr), the installed models
+     * account for their energy consumption on their own
+     *
+     * \param fleet The fleet energy manager
+     */
+    void SetFleetEnergyManager(Ptr<UavFleetEnergyManager> fleet);
+
   private:
-    ObjectFactory m_energyModel;   //!< object factory for creating energy model
-    ObjectFactory m_energySource;  //!< object factory for creating energy source
-    ObjectFactory m_mobilityModel; //!< object factory for creating mobility model
+    ObjectFactory m_energyModel;        //!< object factory for creating energy model
+    ObjectFactory m_energySource;       //!< object factory for creating energy source
+    ObjectFactory m_mobilityModel;      //!< object factory for creating mobility model
+    Ptr<UavFleetEnergyManager> m_fleet; //!< fleet to add the installed models to, if any
 
     /**
      * Checks if a MobilityModel is installed on node
@@ -33,6 +33,7 @@
 #include "intel-http-client.h"
 
 #include <ns3/abort.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/ipv4-address.h>
 #include <ns3/ipv6-address.h>
@@ -128,6 +129,20 @@ IntelHttpClient::GetTypeId()
                           DoubleValue(10000),
                           MakeDoubleAccessor(&IntelHttpClient::m_readTimeHighBound),
                           MakeDoubleChecker<double>())
+            .AddAttribute("MaxConnections",
+                          "Maximum number of parallel connections to the server used to request "
+                          "the embedded objects of a page",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&IntelHttpClient::m_maxConnections),
+                          MakeUintegerChecker<uint16_t>(1))
+            .AddAttribute("Pipelining",
+                          "If true, the requests for the embedded objects are sent on each "
+                          "connection without waiting for the responses to the previous ones. "
+                          "Otherwise, a connection only sends a request after receiving the "
+                          "response to the previous one",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&IntelHttpClient::m_pipelining),
+                          MakeBooleanChecker())
             .AddAttribute("SocketBufferSize",
                           "Size in Bytes of the socket send and receive buffers",
                           UintegerValue(0x7fffffff),
@@ -167,7 +182,12 @@ IntelHttpClient::GetTypeId()
                             "Trace called when object on a page was "
                             "not cached and needs to be requested",
                             MakeTraceSourceAccessor(&IntelHttpClient::m_cacheMiss),
-                            "ns3::psc::IntelHttpClient::CacheCallback");
+                            "ns3::psc::IntelHttpClient::CacheCallback")
+            .AddTraceSource("PageLoadTime",
+                            "Time it took to load the last page, from the request of the main "
+                            "object until the last embedded object was parsed",
+                            MakeTraceSourceAccessor(&IntelHttpClient::m_pageLoadTime),
+                            "ns3::TracedValueCallback::Time");
     return tid;
 }
 
@@ -193,7 +213,7 @@ void
 IntelHttpClient::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    m_socket = nullptr;
+    m_connections.clear();
     Application::DoDispose();
 }
 
@@ -201,26 +221,33 @@ void
 IntelHttpClient::StartApplication()
 {
     NS_LOG_FUNCTION(this);
-    if (!m_socket)
+    while (m_connections.size() < m_maxConnections)
     {
-        m_socket = Socket::CreateSocket(GetNode(), TcpSocketFactory::GetTypeId());
-        m_socket->SetAttribute("SndBufSize", UintegerValue(m_socketBufferSize));
-        m_socket->SetAttribute("RcvBufSize", UintegerValue(m_socketBufferSize));
+        Ptr<Socket> socket = Socket::CreateSocket(GetNode(), TcpSocketFactory::GetTypeId());
+        socket->SetAttribute("SndBufSize", UintegerValue(m_socketBufferSize));
+        socket->SetAttribute("RcvBufSize", UintegerValue(m_socketBufferSize));
 
         if (Ipv4Address::IsMatchingType(m_peerAddress))
         {
-            m_socket->Bind();
-            m_socket->Connect(
+            socket->Bind();
+            socket->Connect(
                 InetSocketAddress(Ipv4Address::ConvertFrom(m_peerAddress), m_peerPort));
         }
         else if (Ipv6Address::IsMatchingType(m_peerAddress))
         {
-            m_socket->Bind6();
-            m_socket->Connect(
+            socket->Bind6();
+            socket->Connect(
                 Inet6SocketAddress(Ipv6Address::ConvertFrom(m_peerAddress), m_peerPort));
         }
+        m_connections.push_back({socket, IntelHttpMessageParser(), 0});
+    }
+    for (auto& connection : m_connections)
+    {
+        connection.socket->SetRecvCallback(MakeCallback(&IntelHttpClient::HandleRead, this));
+        connection.parser = IntelHttpMessageParser();
+        connection.pendingRequests = 0;
     }
-    m_socket->SetRecvCallback(MakeCallback(&IntelHttpClient::HandleRead, this));
+    m_objectsToRequest.clear();
 
     m_sendEvent = Simulator::ScheduleNow(&IntelHttpClient::SendRequestPage, this);
 }
@@ -232,12 +259,12 @@ IntelHttpClient::StopApplication()
     Simulator::Cancel(m_sendEvent);
     Simulator::Cancel(m_parseEvent);
 
-    if (m_socket)
+    for (auto& connection : m_connections)
     {
-        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
-        m_socket->Close();
-        m_socket = nullptr;
+        connection.socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        connection.socket->Close();
     }
+    m_connections.clear();
 }
 
 void
@@ -257,138 +284,135 @@ IntelHttpClient::SendRequestPage()
     p->AddHeader(httpHeader);
 
     NS_LOG_DEBUG("Send Main Object Request of size " << size << " Bytes");
+    m_pageStartTime = Simulator::Now();
     m_txRequestMainObjectTrace(p);
     m_txTrace(p);
-    m_socket->Send(p);
+    m_connections.front().socket->Send(p);
+    m_connections.front().pendingRequests++;
     // Now wait for the response
 }
 
+void
+IntelHttpClient::SendNextRequest(uint16_t connection)
+{
+    NS_LOG_FUNCTION(this << connection);
+
+    if (m_objectsToRequest.empty())
+    {
+        return;
+    }
+    uint16_t object = m_objectsToRequest.front();
+    m_objectsToRequest.pop_front();
+
+    uint32_t randomSizeVal = m_requestSizeRvs->GetInteger();
+    NS_ABORT_MSG_IF(randomSizeVal <= IntelHttpHeader::GetHeaderSize(),
+                    "Packet size generated (" << randomSizeVal
+                                              << " Bytes) is not large enough "
+                                                 "to hold the header ("
+                                              << IntelHttpHeader::GetHeaderSize()
+                                              << " Bytes) and "
+                                                 "at least 1 Bytes of payload");
+    uint32_t size = randomSizeVal - IntelHttpHeader::GetHeaderSize();
+    Ptr<Packet> p = Create<Packet>(size);
+
+    IntelHttpHeader httpHeader;
+    httpHeader.SetRequestType(IntelHttpHeader::Type::Embedded);
+    httpHeader.SetNumberEmbeddedObjects(object);
+    httpHeader.SetPayloadSize(p->GetSize());
+    p->AddHeader(httpHeader);
+
+    NS_LOG_DEBUG("Sending Embedded Object Request of size "
+                 << size << " for Embedded Object #" << object << " on connection "
+                 << connection);
+
+    m_txRequestEmbeddedObjectTrace(p);
+    m_txTrace(p);
+    m_connections[connection].socket->Send(p);
+    m_connections[connection].pendingRequests++;
+}
+
 void
 IntelHttpClient::HandleRead(Ptr<Socket> socket)
 {
     NS_LOG_FUNCTION(this << socket);
 
+    uint16_t connection = 0;
+    while (connection < m_connections.size() && m_connections[connection].socket != socket)
+    {
+        connection++;
+    }
+    if (connection == m_connections.size())
+    {
+        NS_LOG_DEBUG("Socket is not connected to the server anymore");
+        return;
+    }
+    IntelHttpMessageParser& parser = m_connections[connection].parser;
+
+    // Only build the packets of the responses if someone is listening
+    const bool traced = !m_rxTrace.IsEmpty() || !m_rxMainObjectTrace.IsEmpty() ||
+                        !m_rxEmbeddedObjectTrace.IsEmpty();
+
     Ptr<Packet> p;
     Address from;
     while ((p = socket->RecvFrom(from)))
     {
-        NS_LOG_DEBUG("Received packet from socket");
+        NS_LOG_DEBUG("Received " << p->GetSize() << " Bytes from socket");
         if (Simulator::Now() > m_stopTime)
         {
             NS_LOG_DEBUG("Application is stopped. Discard the packet");
             break;
         }
-        // We may have several packets in this segment, so let's remove them sequentially
-        Ptr<Packet> tmpPacket = p->Copy();
-        while (tmpPacket)
+
+        // We may have several responses in this segment, so let's process them sequentially
+        parser.Feed(p);
+        IntelHttpHeader header;
+        Ptr<Packet> packet;
+        while (parser.Next(header, traced ? &packet : nullptr))
         {
-            NS_LOG_DEBUG("Checking if we have enough Bytes to make a packet");
-            if (m_partialPacket)
+            m_connections[connection].pendingRequests--;
+            if (header.GetRequestType() == IntelHttpHeader::Type::Main)
             {
-                NS_LOG_DEBUG(
-                    "Appending the Bytes received to the ones pending from previous receptions");
-                m_partialPacket->AddAtEnd(tmpPacket);
+                NS_LOG_DEBUG("Main Object Response");
             }
             else
             {
-                NS_LOG_DEBUG("The Bytes received are all we have");
-                m_partialPacket = tmpPacket;
+                NS_LOG_DEBUG("Embedded Object Response on connection " << connection);
+                if (!m_pipelining)
+                {
+                    // The connection is free, so it can request the next object right away
+                    SendNextRequest(connection);
+                }
             }
-            NS_LOG_DEBUG("We have " << m_partialPacket->GetSize() << " Bytes");
 
-            if (m_partialPacket->GetSize() >= IntelHttpHeader::GetHeaderSize())
+            if (traced)
             {
-                NS_LOG_DEBUG("Enough Bytes to make a header "
-                             "(Have "
-                             << m_partialPacket->GetSize()
-                             << ", "
-                                "needed "
-                             << IntelHttpHeader::GetHeaderSize() << ")");
-
-                // We have the full header. Now check if we also have the data
-                IntelHttpHeader header;
-                m_partialPacket->PeekHeader(header);
-                if (m_partialPacket->GetSize() >=
-                    header.GetPayloadSize() + header.GetSerializedSize())
+                m_rxTrace(packet, from);
+                if (header.GetRequestType() == IntelHttpHeader::Type::Main)
                 {
-                    NS_LOG_DEBUG("Enough Bytes to make a full packet ("
-                                 "Header is "
-                                 << IntelHttpHeader::GetHeaderSize()
-                                 << ", "
-                                    "Payload is "
-                                 << header.GetPayloadSize() << ")");
-
-                    // We have the full packet. Let's process it
-
-                    // Make a copy containing only our current item
-                    // for our traces
-                    auto packet = m_partialPacket->Copy();
-                    packet->RemoveAtEnd(packet->GetSize() -
-                                        (header.GetPayloadSize() + header.GetSerializedSize()));
-                    m_rxTrace(packet, from);
-                    if (header.GetRequestType() == IntelHttpHeader::Type::Main)
-                    {
-                        NS_LOG_DEBUG("Main Object Response");
-                        m_rxMainObjectTrace(packet, from);
-                    }
-                    else
-                    {
-                        NS_LOG_DEBUG("Embedded Object Response");
-                        m_rxEmbeddedObjectTrace(packet, from);
-                    }
-
-                    double parseValue = m_parseTimeRvs->GetValue();
-                    if (parseValue < m_parseTimeLowBound)
-                    {
-                        parseValue = m_parseTimeLowBound;
-                    }
-                    if (parseValue > m_parseTimeHighBound)
-                    {
-                        parseValue = m_parseTimeHighBound;
-                    }
-
-                    NS_LOG_DEBUG("Process received packet in " << parseValue << " seconds");
-                    m_parseEvent = Simulator::Schedule(Seconds(parseValue),
-                                                       &IntelHttpClient::ProcessRecvPkt,
-                                                       this,
-                                                       from,
-                                                       header);
-
-                    // Actually remove the header
-                    // since we really don't need the
-                    // removed header, just discard it
-                    {
-                        IntelHttpHeader httpHeader;
-                        m_partialPacket->RemoveHeader(httpHeader);
-                    }
-                    // Get how many bytes we need to remove from the packet we just got
-                    NS_LOG_DEBUG("Remove the Bytes 'used' for the previous packet and save "
-                                 "the remaining Bytes for the next packet");
-                    uint32_t bytesToRemove = tmpPacket->GetSize() -
-                                             (m_partialPacket->GetSize() - header.GetPayloadSize());
-                    m_partialPacket->RemoveAllPacketTags();
-                    m_partialPacket->RemoveAllByteTags();
-                    m_partialPacket = nullptr;
-
-                    // Now let's see if there is anything else in the segment
-                    NS_LOG_DEBUG("Removing " << bytesToRemove << " Bytes");
-                    tmpPacket->RemoveAtStart(bytesToRemove);
-                    if (tmpPacket->GetSize() == 0)
-                    {
-                        tmpPacket = nullptr;
-                    }
+                    m_rxMainObjectTrace(packet, from);
                 }
                 else
                 {
-                    // We don't have the full packet. Let's wait.
-                    tmpPacket = nullptr;
+                    m_rxEmbeddedObjectTrace(packet, from);
                 }
             }
-            else
+
+            double parseValue = m_parseTimeRvs->GetValue();
+            if (parseValue < m_parseTimeLowBound)
             {
-                // We still need to keep receiving data (we don't have the full header).
-                tmpPacket = nullptr;
+                parseValue = m_parseTimeLowBound;
             }
+            if (parseValue > m_parseTimeHighBound)
+            {
+                parseValue = m_parseTimeHighBound;
+            }
+
+            NS_LOG_DEBUG("Process received packet in " << parseValue << " seconds");
+            m_parseEvent = Simulator::Schedule(Seconds(parseValue),
+                                               &IntelHttpClient::ProcessRecvPkt,
+                                               this,
+                                               from,
+                                               header);
         }
     }
 }
@@ -398,7 +422,7 @@ IntelHttpClient::ProcessRecvPkt(const Address& from, const IntelHttpHeader& recv
 {
     NS_LOG_FUNCTION(this << from << recvHttpHeader);
 
-    if (!m_socket)
+    if (m_connections.empty())
     {
         return;
     }
@@ -407,62 +431,50 @@ IntelHttpClient::ProcessRecvPkt(const Address& from, const IntelHttpHeader& recv
     {
         NS_LOG_DEBUG("Received Main Object with " << recvHttpHeader.GetNumberEmbeddedObjects()
                                                   << " embedded objects");
-        m_objectsLeft = recvHttpHeader.GetNumberEmbeddedObjects();
-        if (m_objectsLeft > 0)
+        m_objectsLeft = 0;
+        for (uint16_t i = 0; i < recvHttpHeader.GetNumberEmbeddedObjects(); i++)
         {
-            for (int i = 0; i < recvHttpHeader.GetNumberEmbeddedObjects(); i++)
+            NS_LOG_DEBUG("Checking embedded object #" << i);
+            if (m_cacheRvs->GetValue() > m_cacheThreshold)
             {
-                NS_LOG_DEBUG("Checking embedded object #" << i);
-                if (m_cacheRvs->GetValue() > m_cacheThreshold)
-                {
-                    NS_LOG_DEBUG("Embedded Object #" << i << " is not cached");
-                    m_cacheMiss(i);
-                    uint32_t randomSizeVal = m_requestSizeRvs->GetInteger();
-                    NS_ABORT_MSG_IF(randomSizeVal <= IntelHttpHeader::GetHeaderSize(),
-                                    "Packet size generated (" << randomSizeVal
-                                                              << " Bytes) is not large enough "
-                                                                 "to hold the header ("
-                                                              << IntelHttpHeader::GetHeaderSize()
-                                                              << " Bytes) and "
-                                                                 "at least 1 Bytes of payload");
-                    uint32_t size = randomSizeVal - IntelHttpHeader::GetHeaderSize();
-                    Ptr<Packet> p = Create<Packet>(size);
-
-                    IntelHttpHeader httpHeader;
-                    httpHeader.SetRequestType(IntelHttpHeader::Type::Embedded);
-                    httpHeader.SetNumberEmbeddedObjects(i);
-                    httpHeader.SetPayloadSize(p->GetSize());
-                    p->AddHeader(httpHeader);
-
-                    NS_LOG_DEBUG("Sending Embedded Object Request of size "
-                                 << size << " for Embedded Object #" << i);
-
-                    m_txRequestEmbeddedObjectTrace(p);
-                    m_txTrace(p);
-                    m_socket->Send(p);
-                }
-                else
-                {
-                    NS_LOG_DEBUG("Embedded Object #" << i << " is cached");
-                    m_cacheHit(i);
-                    m_objectsLeft--;
-                }
+                NS_LOG_DEBUG("Embedded Object #" << i << " is not cached");
+                m_cacheMiss(i);
+                m_objectsToRequest.push_back(i);
+                m_objectsLeft++;
+            }
+            else
+            {
+                NS_LOG_DEBUG("Embedded Object #" << i << " is cached");
+                m_cacheHit(i);
             }
         }
-        if (m_objectsLeft == 0)
+
+        if (m_pipelining)
         {
-            NS_LOG_DEBUG("No Embedded Object left to receive.");
-            double readValue = m_readTimeRvs->GetValue();
-            if (readValue < m_readTimeLowBound)
+            // Spread all the requests between the connections
+            uint16_t connection = 0;
+            while (!m_objectsToRequest.empty())
             {
-                readValue = m_readTimeLowBound;
+                SendNextRequest(connection);
+                connection = (connection + 1) % m_connections.size();
             }
-            if (readValue > m_readTimeHighBound)
+        }
+        else
+        {
+            // Send one request on each connection, the rest are sent as the responses arrive
+            for (uint16_t connection = 0; connection < m_connections.size(); connection++)
             {
-                readValue = m_readTimeHighBound;
+                if (m_connections[connection].pendingRequests == 0)
+                {
+                    SendNextRequest(connection);
+                }
             }
-            m_sendEvent =
-                Simulator::Schedule(Seconds(readValue), &IntelHttpClient::SendRequestPage, this);
+        }
+
+        if (m_objectsLeft == 0)
+        {
+            NS_LOG_DEBUG("No Embedded Object left to receive.");
+            SchedulePageRead();
         }
     }
     else
@@ -476,20 +488,30 @@ IntelHttpClient::ProcessRecvPkt(const Address& from, const IntelHttpHeader& recv
         if (m_objectsLeft == 0)
         {
             NS_LOG_DEBUG("No Embedded Object left to receive.");
-            double readValue = m_readTimeRvs->GetValue();
-            if (readValue < m_readTimeLowBound)
-            {
-                readValue = m_readTimeLowBound;
-            }
-            if (readValue > m_readTimeHighBound)
-            {
-                readValue = m_readTimeHighBound;
-            }
-            m_sendEvent =
-                Simulator::Schedule(Seconds(readValue), &IntelHttpClient::SendRequestPage, this);
+            SchedulePageRead();
         }
     }
 }
 
+void
+IntelHttpClient::SchedulePageRead()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_pageLoadTime = Simulator::Now() - m_pageStartTime;
+    NS_LOG_DEBUG("Page loaded in " << m_pageLoadTime.Get().As(Time::S));
+
+    double readValue = m_readTimeRvs->GetValue();
+    if (readValue < m_readTimeLowBound)
+    {
+        readValue = m_readTimeLowBound;
+    }
+    if (readValue > m_readTimeHighBound)
+    {
+        readValue = m_readTimeHighBound;
+    }
+    m_sendEvent = Simulator::Schedule(Seconds(readValue), &IntelHttpClient::SendRequestPage, this);
+}
+
 } // namespace psc
 } // namespace ns3
@@ -34,17 +34,23 @@
 #define INTEL_HTTP_CLIENT_H
 
 #include "intel-http-header.h"
+#include "intel-http-message-parser.h"
 
 #include <ns3/address.h>
 #include <ns3/application.h>
 #include <ns3/event-id.h>
+#include <ns3/nstime.h>
 #include <ns3/output-stream-wrapper.h>
 #include <ns3/packet.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/socket.h>
 #include <ns3/traced-callback.h>
+#include <ns3/traced-value.h>
 #include <ns3/type-id.h>
 
+#include <deque>
+#include <vector>
+
 namespace ns3
 {
 
@@ -138,6 +144,12 @@ class IntelHttpClient : public Application
      */
     TracedCallback<uint16_t> m_cacheMiss;
 
+    /**
+     * Time it took to load the last page, from the request of the main
+     * object until the last embedded object was parsed
+     */
+    TracedValue<Time> m_pageLoadTime;
+
     /**
      * Method to orderly clean up the instance before destroying it.
      */
@@ -158,6 +170,14 @@ class IntelHttpClient : public Application
      */
     void SendRequestPage();
 
+    /**
+     * Sends the request for the next embedded object waiting to be requested,
+     * if any, on a connection.
+     *
+     * \param connection The index of the connection to use.
+     */
+    void SendNextRequest(uint16_t connection);
+
     /**
      * Method that processes a received packet.
      *
@@ -173,6 +193,22 @@ class IntelHttpClient : public Application
      */
     void ProcessRecvPkt(const Address& from, const IntelHttpHeader& recvHttpHeader);
 
+    /**
+     * Schedules the request of the next page after the reading time, once
+     * all the objects of the current page have been received.
+     */
+    void SchedulePageRead();
+
+    /**
+     * A connection to the server
+     */
+    struct Connection
+    {
+        Ptr<Socket> socket;            //!< Socket to send and receive data
+        IntelHttpMessageParser parser; //!< Parser of the responses received
+        uint16_t pendingRequests;      //!< Requests sent without a response yet
+    };
+
     /**
      * Address at which to send the packets to.
      */
@@ -190,15 +226,30 @@ class IntelHttpClient : public Application
      */
     EventId m_parseEvent;
     /**
-     * Socket to send and receive data.
+     * Connections to the server. The main objects are always requested on
+     * the first one.
+     */
+    std::vector<Connection> m_connections;
+
+    /**
+     * Maximum number of parallel connections to the server
+     */
+    uint16_t m_maxConnections;
+
+    /**
+     * Flag that indicates if the requests are pipelined on each connection
+     */
+    bool m_pipelining;
+
+    /**
+     * Indexes of the embedded objects of the page waiting to be requested
      */
-    Ptr<Socket> m_socket;
+    std::deque<uint16_t> m_objectsToRequest;
 
     /**
-     * Packet where we "accumulate" the bytes that we receive in
-     * TCP segments until we have a full packet
+     * Time at which the request for the main object of the page was sent
      */
-    Ptr<Packet> m_partialPacket;
+    Time m_pageStartTime;
 
     /**
      * Threshold to decide if an embedded object is cached or not
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "intel-http-message-parser.h"
+
+#include <ns3/assert.h>
+#include <ns3/buffer.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("IntelHttpMessageParser");
+
+namespace psc
+{
+
+IntelHttpMessageParser::IntelHttpMessageParser()
+    : m_offset(0),
+      m_headerBytes(IntelHttpHeader::GetHeaderSize()),
+      m_headerBytesRead(0),
+      m_payloadBytesRead(0),
+      m_messageInSegment(false),
+      m_messageStart(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+IntelHttpMessageParser::Feed(Ptr<const Packet> segment)
+{
+    NS_LOG_FUNCTION(this << segment);
+    NS_ASSERT_MSG(!m_segment || m_offset == m_segment->GetSize(),
+                  "The previous segment has not been fully parsed");
+
+    m_segment = segment;
+    m_offset = 0;
+    m_messageInSegment = false;
+}
+
+bool
+IntelHttpMessageParser::Next(IntelHttpHeader& header, Ptr<Packet>* message)
+{
+    NS_LOG_FUNCTION(this);
+
+    const uint32_t headerSize = m_headerBytes.size();
+    const uint32_t segmentSize = m_segment ? m_segment->GetSize() : 0;
+
+    if (m_headerBytesRead < headerSize)
+    {
+        if (m_offset == segmentSize)
+        {
+            return false;
+        }
+        if (m_headerBytesRead == 0)
+        {
+            m_messageInSegment = true;
+            m_messageStart = m_offset;
+        }
+
+        // Only the header bytes are copied, as they may be split between segments
+        uint32_t bytes = std::min(headerSize - m_headerBytesRead, segmentSize - m_offset);
+        m_segment->CreateFragment(m_offset, bytes)
+            ->CopyData(m_headerBytes.data() + m_headerBytesRead, bytes);
+        m_headerBytesRead += bytes;
+        m_offset += bytes;
+        if (m_headerBytesRead < headerSize)
+        {
+            NS_LOG_DEBUG("Header incomplete, " << m_headerBytesRead << " of " << headerSize
+                                               << " Bytes received");
+            return false;
+        }
+
+        Buffer buffer(headerSize);
+        buffer.Begin().Write(m_headerBytes.data(), headerSize);
+        m_header.Deserialize(buffer.Begin());
+        m_payloadBytesRead = 0;
+    }
+
+    // The payload bytes are just counted
+    const uint32_t payloadSize = m_header.GetPayloadSize();
+    uint32_t bytes = std::min(payloadSize - m_payloadBytesRead, segmentSize - m_offset);
+    m_payloadBytesRead += bytes;
+    m_offset += bytes;
+    if (m_payloadBytesRead < payloadSize)
+    {
+        NS_LOG_DEBUG("Payload incomplete, " << m_payloadBytesRead << " of " << payloadSize
+                                            << " Bytes received");
+        return false;
+    }
+
+    NS_LOG_DEBUG("Message complete, header is " << headerSize << " Bytes, payload is "
+                                                << payloadSize << " Bytes");
+    header = m_header;
+    if (message)
+    {
+        if (m_messageInSegment)
+        {
+            *message = m_segment->CreateFragment(m_messageStart, headerSize + payloadSize);
+        }
+        else
+        {
+            *message = Create<Packet>(payloadSize);
+            (*message)->AddHeader(m_header);
+        }
+    }
+
+    m_headerBytesRead = 0;
+    m_messageInSegment = false;
+    return true;
+}
+
+uint32_t
+IntelHttpMessageParser::GetPendingBytes() const
+{
+    if (m_headerBytesRead < m_headerBytes.size())
+    {
+        return m_headerBytesRead;
+    }
+    return m_headerBytesRead + m_payloadBytesRead;
+}
+
+} // namespace psc
+} // namespace ns3
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef INTEL_HTTP_MESSAGE_PARSER_H
+#define INTEL_HTTP_MESSAGE_PARSER_H
+
+#include "intel-http-header.h"
+
+#include <ns3/packet.h>
+#include <ns3/ptr.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ * \brief Incremental parser of the messages of the Intel HTTP model
+ *
+ * Extracts the messages (IntelHttpHeader plus payload) from the stream of
+ * TCP segments received on a connection. The parser only keeps the bytes of
+ * a header that is split between segments, and counts the payload bytes
+ * received, so the segments are neither copied nor accumulated.
+ *
+ * The segments are passed to Feed, and the messages completed are then
+ * retrieved by calling Next until it returns false:
+ *
+ * \code
+ *   parser.Feed(segment);
+ *   IntelHttpHeader header;
+ *   while (parser.Next(header, nullptr))
+ *   {
+ *       ...
+ *   }
+ * \endcode
+ */
+class IntelHttpMessageParser
+{
+  public:
+    /**
+     * Default constructor
+     */
+    IntelHttpMessageParser();
+
+    /**
+     * Sets the next segment of the stream to parse. The previous segment must
+     * have been fully parsed (i.e., Next must have returned false)
+     *
+     * \param segment The segment received
+     */
+    void Feed(Ptr<const Packet> segment);
+
+    /**
+     * Parses the current segment until the next message is complete
+     *
+     * \param header The header of the message completed
+     * \param message If not null, it is set to a packet with the message
+     *                completed (header and payload). The packet is a fragment
+     *                of the segment if the message was fully contained in it,
+     *                or a new packet with the same header and size otherwise.
+     *                It should only be requested when it is really needed
+     *                (e.g., for traces with sinks connected)
+     * \return True if a message was completed, false if the rest of the
+     *         segment does not complete any message
+     */
+    bool Next(IntelHttpHeader& header, Ptr<Packet>* message);
+
+    /**
+     * Get the number of bytes of the message being parsed that have been
+     * received so far
+     *
+     * \return The number of bytes received of the current message
+     */
+    uint32_t GetPendingBytes() const;
+
+  private:
+    Ptr<const Packet> m_segment;        //!< Segment being parsed
+    uint32_t m_offset;                  //!< Bytes of the segment already parsed
+    std::vector<uint8_t> m_headerBytes; //!< Bytes of the header of the current message
+    uint32_t m_headerBytesRead;         //!< Bytes of the header received so far
+    IntelHttpHeader m_header;           //!< Header of the current message
+    uint32_t m_payloadBytesRead;        //!< Bytes of the payload received so far
+    bool m_messageInSegment;            //!< True if the message started in this segment
+    uint32_t m_messageStart;            //!< Offset of the message in the segment
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif // INTEL_HTTP_MESSAGE_PARSER_H
@@ -0,0 +1,559 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "intel-http-population-client.h"
+
+#include <ns3/abort.h>
+#include <ns3/double.h>
+#include <ns3/inet-socket-address.h>
+#include <ns3/inet6-socket-address.h>
+#include <ns3/ipv4-address.h>
+#include <ns3/ipv6-address.h>
+#include <ns3/log.h>
+#include <ns3/pointer.h>
+#include <ns3/simulator.h>
+#include <ns3/socket.h>
+#include <ns3/string.h>
+#include <ns3/tcp-socket-factory.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("IntelHttpPopulationClient");
+
+namespace psc
+{
+
+NS_OBJECT_ENSURE_REGISTERED(IntelHttpPopulationClient);
+
+TypeId
+IntelHttpPopulationClient::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::psc::IntelHttpPopulationClient")
+            .SetParent<Application>()
+            .AddConstructor<IntelHttpPopulationClient>()
+            .AddAttribute("RemoteAddress",
+                          "The server Address",
+                          AddressValue(),
+                          MakeAddressAccessor(&IntelHttpPopulationClient::m_peerAddress),
+                          MakeAddressChecker())
+            .AddAttribute("RemotePort",
+                          "The server port",
+                          UintegerValue(80),
+                          MakeUintegerAccessor(&IntelHttpPopulationClient::m_peerPort),
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("Clients",
+                          "Number of clients emulated by the application",
+                          UintegerValue(100),
+                          MakeUintegerAccessor(&IntelHttpPopulationClient::m_clients),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxConnections",
+                          "Maximum number of connections to the server shared by the clients. "
+                          "A client waits for a free connection when all of them are in use. "
+                          "Zero means no limit",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&IntelHttpPopulationClient::m_maxConnections),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("StartWindow",
+                          "The clients request their first page at a time uniformly distributed "
+                          "in this window after the application starts",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&IntelHttpPopulationClient::m_startWindow),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("CacheRvs",
+                          "Stream that generates the value compared with the CacheThreshold to "
+                          "decide if an embedded object is cached or not. "
+                          "Should generate a value between 0 and 1",
+                          StringValue("ns3::UniformRandomVariable[Min=0|Max=1]"),
+                          MakePointerAccessor(&IntelHttpPopulationClient::m_cacheRvs),
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute(
+                "CacheThreshold",
+                "Threshold to decide if an embedded object is cached or not. If the value "
+                "generated by CacheRvs is less than or equal to this value, then the "
+                "object was cached and will not be requested",
+                DoubleValue(0.16),
+                MakeDoubleAccessor(&IntelHttpPopulationClient::m_cacheThreshold),
+                MakeDoubleChecker<double>(0, 1))
+            .AddAttribute("RequestSizeRvs",
+                          "Random Variable Stream to generate the size (in Bytes) of the requests",
+                          StringValue("ns3::UniformRandomVariable[Min=7|Max=630]"),
+                          MakePointerAccessor(&IntelHttpPopulationClient::m_requestSizeRvs),
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute(
+                "ParseTimeRvs",
+                "Random Variable Stream to generate the time (in seconds) required to parse "
+                "a downloaded file",
+                StringValue("ns3::LogNormalRandomVariable[Mu=-1.24892|Sigma=2.08427]"),
+                MakePointerAccessor(&IntelHttpPopulationClient::m_parseTimeRvs),
+                MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("ParseTimeLowBound",
+                          "Low bound (in seconds) to the values generated by the parse time "
+                          "random variable stream, in seconds",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&IntelHttpPopulationClient::m_parseTimeLowBound),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ParseTimeHighBound",
+                          "High bound (in seconds) to the values generated by the parse time "
+                          "random variable stream, in seconds",
+                          DoubleValue(300),
+                          MakeDoubleAccessor(&IntelHttpPopulationClient::m_parseTimeHighBound),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ReadTimeRvs",
+                          "Random Variable Stream to generate the time (in seconds) spent reading "
+                          "a page after it has been downloaded",
+                          StringValue("ns3::LogNormalRandomVariable[Mu=-0.495204|Sigma=2.7731]"),
+                          MakePointerAccessor(&IntelHttpPopulationClient::m_readTimeRvs),
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("ReadTimeLowBound",
+                          "Low bound (in seconds) to the values generated by the reading time "
+                          "random variable stream, in seconds",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&IntelHttpPopulationClient::m_readTimeLowBound),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ReadTimeHighBound",
+                          "High bound (in seconds) to the values generated by the reading time "
+                          "random variable stream, in seconds",
+                          DoubleValue(10000),
+                          MakeDoubleAccessor(&IntelHttpPopulationClient::m_readTimeHighBound),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("SocketBufferSize",
+                          "Size in Bytes of the socket send and receive buffers",
+                          UintegerValue(0x7fffffff),
+                          MakeUintegerAccessor(&IntelHttpPopulationClient::m_socketBufferSize),
+                          MakeUintegerChecker<uint32_t>())
+            .AddTraceSource("Rx",
+                            "General trace for receiving a packet of any kind.",
+                            MakeTraceSourceAccessor(&IntelHttpPopulationClient::m_rxTrace),
+                            "ns3::Packet::AddressTracedCallback")
+            .AddTraceSource("Tx",
+                            "General trace for sending a packet of any kind.",
+                            MakeTraceSourceAccessor(&IntelHttpPopulationClient::m_txTrace),
+                            "ns3::Packet::TracedCallback")
+            .AddTraceSource("PageLoad",
+                            "Trace called when a client loads a page, with the index of the "
+                            "client and the time from the request of the main object until "
+                            "the last embedded object was parsed",
+                            MakeTraceSourceAccessor(&IntelHttpPopulationClient::m_pageLoadTrace),
+                            "ns3::psc::IntelHttpPopulationClient::PageLoadTracedCallback");
+    return tid;
+}
+
+bool
+IntelHttpPopulationClient::Event::operator>(const Event& other) const
+{
+    return timestamp > other.timestamp ||
+           (timestamp == other.timestamp && sequence > other.sequence);
+}
+
+IntelHttpPopulationClient::IntelHttpPopulationClient()
+    : m_startRvs(CreateObject<UniformRandomVariable>()),
+      m_eventSequence(0),
+      m_runningEvents(false),
+      m_pagesLoaded(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+IntelHttpPopulationClient::~IntelHttpPopulationClient()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+IntelHttpPopulationClient::SetRemote(Address ip, uint16_t port)
+{
+    NS_LOG_FUNCTION(this << ip << port);
+    m_peerAddress = ip;
+    m_peerPort = port;
+}
+
+uint32_t
+IntelHttpPopulationClient::GetClientCount() const
+{
+    return m_clients;
+}
+
+uint32_t
+IntelHttpPopulationClient::GetConnectionCount() const
+{
+    return m_connections.size();
+}
+
+uint64_t
+IntelHttpPopulationClient::GetPagesLoaded() const
+{
+    return m_pagesLoaded;
+}
+
+int64_t
+IntelHttpPopulationClient::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+
+    m_requestSizeRvs->SetStream(stream);
+    m_parseTimeRvs->SetStream(stream + 1);
+    m_cacheRvs->SetStream(stream + 2);
+    m_readTimeRvs->SetStream(stream + 3);
+    m_startRvs->SetStream(stream + 4);
+
+    return 5;
+}
+
+void
+IntelHttpPopulationClient::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_connections.clear();
+    m_connectionIndex.clear();
+    m_requestSizeRvs = nullptr;
+    m_parseTimeRvs = nullptr;
+    m_cacheRvs = nullptr;
+    m_readTimeRvs = nullptr;
+    m_startRvs = nullptr;
+    Application::DoDispose();
+}
+
+void
+IntelHttpPopulationClient::StartApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_objectsLeft.assign(m_clients, 0);
+    m_pageStartTime.assign(m_clients, Time());
+    m_connectionOf.assign(m_clients, NO_CONNECTION);
+    m_freeConnections.clear();
+    for (uint32_t connection = 0; connection < m_connections.size(); connection++)
+    {
+        m_freeConnections.push_back(connection);
+    }
+    m_waitingClients.clear();
+
+    for (uint32_t client = 0; client < m_clients; client++)
+    {
+        Time start = Seconds(m_startRvs->GetValue(0, m_startWindow.GetSeconds()));
+        ScheduleEvent(start, client, EventKind::RequestPage);
+    }
+}
+
+void
+IntelHttpPopulationClient::StopApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    Simulator::Cancel(m_nextEvent);
+    m_events = decltype(m_events)();
+    m_waitingClients.clear();
+
+    for (auto& connection : m_connections)
+    {
+        connection.socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        connection.socket->Close();
+    }
+    m_connections.clear();
+    m_connectionIndex.clear();
+    m_freeConnections.clear();
+}
+
+void
+IntelHttpPopulationClient::ScheduleEvent(Time delay,
+                                         uint32_t client,
+                                         EventKind kind,
+                                         uint16_t objects)
+{
+    NS_LOG_FUNCTION(this << delay << client << static_cast<uint16_t>(kind) << objects);
+
+    Event event{(Simulator::Now() + delay).GetTimeStep(), m_eventSequence++, client, kind, objects};
+    bool earliest = m_events.empty() || m_events.top() > event;
+    m_events.push(event);
+
+    // Only the earliest event of the queue is scheduled in the simulator
+    if (earliest && !m_runningEvents)
+    {
+        Simulator::Cancel(m_nextEvent);
+        m_nextEvent = Simulator::Schedule(delay, &IntelHttpPopulationClient::RunEvents, this);
+    }
+}
+
+void
+IntelHttpPopulationClient::RunEvents()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_runningEvents = true;
+    const int64_t now = Simulator::Now().GetTimeStep();
+    while (!m_events.empty() && m_events.top().timestamp <= now)
+    {
+        Event event = m_events.top();
+        m_events.pop();
+        switch (event.kind)
+        {
+        case EventKind::RequestPage:
+            RequestPage(event.client);
+            break;
+        case EventKind::ParseMain:
+            ProcessMainObject(event.client, event.objects);
+            break;
+        case EventKind::ParseEmbedded:
+            NS_LOG_DEBUG("Client " << event.client << " parsed an embedded object, "
+                                   << m_objectsLeft[event.client] - 1 << " pending");
+            if (--m_objectsLeft[event.client] == 0)
+            {
+                CompletePage(event.client);
+            }
+            break;
+        }
+    }
+    m_runningEvents = false;
+
+    if (!m_events.empty())
+    {
+        m_nextEvent = Simulator::Schedule(TimeStep(m_events.top().timestamp - now),
+                                          &IntelHttpPopulationClient::RunEvents,
+                                          this);
+    }
+}
+
+void
+IntelHttpPopulationClient::RequestPage(uint32_t client)
+{
+    NS_LOG_FUNCTION(this << client);
+
+    m_pageStartTime[client] = Simulator::Now();
+    if (!m_freeConnections.empty())
+    {
+        uint32_t connection = m_freeConnections.back();
+        m_freeConnections.pop_back();
+        SendMainRequest(client, connection);
+    }
+    else if (m_maxConnections == 0 || m_connections.size() < m_maxConnections)
+    {
+        SendMainRequest(client, CreateConnection());
+    }
+    else
+    {
+        NS_LOG_DEBUG("Client " << client << " waits for a free connection");
+        m_waitingClients.push_back(client);
+    }
+}
+
+void
+IntelHttpPopulationClient::SendMainRequest(uint32_t client, uint32_t connection)
+{
+    NS_LOG_FUNCTION(this << client << connection);
+
+    m_connectionOf[client] = connection;
+    m_connections[connection].client = client;
+
+    uint32_t randomSizeVal = m_requestSizeRvs->GetInteger();
+    NS_ABORT_MSG_IF(randomSizeVal <= IntelHttpHeader::GetHeaderSize(),
+                    "Packet size generated (" << randomSizeVal
+                                              << " Bytes) is not large enough "
+                                                 "to hold the header ("
+                                              << IntelHttpHeader::GetHeaderSize()
+                                              << " Bytes) and "
+                                                 "at least 1 Bytes of payload");
+    uint16_t size = randomSizeVal - IntelHttpHeader::GetHeaderSize();
+    Ptr<Packet> p = Create<Packet>(size);
+
+    IntelHttpHeader httpHeader;
+    httpHeader.SetRequestType(IntelHttpHeader::Type::Main);
+    httpHeader.SetNumberEmbeddedObjects(0);
+    httpHeader.SetPayloadSize(p->GetSize());
+    p->AddHeader(httpHeader);
+
+    NS_LOG_DEBUG("Client " << client << " sends Main Object Request of size " << size
+                           << " Bytes on connection " << connection);
+    m_txTrace(p);
+    m_connections[connection].socket->Send(p);
+}
+
+void
+IntelHttpPopulationClient::ProcessMainObject(uint32_t client, uint16_t objects)
+{
+    NS_LOG_FUNCTION(this << client << objects);
+
+    Ptr<Socket> socket = m_connections[m_connectionOf[client]].socket;
+    m_objectsLeft[client] = 0;
+    for (uint16_t i = 0; i < objects; i++)
+    {
+        if (m_cacheRvs->GetValue() <= m_cacheThreshold)
+        {
+            NS_LOG_DEBUG("Client " << client << " has Embedded Object #" << i << " cached");
+            continue;
+        }
+
+        uint32_t randomSizeVal = m_requestSizeRvs->GetInteger();
+        NS_ABORT_MSG_IF(randomSizeVal <= IntelHttpHeader::GetHeaderSize(),
+                        "Packet size generated (" << randomSizeVal
+                                                  << " Bytes) is not large enough "
+                                                     "to hold the header ("
+                                                  << IntelHttpHeader::GetHeaderSize()
+                                                  << " Bytes) and "
+                                                     "at least 1 Bytes of payload");
+        Ptr<Packet> p = Create<Packet>(randomSizeVal - IntelHttpHeader::GetHeaderSize());
+
+        IntelHttpHeader httpHeader;
+        httpHeader.SetRequestType(IntelHttpHeader::Type::Embedded);
+        httpHeader.SetNumberEmbeddedObjects(i);
+        httpHeader.SetPayloadSize(p->GetSize());
+        p->AddHeader(httpHeader);
+
+        m_txTrace(p);
+        socket->Send(p);
+        m_objectsLeft[client]++;
+    }
+
+    NS_LOG_DEBUG("Client " << client << " requested " << m_objectsLeft[client] << " of "
+                           << objects << " Embedded Objects");
+    if (m_objectsLeft[client] == 0)
+    {
+        CompletePage(client);
+    }
+}
+
+void
+IntelHttpPopulationClient::CompletePage(uint32_t client)
+{
+    NS_LOG_FUNCTION(this << client);
+
+    m_pagesLoaded++;
+    m_pageLoadTrace(client, Simulator::Now() - m_pageStartTime[client]);
+
+    // All the responses have been received, so the connection can be used by other client
+    uint32_t connection = m_connectionOf[client];
+    m_connectionOf[client] = NO_CONNECTION;
+    if (!m_waitingClients.empty())
+    {
+        uint32_t next = m_waitingClients.front();
+        m_waitingClients.pop_front();
+        SendMainRequest(next, connection);
+    }
+    else
+    {
+        m_freeConnections.push_back(connection);
+    }
+
+    double readValue = m_readTimeRvs->GetValue();
+    readValue = std::min(std::max(readValue, m_readTimeLowBound), m_readTimeHighBound);
+    ScheduleEvent(Seconds(readValue), client, EventKind::RequestPage);
+}
+
+uint32_t
+IntelHttpPopulationClient::CreateConnection()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<Socket> socket = Socket::CreateSocket(GetNode(), TcpSocketFactory::GetTypeId());
+    socket->SetAttribute("SndBufSize", UintegerValue(m_socketBufferSize));
+    socket->SetAttribute("RcvBufSize", UintegerValue(m_socketBufferSize));
+
+    if (Ipv4Address::IsMatchingType(m_peerAddress))
+    {
+        socket->Bind();
+        socket->Connect(InetSocketAddress(Ipv4Address::ConvertFrom(m_peerAddress), m_peerPort));
+    }
+    else if (Ipv6Address::IsMatchingType(m_peerAddress))
+    {
+        socket->Bind6();
+        socket->Connect(Inet6SocketAddress(Ipv6Address::ConvertFrom(m_peerAddress), m_peerPort));
+    }
+    socket->SetRecvCallback(MakeCallback(&IntelHttpPopulationClient::HandleRead, this));
+
+    uint32_t connection = m_connections.size();
+    m_connections.push_back({socket, IntelHttpMessageParser(), NO_CONNECTION});
+    m_connectionIndex.emplace(socket, connection);
+    NS_LOG_DEBUG("Connection " << connection << " created");
+
+    return connection;
+}
+
+void
+IntelHttpPopulationClient::HandleRead(Ptr<Socket> socket)
+{
+    NS_LOG_FUNCTION(this << socket);
+
+    auto it = m_connectionIndex.find(socket);
+    if (it == m_connectionIndex.end())
+    {
+        NS_LOG_DEBUG("Socket is not connected to the server anymore");
+        return;
+    }
+    Connection& connection = m_connections[it->second];
+
+    // Only build the packets of the responses if someone is listening
+    const bool traced = !m_rxTrace.IsEmpty();
+
+    Ptr<Packet> p;
+    Address from;
+    while ((p = socket->RecvFrom(from)))
+    {
+        if (Simulator::Now() > m_stopTime)
+        {
+            NS_LOG_DEBUG("Application is stopped. Discard the packet");
+            break;
+        }
+
+        connection.parser.Feed(p);
+        IntelHttpHeader header;
+        Ptr<Packet> packet;
+        while (connection.parser.Next(header, traced ? &packet : nullptr))
+        {
+            if (traced)
+            {
+                m_rxTrace(packet, from);
+            }
+
+            double parseValue = m_parseTimeRvs->GetValue();
+            parseValue = std::min(std::max(parseValue, m_parseTimeLowBound), m_parseTimeHighBound);
+
+            if (header.GetRequestType() == IntelHttpHeader::Type::Main)
+            {
+                ScheduleEvent(Seconds(parseValue),
+                              connection.client,
+                              EventKind::ParseMain,
+                              header.GetNumberEmbeddedObjects());
+            }
+            else
+            {
+                ScheduleEvent(Seconds(parseValue), connection.client, EventKind::ParseEmbedded);
+            }
+        }
+    }
+}
+
+} // namespace psc
+} // namespace ns3
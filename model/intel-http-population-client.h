@@ -0,0 +1,312 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef INTEL_HTTP_POPULATION_CLIENT_H
+#define INTEL_HTTP_POPULATION_CLIENT_H
+
+#include "intel-http-header.h"
+#include "intel-http-message-parser.h"
+
+#include <ns3/address.h>
+#include <ns3/application.h>
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
+#include <ns3/packet.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/socket.h>
+#include <ns3/traced-callback.h>
+#include <ns3/type-id.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <queue>
+#include <vector>
+
+namespace ns3
+{
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ * \brief Population of HTTP clients based off of the Intel HTTP model
+ *
+ * Emulates a number of IntelHttpClient applications (the logical clients)
+ * in a single application, to generate the web load of a large population
+ * of users with a fraction of the memory and events. Each logical client
+ * follows the same model as IntelHttpClient (with a single connection and
+ * pipelined requests), and the values are drawn from the same distributions.
+ *
+ * The state of the clients is kept in arrays indexed by the client, and
+ * all the parse and read timers are kept in a single queue, so that only
+ * the earliest one is scheduled in the simulator. The clients share a pool
+ * of connections to the server: a client takes a connection when it requests
+ * a page, and releases it when the page is loaded, so the number of sockets
+ * is the number of pages being loaded at the same time instead of the number
+ * of clients. Intended to communicate with IntelHttpServer.
+ *
+ * See the model documentation for details about this class
+ */
+class IntelHttpPopulationClient : public Application
+{
+  public:
+    /**
+     * Signature for a callback triggered when a client loads a page
+     *
+     * \param client The index of the client
+     * \param loadTime The time it took to load the page
+     */
+    typedef void (*PageLoadTracedCallback)(uint32_t client, Time loadTime);
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * Default constructor.
+     */
+    IntelHttpPopulationClient();
+
+    /**
+     * Default destructor.
+     */
+    ~IntelHttpPopulationClient() override;
+
+    /**
+     * Setter for the address of the server for the clients.
+     *
+     * \param ip The address at which the server will be listening.
+     * \param port The port at which the server will be listening.
+     */
+    void SetRemote(Address ip, uint16_t port);
+
+    /**
+     * Get the number of clients emulated
+     *
+     * \return The number of clients
+     */
+    uint32_t GetClientCount() const;
+
+    /**
+     * Get the number of connections opened to the server
+     *
+     * \return The size of the pool of connections
+     */
+    uint32_t GetConnectionCount() const;
+
+    /**
+     * Get the number of pages loaded by all the clients
+     *
+     * \return The number of pages loaded
+     */
+    uint64_t GetPagesLoaded() const;
+
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this application.
+     *
+     * \param stream The first stream index to use
+     * \return The number of stream indices assigned by this application
+     */
+    int64_t AssignStreams(int64_t stream) override;
+
+  protected:
+    /**
+     * Method to orderly clean up the instance before destroying it.
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * The kind of the events in the queue of the clients
+     */
+    enum class EventKind : uint8_t
+    {
+        RequestPage,   //!< The client requests a new page
+        ParseMain,     //!< The client finished parsing a main object
+        ParseEmbedded, //!< The client finished parsing an embedded object
+    };
+
+    /**
+     * An event in the queue of the clients
+     */
+    struct Event
+    {
+        int64_t timestamp; //!< Time of the event, in simulator time steps
+        uint64_t sequence; //!< Sequence number to keep the order of simultaneous events
+        uint32_t client;   //!< Index of the client
+        EventKind kind;    //!< Kind of event
+        uint16_t objects;  //!< Number of embedded objects of a main object
+
+        /**
+         * Compares the events by time and sequence
+         *
+         * \param other The other event
+         * \return True if this event happens after the other one
+         */
+        bool operator>(const Event& other) const;
+    };
+
+    /**
+     * A connection to the server
+     */
+    struct Connection
+    {
+        Ptr<Socket> socket;            //!< Socket to send and receive data
+        IntelHttpMessageParser parser; //!< Parser of the responses received
+        uint32_t client;               //!< Index of the client using the connection
+    };
+
+    /**
+     * Method that starts the operation of this application.
+     */
+    void StartApplication() override;
+    /**
+     * Method that stops the operation of this application.
+     */
+    void StopApplication() override;
+
+    /**
+     * Adds an event to the queue of the clients
+     *
+     * \param delay The time until the event
+     * \param client The index of the client
+     * \param kind The kind of event
+     * \param objects The number of embedded objects, for ParseMain events
+     */
+    void ScheduleEvent(Time delay, uint32_t client, EventKind kind, uint16_t objects = 0);
+
+    /**
+     * Processes the events of the queue that are due, and schedules the next
+     * one in the simulator
+     */
+    void RunEvents();
+
+    /**
+     * Makes a client request a page, taking a connection from the pool
+     *
+     * \param client The index of the client
+     */
+    void RequestPage(uint32_t client);
+
+    /**
+     * Assigns a connection to a client and sends the request for the main object
+     *
+     * \param client The index of the client
+     * \param connection The index of the connection
+     */
+    void SendMainRequest(uint32_t client, uint32_t connection);
+
+    /**
+     * Processes a main object once it has been parsed, requesting the
+     * embedded objects not cached
+     *
+     * \param client The index of the client
+     * \param objects The number of embedded objects of the page
+     */
+    void ProcessMainObject(uint32_t client, uint16_t objects);
+
+    /**
+     * Completes the page of a client, releasing its connection and
+     * scheduling the next page after the reading time
+     *
+     * \param client The index of the client
+     */
+    void CompletePage(uint32_t client);
+
+    /**
+     * Creates a new connection to the server
+     *
+     * \return The index of the connection
+     */
+    uint32_t CreateConnection();
+
+    /**
+     * Method that processes a received packet.
+     *
+     * \param socket Socket that received the packet.
+     */
+    void HandleRead(Ptr<Socket> socket);
+
+    /**
+     * Value used as the connection of the clients without one
+     */
+    static constexpr uint32_t NO_CONNECTION = UINT32_MAX;
+
+    Address m_peerAddress;       //!< Address at which to send the packets to
+    uint16_t m_peerPort;         //!< Port at which to send the packets to
+    uint32_t m_clients;          //!< Number of clients emulated
+    uint32_t m_maxConnections;   //!< Maximum number of connections, 0 for no limit
+    Time m_startWindow;          //!< Window in which the clients request their first page
+    double m_cacheThreshold;     //!< Threshold to decide if an embedded object is cached
+    double m_parseTimeLowBound;  //!< Low bound for the parse time, in seconds
+    double m_parseTimeHighBound; //!< High bound for the parse time, in seconds
+    double m_readTimeLowBound;   //!< Low bound for the reading time, in seconds
+    double m_readTimeHighBound;  //!< High bound for the reading time, in seconds
+    uint32_t m_socketBufferSize; //!< Size of the send and receive socket buffers
+
+    Ptr<RandomVariableStream> m_requestSizeRvs; //!< Generates the size of the requests
+    Ptr<RandomVariableStream> m_parseTimeRvs;   //!< Generates the time spent parsing
+    Ptr<RandomVariableStream> m_cacheRvs;       //!< Decides if an embedded object is cached
+    Ptr<RandomVariableStream> m_readTimeRvs;    //!< Generates the time spent reading
+    Ptr<UniformRandomVariable> m_startRvs;      //!< Generates the time of the first page
+
+    std::vector<uint16_t> m_objectsLeft;               //!< Embedded objects left by client
+    std::vector<Time> m_pageStartTime;                 //!< Time each client started its page
+    std::vector<uint32_t> m_connectionOf;              //!< Connection used by each client
+    std::vector<Connection> m_connections;             //!< Pool of connections to the server
+    std::map<Ptr<Socket>, uint32_t> m_connectionIndex; //!< Index of each connection by socket
+    std::vector<uint32_t> m_freeConnections;           //!< Connections not used by any client
+    std::deque<uint32_t> m_waitingClients;             //!< Clients waiting for a free connection
+
+    /**
+     * Queue of the events of all the clients, with the earliest on top
+     */
+    std::priority_queue<Event, std::vector<Event>, std::greater<>> m_events;
+    uint64_t m_eventSequence; //!< Sequence number of the next event
+    EventId m_nextEvent;      //!< Simulator event for the earliest event in the queue
+    bool m_runningEvents;     //!< True while the events of the queue are being processed
+    uint64_t m_pagesLoaded;   //!< Number of pages loaded by all the clients
+
+    TracedCallback<Ptr<const Packet>> m_txTrace;                 //!< Tx trace
+    TracedCallback<Ptr<const Packet>, const Address&> m_rxTrace; //!< Rx trace
+    TracedCallback<uint32_t, Time> m_pageLoadTrace;              //!< Page load trace
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif // INTEL_HTTP_POPULATION_CLIENT_H
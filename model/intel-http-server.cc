@@ -186,6 +186,7 @@ IntelHttpServer::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     m_socket = nullptr;
+    m_parsers.clear();
     Application::DoDispose();
 }
 
@@ -220,6 +221,15 @@ IntelHttpServer::StopApplication()
         m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
         m_socket = nullptr;
     }
+
+    for (auto& [socket, parser] : m_parsers)
+    {
+        socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        socket->SetCloseCallbacks(MakeNullCallback<void, Ptr<Socket>>(),
+                                  MakeNullCallback<void, Ptr<Socket>>());
+        socket->Close();
+    }
+    m_parsers.clear();
 }
 
 void
@@ -227,113 +237,61 @@ IntelHttpServer::HandleRead(Ptr<Socket> socket)
 {
     NS_LOG_FUNCTION(this << socket);
 
+    // Each connection has its own parser, as the segments of concurrent
+    // clients may arrive interleaved
+    auto parserIt = m_parsers.find(socket);
+    if (parserIt == m_parsers.end())
+    {
+        NS_LOG_DEBUG("Read on a connection that is already closed; ignore it");
+        return;
+    }
+    IntelHttpMessageParser& parser = parserIt->second;
+
+    // Only build the packets of the requests if someone is listening
+    const bool traced = !m_rxTrace.IsEmpty() || !m_rxMainObjectRequestTrace.IsEmpty() ||
+                        !m_rxEmbeddedObjectRequestTrace.IsEmpty();
+
     Ptr<Packet> recvPkt;
     Address from;
     while ((recvPkt = socket->RecvFrom(from)))
     {
-        NS_LOG_DEBUG("Received packet from socket");
+        NS_LOG_DEBUG("Received " << recvPkt->GetSize() << " Bytes from socket");
         if (Simulator::Now() > m_stopTime)
         {
             NS_LOG_DEBUG("Application is stopped. Discard the packet");
             break;
         }
-        // We may have several packets in this segment, so let's remove them sequentially
-        Ptr<Packet> tmpPacket = recvPkt->Copy();
-        while (tmpPacket)
+
+        // We may have several requests in this segment, so let's process them sequentially
+        parser.Feed(recvPkt);
+        IntelHttpHeader header;
+        Ptr<Packet> packet;
+        while (parser.Next(header, traced ? &packet : nullptr))
         {
-            NS_LOG_DEBUG("Checking if we have enough Bytes to make a packet");
-            if (m_partialPacket)
+            if (header.GetRequestType() == IntelHttpHeader::Type::Main)
             {
-                NS_LOG_DEBUG(
-                    "Appending the Bytes received to the ones pending from previous receptions");
-                m_partialPacket->AddAtEnd(tmpPacket);
+                NS_LOG_DEBUG("Main Object Request");
             }
             else
             {
-                NS_LOG_DEBUG("The Bytes received are all we have");
-                m_partialPacket = tmpPacket;
+                NS_LOG_DEBUG("Embedded Object Request");
             }
-            NS_LOG_DEBUG("We have " << m_partialPacket->GetSize() << " Bytes");
 
-            if (m_partialPacket->GetSize() >= IntelHttpHeader::GetHeaderSize())
+            if (traced)
             {
-                NS_LOG_DEBUG("Enough Bytes to make a header "
-                             "(Have "
-                             << m_partialPacket->GetSize()
-                             << ", "
-                                "needed "
-                             << IntelHttpHeader::GetHeaderSize() << ")");
-
-                // We have the full header. Now check if we also have the data
-                IntelHttpHeader header;
-                m_partialPacket->PeekHeader(header);
-                if (m_partialPacket->GetSize() >=
-                    header.GetPayloadSize() + header.GetSerializedSize())
+                m_rxTrace(packet, from);
+                if (header.GetRequestType() == IntelHttpHeader::Type::Main)
                 {
-                    NS_LOG_DEBUG("Enough Bytes to make a full packet ("
-                                 "Header is "
-                                 << IntelHttpHeader::GetHeaderSize()
-                                 << ", "
-                                    "Payload is "
-                                 << header.GetPayloadSize() << ")");
-
-                    // We have the full packet. Let's process it
-
-                    // Make a copy containing only our current item
-                    // for our traces
-                    auto packet = m_partialPacket->Copy();
-                    packet->RemoveAtEnd(packet->GetSize() -
-                                        (header.GetPayloadSize() + header.GetSerializedSize()));
-                    m_rxTrace(packet, from);
-                    if (header.GetRequestType() == IntelHttpHeader::Type::Main)
-                    {
-                        NS_LOG_DEBUG("Main Object Request");
-                        m_rxMainObjectRequestTrace(packet, from);
-                    }
-                    else
-                    {
-                        NS_LOG_DEBUG("Embedded Object Request");
-                        m_rxEmbeddedObjectRequestTrace(packet, from);
-                    }
-
-                    NS_LOG_DEBUG("Process received packet");
-                    ProcessRecvPkt(socket, from, header);
-
-                    // Actually remove the header
-                    // since we really don't need the
-                    // removed header, just discard it
-                    {
-                        IntelHttpHeader httpHeader;
-                        m_partialPacket->RemoveHeader(httpHeader);
-                    }
-                    // Get how many bytes we need to remove from the packet we just got
-                    NS_LOG_DEBUG("Remove the Bytes 'used' for the previous packet and save "
-                                 "the remaining Bytes for the next packet");
-                    uint32_t bytesToRemove = tmpPacket->GetSize() -
-                                             (m_partialPacket->GetSize() - header.GetPayloadSize());
-                    m_partialPacket->RemoveAllPacketTags();
-                    m_partialPacket->RemoveAllByteTags();
-                    m_partialPacket = nullptr;
-
-                    // Now let's see if there is anything else in the segment
-                    NS_LOG_DEBUG("Removing " << bytesToRemove << " Bytes");
-                    tmpPacket->RemoveAtStart(bytesToRemove);
-                    if (tmpPacket->GetSize() == 0)
-                    {
-                        tmpPacket = nullptr;
-                    }
+                    m_rxMainObjectRequestTrace(packet, from);
                 }
                 else
                 {
-                    // We don't have the full packet. Let's wait.
-                    tmpPacket = nullptr;
+                    m_rxEmbeddedObjectRequestTrace(packet, from);
                 }
             }
-            else
-            {
-                // We still need to keep receiving data (we don't have the full header).
-                tmpPacket = nullptr;
-            }
+
+            NS_LOG_DEBUG("Process received packet");
+            ProcessRecvPkt(socket, from, header);
         }
     }
 }
@@ -436,7 +394,18 @@ IntelHttpServer::HandleAccept(Ptr<Socket> socket, const Address& from)
 {
     NS_LOG_FUNCTION(this << socket << from);
 
+    m_parsers.emplace(socket, IntelHttpMessageParser());
     socket->SetRecvCallback(MakeCallback(&IntelHttpServer::HandleRead, this));
+    socket->SetCloseCallbacks(MakeCallback(&IntelHttpServer::HandleClose, this),
+                              MakeCallback(&IntelHttpServer::HandleClose, this));
+}
+
+void
+IntelHttpServer::HandleClose(Ptr<Socket> socket)
+{
+    NS_LOG_FUNCTION(this << socket);
+
+    m_parsers.erase(socket);
 }
 
 void
@@ -34,6 +34,7 @@
 #define INTEL_HTTP_SERVER_H
 
 #include "intel-http-header.h"
+#include "intel-http-message-parser.h"
 
 #include <ns3/address.h>
 #include <ns3/application.h>
@@ -42,6 +43,8 @@
 #include <ns3/traced-callback.h>
 #include <ns3/type-id.h>
 
+#include <map>
+
 namespace ns3
 {
 
@@ -124,8 +127,9 @@ class IntelHttpServer : public Application
 
     /**
      * Method that processes a received packet. Note that, as we are using TCP, this packet
-     * may not be an application packet, but a TCP segment. When we get a full application
-     * packet, it will be passed to ProcessRecvPacket.
+     * may not be an application packet, but a TCP segment. The segments are parsed
+     * incrementally, and when we get a full application packet, its header will be passed
+     * to ProcessRecvPkt.
      *
      * \param socket Socket that received the packet.
      */
@@ -148,6 +152,13 @@ class IntelHttpServer : public Application
      * \param from Client address.
      */
     void HandleAccept(Ptr<Socket> socket, const Address& from);
+    /**
+     * Method that processes the closing of a connection from a client,
+     * releasing the reassembly state of the connection.
+     *
+     * \param socket Socket of the connection.
+     */
+    void HandleClose(Ptr<Socket> socket);
     /**
      * Method to handle the scheduling of sending event. It just sends and traces the response
      * packet, but being a separate methods allows us to call Simulator::Schedule () on it.
@@ -168,10 +179,10 @@ class IntelHttpServer : public Application
     Ptr<Socket> m_socket;
 
     /**
-     * Packet where we "accumulate" the bytes that we receive in
-     * TCP segments until we have a full packet
+     * Parsers of the requests received in TCP segments, for each
+     * connection accepted, indexed by the socket of the connection
      */
-    Ptr<Packet> m_partialPacket;
+    std::map<Ptr<Socket>, IntelHttpMessageParser> m_parsers;
 
     /**
      * Size of the send and receive socket buffers
@@ -737,7 +737,9 @@ McpttCallMachineGrpBroadcast::SetGrpId(const McpttCallMsgFieldGrpId& grpId)
 {
     NS_LOG_FUNCTION(this << &grpId);
 
+    uint32_t oldGrpId = m_grpId.GetGrpId();
     m_grpId = grpId;
+    NotifyGrpIdChanged(oldGrpId);
 }
 
 void
@@ -880,7 +880,9 @@ McpttCallMachinePrivate::SetGrpId(uint32_t grpId)
 {
     NS_LOG_FUNCTION(this << grpId);
 
+    uint32_t oldGrpId = m_grpId.GetGrpId();
     m_grpId = McpttCallMsgFieldGrpId(grpId);
+    NotifyGrpIdChanged(oldGrpId);
 }
 
 void
@@ -142,6 +142,18 @@ McpttCallMachineGrp::IsPrivateCall(uint32_t userId) const
     return false;
 }
 
+void
+McpttCallMachineGrp::NotifyGrpIdChanged(uint32_t oldGrpId) const
+{
+    NS_LOG_FUNCTION(this << oldGrpId);
+
+    Ptr<McpttCall> call = GetCall();
+    if (call && call->GetOwner() && GetGrpId().GetGrpId() != oldGrpId)
+    {
+        call->GetOwner()->UpdateGrpCall(call, oldGrpId);
+    }
+}
+
 /** McpttCallMachineGrp - end **/
 
 /** McpttCallMachineNull - begin **/
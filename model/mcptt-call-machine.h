@@ -259,6 +259,14 @@ class McpttCallMachineGrp : public McpttCallMachine
      * \param grpId The group ID.
      */
     virtual void SetGrpId(uint32_t grpId) = 0;
+
+  protected:
+    /**
+     * Notifies the application of the call, if any, that the group ID has
+     * changed. Subclasses call it after setting the group ID.
+     * \param oldGrpId The previous group ID.
+     */
+    void NotifyGrpIdChanged(uint32_t oldGrpId) const;
 };
 
 /**
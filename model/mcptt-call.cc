@@ -465,12 +465,59 @@ McpttCall::Stop()
     GetOwner()->CloseCallChannel(m_callPort, this, m_networkCallType);
 }
 
+void
+McpttCall::Reset()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (IsFloorChannelOpen())
+    {
+        CloseFloorChannel();
+    }
+    if (IsMediaChannelOpen())
+    {
+        CloseMediaChannel();
+    }
+    if (m_callMachine)
+    {
+        m_callMachine->Dispose();
+    }
+    if (m_floorMachine)
+    {
+        m_floorMachine->Dispose();
+    }
+    SetCallMachine(nullptr);
+    SetFloorMachine(nullptr);
+    SetOwner(nullptr);
+
+    // Restore the attributes as a newly created call would have them,
+    // including those of a subclass
+    for (TypeId tid = GetInstanceTypeId(); tid != Object::GetTypeId(); tid = tid.GetParent())
+    {
+        for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+        {
+            TypeId::AttributeInformation info = tid.GetAttribute(i);
+            if (info.flags & TypeId::ATTR_SET)
+            {
+                SetAttribute(info.name, *info.initialValue);
+            }
+        }
+    }
+    m_pushOnSelect = false;
+    m_startTime = Seconds(0);
+    m_stopTime = Seconds(0);
+}
+
 void
 McpttCall::DoDispose()
 {
     NS_LOG_FUNCTION(this);
 
-    GetCallMachine()->Dispose();
+    // A pooled call has no machines
+    if (m_callMachine)
+    {
+        m_callMachine->Dispose();
+    }
     SetCallMachine(nullptr);
     SetFloorChannel(nullptr);
     SetFloorMachine(nullptr);
@@ -692,6 +739,14 @@ McpttCall::SetOwner(Ptr<McpttPttApp> owner)
     m_owner = owner;
 }
 
+void
+McpttCall::SetPeerAddress(const Address& peerAddress)
+{
+    NS_LOG_FUNCTION(this << peerAddress);
+
+    m_peerAddress = peerAddress;
+}
+
 void
 McpttCall::SetStartTime(Time startTime)
 {
@@ -231,6 +231,14 @@ class McpttCall : public Object
      * Stops the call.
      */
     void Stop();
+    /**
+     * Resets a stopped call so that it can be reused for another call of the
+     * same network call type. The call and floor machines are disposed of and
+     * detached, the attributes are restored to their initial values, and the
+     * call is detached from its owner. The floor and media channels are kept,
+     * closed, to be reused with the machines of the next call.
+     */
+    void Reset();
 
   protected:
     /**
@@ -333,6 +341,12 @@ class McpttCall : public Object
      * \param owner The owner.
      */
     void SetOwner(Ptr<McpttPttApp> owner);
+    /**
+     * Sets the address of the node that the peer application is on (same as
+     * the PeerAddress attribute).
+     * \param peerAddress The peer address.
+     */
+    void SetPeerAddress(const Address& peerAddress);
     /**
      * Sets the call start time
      * \param startTime The start time.
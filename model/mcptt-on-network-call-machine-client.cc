@@ -439,6 +439,20 @@ McpttOnNetworkCallMachineClient::SetGrpId(uint32_t grpId)
     m_grpId = grpIdField;
 }
 
+void
+McpttOnNetworkCallMachineClient::SetFloorPort(uint16_t floorPort)
+{
+    NS_LOG_FUNCTION(this << floorPort);
+    m_floorPort = floorPort;
+}
+
+void
+McpttOnNetworkCallMachineClient::SetMediaPort(uint16_t mediaPort)
+{
+    NS_LOG_FUNCTION(this << mediaPort);
+    m_mediaPort = mediaPort;
+}
+
 McpttCallMsgFieldGrpId
 McpttOnNetworkCallMachineClient::GetGrpId() const
 {
@@ -210,6 +210,18 @@ class McpttOnNetworkCallMachineClient : public McpttCallMachineGrp
      * \param grpId The group ID
      */
     void SetGrpId(uint32_t grpId) override;
+    /**
+     * Sets the port to use for floor control messages (same as the FloorPort
+     * attribute).
+     * \param floorPort The floor port.
+     */
+    void SetFloorPort(uint16_t floorPort);
+    /**
+     * Sets the port to use for media messages (same as the MediaPort
+     * attribute).
+     * \param mediaPort The media port.
+     */
+    void SetMediaPort(uint16_t mediaPort);
     /**
      * Gets the group ID
      * \return The group ID
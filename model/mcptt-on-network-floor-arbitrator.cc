@@ -211,6 +211,14 @@ McpttOnNetworkFloorArbitrator::AddParticipant(
     m_participants.push_back(participant);
 }
 
+void
+McpttOnNetworkFloorArbitrator::ReserveParticipants(uint32_t count)
+{
+    NS_LOG_FUNCTION(this << count);
+
+    m_participants.reserve(count);
+}
+
 void
 McpttOnNetworkFloorArbitrator::CallInitialized(
     Ptr<McpttOnNetworkFloorTowardsParticipant> participant,
@@ -83,6 +83,12 @@ class McpttOnNetworkFloorArbitrator : public Object
      * \param participant The interface for the associated participant.
      */
     virtual void AddParticipant(Ptr<McpttOnNetworkFloorTowardsParticipant> participant);
+    /**
+     * Reserves room for a number of floor participants, to be added with
+     * AddParticipant.
+     * \param count The number of participants.
+     */
+    void ReserveParticipants(uint32_t count);
     /**
      * Notifies this machine that a call has been initialized.
      * \param participant The participant that initiated the call
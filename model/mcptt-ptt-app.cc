@@ -33,6 +33,7 @@
 
 #include "mcptt-call-machine-grp-basic.h"
 #include "mcptt-call-machine-grp-broadcast.h"
+#include "mcptt-call-machine-private.h"
 #include "mcptt-call-msg.h"
 #include "mcptt-channel.h"
 #include "mcptt-floor-msg.h"
@@ -62,6 +63,8 @@
 #include <ns3/uinteger.h>
 #include <ns3/vector.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -70,16 +73,100 @@ NS_LOG_COMPONENT_DEFINE("McpttPttApp");
 namespace psc
 {
 
+namespace
+{
+
+/**
+ * Orders calls by call ID.
+ * \param a The first call.
+ * \param b The second call.
+ * \returns True, if the call ID of the first call is lower.
+ */
+bool
+CallIdLess(const Ptr<McpttCall>& a, const Ptr<McpttCall>& b)
+{
+    return a->GetCallId() < b->GetCallId();
+}
+
+/**
+ * Finds a call in a container of calls ordered by call ID.
+ * \param calls The container of calls.
+ * \param call The call.
+ * \returns The position of the call, or the end of the container.
+ */
+std::vector<Ptr<McpttCall>>::iterator
+FindOrderedCall(std::vector<Ptr<McpttCall>>& calls, const Ptr<McpttCall>& call)
+{
+    auto range = std::equal_range(calls.begin(), calls.end(), call, CallIdLess);
+    auto it = std::find(range.first, range.second, call);
+    return it == range.second ? calls.end() : it;
+}
+
+/**
+ * Adds a call to an index of calls by group ID.
+ * \param index The index.
+ * \param grpId The group ID of the call.
+ * \param call The call.
+ */
+void
+AddGrpIndexCall(std::map<uint32_t, std::vector<Ptr<McpttCall>>>& index,
+                uint32_t grpId,
+                const Ptr<McpttCall>& call)
+{
+    std::vector<Ptr<McpttCall>>& calls = index[grpId];
+    if (std::find(calls.begin(), calls.end(), call) == calls.end())
+    {
+        calls.insert(std::upper_bound(calls.begin(), calls.end(), call, CallIdLess), call);
+    }
+}
+
+/**
+ * Removes a call from an index of calls by group ID.
+ * \param index The index.
+ * \param grpId The group ID under which the call was added.
+ * \param call The call.
+ */
+void
+RemoveGrpIndexCall(std::map<uint32_t, std::vector<Ptr<McpttCall>>>& index,
+                   uint32_t grpId,
+                   const Ptr<McpttCall>& call)
+{
+    auto it = index.find(grpId);
+    if (it == index.end())
+    {
+        return;
+    }
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), call), it->second.end());
+    if (it->second.empty())
+    {
+        index.erase(it);
+    }
+}
+
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(McpttPttApp);
 
 uint16_t McpttPttApp::s_mediaPortNumber = 9000;  // Media ports typically 9000-10999
 uint16_t McpttPttApp::s_floorPortNumber = 11000; // Floor ports arbitrarily start after
+uint16_t McpttPttApp::s_portStride = 1;
 
 // Legacy method, to preserve test code for the moment
 uint16_t
 McpttPttApp::AllocateNextPortNumber()
 {
-    return s_mediaPortNumber++;
+    // The counter is the same on every rank when the simulation starts, so
+    // interleaving the ranks keeps the ports unique across them
+    uint16_t port = s_mediaPortNumber + Simulator::GetSystemId() % s_portStride;
+    s_mediaPortNumber += s_portStride;
+    return port;
+}
+
+void
+McpttPttApp::SetPortAllocationStride(uint16_t stride)
+{
+    NS_ABORT_MSG_IF(stride == 0, "The port allocation stride must be at least 1");
+    s_portStride = stride;
 }
 
 uint16_t
@@ -124,12 +211,27 @@ McpttPttApp::GetTypeId()
                 AddressValue(Ipv4Address::GetAny()),
                 MakeAddressAccessor(&McpttPttApp::GetLocalAddress, &McpttPttApp::SetLocalAddress),
                 MakeAddressChecker())
+            .AddAttribute("MaxPooledCalls",
+                          "The maximum number of released calls, per type of call, network call "
+                          "type and types of machines, kept for reuse by the calls created "
+                          "later (see RecycleCall). Only the calls and their channels are "
+                          "kept, not their machines.",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&McpttPttApp::m_maxPooledCalls),
+                          MakeUintegerChecker<uint32_t>())
             .AddAttribute(
                 "PushOnStart",
                 "The flag that indicates if the pusher should be started with the application.",
                 BooleanValue(false),
                 MakeBooleanAccessor(&McpttPttApp::m_pushOnStart),
                 MakeBooleanChecker())
+            .AddAttribute("RecycleReleasedCalls",
+                          "The flag that indicates if the calls released at their stop time, "
+                          "after their start time, are recycled (see RecycleCall) once they are "
+                          "no longer ongoing.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&McpttPttApp::m_recycleReleasedCalls),
+                          MakeBooleanChecker())
             .AddTraceSource("RxTrace",
                             "The trace for capturing received messages",
                             MakeTraceSourceAccessor(&McpttPttApp::m_rxTrace),
@@ -257,40 +359,160 @@ McpttPttApp::CreateCall(ObjectFactory& callFac,
 {
     NS_LOG_FUNCTION(this << callId << callType);
 
-    Ptr<McpttCall> call = CreateObject<McpttCall>(callType);
-    Ptr<McpttChannel> floorChannel = CreateObject<McpttChannel>();
-    Ptr<McpttChannel> mediaChannel = CreateObject<McpttChannel>();
     Ptr<McpttCallMachine> callMachine = callFac.Create<McpttCallMachine>();
     Ptr<McpttFloorParticipant> floorMachine = floorFac.Create<McpttFloorParticipant>();
 
-    call->SetCallMachine(callMachine);
-    call->SetFloorChannel(floorChannel);
-    call->SetFloorMachine(floorMachine);
-    call->SetMediaChannel(mediaChannel);
+    Ptr<McpttCall> call = AllocateCall(callType, callMachine, floorMachine);
     call->SetCallId(callId);
     AddCall(call);
     return call;
 }
 
+Ptr<McpttCall>
+McpttPttApp::AllocateCall(McpttCall::NetworkCallType callType,
+                          Ptr<McpttCallMachine> callMachine,
+                          Ptr<McpttFloorParticipant> floorMachine)
+{
+    NS_LOG_FUNCTION(this << callType << callMachine << floorMachine);
+
+    Ptr<McpttCall> call;
+    std::vector<Ptr<McpttCall>>& pool = m_callPool[CallPoolKey(McpttCall::GetTypeId(),
+                                                               callType,
+                                                               callMachine->GetInstanceTypeId(),
+                                                               floorMachine->GetInstanceTypeId())];
+    if (!pool.empty())
+    {
+        // Reuse a released call, with its channels, and only renew the machines
+        call = pool.back();
+        pool.pop_back();
+        NS_LOG_LOGIC("Reusing a released call");
+        call->SetCallMachine(callMachine);
+        call->SetFloorMachine(floorMachine);
+    }
+    else
+    {
+        call = CreateObject<McpttCall>(callType);
+        Ptr<McpttChannel> floorChannel = CreateObject<McpttChannel>();
+        Ptr<McpttChannel> mediaChannel = CreateObject<McpttChannel>();
+
+        call->SetCallMachine(callMachine);
+        call->SetFloorChannel(floorChannel);
+        call->SetFloorMachine(floorMachine);
+        call->SetMediaChannel(mediaChannel);
+    }
+    return call;
+}
+
 void
 McpttPttApp::AddCall(Ptr<McpttCall> call)
 {
     NS_LOG_FUNCTION(this << call);
     call->SetOwner(this);
+    // As with a map, the call already added with the same ID is kept
+    auto pos = FindCall(call->GetCallId());
+    if (pos == m_calls.end() || pos->first != call->GetCallId())
+    {
+        m_calls.emplace(pos, call->GetCallId(), call);
+        AddGrpCall(call);
+    }
+    if (!IsLocal())
+    {
+        // Mirror of an application simulated by another rank
+        return;
+    }
     NS_ABORT_MSG_UNLESS(call->GetStartTime() >= Simulator::Now(), "Call start time in the past");
-    Simulator::ScheduleWithContext(GetNode()->GetId(),
-                                   call->GetStartTime() - Simulator::Now(),
-                                   &McpttPttApp::SelectCall,
-                                   this,
-                                   call->GetCallId(),
-                                   call->GetPushOnSelect());
+    EventId selectEvent = Simulator::ScheduleWithContext(GetNode()->GetId(),
+                                                         call->GetStartTime() - Simulator::Now(),
+                                                         &McpttPttApp::SelectCall,
+                                                         this,
+                                                         call->GetCallId(),
+                                                         call->GetPushOnSelect());
     NS_ABORT_MSG_UNLESS(call->GetStopTime() >= Simulator::Now(), "Call stop time in the past");
-    Simulator::ScheduleWithContext(GetNode()->GetId(),
-                                   call->GetStopTime() - Simulator::Now(),
-                                   &McpttPttApp::ReleaseCallByCallId,
-                                   this,
-                                   call->GetCallId());
-    m_calls.insert(std::pair<uint16_t, Ptr<McpttCall>>(call->GetCallId(), call));
+    EventId releaseEvent = Simulator::ScheduleWithContext(GetNode()->GetId(),
+                                                          call->GetStopTime() - Simulator::Now(),
+                                                          &McpttPttApp::ReleaseCallByCallId,
+                                                          this,
+                                                          call->GetCallId());
+    m_callEvents[call->GetCallId()] = std::make_pair(selectEvent, releaseEvent);
+}
+
+void
+McpttPttApp::RecycleCall(uint16_t callId)
+{
+    NS_LOG_FUNCTION(this << callId);
+
+    auto it = FindCall(callId);
+    NS_ABORT_MSG_IF(it == m_calls.end() || it->first != callId,
+                    "No call with ID " << callId << " to recycle");
+    Ptr<McpttCall> call = it->second;
+    NS_ABORT_MSG_IF(call->GetCallMachine() && call->GetCallMachine()->IsCallOngoing(),
+                    "Call " << callId << " is still ongoing");
+
+    auto events = m_callEvents.find(callId);
+    if (events != m_callEvents.end())
+    {
+        events->second.first.Cancel();
+        events->second.second.Cancel();
+        m_callEvents.erase(events);
+    }
+
+    if (call == m_selectedCall)
+    {
+        call->GetCallMachine()->SetNewCallCb(MakeNullCallback<void, uint16_t>());
+        call->GetFloorMachine()->SetFloorGrantedCb(MakeNullCallback<void>());
+        if (m_pusher && m_isRunning)
+        {
+            m_pusher->Stop();
+        }
+        m_selectedCall = nullptr;
+    }
+
+    // A call is only started while its call channel is open
+    if (FindOrderedCall(m_startedCalls, call) != m_startedCalls.end())
+    {
+        call->Stop();
+    }
+    if (call->GetNetworkCallType() == McpttCall::NetworkCallType::ON_NETWORK)
+    {
+        m_sipAgent->SetCallbacks(
+            callId,
+            MakeNullCallback<void,
+                             Ptr<Packet>,
+                             const sip::SipHeader&,
+                             sip::SipAgent::TransactionState>(),
+            MakeNullCallback<void, const char*, sip::SipAgent::TransactionState>());
+    }
+    RemoveGrpCall(call);
+    m_calls.erase(it);
+    auto releasing = m_releasingCalls.find(callId);
+    if (releasing != m_releasingCalls.end())
+    {
+        releasing->second->TraceDisconnectWithoutContext(
+            "StateChangeTrace",
+            MakeCallback(&McpttPttApp::ReleasingCallStateChanged, this));
+        m_releasingCalls.erase(releasing);
+    }
+
+    if (!call->GetCallMachine() || !call->GetFloorMachine())
+    {
+        // Without machines, the call cannot be allocated again
+        call->Dispose();
+        return;
+    }
+    std::vector<Ptr<McpttCall>>& pool =
+        m_callPool[CallPoolKey(call->GetInstanceTypeId(),
+                               call->GetNetworkCallType(),
+                               call->GetCallMachine()->GetInstanceTypeId(),
+                               call->GetFloorMachine()->GetInstanceTypeId())];
+    if (pool.size() < m_maxPooledCalls)
+    {
+        call->Reset();
+        pool.push_back(call);
+    }
+    else
+    {
+        call->Dispose();
+    }
 }
 
 void
@@ -325,15 +547,12 @@ McpttPttApp::HasGrpCallFor(uint32_t grpId)
 {
     NS_LOG_FUNCTION(this << grpId);
 
-    bool found = false;
-    Ptr<McpttCallMachine> callMachine = nullptr;
-
-    for (auto it = m_calls.begin(); it != m_calls.end() && !found; it++)
+    // Every group call is indexed under its group ID
+    if (grpId == 0)
     {
-        callMachine = it->second->GetCallMachine();
-        found = (callMachine->IsGrpCall(grpId));
+        return !m_grpCalls.empty();
     }
-    return found;
+    return m_grpCalls.find(grpId) != m_grpCalls.end();
 }
 
 bool
@@ -341,16 +560,16 @@ McpttPttApp::HasPrivateCallFor(uint32_t userId)
 {
     NS_LOG_FUNCTION(this << userId);
 
-    bool found = false;
-    Ptr<McpttCallMachine> callMachine = nullptr;
-
-    for (auto it = m_calls.begin(); it != m_calls.end() && !found; it++)
+    // The peer of a private call is only known once the call is set up, so
+    // the calls are checked rather than indexed by user ID
+    for (const auto& [callId, call] : m_calls)
     {
-        callMachine = it->second->GetCallMachine();
-        found = (callMachine->IsPrivateCall(userId));
+        if (call->GetCallMachine()->IsPrivateCall(userId))
+        {
+            return true;
+        }
     }
-
-    return found;
+    return false;
 }
 
 void
@@ -389,6 +608,12 @@ McpttPttApp::SessionInitiateRequest()
     // floor control start is handled from the McpttCall or call control
 }
 
+bool
+McpttPttApp::IsLocal() const
+{
+    return GetNode()->GetSystemId() == Simulator::GetSystemId();
+}
+
 bool
 McpttPttApp::IsRunning() const
 {
@@ -453,7 +678,7 @@ McpttPttApp::ReleaseCallByCallId(uint32_t callId)
 {
     NS_LOG_FUNCTION(this << callId);
 
-    Ptr<McpttCall> call = m_calls.find(callId)->second;
+    Ptr<McpttCall> call = GetCall(callId);
     Ptr<McpttCallMachine> callMachine = nullptr;
 
     if (call)
@@ -466,6 +691,29 @@ McpttPttApp::ReleaseCallByCallId(uint32_t callId)
         NS_LOG_DEBUG("Stopping pusher on call ID " << call->GetCallId());
         m_pusher->Stop();
     }
+    // A call without a lifetime is released when it is added, before it is
+    // ever used, so only the calls released at the end of their lifetime are
+    // recycled
+    if (call && m_recycleReleasedCalls && call->GetStopTime() > call->GetStartTime())
+    {
+        if (!callMachine->IsCallOngoing())
+        {
+            Simulator::ScheduleNow(&McpttPttApp::RecycleReleasedCall,
+                                   this,
+                                   call->GetCallId(),
+                                   callMachine);
+        }
+        else if (callMachine->TraceConnectWithoutContext(
+                     "StateChangeTrace",
+                     MakeCallback(&McpttPttApp::ReleasingCallStateChanged, this)))
+        {
+            m_releasingCalls[call->GetCallId()] = callMachine;
+        }
+        else
+        {
+            NS_LOG_LOGIC("Call ID " << call->GetCallId() << " cannot be recycled once released");
+        }
+    }
 }
 
 void
@@ -550,7 +798,7 @@ McpttPttApp::SelectCall(uint32_t callId, bool pushOnSelect)
         }
     }
 
-    newCall = m_calls.find(callId)->second;
+    newCall = GetCall(callId);
     if (newCall)
     {
         newCallId = newCall->GetCallId();
@@ -718,14 +966,26 @@ McpttPttApp::DoDispose()
     SetPusher(nullptr);
     m_selectedCall = nullptr;
     m_callChannels.clear();
-    m_callChannelReferenceCount.clear();
-    for (auto it = m_calls.begin(); it != m_calls.end(); it++)
+    for (auto& [callId, call] : m_calls)
     {
-        it->second->Dispose();
+        call->Dispose();
     }
     m_calls.clear();
-    m_onNetworkCalls.clear();
-    m_offNetworkCalls.clear();
+    for (auto& [callType, pool] : m_callPool)
+    {
+        for (auto& call : pool)
+        {
+            call->Dispose();
+        }
+    }
+    m_callPool.clear();
+    m_callEvents.clear();
+    m_releasingCalls.clear();
+    m_startedCalls.clear();
+    m_grpCalls.clear();
+    m_offNetworkGrpCalls.clear();
+    m_offNetworkBroadcastCalls.clear();
+    m_offNetworkPrivateCalls.clear();
     m_sipAgent->Dispose();
     m_sipAgent = nullptr;
 
@@ -777,31 +1037,31 @@ McpttPttApp::ReceiveOffNetworkCallPacket(Ptr<Packet> pkt, Address from)
     {
         McpttCallMsgGrpProbe probeMsg;
         pkt->PeekHeader(probeMsg);
-        Receive(pkt, probeMsg);
+        ReceiveGrpCallMsg(pkt, probeMsg, probeMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpAnnoun::CODE)
     {
         McpttCallMsgGrpAnnoun grpAnnounMsg;
         pkt->PeekHeader(grpAnnounMsg);
-        Receive(pkt, grpAnnounMsg);
+        ReceiveGrpCallMsg(pkt, grpAnnounMsg, grpAnnounMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpAccept::CODE)
     {
         McpttCallMsgGrpAccept grpAcceptMsg;
         pkt->PeekHeader(grpAcceptMsg);
-        Receive(pkt, grpAcceptMsg);
+        ReceiveGrpCallMsg(pkt, grpAcceptMsg, grpAcceptMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpImmPerilEnd::CODE)
     {
         McpttCallMsgGrpImmPerilEnd grpImmPerilEndMsg;
         pkt->PeekHeader(grpImmPerilEndMsg);
-        Receive(pkt, grpImmPerilEndMsg);
+        ReceiveGrpCallMsg(pkt, grpImmPerilEndMsg, grpImmPerilEndMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpEmergEnd::CODE)
     {
         McpttCallMsgGrpEmergEnd grpEmergEndMsg;
         pkt->PeekHeader(grpEmergEndMsg);
-        Receive(pkt, grpEmergEndMsg);
+        ReceiveGrpCallMsg(pkt, grpEmergEndMsg, grpEmergEndMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpEmergAlert::CODE)
     {
@@ -813,7 +1073,7 @@ McpttPttApp::ReceiveOffNetworkCallPacket(Ptr<Packet> pkt, Address from)
     {
         McpttCallMsgGrpEmergAlertAck grpEmergAlertAckMsg;
         pkt->PeekHeader(grpEmergAlertAckMsg);
-        Receive(pkt, grpEmergAlertAckMsg);
+        ReceiveGrpCallMsg(pkt, grpEmergAlertAckMsg, grpEmergAlertAckMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpEmergAlertCancel::CODE)
     {
@@ -825,73 +1085,75 @@ McpttPttApp::ReceiveOffNetworkCallPacket(Ptr<Packet> pkt, Address from)
     {
         McpttCallMsgGrpEmergAlertCancelAck emergAlertCancelAckMsg;
         pkt->PeekHeader(emergAlertCancelAckMsg);
-        Receive(pkt, emergAlertCancelAckMsg);
+        ReceiveGrpCallMsg(pkt,
+                          emergAlertCancelAckMsg,
+                          emergAlertCancelAckMsg.GetGrpId().GetGrpId());
     }
     else if (code == McpttCallMsgGrpBroadcast::CODE)
     {
         McpttCallMsgGrpBroadcast grpBroadcastMsg;
         pkt->PeekHeader(grpBroadcastMsg);
-        Receive(pkt, grpBroadcastMsg);
+        DeliverCallMsg(pkt, grpBroadcastMsg, m_offNetworkBroadcastCalls);
     }
     else if (code == McpttCallMsgGrpBroadcastEnd::CODE)
     {
         McpttCallMsgGrpBroadcastEnd grpBroadcastEndMsg;
         pkt->PeekHeader(grpBroadcastEndMsg);
-        Receive(pkt, grpBroadcastEndMsg);
+        DeliverCallMsg(pkt, grpBroadcastEndMsg, m_offNetworkBroadcastCalls);
     }
     else if (code == McpttCallMsgPrivateSetupReq::CODE)
     {
         McpttCallMsgPrivateSetupReq privateSetupReqMsg;
         pkt->PeekHeader(privateSetupReqMsg);
-        Receive(pkt, privateSetupReqMsg);
+        DeliverCallMsg(pkt, privateSetupReqMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateRinging::CODE)
     {
         McpttCallMsgPrivateRinging privateRingingMsg;
         pkt->PeekHeader(privateRingingMsg);
-        Receive(pkt, privateRingingMsg);
+        DeliverCallMsg(pkt, privateRingingMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateAccept::CODE)
     {
         McpttCallMsgPrivateAccept privateAcceptMsg;
         pkt->PeekHeader(privateAcceptMsg);
-        Receive(pkt, privateAcceptMsg);
+        DeliverCallMsg(pkt, privateAcceptMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateReject::CODE)
     {
         McpttCallMsgPrivateReject privateRejectMsg;
         pkt->PeekHeader(privateRejectMsg);
-        Receive(pkt, privateRejectMsg);
+        DeliverCallMsg(pkt, privateRejectMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateRelease::CODE)
     {
         McpttCallMsgPrivateRelease privateReleaseMsg;
         pkt->PeekHeader(privateReleaseMsg);
-        Receive(pkt, privateReleaseMsg);
+        DeliverCallMsg(pkt, privateReleaseMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateReleaseAck::CODE)
     {
         McpttCallMsgPrivateReleaseAck privateReleaseAckMsg;
         pkt->PeekHeader(privateReleaseAckMsg);
-        Receive(pkt, privateReleaseAckMsg);
+        DeliverCallMsg(pkt, privateReleaseAckMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateAcceptAck::CODE)
     {
         McpttCallMsgPrivateAcceptAck privateAcceptAckMsg;
         pkt->PeekHeader(privateAcceptAckMsg);
-        Receive(pkt, privateAcceptAckMsg);
+        DeliverCallMsg(pkt, privateAcceptAckMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateEmergCancel::CODE)
     {
         McpttCallMsgPrivateEmergCancel privateEmergCancelMsg;
         pkt->PeekHeader(privateEmergCancelMsg);
-        Receive(pkt, privateEmergCancelMsg);
+        DeliverCallMsg(pkt, privateEmergCancelMsg, m_offNetworkPrivateCalls);
     }
     else if (code == McpttCallMsgPrivateEmergCancelAck::CODE)
     {
         McpttCallMsgPrivateEmergCancelAck privateEmergCancelAckMsg;
         pkt->PeekHeader(privateEmergCancelAckMsg);
-        Receive(pkt, privateEmergCancelAckMsg);
+        DeliverCallMsg(pkt, privateEmergCancelAckMsg, m_offNetworkPrivateCalls);
     }
     else
     {
@@ -904,10 +1166,257 @@ McpttPttApp::Receive(Ptr<Packet> pkt, const McpttCallMsg& msg)
 {
     NS_LOG_FUNCTION(this << &msg);
 
-    for (auto it = m_offNetworkCalls.begin(); it != m_offNetworkCalls.end(); it++)
+    bool delivered = false;
+    for (const auto& call : m_startedCalls)
     {
-        TraceMessageReceive(it->second->GetCallId(), pkt, msg.GetInstanceTypeId());
-        it->second->Receive(msg);
+        if (call->GetNetworkCallType() == McpttCall::NetworkCallType::OFF_NETWORK)
+        {
+            TraceMessageReceive(call->GetCallId(), pkt, msg.GetInstanceTypeId());
+            call->Receive(msg);
+            delivered = true;
+        }
+    }
+    if (!delivered)
+    {
+        ReceiveUnmatchedCallMsg(pkt, msg);
+    }
+}
+
+void
+McpttPttApp::ReceiveGrpCallMsg(Ptr<Packet> pkt, const McpttCallMsg& msg, uint32_t grpId)
+{
+    NS_LOG_FUNCTION(this << &msg << grpId);
+
+    // The basic group call machines discard the messages of other groups,
+    // so only the calls of the addressed group need to see the message
+    auto it = m_offNetworkGrpCalls.find(grpId);
+    if (it == m_offNetworkGrpCalls.end())
+    {
+        ReceiveUnmatchedCallMsg(pkt, msg);
+        return;
+    }
+    DeliverCallMsg(pkt, msg, it->second);
+}
+
+void
+McpttPttApp::ReceiveUnmatchedCallMsg(Ptr<Packet> pkt, const McpttCallMsg& msg)
+{
+    NS_LOG_FUNCTION(this << pkt << &msg);
+
+    NS_LOG_LOGIC("User " << m_userId << " has no call for " << msg.GetInstanceTypeId().GetName()
+                         << "; message ignored.");
+}
+
+void
+McpttPttApp::DeliverCallMsg(Ptr<Packet> pkt,
+                            const McpttCallMsg& msg,
+                            const std::vector<Ptr<McpttCall>>& calls)
+{
+    NS_LOG_FUNCTION(this << pkt << &msg);
+
+    if (calls.empty())
+    {
+        ReceiveUnmatchedCallMsg(pkt, msg);
+        return;
+    }
+
+    for (const auto& call : calls)
+    {
+        TraceMessageReceive(call->GetCallId(), pkt, msg.GetInstanceTypeId());
+        call->Receive(msg);
+    }
+}
+
+McpttPttApp::CallTable::const_iterator
+McpttPttApp::FindCall(uint16_t callId) const
+{
+    return std::lower_bound(m_calls.begin(),
+                            m_calls.end(),
+                            callId,
+                            [](const CallTable::value_type& entry, uint16_t id) {
+                                return entry.first < id;
+                            });
+}
+
+void
+McpttPttApp::RecycleReleasedCall(uint16_t callId, Ptr<McpttCallMachine> callMachine)
+{
+    NS_LOG_FUNCTION(this << callId << callMachine);
+
+    // The trace is disconnected here, rather than from the traced callback
+    callMachine->TraceDisconnectWithoutContext(
+        "StateChangeTrace",
+        MakeCallback(&McpttPttApp::ReleasingCallStateChanged, this));
+    Ptr<McpttCall> call = GetCall(callId);
+    if (call && call->GetCallMachine() == callMachine && !callMachine->IsCallOngoing())
+    {
+        RecycleCall(callId);
+    }
+}
+
+void
+McpttPttApp::ReleasingCallStateChanged(uint32_t userId,
+                                       uint16_t callId,
+                                       const std::string& selected,
+                                       const std::string& typeId,
+                                       const std::string& oldStateName,
+                                       const std::string& newStateName)
+{
+    NS_LOG_FUNCTION(this << userId << callId << selected << typeId << oldStateName
+                         << newStateName);
+
+    auto it = m_releasingCalls.find(callId);
+    if (it != m_releasingCalls.end() && !it->second->IsCallOngoing())
+    {
+        Simulator::ScheduleNow(&McpttPttApp::RecycleReleasedCall, this, callId, it->second);
+        m_releasingCalls.erase(it);
+    }
+}
+
+std::vector<McpttPttApp::CallChannel>::iterator
+McpttPttApp::FindCallChannel(uint16_t port)
+{
+    // An application only has a few call channels, one per call port
+    return std::find_if(m_callChannels.begin(), m_callChannels.end(), [port](const CallChannel& c) {
+        return c.port == port;
+    });
+}
+
+void
+McpttPttApp::AddStartedCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    if (FindOrderedCall(m_startedCalls, call) != m_startedCalls.end())
+    {
+        NS_LOG_LOGIC("Call " << call->GetCallId() << " already started");
+        return;
+    }
+    m_startedCalls.insert(
+        std::upper_bound(m_startedCalls.begin(), m_startedCalls.end(), call, CallIdLess),
+        call);
+
+    if (call->GetNetworkCallType() == McpttCall::NetworkCallType::OFF_NETWORK)
+    {
+        AddOffNetworkCall(call);
+    }
+}
+
+void
+McpttPttApp::RemoveStartedCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    auto pos = FindOrderedCall(m_startedCalls, call);
+    if (pos == m_startedCalls.end())
+    {
+        return;
+    }
+    m_startedCalls.erase(pos);
+
+    if (call->GetNetworkCallType() == McpttCall::NetworkCallType::OFF_NETWORK)
+    {
+        RemoveOffNetworkCall(call);
+    }
+}
+
+void
+McpttPttApp::AddOffNetworkCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    std::vector<Ptr<McpttCall>>* calls = nullptr;
+    Ptr<McpttCallMachine> machine = call->GetCallMachine();
+    if (auto grpMachine = DynamicCast<McpttCallMachineGrpBasic>(machine))
+    {
+        calls = &m_offNetworkGrpCalls[grpMachine->GetGrpId().GetGrpId()];
+    }
+    else if (DynamicCast<McpttCallMachineGrpBroadcast>(machine))
+    {
+        calls = &m_offNetworkBroadcastCalls;
+    }
+    else if (DynamicCast<McpttCallMachinePrivate>(machine))
+    {
+        calls = &m_offNetworkPrivateCalls;
+    }
+    else
+    {
+        // Only the messages delivered to every call reach this call
+        return;
+    }
+
+    // Keep the calls ordered by call ID so the delivery order does not
+    // depend on the order in which the calls were started
+    calls->insert(std::lower_bound(calls->begin(), calls->end(), call, CallIdLess), call);
+}
+
+void
+McpttPttApp::RemoveOffNetworkCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    auto remove = [&call](std::vector<Ptr<McpttCall>>& calls) {
+        calls.erase(std::remove(calls.begin(), calls.end(), call), calls.end());
+    };
+    Ptr<McpttCallMachine> machine = call->GetCallMachine();
+    if (auto grpMachine = DynamicCast<McpttCallMachineGrpBasic>(machine))
+    {
+        // The index follows the changes of the group ID of the call
+        RemoveGrpIndexCall(m_offNetworkGrpCalls, grpMachine->GetGrpId().GetGrpId(), call);
+    }
+    else if (DynamicCast<McpttCallMachineGrpBroadcast>(machine))
+    {
+        remove(m_offNetworkBroadcastCalls);
+    }
+    else if (DynamicCast<McpttCallMachinePrivate>(machine))
+    {
+        remove(m_offNetworkPrivateCalls);
+    }
+}
+
+void
+McpttPttApp::AddGrpCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    Ptr<McpttCallMachineGrp> grpMachine = DynamicCast<McpttCallMachineGrp>(call->GetCallMachine());
+    if (grpMachine && grpMachine->IsGrpCall())
+    {
+        AddGrpIndexCall(m_grpCalls, grpMachine->GetGrpId().GetGrpId(), call);
+    }
+}
+
+void
+McpttPttApp::RemoveGrpCall(Ptr<McpttCall> call)
+{
+    NS_LOG_FUNCTION(this << call);
+
+    Ptr<McpttCallMachineGrp> grpMachine = DynamicCast<McpttCallMachineGrp>(call->GetCallMachine());
+    if (grpMachine)
+    {
+        RemoveGrpIndexCall(m_grpCalls, grpMachine->GetGrpId().GetGrpId(), call);
+    }
+}
+
+void
+McpttPttApp::UpdateGrpCall(Ptr<McpttCall> call, uint32_t oldGrpId)
+{
+    NS_LOG_FUNCTION(this << call << oldGrpId);
+
+    auto pos = FindCall(call->GetCallId());
+    if (pos == m_calls.end() || pos->second != call)
+    {
+        return;
+    }
+    RemoveGrpIndexCall(m_grpCalls, oldGrpId, call);
+    AddGrpCall(call);
+
+    auto grpMachine = DynamicCast<McpttCallMachineGrpBasic>(call->GetCallMachine());
+    if (grpMachine && call->GetNetworkCallType() == McpttCall::NetworkCallType::OFF_NETWORK &&
+        FindOrderedCall(m_startedCalls, call) != m_startedCalls.end())
+    {
+        RemoveGrpIndexCall(m_offNetworkGrpCalls, oldGrpId, call);
+        AddGrpIndexCall(m_offNetworkGrpCalls, grpMachine->GetGrpId().GetGrpId(), call);
     }
 }
 
@@ -979,11 +1488,11 @@ McpttPttApp::OpenCallChannel(uint16_t port,
 
     // Check if a call channel exists to the port.  If so,
     // increase its reference count.  If not, create it.
-    auto it = m_callChannels.find(port);
+    auto it = FindCallChannel(port);
     if (it != m_callChannels.end())
     {
         NS_LOG_DEBUG("Call channel exists for port " << port << "; increment reference count");
-        m_callChannelReferenceCount[it->second]++;
+        it->referenceCount++;
         m_sipAgent->SetCallbacks(call->GetCallId(),
                                  MakeCallback(&McpttCall::ReceiveSipMessage, call),
                                  MakeCallback(&McpttCall::ReceiveSipEvent, call));
@@ -995,7 +1504,7 @@ McpttPttApp::OpenCallChannel(uint16_t port,
         int result = channel->Open(GetNode(), port, GetLocalAddress(), Ipv4Address::GetAny());
         NS_ABORT_MSG_UNLESS(result == 0,
                             "Unable to open call channel on node " << GetNode()->GetId());
-        m_callChannels.emplace(port, channel);
+        m_callChannels.push_back({port, channel, 1});
         if (callType == McpttCall::NetworkCallType::ON_NETWORK)
         {
             // The next two statements do the following.  The McpttChan
@@ -1016,18 +1525,9 @@ McpttPttApp::OpenCallChannel(uint16_t port,
         {
             NS_FATAL_ERROR("Call type unsupported");
         }
-        m_callChannelReferenceCount.emplace(channel, 1);
     }
 
-    // Add this call to the list of on-network or off-network calls, respectively
-    if (callType == McpttCall::NetworkCallType::ON_NETWORK)
-    {
-        m_onNetworkCalls.insert(std::pair<uint16_t, Ptr<McpttCall>>(call->GetCallId(), call));
-    }
-    else if (callType == McpttCall::NetworkCallType::OFF_NETWORK)
-    {
-        m_offNetworkCalls.insert(std::pair<uint16_t, Ptr<McpttCall>>(call->GetCallId(), call));
-    }
+    AddStartedCall(call);
 }
 
 void
@@ -1036,46 +1536,50 @@ McpttPttApp::CloseCallChannel(uint16_t port,
                               McpttCall::NetworkCallType callType)
 {
     NS_LOG_FUNCTION(port << call << callType);
-    auto it = m_callChannels.find(port);
+    auto it = FindCallChannel(port);
     if (it != m_callChannels.end())
     {
-        if (m_callChannelReferenceCount[it->second] == 1)
+        if (it->referenceCount == 1)
         {
             NS_LOG_DEBUG("Closing call channel");
-            it->second->Close();
-            it->second->SetRxPktCb(MakeNullCallback<void, Ptr<Packet>, Address>());
-            m_callChannelReferenceCount.erase(it->second);
+            it->channel->Close();
+            it->channel->SetRxPktCb(MakeNullCallback<void, Ptr<Packet>, Address>());
             m_callChannels.erase(it);
         }
         else
         {
             NS_LOG_DEBUG("Decrementing reference count on the call channel");
-            m_callChannelReferenceCount[it->second]--;
+            it->referenceCount--;
         }
     }
-    // Remove call from the list of on-network or off-network calls, respectively
-    if (callType == McpttCall::NetworkCallType::ON_NETWORK)
-    {
-        m_onNetworkCalls.erase(call->GetCallId());
-    }
-    else if (callType == McpttCall::NetworkCallType::OFF_NETWORK)
-    {
-        m_offNetworkCalls.erase(call->GetCallId());
-    }
+    RemoveStartedCall(call);
 }
 
 Ptr<McpttChannel>
 McpttPttApp::GetCallChannel(uint16_t port) const
 {
-    auto it = m_callChannels.find(port);
-    if (it != m_callChannels.end())
+    for (const auto& callChannel : m_callChannels)
+    {
+        if (callChannel.port == port)
+        {
+            return callChannel.channel;
+        }
+    }
+    return nullptr;
+}
+
+Ptr<McpttCall>
+McpttPttApp::GetCall(uint16_t callId) const
+{
+    auto it = FindCall(callId);
+    if (it != m_calls.end() && it->first == callId)
     {
         return it->second;
     }
     return nullptr;
 }
 
-std::map<uint16_t, Ptr<McpttCall>>
+const McpttPttApp::CallTable&
 McpttPttApp::GetCalls() const
 {
     return m_calls;
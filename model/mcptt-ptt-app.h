@@ -40,6 +40,7 @@
 
 #include <ns3/application.h>
 #include <ns3/callback.h>
+#include <ns3/event-id.h>
 #include <ns3/header.h>
 #include <ns3/packet.h>
 #include <ns3/ptr.h>
@@ -49,6 +50,10 @@
 #include <ns3/vector.h>
 
 #include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -113,9 +118,20 @@ class McpttPttApp : public Application, public McpttMediaSink
     static uint16_t GetCurrentMediaPortNumber();
     /**
      * Gets the next port number to use.
+     *
+     * This is the allocation used by the call machines while the simulation
+     * runs. In a distributed simulation the ranks do not share the counter, so
+     * each rank only uses one of every SetPortAllocationStride() ports,
+     * offset by its system ID, which keeps the ports unique across ranks.
      * \returns The next port number.
      */
     static uint16_t AllocateNextPortNumber();
+    /**
+     * Sets the stride of the port allocation of AllocateNextPortNumber(),
+     * which must be the number of ranks of a distributed simulation.
+     * \param stride The number of ranks (at least 1, the default).
+     */
+    static void SetPortAllocationStride(uint16_t stride);
     /**
      * Gets the next media port number to use.
      * \returns The next media port number.
@@ -171,12 +187,44 @@ class McpttPttApp : public Application, public McpttMediaSink
                                       ObjectFactory& floorFac,
                                       McpttCall::NetworkCallType callType,
                                       uint16_t callId);
+    /**
+     * Allocates a call for the given machines, without adding it to this
+     * application. A released call with the same network call type and
+     * machine types is taken from the pool, with its channels, if there is
+     * one; otherwise, a new call is created with new channels. Only the call
+     * and its channels are reused; the given machines are always new.
+     * \param callType The type of network call (e.g. on-network)
+     * \param callMachine The call machine of the call.
+     * \param floorMachine The floor machine of the call.
+     * \return pointer to the call
+     */
+    Ptr<McpttCall> AllocateCall(McpttCall::NetworkCallType callType,
+                                Ptr<McpttCallMachine> callMachine,
+                                Ptr<McpttFloorParticipant> floorMachine);
     /**
      * Adds a previously created call to the container of calls on this
      * application instance.
      * \param call The call to add
      */
     void AddCall(Ptr<McpttCall> call);
+    /**
+     * Removes a call that is no longer ongoing from this application, and
+     * returns it to the pool of the calls with the same type, network call
+     * type and machine types, or disposes of it if that pool is full. Its
+     * call and floor machines are disposed of, not pooled; the next call
+     * allocated with new machines of the same types reuses only the pooled
+     * call and its channels.
+     * The pending selection and release of the call, if any, are cancelled.
+     * \param callId The ID of the call.
+     */
+    void RecycleCall(uint16_t callId);
+    /**
+     * Updates the index of the group calls after the call machine of a call
+     * of this application changed its group ID.
+     * \param call The call.
+     * \param oldGrpId The previous group ID of the call.
+     */
+    void UpdateGrpCall(Ptr<McpttCall> call, uint32_t oldGrpId);
     /**
      * Downgrades the call type.
      */
@@ -188,7 +236,7 @@ class McpttPttApp : public Application, public McpttMediaSink
     virtual Vector GetNodeLoc() const;
     /**
      * Indicates if there is an existing group call.
-     * \param grpId The group ID of the call to check for.
+     * \param grpId The group ID of the call to check for, or 0 for any group.
      * \returns True, if there is an existing group call; otherwise, false.
      */
     virtual bool HasGrpCallFor(uint32_t grpId);
@@ -206,6 +254,12 @@ class McpttPttApp : public Application, public McpttMediaSink
      * Process an MCPTT session initiate request received from call control.
      */
     virtual void SessionInitiateRequest();
+    /**
+     * Indicates whether the node of the application is simulated by this
+     * process, which is always the case unless the simulation is distributed.
+     * \returns True, if the application is local.
+     */
+    bool IsLocal() const;
     /**
      * Indicates whether or not the application is running
      * \returns True, if the application is running.
@@ -326,6 +380,21 @@ class McpttPttApp : public Application, public McpttMediaSink
      * \param msg The message that was received.
      */
     virtual void Receive(Ptr<Packet> pkt, const McpttCallMsg& msg);
+    /**
+     * Distributes a received off-network call control packet to the basic
+     * group calls of the group that the message is addressed to.
+     * \param pkt The call control packet that was received.
+     * \param msg The message that was received.
+     * \param grpId The group ID carried by the message.
+     */
+    virtual void ReceiveGrpCallMsg(Ptr<Packet> pkt, const McpttCallMsg& msg, uint32_t grpId);
+    /**
+     * Handles a received off-network call control packet that is not addressed
+     * to any of the calls of this application.
+     * \param pkt The call control packet that was received.
+     * \param msg The message that was received.
+     */
+    virtual void ReceiveUnmatchedCallMsg(Ptr<Packet> pkt, const McpttCallMsg& msg);
     /**
      * Starts the McpttPttApp application.
      */
@@ -357,17 +426,39 @@ class McpttPttApp : public Application, public McpttMediaSink
                                         const std::string& selected,
                                         const char* event);
 
+  public:
+    /**
+     * The container of calls, as (call ID, call) pairs ordered by call ID.
+     */
+    typedef std::vector<std::pair<uint16_t, Ptr<McpttCall>>> CallTable;
+
   private:
+    /**
+     * A call channel, with the number of calls that use it.
+     */
+    struct CallChannel
+    {
+        uint16_t port;             //!< The local port of the channel.
+        Ptr<McpttChannel> channel; //!< The channel.
+        uint32_t referenceCount;   //!< The number of calls that use the channel.
+    };
+
     static uint16_t s_mediaPortNumber;                    //!< Media port number.
     static uint16_t s_floorPortNumber;                    //!< Floor port number.
+    static uint16_t s_portStride;                         //!< Stride of the runtime ports.
     bool m_isRunning;                                     //!< Whether application is running or not
     uint16_t m_callIdAllocator;                           //!< Counter to allocate call IDs
-    std::map<uint16_t, Ptr<McpttChannel>> m_callChannels; //!< Map of call channels
-    std::map<Ptr<McpttChannel>, uint32_t>
-        m_callChannelReferenceCount;                      //!< Reference count for call channels
-    std::map<uint16_t, Ptr<McpttCall>> m_calls;           //!< The container of all calls.
-    std::map<uint16_t, Ptr<McpttCall>> m_onNetworkCalls;  //!< The container of on-network calls.
-    std::map<uint16_t, Ptr<McpttCall>> m_offNetworkCalls; //!< The container of off-network calls.
+    std::vector<CallChannel> m_callChannels;              //!< The open call channels.
+    CallTable m_calls;                                    //!< The container of all calls.
+    std::vector<Ptr<McpttCall>>
+        m_startedCalls; //!< The calls with an open call channel, ordered by call ID.
+    std::map<uint32_t, std::vector<Ptr<McpttCall>>>
+        m_grpCalls; //!< The group calls, indexed by group ID.
+    std::map<uint32_t, std::vector<Ptr<McpttCall>>>
+        m_offNetworkGrpCalls; //!< The off-network basic group calls, indexed by group ID.
+    std::vector<Ptr<McpttCall>>
+        m_offNetworkBroadcastCalls; //!< The off-network broadcast group calls.
+    std::vector<Ptr<McpttCall>> m_offNetworkPrivateCalls; //!< The off-network private calls.
     Callback<void> m_floorGrantedCb;                      //!< The floor granted callback.
     Address m_localAddress;                               //!< The local IP address.
     Ptr<sip::SipAgent> m_sipAgent;                        //!< SIP user agent
@@ -387,6 +478,101 @@ class McpttPttApp : public Application, public McpttMediaSink
     TracedCallback<uint32_t, uint16_t, const std::string&, const char*>
         m_eventTrace; //!< Event trace
 
+    /**
+     * The key of a pool of released calls: the type of the call, its network
+     * call type, and the types of its call and floor machines.
+     */
+    typedef std::tuple<TypeId, McpttCall::NetworkCallType, TypeId, TypeId> CallPoolKey;
+
+    uint32_t m_maxPooledCalls;   //!< The maximum number of released calls kept per pool.
+    bool m_recycleReleasedCalls; //!< Whether the calls released at their stop time are recycled.
+    std::map<CallPoolKey, std::vector<Ptr<McpttCall>>>
+        m_callPool; //!< The released calls kept for reuse.
+    std::map<uint16_t, std::pair<EventId, EventId>>
+        m_callEvents; //!< The pending selection and release of each call.
+    std::map<uint16_t, Ptr<McpttCallMachine>>
+        m_releasingCalls; //!< The call machines of the released calls still ongoing.
+
+    /**
+     * Finds a call in the container of calls.
+     * \param callId The ID of the call.
+     * \returns The position of the call, or of the next call if there is no
+     *          call with the ID.
+     */
+    CallTable::const_iterator FindCall(uint16_t callId) const;
+    /**
+     * Recycles a released call once it is no longer ongoing, if it is still
+     * the call with the given call machine.
+     * \param callId The ID of the call.
+     * \param callMachine The call machine of the released call.
+     */
+    void RecycleReleasedCall(uint16_t callId, Ptr<McpttCallMachine> callMachine);
+    /**
+     * Receives the state changes of the call machines of the released calls
+     * that were still ongoing, to recycle them once they are no longer.
+     * \param userId The MCPTT user ID.
+     * \param callId The ID of the call.
+     * \param selected Whether the call is selected.
+     * \param typeId The type ID of the machine.
+     * \param oldStateName The name of the old state.
+     * \param newStateName The name of the new state.
+     */
+    void ReleasingCallStateChanged(uint32_t userId,
+                                   uint16_t callId,
+                                   const std::string& selected,
+                                   const std::string& typeId,
+                                   const std::string& oldStateName,
+                                   const std::string& newStateName);
+    /**
+     * Finds a call channel.
+     * \param port The local port of the channel.
+     * \returns The position of the channel, or the end of the container.
+     */
+    std::vector<CallChannel>::iterator FindCallChannel(uint16_t port);
+    /**
+     * Adds a call whose call channel has been opened to the started calls and
+     * to the indexes of the started calls.
+     * \param call The call.
+     */
+    void AddStartedCall(Ptr<McpttCall> call);
+    /**
+     * Removes a call whose call channel has been closed from the started calls
+     * and from the indexes of the started calls.
+     * \param call The call.
+     */
+    void RemoveStartedCall(Ptr<McpttCall> call);
+    /**
+     * Adds an off-network call to the containers used to demultiplex the
+     * received call control messages.
+     * \param call The call.
+     */
+    void AddOffNetworkCall(Ptr<McpttCall> call);
+    /**
+     * Removes an off-network call from the containers used to demultiplex the
+     * received call control messages.
+     * \param call The call.
+     */
+    void RemoveOffNetworkCall(Ptr<McpttCall> call);
+    /**
+     * Adds a call to the index of the group calls, if it is a group call.
+     * \param call The call.
+     */
+    void AddGrpCall(Ptr<McpttCall> call);
+    /**
+     * Removes a call from the index of the group calls.
+     * \param call The call.
+     */
+    void RemoveGrpCall(Ptr<McpttCall> call);
+    /**
+     * Delivers a received off-network call control message to the given calls.
+     * \param pkt The call control packet that was received.
+     * \param msg The message that was received.
+     * \param calls The calls to deliver the message to.
+     */
+    void DeliverCallMsg(Ptr<Packet> pkt,
+                        const McpttCallMsg& msg,
+                        const std::vector<Ptr<McpttCall>>& calls);
+
   public:
     /**
      * Open a call control channel to listen on the provided port, if not already open
@@ -411,10 +597,17 @@ class McpttPttApp : public Application, public McpttMediaSink
      */
     virtual Ptr<McpttChannel> GetCallChannel(uint16_t port) const;
     /**
-     * Gets the container of calls.
-     * \returns The container of calls.
+     * Gets a call.
+     * \param callId The ID of the call.
+     * \returns The call, or a null pointer if there is no call with the ID.
+     */
+    Ptr<McpttCall> GetCall(uint16_t callId) const;
+    /**
+     * Gets the container of calls, without copying it. The container is
+     * only valid until a call is added or removed.
+     * \returns The container of calls, ordered by call ID.
      */
-    virtual std::map<uint16_t, Ptr<McpttCall>> GetCalls() const;
+    virtual const CallTable& GetCalls() const;
     /**
      * Gets the local address.
      * \returns The local address.
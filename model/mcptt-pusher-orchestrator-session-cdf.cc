@@ -32,6 +32,7 @@
 #include "mcptt-pusher-orchestrator-session-cdf.h"
 
 #include "mcptt-pusher.h"
+#include "psc-cdf-random-variable.h"
 
 #include <ns3/log.h>
 #include <ns3/pointer.h>
@@ -218,6 +219,24 @@ const std::vector<std::pair<double, double>> McpttPusherOrchestratorSessionCdf::
 
 const double McpttPusherOrchestratorSessionCdf::CDF_POINTS_AVG = 8.58;
 
+namespace
+{
+
+/**
+ * Gets the table built from the CDF points, which is shared by all instances.
+ * \returns The table.
+ */
+Ptr<const PscCdfTable>
+GetCdfTable()
+{
+    static Ptr<const PscCdfTable> table =
+        Create<PscCdfTable>(McpttPusherOrchestratorSessionCdf::CDF_POINTS);
+
+    return table;
+}
+
+} // namespace
+
 TypeId
 McpttPusherOrchestratorSessionCdf::GetTypeId()
 {
@@ -259,15 +278,13 @@ McpttPusherOrchestratorSessionCdf::McpttPusherOrchestratorSessionCdf()
     : McpttPusherOrchestratorInterface(),
       m_avgSessionDuration(CDF_POINTS_AVG),
       m_nextEvent(EventId()),
-      m_sessionDurationVariable(CreateObject<EmpiricalRandomVariable>()),
       m_sessionIatVariable(CreateObject<ExponentialRandomVariable>())
 {
     NS_LOG_FUNCTION(this);
 
-    for (uint32_t i = 0; i < CDF_POINTS.size(); i++)
-    {
-        m_sessionDurationVariable->CDF(CDF_POINTS[i].first, CDF_POINTS[i].second);
-    }
+    Ptr<PscCdfRandomVariable> sessionDurationVariable = CreateObject<PscCdfRandomVariable>();
+    sessionDurationVariable->SetTable(GetCdfTable());
+    m_sessionDurationVariable = sessionDurationVariable;
 }
 
 McpttPusherOrchestratorSessionCdf::~McpttPusherOrchestratorSessionCdf()
@@ -298,7 +315,7 @@ McpttPusherOrchestratorSessionCdf::AssignStreams(int64_t stream)
 }
 
 void
-McpttPusherOrchestratorSessionCdf::ChangeCdf(Ptr<EmpiricalRandomVariable> sessionDurationVariable,
+McpttPusherOrchestratorSessionCdf::ChangeCdf(Ptr<RandomVariableStream> sessionDurationVariable,
                                              double avgSessionDuration)
 {
     NS_LOG_FUNCTION(this << sessionDurationVariable << avgSessionDuration);
@@ -95,10 +95,11 @@ class McpttPusherOrchestratorSessionCdf : public McpttPusherOrchestratorInterfac
     int64_t AssignStreams(int64_t stream) override;
     /**
      * Changes the CDF used for the call session.
-     * \param sessionDurationVariable The ECDF to use for session durations.
+     * \param sessionDurationVariable The ECDF to use for session durations, such as an
+     * EmpiricalRandomVariable or a PscCdfRandomVariable.
      * \param avgSessionDuration The average produced by the ECDF.
      */
-    virtual void ChangeCdf(Ptr<EmpiricalRandomVariable> sessionDurationVariable,
+    virtual void ChangeCdf(Ptr<RandomVariableStream> sessionDurationVariable,
                            double avgSessionDuration);
     /**
      * \brief Gets the set of orchestrated pushers.
@@ -152,7 +153,7 @@ class McpttPusherOrchestratorSessionCdf : public McpttPusherOrchestratorInterfac
     double m_avgSessionDuration;                            //!< The average duration of a session.
     EventId m_nextEvent;                                    //!< The next event.
     Ptr<McpttPusherOrchestratorInterface> m_orchestrator;   //!< The underlying orchestrator.
-    Ptr<EmpiricalRandomVariable> m_sessionDurationVariable; //!< Duration of a session.
+    Ptr<RandomVariableStream> m_sessionDurationVariable;    //!< Duration of a session.
     Ptr<ExponentialRandomVariable> m_sessionIatVariable;    //!< Interarrival time of sesssions.
     TracedCallback<Time> m_sessionIatTrace;      //!< The session interarrival time trace.
     TracedCallback<Time> m_sessionDurationTrace; //!< The session duration trace.
@@ -32,6 +32,7 @@
 #include "mcptt-pusher-orchestrator-spurt-cdf.h"
 
 #include "mcptt-pusher.h"
+#include "psc-cdf-random-variable.h"
 
 #include <ns3/log.h>
 #include <ns3/pointer.h>
@@ -291,6 +292,24 @@ const std::vector<std::pair<double, double>> McpttPusherOrchestratorSpurtCdf::CD
 
 const double McpttPusherOrchestratorSpurtCdf::CDF_POINTS_AVG = 4.69;
 
+namespace
+{
+
+/**
+ * Gets the table built from the CDF points, which is shared by all instances.
+ * \returns The table.
+ */
+Ptr<const PscCdfTable>
+GetCdfTable()
+{
+    static Ptr<const PscCdfTable> table =
+        Create<PscCdfTable>(McpttPusherOrchestratorSpurtCdf::CDF_POINTS);
+
+    return table;
+}
+
+} // namespace
+
 TypeId
 McpttPusherOrchestratorSpurtCdf::GetTypeId()
 {
@@ -316,13 +335,9 @@ McpttPusherOrchestratorSpurtCdf::McpttPusherOrchestratorSpurtCdf()
     NS_LOG_FUNCTION(this);
 
     Ptr<ExponentialRandomVariable> pttIatVariable = CreateObject<ExponentialRandomVariable>();
-    Ptr<EmpiricalRandomVariable> pttDurationVariable = CreateObject<EmpiricalRandomVariable>();
+    Ptr<PscCdfRandomVariable> pttDurationVariable = CreateObject<PscCdfRandomVariable>();
     pttDurationVariable->SetInterpolate(true);
-
-    for (uint32_t i = 0; i < CDF_POINTS.size(); i++)
-    {
-        pttDurationVariable->CDF(CDF_POINTS[i].first, CDF_POINTS[i].second);
-    }
+    pttDurationVariable->SetTable(GetCdfTable());
 
     m_orchestrator->SetAttribute("PttDurationVariable", PointerValue(pttDurationVariable));
     m_orchestrator->SetAttribute("PttInterarrivalTimeVariable", PointerValue(pttIatVariable));
@@ -356,7 +371,7 @@ McpttPusherOrchestratorSpurtCdf::AssignStreams(int64_t stream)
 }
 
 void
-McpttPusherOrchestratorSpurtCdf::ChangeCdf(Ptr<EmpiricalRandomVariable> pttDurationVariable,
+McpttPusherOrchestratorSpurtCdf::ChangeCdf(Ptr<RandomVariableStream> pttDurationVariable,
                                            double avgPttDuration)
 {
     NS_LOG_FUNCTION(this << pttDurationVariable << avgPttDuration);
@@ -92,11 +92,12 @@ class McpttPusherOrchestratorSpurtCdf : public McpttPusherOrchestratorInterface
     int64_t AssignStreams(int64_t stream) override;
     /**
      * \brief Changes the ECDF and updates the average obtained with that CDF.
-     * \param pttDurationVariable The new variable to use for selecting PTT durations.
+     * \param pttDurationVariable The new variable to use for selecting PTT durations,
+     * such as an EmpiricalRandomVariable or a PscCdfRandomVariable.
      * \param avgPttDuration The average value of the PTT durations obtained from the ECDF being
      * provided.
      */
-    virtual void ChangeCdf(Ptr<EmpiricalRandomVariable> pttDurationVariable, double avgPttDuration);
+    virtual void ChangeCdf(Ptr<RandomVariableStream> pttDurationVariable, double avgPttDuration);
     /**
      * \brief Gets the set of orchestrated pushers.
      * \returns The set of pushers.
@@ -0,0 +1,260 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "psc-cdf-random-variable.h"
+
+#include <ns3/abort.h>
+#include <ns3/boolean.h>
+#include <ns3/log.h>
+#include <ns3/rng-stream.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PscCdfRandomVariable");
+
+namespace psc
+{
+
+NS_OBJECT_ENSURE_REGISTERED(PscCdfRandomVariable);
+
+PscCdfTable::PscCdfTable(const std::vector<std::pair<double, double>>& points)
+{
+    NS_LOG_FUNCTION(this << points.size());
+
+    NS_ABORT_MSG_IF(points.empty(), "The CDF must have at least one point.");
+
+    m_points.reserve(points.size());
+    for (const auto& point : points)
+    {
+        NS_ABORT_MSG_IF(point.second < 0 || point.second > 1,
+                        "CDF probability " << point.second << " is outside of [0, 1].");
+        m_points.push_back({point.second, point.first});
+    }
+
+    // Keep the last point provided for each probability, as
+    // EmpiricalRandomVariable does (it overwrites the value of a probability).
+    std::stable_sort(m_points.begin(), m_points.end(), [](const Point& a, const Point& b) {
+        return a.cdf < b.cdf;
+    });
+    auto first = std::unique(m_points.rbegin(),
+                             m_points.rend(),
+                             [](const Point& a, const Point& b) { return a.cdf == b.cdf; });
+    m_points.erase(m_points.begin(), first.base());
+    m_points.shrink_to_fit();
+
+    for (std::size_t i = 1; i < m_points.size(); i++)
+    {
+        NS_ABORT_MSG_IF(m_points[i].value < m_points[i - 1].value,
+                        "CDF value " << m_points[i].value << " at probability "
+                                     << m_points[i].cdf << " is smaller than the previous one.");
+    }
+    NS_ABORT_MSG_IF(m_points.back().cdf != 1, "The last CDF probability must be 1.");
+
+    // One grid cell per point keeps the expected number of points per cell
+    // below one, independently of how the probabilities are spread.
+    m_guide.resize(m_points.size());
+    uint32_t index = 0;
+    for (std::size_t cell = 0; cell < m_guide.size(); cell++)
+    {
+        double start = static_cast<double>(cell) / m_guide.size();
+        while (index < m_points.size() && m_points[index].cdf <= start)
+        {
+            index++;
+        }
+        m_guide[cell] = index;
+    }
+}
+
+double
+PscCdfTable::Sample(double r, bool interpolate) const
+{
+    if (r <= m_points.front().cdf)
+    {
+        return m_points.front().value;
+    }
+    if (r >= m_points.back().cdf)
+    {
+        return m_points.back().value;
+    }
+
+    // Find the first point above r, starting from the guide entry of the cell
+    // containing r. Since the last probability is 1 and r is below it, the
+    // forward scan always stops inside the table.
+    auto cell = std::min(static_cast<std::size_t>(r * m_guide.size()), m_guide.size() - 1);
+    std::size_t upper = m_guide[cell];
+    while (upper > 0 && m_points[upper - 1].cdf > r)
+    {
+        upper--; // Only reachable through rounding of the cell index
+    }
+    while (m_points[upper].cdf <= r)
+    {
+        upper++;
+    }
+
+    if (!interpolate)
+    {
+        return m_points[upper].value;
+    }
+
+    const Point& lo = m_points[upper - 1];
+    const Point& hi = m_points[upper];
+    return lo.value + ((hi.value - lo.value) / (hi.cdf - lo.cdf)) * (r - lo.cdf);
+}
+
+std::size_t
+PscCdfTable::GetSize() const
+{
+    return m_points.size();
+}
+
+double
+PscCdfTable::GetMin() const
+{
+    return m_points.front().value;
+}
+
+double
+PscCdfTable::GetMax() const
+{
+    return m_points.back().value;
+}
+
+TypeId
+PscCdfRandomVariable::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::psc::PscCdfRandomVariable")
+            .SetParent<RandomVariableStream>()
+            .AddConstructor<PscCdfRandomVariable>()
+            .AddAttribute("Interpolate",
+                          "Treat the CDF as a smooth distribution and interpolate between points.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PscCdfRandomVariable::m_interpolate),
+                          MakeBooleanChecker());
+
+    return tid;
+}
+
+PscCdfRandomVariable::PscCdfRandomVariable()
+    : RandomVariableStream(),
+      m_interpolate(false),
+      m_table(nullptr)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PscCdfRandomVariable::~PscCdfRandomVariable()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+PscCdfRandomVariable::CDF(double v, double c)
+{
+    NS_LOG_FUNCTION(this << v << c);
+
+    m_points.emplace_back(v, c);
+    m_table = nullptr;
+}
+
+void
+PscCdfRandomVariable::SetTable(Ptr<const PscCdfTable> table)
+{
+    NS_LOG_FUNCTION(this << table);
+
+    m_points.clear();
+    m_table = table;
+}
+
+Ptr<const PscCdfTable>
+PscCdfRandomVariable::GetTable()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_table)
+    {
+        m_table = Create<PscCdfTable>(m_points);
+    }
+
+    return m_table;
+}
+
+bool
+PscCdfRandomVariable::SetInterpolate(bool interpolate)
+{
+    NS_LOG_FUNCTION(this << interpolate);
+
+    bool prev = m_interpolate;
+    m_interpolate = interpolate;
+
+    return prev;
+}
+
+double
+PscCdfRandomVariable::GetValue()
+{
+    if (!m_table)
+    {
+        GetTable();
+    }
+
+    double r = Peek()->RandU01();
+    if (IsAntithetic())
+    {
+        r = (1 - r);
+    }
+
+    return m_table->Sample(r, m_interpolate);
+}
+
+uint32_t
+PscCdfRandomVariable::GetInteger()
+{
+    return static_cast<uint32_t>(GetValue());
+}
+
+void
+PscCdfRandomVariable::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_points.clear();
+    m_table = nullptr;
+
+    RandomVariableStream::DoDispose();
+}
+
+} // namespace psc
+} // namespace ns3
@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef PSC_CDF_RANDOM_VARIABLE_H
+#define PSC_CDF_RANDOM_VARIABLE_H
+
+#include <ns3/ptr.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/simple-ref-count.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ *
+ * Immutable, flat representation of an empirical CDF that supports inverse
+ * transform sampling in expected constant time.
+ *
+ * The points of the CDF are stored sorted by probability in a single
+ * contiguous array. Next to it, a uniform-grid guide table stores, for each
+ * of N equally sized probability cells, the index of the first point whose
+ * probability is greater than the start of the cell. A lookup therefore
+ * starts at the guide entry of the cell that contains the uniform draw and,
+ * on average, needs less than two comparisons to find the bracketing points,
+ * instead of the binary search over a tree performed by
+ * ns3::EmpiricalRandomVariable.
+ *
+ * The results are the same as the ones of ns3::EmpiricalRandomVariable for
+ * the same uniform draw, both with and without interpolation.
+ *
+ * A table holds no random number generator and is never modified after being
+ * built, so it can be shared by any number of PscCdfRandomVariable instances.
+ */
+class PscCdfTable : public SimpleRefCount<PscCdfTable>
+{
+  public:
+    /**
+     * Builds the table from a collection of CDF points.
+     *
+     * The points do not need to be sorted. If more than one point is provided
+     * for the same probability, only the last one is kept. The simulation is
+     * aborted if the probabilities are outside of [0, 1], if the values are
+     * not non-decreasing with the probability, or if the last probability is
+     * not 1.
+     *
+     * \param points The CDF points, as (value, probability) pairs.
+     */
+    PscCdfTable(const std::vector<std::pair<double, double>>& points);
+    /**
+     * Gets the value associated with a given probability.
+     * \param r The probability, in [0, 1].
+     * \param interpolate If true, the value is linearly interpolated between the
+     * two points bracketing the probability, otherwise the value of the upper
+     * point is returned.
+     * \returns The value.
+     */
+    double Sample(double r, bool interpolate) const;
+    /**
+     * Gets the number of points of the CDF.
+     * \returns The number of points.
+     */
+    std::size_t GetSize() const;
+    /**
+     * Gets the smallest value of the CDF.
+     * \returns The smallest value.
+     */
+    double GetMin() const;
+    /**
+     * Gets the largest value of the CDF.
+     * \returns The largest value.
+     */
+    double GetMax() const;
+
+  private:
+    /**
+     * A point of the CDF.
+     */
+    struct Point
+    {
+        double cdf;   //!< The cumulative probability.
+        double value; //!< The value.
+    };
+
+    std::vector<Point> m_points;  //!< The CDF points, sorted by probability.
+    std::vector<uint32_t> m_guide; //!< The index of the first point above each grid cell.
+};
+
+/**
+ * \ingroup psc
+ *
+ * Random variable drawing values from an empirical CDF through a shared
+ * PscCdfTable.
+ *
+ * This class is a drop-in replacement of ns3::EmpiricalRandomVariable: the
+ * CDF can be provided point by point through CDF (), in which case a private
+ * table is built on the first draw, or an existing table can be attached
+ * through SetTable (), in which case the table is shared and the only state
+ * owned by the variable is its random number stream. Being a
+ * ns3::RandomVariableStream, the stream can be fixed with SetStream () and
+ * through the AssignStreams () methods of the objects using it.
+ */
+class PscCdfRandomVariable : public RandomVariableStream
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    /**
+     * \brief Creates an instance of the PscCdfRandomVariable class.
+     */
+    PscCdfRandomVariable();
+    /**
+     * \brief The destructor of the PscCdfRandomVariable class.
+     */
+    ~PscCdfRandomVariable() override;
+    /**
+     * Adds a point to the CDF. Adding points discards the current table, if
+     * any, and a new one will be built on the next draw.
+     * \param v The value.
+     * \param c The cumulative probability of the value.
+     */
+    void CDF(double v, double c);
+    /**
+     * Sets the table to draw values from.
+     * \param table The table.
+     */
+    void SetTable(Ptr<const PscCdfTable> table);
+    /**
+     * Gets the table values are drawn from, building it if needed.
+     * \returns The table.
+     */
+    Ptr<const PscCdfTable> GetTable();
+    /**
+     * Sets the interpolation mode.
+     * \param interpolate If true, values are interpolated between CDF points.
+     * \returns The previous interpolation mode.
+     */
+    bool SetInterpolate(bool interpolate);
+    /**
+     * Draws a value from the CDF.
+     * \returns The value.
+     */
+    double GetValue() override;
+    /**
+     * Draws a value from the CDF and truncates it to an integer.
+     * \returns The value.
+     */
+    uint32_t GetInteger() override;
+
+  protected:
+    /**
+     * Disposes of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    bool m_interpolate;                              //!< The interpolation mode.
+    std::vector<std::pair<double, double>> m_points; //!< The points added through CDF ().
+    Ptr<const PscCdfTable> m_table;                  //!< The table to sample from.
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif /* PSC_CDF_RANDOM_VARIABLE_H */
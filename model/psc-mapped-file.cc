@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "psc-mapped-file.h"
+
+#include <ns3/abort.h>
+#include <ns3/log.h>
+
+#ifdef __WIN32__
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PscMappedFile");
+
+namespace psc
+{
+
+PscMappedFile::PscMappedFile(const std::string& filePath)
+    : m_path(filePath),
+      m_data(nullptr),
+      m_size(0)
+{
+    NS_LOG_FUNCTION(this << filePath);
+
+#ifndef __WIN32__
+    int fd = open(filePath.c_str(), O_RDONLY);
+    NS_ABORT_MSG_IF(fd < 0, "Cannot open file " + filePath);
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) < 0)
+    {
+        close(fd);
+        NS_ABORT_MSG("Cannot get the size of file " + filePath);
+    }
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+
+    if (m_size > 0)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            NS_ABORT_MSG("Cannot map file " + filePath);
+        }
+        m_data = static_cast<const uint8_t*>(data);
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+#else
+    std::ifstream fin(filePath.c_str(), std::ios::binary);
+    NS_ABORT_MSG_IF(!fin.is_open(), "Cannot open file " + filePath);
+    m_buffer.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    m_size = m_buffer.size();
+    m_data = m_buffer.empty() ? nullptr : m_buffer.data();
+#endif
+
+    NS_LOG_DEBUG("Mapped " << m_size << " bytes of " << filePath);
+}
+
+PscMappedFile::~PscMappedFile()
+{
+    NS_LOG_FUNCTION(this);
+
+#ifndef __WIN32__
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+const std::string&
+PscMappedFile::GetPath() const
+{
+    return m_path;
+}
+
+const uint8_t*
+PscMappedFile::GetData() const
+{
+    return m_data;
+}
+
+std::size_t
+PscMappedFile::GetSize() const
+{
+    return m_size;
+}
+
+} // namespace psc
+} // namespace ns3
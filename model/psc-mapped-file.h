@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef PSC_MAPPED_FILE_H
+#define PSC_MAPPED_FILE_H
+
+#include <ns3/simple-ref-count.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ *
+ * Read-only view of the contents of a file, mapped into memory.
+ *
+ * The file is mapped when the object is created and unmapped when the last
+ * reference to it is released, so a single instance can be shared by any
+ * number of readers without copying the contents. On platforms without
+ * memory-mapped files the contents are read into memory instead.
+ */
+class PscMappedFile : public SimpleRefCount<PscMappedFile>
+{
+  public:
+    /**
+     * Maps a file into memory. The simulation is aborted if the file cannot be
+     * opened or mapped.
+     *
+     * \param filePath The path to the file.
+     */
+    PscMappedFile(const std::string& filePath);
+    /**
+     * Unmaps the file.
+     */
+    ~PscMappedFile();
+    /**
+     * Gets the path to the file.
+     * \returns The path to the file.
+     */
+    const std::string& GetPath() const;
+    /**
+     * Gets the contents of the file.
+     * \returns A pointer to the first byte of the file, or nullptr if the file is empty.
+     */
+    const uint8_t* GetData() const;
+    /**
+     * Gets the size of the file.
+     * \returns The size of the file, in bytes.
+     */
+    std::size_t GetSize() const;
+
+  private:
+    PscMappedFile(const PscMappedFile&) = delete;
+    PscMappedFile& operator=(const PscMappedFile&) = delete;
+
+    std::string m_path;            //!< The path to the file.
+    const uint8_t* m_data;         //!< The contents of the file.
+    std::size_t m_size;            //!< The size of the file.
+    std::vector<uint8_t> m_buffer; //!< The contents, when the file could not be mapped.
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif /* PSC_MAPPED_FILE_H */
@@ -0,0 +1,234 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "psc-video-frame-trace.h"
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PscVideoFrameTrace");
+
+namespace psc
+{
+
+namespace
+{
+
+/**
+ * Magic string at the start of the binary frame trace files
+ */
+constexpr char FRAME_TRACE_MAGIC[8] = {'P', 'S', 'C', 'V', 'F', 'T', '0', '1'};
+
+/**
+ * Header of the binary frame trace files
+ */
+struct FrameTraceHeader
+{
+    char magic[8];     //!< FRAME_TRACE_MAGIC
+    uint32_t count;    //!< Number of frames
+    uint32_t reserved; //!< Reserved, set to 0
+};
+
+/**
+ * Record of a frame in the binary frame trace files
+ */
+struct FrameTraceRecord
+{
+    int64_t timestamp; //!< Timestamp of the frame, in ns
+    uint32_t size;     //!< Size of the frame, in bytes
+    uint32_t reserved; //!< Reserved, set to 0
+};
+
+static_assert(sizeof(FrameTraceHeader) == 16, "Unexpected padding in the frame trace header");
+static_assert(sizeof(FrameTraceRecord) == 16, "Unexpected padding in the frame trace record");
+
+/**
+ * Reads a frame record from the trace
+ *
+ * \param frames The first frame record
+ * \param index The index of the record to read
+ * \return The record
+ */
+FrameTraceRecord
+ReadRecord(const uint8_t* frames, uint32_t index)
+{
+    FrameTraceRecord record;
+    std::memcpy(&record, frames + static_cast<std::size_t>(index) * sizeof(record), sizeof(record));
+    return record;
+}
+
+} // namespace
+
+PscVideoFrameTrace::PscVideoFrameTrace(const std::string& filePath)
+{
+    NS_LOG_FUNCTION(this << filePath);
+
+    m_file = Create<PscMappedFile>(filePath);
+
+    FrameTraceHeader header;
+    NS_ABORT_MSG_IF(m_file->GetSize() < sizeof(header), "File " + filePath + " is too short");
+    std::memcpy(&header, m_file->GetData(), sizeof(header));
+    NS_ABORT_MSG_IF(std::memcmp(header.magic, FRAME_TRACE_MAGIC, sizeof(header.magic)) != 0,
+                    "File " + filePath +
+                        " is not a binary frame trace file, use "
+                        "PscVideoFrameTrace::ConvertFromText to convert it");
+    NS_ABORT_MSG_IF(header.count == 0, "Frame trace file " + filePath + " has no frames");
+    NS_ABORT_MSG_IF(m_file->GetSize() !=
+                        sizeof(header) + static_cast<std::size_t>(header.count) *
+                                             sizeof(FrameTraceRecord),
+                    "Size of frame trace file " + filePath + " does not match its header");
+
+    m_frames = m_file->GetData() + sizeof(header);
+    m_count = header.count;
+
+    // Validate the timestamps once, so that the intervals are never negative
+    int64_t previous = ReadRecord(m_frames, 0).timestamp;
+    for (uint32_t i = 1; i < m_count; i++)
+    {
+        int64_t timestamp = ReadRecord(m_frames, i).timestamp;
+        NS_ABORT_MSG_IF(timestamp < previous,
+                        "Timestamps of frame trace file " + filePath + " are not sorted");
+        previous = timestamp;
+    }
+
+    if (m_count > 1)
+    {
+        int64_t duration = previous - ReadRecord(m_frames, 0).timestamp;
+        m_loopInterval = NanoSeconds(duration / (m_count - 1));
+    }
+    else
+    {
+        // With a single frame, the trace spans from its start to the frame
+        m_loopInterval = NanoSeconds(previous);
+    }
+}
+
+Ptr<const PscVideoFrameTrace>
+PscVideoFrameTrace::Load(const std::string& filePath)
+{
+    NS_LOG_FUNCTION(filePath);
+
+    static std::map<std::string, Ptr<const PscVideoFrameTrace>> registry;
+
+    auto it = registry.find(filePath);
+    if (it == registry.end())
+    {
+        NS_LOG_DEBUG("Mapping frame trace " << filePath);
+        it = registry.emplace(filePath, Create<PscVideoFrameTrace>(filePath)).first;
+    }
+
+    return it->second;
+}
+
+void
+PscVideoFrameTrace::ConvertFromText(const std::string& textFilePath,
+                                    const std::string& binaryFilePath)
+{
+    NS_LOG_FUNCTION(textFilePath << binaryFilePath);
+
+    std::ifstream fin(textFilePath.c_str());
+    NS_ABORT_MSG_IF(!fin.is_open(), "Cannot open file " + textFilePath);
+
+    std::vector<FrameTraceRecord> records;
+    double timestamp;
+    uint32_t size;
+    while (fin >> timestamp >> size)
+    {
+        records.push_back({static_cast<int64_t>(std::llround(timestamp * 1e9)), size, 0});
+    }
+    NS_ABORT_MSG_IF(!fin.eof(), "Cannot parse frame trace file " + textFilePath);
+
+    FrameTraceHeader header;
+    std::memcpy(header.magic, FRAME_TRACE_MAGIC, sizeof(header.magic));
+    header.count = static_cast<uint32_t>(records.size());
+    header.reserved = 0;
+
+    std::ofstream fout(binaryFilePath.c_str(), std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!fout.is_open(), "Cannot open file " + binaryFilePath);
+    fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    fout.write(reinterpret_cast<const char*>(records.data()),
+               records.size() * sizeof(FrameTraceRecord));
+}
+
+bool
+PscVideoFrameTrace::IsBinaryFile(const std::string& filePath)
+{
+    NS_LOG_FUNCTION(filePath);
+
+    char magic[sizeof(FRAME_TRACE_MAGIC)];
+    std::ifstream fin(filePath.c_str(), std::ios::binary);
+
+    return fin.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, FRAME_TRACE_MAGIC, sizeof(magic)) == 0;
+}
+
+uint32_t
+PscVideoFrameTrace::GetFrameCount() const
+{
+    return m_count;
+}
+
+PscVideoFrameTrace::Frame
+PscVideoFrameTrace::GetFrame(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_count, "Frame index out of range");
+
+    FrameTraceRecord record = ReadRecord(m_frames, index);
+    return {NanoSeconds(record.timestamp), record.size};
+}
+
+Time
+PscVideoFrameTrace::GetInterval(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_count, "Frame index out of range");
+
+    if (index + 1 == m_count)
+    {
+        return m_loopInterval;
+    }
+
+    return NanoSeconds(ReadRecord(m_frames, index + 1).timestamp -
+                       ReadRecord(m_frames, index).timestamp);
+}
+
+} // namespace psc
+} // namespace ns3
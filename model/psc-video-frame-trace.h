@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef PSC_VIDEO_FRAME_TRACE_H
+#define PSC_VIDEO_FRAME_TRACE_H
+
+#include "psc-mapped-file.h"
+
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+
+#include <cstdint>
+#include <string>
+
+namespace ns3
+{
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ *
+ * Immutable trace of the frames generated by a video encoder, with the
+ * timestamp and size of each frame, used by PscVideoStreaming to replay real
+ * encoder output.
+ *
+ * The trace is stored in a binary file that is mapped into memory, and the
+ * frames are read directly from the mapping when requested, so traces with
+ * any number of frames can be shared by any number of applications without
+ * copying them. Instances are obtained through Load, which maps each file only
+ * once per process.
+ *
+ * The binary file starts with a 16 byte header (the magic string "PSCVFT01",
+ * followed by the number of frames and a reserved field, both as 32 bit
+ * unsigned integers), followed by a 16 byte record for each frame (the
+ * timestamp in nanoseconds as a 64 bit signed integer, followed by the size in
+ * bytes and a reserved field, both as 32 bit unsigned integers). All the
+ * fields use the byte order of the host. Files in this format can be generated
+ * from text files with ConvertFromText.
+ */
+class PscVideoFrameTrace : public SimpleRefCount<PscVideoFrameTrace>
+{
+  public:
+    /**
+     * Frame of the trace
+     */
+    struct Frame
+    {
+        Time timestamp; //!< Time at which the frame was generated
+        uint32_t size;  //!< Size of the frame, in bytes
+    };
+
+    /**
+     * Maps a frame trace file into memory. The simulation is aborted if the
+     * file is not a valid frame trace.
+     *
+     * \param filePath Path to the frame trace file, in binary format
+     */
+    PscVideoFrameTrace(const std::string& filePath);
+
+    /**
+     * Get the frame trace stored in a file, mapping the file the first time it
+     * is requested and sharing it afterwards.
+     *
+     * \param filePath Path to the frame trace file, in binary format
+     * \return The frame trace
+     */
+    static Ptr<const PscVideoFrameTrace> Load(const std::string& filePath);
+
+    /**
+     * Converts a frame trace in text format, with a line for each frame with
+     * its timestamp (in seconds) and size (in bytes) separated by whitespace,
+     * into the binary format read by Load.
+     *
+     * \param textFilePath Path to the frame trace file in text format
+     * \param binaryFilePath Path to the frame trace file to write in binary format
+     */
+    static void ConvertFromText(const std::string& textFilePath,
+                                const std::string& binaryFilePath);
+
+    /**
+     * Checks if a file is a frame trace in binary format
+     *
+     * \param filePath Path to the file
+     * \return True if the file starts with the magic string of the binary format
+     */
+    static bool IsBinaryFile(const std::string& filePath);
+
+    /**
+     * Get the number of frames of the trace
+     *
+     * \return The number of frames
+     */
+    uint32_t GetFrameCount() const;
+
+    /**
+     * Get a frame of the trace
+     *
+     * \param index The index of the frame, lower than GetFrameCount ()
+     * \return The frame
+     */
+    Frame GetFrame(uint32_t index) const;
+
+    /**
+     * Get the time between a frame and the next one. For the last frame, the
+     * mean interval between frames of the trace is returned, to be used when
+     * the trace is replayed in a loop, or the timestamp of the frame if the
+     * trace only has one frame.
+     *
+     * \param index The index of the frame, lower than GetFrameCount ()
+     * \return The time to the next frame
+     */
+    Time GetInterval(uint32_t index) const;
+
+  private:
+    Ptr<PscMappedFile> m_file; //!< The file with the trace
+    const uint8_t* m_frames;   //!< The first frame record in the file
+    uint32_t m_count;          //!< The number of frames
+    Time m_loopInterval;       //!< The time from the last frame to the first one
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif // PSC_VIDEO_FRAME_TRACE_H
@@ -1,30 +1,30 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
  * NIST-developed software is provided by NIST as a public service. You may use,
- * copy and distribute copies of the software in any medium] = provided that you
+ * copy and distribute copies of the software in any medium, provided that you
  * keep intact this entire notice. You may improve,modify and create derivative
- * works of the software or any portion of the software] = and you may copy and
+ * works of the software or any portion of the software, and you may copy and
  * distribute such modifications or works. Modified works should carry a notice
  * stating that you changed the software and should note the date and nature of
  * any such change. Please explicitly acknowledge the National Institute of
  * Standards and Technology as the source of the software.
  *
  * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
- * WARRANTY OF ANY KIND] = EXPRESS] = IMPLIED] = IN FACT OR ARISING BY OPERATION OF
- * LAW] = INCLUDING] = WITHOUT LIMITATION] = THE IMPLIED WARRANTY OF
- * MERCHANTABILITY] = FITNESS FOR A PARTICULAR PURPOSE] = NON-INFRINGEMENT
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
  * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
- * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE] = OR THAT
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
  * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
  * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
- * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS] = ACCURACY] = RELIABILITY,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
  * OR USEFULNESS OF THE SOFTWARE.
  *
  * You are solely responsible for determining the appropriateness of using and
  * distributing the software and you assume all risks associated with its use,
  * including but not limited to the risks and costs of program errors,
- * compliance with applicable laws] = damage to or loss of data] = programs or
- * equipment] = and the unavailability or interruption of operation. This
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
  * software is not intended to be used in any situation where a failure could
  * cause risk of injury or damage to property. The software developed by NIST
  * employees is not subject to copyright protection within the United States.
@@ -32,9 +32,17 @@
 
 #include "psc-video-streaming-distributions.h"
 
-#include <ns3/boolean.h>
+#include <ns3/abort.h>
 #include <ns3/log.h>
-#include <ns3/object-factory.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
 
 namespace ns3
 {
@@ -44,3422 +52,778 @@ NS_LOG_COMPONENT_DEFINE("PscVideoStreamingDistributions");
 namespace psc
 {
 
-std::map<double, uint32_t>
-PscVideoStreamingDistributions::GetSizeDistribution(std::string distributionName)
+namespace
 {
-    NS_LOG_FUNCTION(distributionName);
 
-    std::map<std::string, uint8_t> distributions;
-    distributions["1080p-bright"] = 1;
-    distributions["1080p-dark"] = 2;
-    distributions["720p-bright"] = 3;
-    distributions["720p-dark"] = 4;
+// Built-in distributions. Each array holds the values for probabilities
+// evenly spaced in [0, 1], so the probability of the i-th value of an array
+// of N values is i / (N - 1). New distributions can be generated from CDF files
+// with examples/video_cdf/generate-builtin-distribution.py
+
+/// Packet sizes of 1080p-bright
+constexpr uint32_t SIZE_1080P_BRIGHT[] = {
+    88, 145, 171, 205, 258, 280, 298, 310, 319, 329, 337, 343, 349, 355, 360, 366, 370, 375, 379,
+    383, 387, 391, 394, 398, 402, 405, 408, 411, 415, 418, 421, 424, 427, 430, 433, 436, 439, 442,
+    445, 448, 451, 454, 456, 459, 462, 465, 468, 471, 474, 477, 479, 483, 486, 489, 491, 494, 497,
+    500, 503, 506, 508, 512, 515, 518, 521, 524, 528, 531, 535, 538, 541, 544, 548, 551, 555, 558,
+    561, 564, 567, 571, 574, 577, 581, 584, 587, 590, 594, 598, 601, 604, 608, 611, 614, 617, 620,
+    624, 628, 631, 635, 638, 641, 644, 647, 651, 654, 657, 660, 663, 666, 669, 673, 676, 679, 682,
+    685, 688, 691, 694, 697, 700, 703, 706, 709, 712, 715, 718, 721, 724, 727, 730, 733, 736, 739,
+    743, 746, 749, 752, 755, 758, 760, 763, 766, 769, 772, 775, 778, 781, 784, 787, 790, 793, 795,
+    798, 801, 804, 807, 809, 812, 815, 818, 821, 823, 826, 829, 832, 834, 838, 840, 843, 845, 848,
+    851, 854, 857, 859, 862, 865, 867, 870, 873, 876, 878, 881, 884, 886, 889, 892, 894, 896, 899,
+    902, 905, 907, 910, 913, 916, 918, 921, 924, 927, 930, 932, 935, 938, 941, 944, 946, 949, 952,
+    955, 957, 960, 963, 967, 970, 973, 976, 979, 983, 986, 989, 993, 997, 1001, 1006, 1010, 1014,
+    1019, 1024, 1028, 1033, 1038, 1043, 1048, 1053, 1059, 1064, 1069, 1075, 1081, 1086, 1094, 1101,
+    1107, 1114, 1122, 1129, 1138, 1146, 1154, 1163, 1171, 1179, 1187, 1198, 1207, 1217, 1227, 1239,
+    1253, 1267, 1278, 1291, 1303, 1314, 1327, 1340, 1353, 1368, 1384, 1399, 1414, 1431, 1447, 1469,
+    1490, 1509, 1533, 1553, 1574, 1602, 1628, 1655, 1682, 1711, 1740, 1769, 1798, 1828, 1859, 1893,
+    1929, 1964, 2000, 2037, 2074, 2111, 2151, 2185, 2228, 2263, 2304, 2341, 2379, 2416, 2454, 2489,
+    2530, 2569, 2612, 2652, 2689, 2730, 2767, 2807, 2845, 2881, 2921, 2969, 3017, 3065, 3110, 3152,
+    3204, 3256, 3308, 3354, 3404, 3452, 3501, 3543, 3594, 3652, 3709, 3773, 3842, 3909, 3967, 4030,
+    4096, 4157, 4218, 4276, 4341, 4402, 4463, 4529, 4580, 4637, 4691, 4746, 4804, 4869, 4934, 4998,
+    5066, 5132, 5200, 5277, 5344, 5421, 5497, 5576, 5655, 5740, 5822, 5912, 6017, 6109, 6199, 6278,
+    6379, 6492, 6590, 6700, 6805, 6935, 7080, 7216, 7347, 7473, 7598, 7726, 7831, 7945, 8062, 8175,
+    8284, 8386, 8503, 8626, 8748, 8850, 8969, 9089, 9193, 9308, 9406, 9509, 9610, 9697, 9795, 9897,
+    9999, 10107, 10212, 10320, 10425, 10530, 10630, 10741, 10840, 10923, 11024, 11114, 11191,
+    11288, 11391, 11488, 11590, 11684, 11785, 11885, 11988, 12106, 12179, 12291, 12389, 12487,
+    12584, 12686, 12802, 12901, 12992, 13082, 13174, 13255, 13339, 13436, 13520, 13630, 13706,
+    13770, 13856, 13952, 14022, 14124, 14211, 14295, 14383, 14450, 14534, 14616, 14714, 14808,
+    14887, 14990, 15105, 15208, 15296, 15390, 15506, 15649, 15775, 15937, 16076, 16232, 16387,
+    16553, 16710, 16868, 17022, 17210, 17385, 17632, 17850, 18071, 18293, 18530, 18804, 19102,
+    19386, 19708, 20082, 20469, 20807, 21209, 21658, 22160, 22953, 24049, 25508, 26955, 28579,
+    29736, 31210, 33586, 40969, 49343, 136026, 316528};
+
+/// Packet intervals (ms) of 1080p-bright
+constexpr double INTERVAL_1080P_BRIGHT[] = {
+    0.039, 6.207, 7.085, 7.417, 7.945, 8.437, 8.783, 9.273, 9.827, 10.202, 10.827, 13.476, 15.210,
+    15.786, 15.980, 16.042, 16.096, 16.159, 16.240, 16.352, 16.536, 16.765, 16.966, 17.114, 17.193,
+    17.249, 17.301, 17.353, 17.410, 17.478, 17.562, 17.672, 17.824, 18.007, 18.204, 18.391, 18.541,
+    18.666, 18.796, 18.952, 19.162, 19.430, 19.731, 20.005, 20.215, 20.436, 20.908, 22.732, 25.798,
+    31.016, 198.444};
+
+/// Packet sizes of 1080p-dark
+constexpr uint32_t SIZE_1080P_DARK[] = {
+    66, 85, 91, 96, 101, 106, 112, 119, 128, 140, 152, 163, 173, 180, 187, 195, 200, 206, 213, 219,
+    224, 229, 233, 238, 243, 248, 254, 258, 263, 268, 272, 277, 282, 286, 291, 296, 300, 305, 310,
+    314, 319, 324, 330, 335, 341, 347, 353, 359, 365, 371, 378, 384, 390, 397, 404, 410, 417, 424,
+    431, 438, 445, 452, 458, 465, 472, 480, 486, 493, 499, 506, 513, 519, 526, 532, 539, 545, 552,
+    558, 564, 572, 578, 586, 593, 599, 606, 613, 620, 627, 633, 641, 648, 655, 661, 668, 676, 683,
+    692, 700, 707, 714, 722, 729, 736, 743, 749, 756, 763, 770, 777, 783, 790, 796, 801, 807, 813,
+    818, 824, 829, 834, 839, 845, 850, 855, 860, 865, 871, 876, 881, 886, 892, 898, 902, 907, 913,
+    919, 924, 929, 934, 939, 944, 950, 955, 960, 965, 970, 975, 979, 983, 989, 994, 999, 1004,
+    1009, 1014, 1020, 1026, 1031, 1036, 1042, 1048, 1054, 1060, 1066, 1072, 1078, 1084, 1090, 1097,
+    1104, 1112, 1118, 1125, 1132, 1140, 1148, 1155, 1163, 1170, 1178, 1185, 1192, 1200, 1208, 1217,
+    1225, 1233, 1240, 1248, 1256, 1263, 1270, 1277, 1284, 1291, 1298, 1306, 1312, 1318, 1325, 1333,
+    1340, 1347, 1354, 1361, 1369, 1376, 1384, 1392, 1399, 1406, 1413, 1420, 1427, 1436, 1443, 1451,
+    1458, 1467, 1475, 1482, 1491, 1499, 1507, 1515, 1523, 1531, 1541, 1551, 1560, 1569, 1578, 1587,
+    1596, 1604, 1612, 1622, 1630, 1639, 1647, 1657, 1666, 1674, 1683, 1692, 1701, 1711, 1720, 1729,
+    1739, 1749, 1759, 1769, 1779, 1788, 1798, 1809, 1819, 1829, 1840, 1851, 1862, 1872, 1882, 1892,
+    1905, 1917, 1928, 1941, 1952, 1966, 1977, 1990, 2004, 2017, 2031, 2044, 2058, 2072, 2087, 2100,
+    2115, 2131, 2147, 2163, 2176, 2191, 2207, 2224, 2239, 2254, 2271, 2288, 2304, 2323, 2340, 2359,
+    2379, 2398, 2417, 2433, 2453, 2472, 2492, 2515, 2536, 2557, 2578, 2599, 2621, 2646, 2670, 2694,
+    2719, 2744, 2770, 2794, 2818, 2841, 2870, 2895, 2923, 2952, 2980, 3006, 3033, 3063, 3092, 3117,
+    3144, 3174, 3201, 3228, 3254, 3281, 3310, 3340, 3369, 3398, 3427, 3457, 3483, 3513, 3545, 3575,
+    3606, 3637, 3667, 3697, 3725, 3756, 3791, 3820, 3849, 3880, 3910, 3941, 3975, 4011, 4043, 4079,
+    4116, 4148, 4186, 4222, 4256, 4289, 4324, 4358, 4390, 4425, 4461, 4497, 4533, 4571, 4610, 4645,
+    4677, 4714, 4752, 4793, 4830, 4867, 4902, 4939, 4980, 5022, 5060, 5098, 5136, 5177, 5217, 5262,
+    5304, 5346, 5391, 5433, 5481, 5528, 5574, 5613, 5653, 5692, 5734, 5775, 5811, 5848, 5891, 5933,
+    5977, 6020, 6063, 6111, 6153, 6200, 6245, 6291, 6340, 6387, 6433, 6483, 6531, 6585, 6636, 6680,
+    6725, 6774, 6825, 6876, 6923, 6980, 7042, 7099, 7150, 7213, 7264, 7311, 7365, 7421, 7484, 7541,
+    7604, 7658, 7723, 7789, 7854, 7933, 7994, 8067, 8126, 8184, 8248, 8311, 8384, 8450, 8530, 8611,
+    8702, 8792, 8887, 8974, 9055, 9129, 9208, 9288, 9367, 9455, 9544, 9633, 9748, 9861, 9965,
+    10067, 10164, 10281, 10402, 10527, 10687, 10808, 10972, 11117, 11253, 11407, 11573, 11724,
+    11888, 12075, 12276, 12457, 12670, 12872, 13094, 13330, 13624, 13959, 14483, 15238, 16111,
+    17013, 20675, 45077, 124056};
+
+/// Packet intervals (ms) of 1080p-dark
+constexpr double INTERVAL_1080P_DARK[] = {
+    6.084, 6.084, 6.901, 7.174, 7.335, 7.597, 8.051, 8.419, 8.683, 8.985, 9.485, 10.018, 10.349,
+    11.066, 13.970, 15.307, 15.640, 15.848, 15.915, 15.945, 15.967, 15.986, 16.004, 16.020, 16.036,
+    16.051, 16.065, 16.081, 16.096, 16.113, 16.130, 16.149, 16.169, 16.191, 16.215, 16.241, 16.270,
+    16.305, 16.351, 16.419, 16.520, 16.622, 16.716, 16.802, 16.882, 16.956, 17.027, 17.080, 17.116,
+    17.142, 17.164, 17.183, 17.200, 17.216, 17.232, 17.247, 17.262, 17.277, 17.291, 17.306, 17.321,
+    17.336, 17.351, 17.367, 17.384, 17.402, 17.422, 17.442, 17.466, 17.491, 17.520, 17.555, 17.595,
+    17.648, 17.717, 17.802, 17.898, 17.999, 18.103, 18.209, 18.309, 18.403, 18.487, 18.569, 18.646,
+    18.724, 18.805, 18.898, 19.009, 19.148, 19.319, 19.536, 19.799, 20.023, 20.185, 20.342, 20.537,
+    21.260, 26.076, 27.471, 197.934};
+
+/// Packet sizes of 720p-bright
+constexpr uint32_t SIZE_720P_BRIGHT[] = {
+    88, 137, 151, 159, 165, 170, 175, 179, 182, 186, 189, 193, 196, 200, 203, 206, 208, 211, 214,
+    217, 220, 222, 225, 227, 230, 233, 235, 238, 241, 243, 246, 249, 251, 254, 257, 259, 262, 265,
+    267, 270, 272, 275, 277, 280, 283, 285, 288, 291, 293, 296, 298, 301, 304, 306, 309, 311, 314,
+    316, 319, 322, 324, 326, 329, 331, 334, 336, 338, 341, 343, 346, 348, 351, 353, 355, 358, 360,
+    363, 365, 368, 370, 373, 376, 378, 381, 383, 386, 389, 391, 394, 397, 399, 402, 404, 407, 409,
+    412, 414, 417, 420, 422, 425, 427, 430, 433, 435, 438, 441, 443, 446, 448, 451, 454, 457, 460,
+    463, 465, 468, 471, 473, 476, 479, 482, 485, 487, 490, 493, 495, 498, 500, 503, 506, 509, 511,
+    514, 517, 520, 523, 525, 528, 531, 534, 537, 540, 542, 545, 548, 550, 553, 556, 558, 561, 564,
+    566, 569, 571, 574, 577, 579, 582, 584, 587, 589, 592, 594, 596, 599, 601, 603, 606, 608, 610,
+    613, 615, 617, 620, 622, 624, 626, 629, 631, 634, 636, 638, 641, 643, 646, 648, 650, 653, 655,
+    658, 660, 663, 665, 668, 670, 672, 675, 677, 679, 682, 684, 687, 690, 692, 695, 697, 700, 702,
+    705, 707, 709, 712, 715, 717, 719, 722, 724, 727, 729, 732, 734, 737, 739, 742, 745, 747, 750,
+    752, 755, 757, 760, 762, 765, 767, 770, 772, 775, 777, 780, 783, 786, 788, 791, 793, 795, 798,
+    800, 803, 805, 807, 810, 813, 815, 817, 820, 823, 825, 828, 830, 832, 835, 838, 840, 843, 846,
+    848, 851, 854, 857, 859, 862, 865, 867, 870, 872, 875, 878, 881, 883, 886, 889, 892, 895, 897,
+    901, 904, 906, 909, 912, 915, 918, 921, 925, 928, 931, 934, 937, 940, 943, 946, 949, 952, 955,
+    959, 962, 965, 968, 971, 974, 977, 981, 983, 987, 990, 993, 996, 999, 1003, 1006, 1009, 1013,
+    1016, 1020, 1024, 1028, 1031, 1035, 1038, 1042, 1046, 1050, 1054, 1058, 1062, 1066, 1070, 1074,
+    1078, 1083, 1087, 1091, 1094, 1099, 1103, 1107, 1111, 1115, 1119, 1123, 1127, 1131, 1135, 1139,
+    1143, 1147, 1151, 1154, 1158, 1162, 1167, 1170, 1174, 1178, 1182, 1186, 1190, 1194, 1198, 1202,
+    1206, 1210, 1214, 1218, 1223, 1227, 1231, 1236, 1239, 1243, 1247, 1251, 1255, 1259, 1263, 1267,
+    1272, 1276, 1280, 1284, 1288, 1292, 1297, 1301, 1306, 1310, 1315, 1319, 1324, 1329, 1333, 1337,
+    1342, 1346, 1351, 1355, 1360, 1364, 1369, 1373, 1378, 1382, 1386, 1391, 1395, 1399, 1404, 1409,
+    1413, 1417, 1421, 1425, 1429, 1434, 1438, 1443, 1447, 1451, 1455, 1460, 1466, 1470, 1475, 1480,
+    1485, 1489, 1494, 1499, 1503, 1508, 1513, 1518, 1523, 1528, 1532, 1538, 1543, 1549, 1554, 1560,
+    1565, 1571, 1576, 1582, 1588, 1594, 1599, 1604, 1609, 1615, 1621, 1627, 1632, 1638, 1643, 1648,
+    1653, 1659, 1664, 1670, 1676, 1682, 1686, 1693, 1698, 1704, 1710, 1716, 1722, 1728, 1735, 1742,
+    1748, 1755, 1761, 1768, 1775, 1781, 1787, 1794, 1801, 1809, 1815, 1823, 1830, 1838, 1846, 1853,
+    1861, 1870, 1878, 1886, 1894, 1902, 1908, 1916, 1923, 1931, 1938, 1946, 1955, 1963, 1970, 1977,
+    1984, 1992, 1999, 2006, 2014, 2021, 2030, 2036, 2042, 2048, 2055, 2063, 2069, 2078, 2083, 2091,
+    2096, 2103, 2109, 2117, 2124, 2132, 2138, 2145, 2153, 2159, 2165, 2173, 2179, 2184, 2190, 2196,
+    2203, 2209, 2214, 2221, 2226, 2232, 2237, 2243, 2248, 2254, 2260, 2266, 2273, 2278, 2283, 2289,
+    2294, 2299, 2305, 2311, 2318, 2324, 2331, 2337, 2343, 2350, 2356, 2361, 2368, 2374, 2381, 2386,
+    2394, 2400, 2406, 2414, 2419, 2426, 2432, 2438, 2445, 2452, 2457, 2464, 2470, 2479, 2485, 2492,
+    2501, 2510, 2516, 2523, 2532, 2539, 2548, 2556, 2563, 2571, 2580, 2587, 2595, 2603, 2610, 2617,
+    2625, 2632, 2639, 2647, 2654, 2661, 2670, 2677, 2686, 2696, 2702, 2711, 2721, 2729, 2738, 2747,
+    2753, 2761, 2770, 2779, 2786, 2794, 2803, 2811, 2820, 2828, 2835, 2841, 2850, 2860, 2871, 2881,
+    2892, 2904, 2911, 2920, 2933, 2944, 2954, 2967, 2977, 2991, 2999, 3011, 3019, 3034, 3046, 3059,
+    3073, 3088, 3103, 3115, 3130, 3145, 3162, 3180, 3191, 3204, 3214, 3227, 3239, 3258, 3270, 3282,
+    3293, 3307, 3319, 3335, 3349, 3362, 3376, 3392, 3406, 3418, 3430, 3444, 3456, 3468, 3477, 3492,
+    3506, 3523, 3540, 3556, 3570, 3587, 3601, 3615, 3636, 3651, 3666, 3675, 3691, 3712, 3725, 3742,
+    3758, 3774, 3791, 3809, 3816, 3834, 3847, 3860, 3881, 3896, 3917, 3934, 3953, 3970, 3994, 4013,
+    4031, 4052, 4070, 4093, 4116, 4140, 4156, 4179, 4196, 4217, 4236, 4255, 4281, 4303, 4323, 4350,
+    4365, 4385, 4406, 4429, 4455, 4476, 4502, 4527, 4542, 4562, 4589, 4613, 4629, 4649, 4671, 4694,
+    4718, 4733, 4757, 4780, 4807, 4823, 4848, 4871, 4896, 4924, 4952, 4971, 4999, 5020, 5036, 5052,
+    5072, 5093, 5107, 5132, 5153, 5178, 5196, 5221, 5243, 5264, 5282, 5311, 5333, 5352, 5380, 5401,
+    5431, 5453, 5473, 5494, 5515, 5544, 5559, 5579, 5595, 5611, 5639, 5675, 5707, 5742, 5773, 5809,
+    5845, 5878, 5907, 5928, 5956, 5993, 6014, 6046, 6075, 6103, 6138, 6167, 6194, 6217, 6241, 6267,
+    6298, 6320, 6345, 6373, 6408, 6435, 6461, 6481, 6508, 6538, 6573, 6602, 6630, 6653, 6681, 6710,
+    6738, 6762, 6781, 6801, 6822, 6848, 6867, 6888, 6907, 6941, 6971, 6993, 7021, 7039, 7066, 7096,
+    7129, 7157, 7191, 7226, 7250, 7285, 7313, 7335, 7363, 7390, 7425, 7450, 7480, 7506, 7532, 7562,
+    7590, 7613, 7643, 7678, 7707, 7729, 7754, 7780, 7810, 7835, 7858, 7887, 7920, 7952, 7983, 8013,
+    8043, 8079, 8108, 8148, 8177, 8209, 8243, 8280, 8319, 8360, 8410, 8472, 8533, 8596, 8648, 8707,
+    8761, 8819, 8883, 8958, 9036, 9113, 9165, 9221, 9278, 9337, 9390, 9458, 9531, 9604, 9672, 9727,
+    9795, 9860, 9924, 9997, 10066, 10145, 10220, 10292, 10369, 10445, 10521, 10583, 10652, 10713,
+    10787, 10860, 10928, 11001, 11065, 11132, 11197, 11247, 11315, 11385, 11466, 11531, 11600,
+    11660, 11715, 11770, 11838, 11905, 11974, 12034, 12091, 12158, 12225, 12307, 12387, 12466,
+    12541, 12623, 12699, 12795, 12875, 12961, 13052, 13133, 13207, 13290, 13373, 13458, 13551,
+    13655, 13781, 13895, 14003, 14121, 14269, 14417, 14519, 14665, 14790, 14932, 15046, 15175,
+    15354, 15529, 15677, 15873, 16156, 16421, 16755, 16991, 17161, 17436, 17710, 18075, 18420,
+    18947, 19725, 20728, 47715, 65710, 104961, 123734, 222476};
+
+/// Packet intervals (ms) of 720p-bright
+constexpr double INTERVAL_720P_BRIGHT[] = {
+    0.052, 13.586, 23.656, 23.794, 24.275, 25.740, 33.095, 33.116, 33.129, 33.137, 33.144, 33.151,
+    33.157, 33.162, 33.167, 33.172, 33.177, 33.182, 33.187, 33.192, 33.197, 33.202, 33.207, 33.212,
+    33.218, 33.223, 33.229, 33.234, 33.240, 33.247, 33.253, 33.259, 33.265, 33.272, 33.279, 33.287,
+    33.294, 33.302, 33.311, 33.319, 33.329, 33.338, 33.348, 33.360, 33.371, 33.385, 33.401, 33.420,
+    33.444, 33.480, 33.539, 33.657, 33.703, 33.720, 33.731, 33.741, 33.749, 33.757, 33.764, 33.771,
+    33.778, 33.785, 33.791, 33.798, 33.805, 33.811, 33.818, 33.824, 33.831, 33.838, 33.845, 33.852,
+    33.860, 33.868, 33.875, 33.884, 33.892, 33.902, 33.912, 33.922, 33.934, 33.946, 33.960, 33.975,
+    33.992, 34.014, 34.042, 34.082, 34.139, 34.206, 34.269, 34.332, 34.400, 34.488, 34.636, 34.826,
+    34.946, 35.043, 35.159, 35.459, 192.686};
+
+/// Packet sizes of 720p-dark
+constexpr uint32_t SIZE_720P_DARK[] = {
+    37, 46, 48, 50, 52, 53, 55, 56, 57, 58, 59, 60, 62, 63, 64, 65, 66, 68, 69, 71, 72, 74, 75, 77,
+    78, 80, 82, 84, 85, 87, 88, 90, 91, 93, 95, 97, 99, 101, 103, 104, 106, 108, 109, 111, 112,
+    114, 115, 117, 118, 120, 122, 123, 125, 126, 128, 130, 131, 133, 134, 136, 137, 139, 141, 142,
+    144, 146, 147, 149, 150, 152, 153, 155, 157, 159, 161, 163, 164, 166, 168, 170, 172, 174, 176,
+    178, 180, 183, 185, 187, 189, 191, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 217,
+    219, 221, 223, 225, 227, 229, 230, 232, 234, 236, 238, 240, 242, 244, 246, 247, 249, 251, 253,
+    254, 256, 258, 260, 261, 263, 264, 266, 268, 271, 273, 274, 276, 278, 280, 282, 284, 286, 288,
+    290, 292, 294, 296, 297, 299, 301, 302, 304, 306, 307, 309, 311, 313, 315, 316, 318, 320, 322,
+    323, 325, 327, 328, 330, 331, 333, 335, 336, 338, 340, 342, 343, 345, 347, 349, 351, 352, 354,
+    356, 358, 359, 361, 363, 365, 367, 369, 371, 373, 375, 377, 379, 381, 383, 386, 388, 390, 392,
+    394, 396, 399, 401, 403, 406, 408, 410, 413, 415, 417, 419, 422, 424, 427, 429, 432, 434, 437,
+    439, 441, 444, 446, 449, 451, 453, 456, 458, 461, 463, 466, 468, 470, 473, 475, 477, 480, 483,
+    485, 488, 490, 493, 496, 498, 500, 503, 505, 508, 510, 513, 515, 517, 519, 522, 524, 527, 530,
+    532, 535, 537, 540, 543, 545, 547, 549, 552, 554, 556, 559, 561, 563, 566, 569, 571, 573, 576,
+    578, 581, 583, 586, 589, 591, 593, 596, 598, 601, 603, 605, 608, 610, 613, 615, 617, 619, 622,
+    624, 627, 630, 632, 635, 637, 639, 642, 645, 647, 650, 652, 655, 657, 660, 662, 665, 667, 669,
+    672, 674, 677, 679, 682, 685, 687, 690, 693, 695, 698, 701, 703, 706, 708, 711, 714, 716, 719,
+    722, 725, 728, 730, 733, 736, 739, 742, 745, 747, 750, 753, 756, 759, 762, 765, 767, 769, 772,
+    775, 778, 781, 784, 787, 789, 792, 795, 798, 801, 804, 806, 810, 813, 816, 819, 822, 825, 828,
+    831, 834, 837, 840, 844, 847, 850, 853, 856, 859, 862, 865, 869, 873, 876, 880, 883, 886, 888,
+    891, 893, 896, 900, 904, 908, 911, 915, 919, 922, 926, 929, 932, 936, 939, 942, 946, 950, 953,
+    957, 960, 963, 967, 971, 975, 978, 981, 985, 989, 994, 997, 1001, 1004, 1008, 1012, 1016, 1021,
+    1025, 1029, 1033, 1037, 1042, 1046, 1050, 1054, 1057, 1062, 1066, 1070, 1074, 1078, 1082, 1086,
+    1090, 1094, 1098, 1102, 1106, 1111, 1115, 1119, 1123, 1127, 1131, 1136, 1139, 1143, 1148, 1152,
+    1156, 1161, 1164, 1169, 1172, 1177, 1181, 1185, 1189, 1192, 1196, 1200, 1204, 1208, 1213, 1217,
+    1221, 1226, 1230, 1234, 1239, 1242, 1247, 1250, 1255, 1260, 1264, 1269, 1273, 1277, 1282, 1286,
+    1291, 1294, 1298, 1303, 1308, 1313, 1317, 1321, 1327, 1331, 1336, 1340, 1345, 1350, 1355, 1360,
+    1365, 1370, 1375, 1380, 1384, 1389, 1394, 1399, 1404, 1409, 1414, 1419, 1425, 1429, 1435, 1440,
+    1444, 1449, 1454, 1459, 1464, 1470, 1475, 1480, 1486, 1491, 1496, 1501, 1506, 1511, 1516, 1521,
+    1526, 1531, 1536, 1541, 1546, 1549, 1554, 1560, 1565, 1570, 1574, 1579, 1584, 1590, 1595, 1601,
+    1606, 1611, 1615, 1621, 1628, 1634, 1640, 1646, 1651, 1656, 1661, 1667, 1671, 1676, 1682, 1687,
+    1693, 1699, 1705, 1711, 1717, 1724, 1730, 1736, 1742, 1749, 1755, 1762, 1768, 1773, 1780, 1786,
+    1791, 1797, 1804, 1811, 1817, 1825, 1832, 1838, 1845, 1850, 1858, 1865, 1872, 1880, 1887, 1894,
+    1901, 1907, 1915, 1922, 1930, 1937, 1946, 1953, 1962, 1969, 1979, 1987, 1997, 2007, 2015, 2022,
+    2030, 2037, 2046, 2053, 2062, 2071, 2081, 2091, 2101, 2110, 2118, 2127, 2137, 2146, 2158, 2167,
+    2177, 2188, 2198, 2207, 2217, 2226, 2235, 2245, 2254, 2266, 2275, 2285, 2295, 2304, 2313, 2323,
+    2334, 2344, 2355, 2364, 2374, 2386, 2397, 2407, 2418, 2427, 2439, 2448, 2459, 2470, 2480, 2491,
+    2501, 2513, 2523, 2536, 2548, 2558, 2571, 2582, 2592, 2604, 2615, 2625, 2636, 2647, 2659, 2667,
+    2679, 2688, 2700, 2709, 2720, 2733, 2745, 2755, 2764, 2775, 2788, 2799, 2810, 2821, 2831, 2842,
+    2854, 2864, 2874, 2885, 2895, 2906, 2917, 2928, 2940, 2952, 2964, 2976, 2986, 2997, 3009, 3020,
+    3031, 3040, 3049, 3060, 3071, 3082, 3094, 3106, 3117, 3129, 3140, 3151, 3164, 3176, 3188, 3200,
+    3211, 3223, 3234, 3245, 3255, 3266, 3275, 3288, 3298, 3311, 3322, 3332, 3344, 3358, 3369, 3381,
+    3394, 3407, 3421, 3435, 3448, 3461, 3475, 3486, 3501, 3517, 3532, 3547, 3561, 3572, 3587, 3603,
+    3615, 3625, 3639, 3652, 3668, 3681, 3697, 3713, 3727, 3741, 3758, 3773, 3783, 3796, 3809, 3824,
+    3836, 3850, 3861, 3875, 3890, 3903, 3916, 3927, 3946, 3960, 3974, 3990, 4003, 4016, 4029, 4041,
+    4053, 4071, 4086, 4104, 4122, 4140, 4151, 4170, 4184, 4199, 4209, 4223, 4239, 4252, 4266, 4279,
+    4295, 4308, 4325, 4339, 4356, 4370, 4386, 4401, 4417, 4428, 4446, 4466, 4483, 4497, 4515, 4526,
+    4545, 4559, 4577, 4593, 4606, 4629, 4646, 4663, 4679, 4694, 4708, 4722, 4737, 4753, 4765, 4774,
+    4790, 4805, 4817, 4830, 4841, 4855, 4873, 4888, 4905, 4921, 4935, 4958, 4970, 4986, 4996, 5010,
+    5025, 5041, 5057, 5075, 5094, 5117, 5138, 5157, 5174, 5191, 5209, 5228, 5248, 5270, 5291, 5310,
+    5324, 5341, 5358, 5374, 5391, 5406, 5429, 5454, 5476, 5501, 5515, 5532, 5547, 5573, 5598, 5624,
+    5651, 5670, 5689, 5706, 5728, 5748, 5773, 5794, 5819, 5844, 5866, 5888, 5909, 5931, 5957, 5982,
+    6009, 6028, 6054, 6080, 6109, 6137, 6167, 6194, 6225, 6260, 6296, 6327, 6361, 6396, 6431, 6464,
+    6505, 6538, 6577, 6615, 6657, 6693, 6732, 6768, 6800, 6837, 6869, 6902, 6940, 6977, 7012, 7056,
+    7093, 7130, 7166, 7201, 7241, 7289, 7342, 7389, 7438, 7484, 7530, 7580, 7634, 7685, 7747, 7803,
+    7851, 7899, 7954, 8011, 8074, 8135, 8201, 8264, 8322, 8373, 8419, 8477, 8537, 8603, 8664, 8730,
+    8804, 8871, 8932, 8988, 9046, 9107, 9173, 9256, 9329, 9429, 9522, 9604, 9702, 9804, 9918,
+    10036, 10129, 10218, 10314, 10397, 10483, 10623, 10802, 11029, 11223, 11478, 11923, 12404,
+    15490, 22140, 37817, 59737, 85660};
 
-    std::map<double, uint32_t> sizeDistribution;
+/// Packet intervals (ms) of 720p-dark
+constexpr double INTERVAL_720P_DARK[] = {
+    0.055, 23.472, 23.759, 25.019, 33.085, 33.098, 33.107, 33.114, 33.120, 33.126, 33.131, 33.136,
+    33.140, 33.144, 33.148, 33.152, 33.155, 33.159, 33.162, 33.166, 33.169, 33.173, 33.176, 33.180,
+    33.183, 33.186, 33.190, 33.193, 33.197, 33.201, 33.204, 33.208, 33.212, 33.216, 33.220, 33.223,
+    33.227, 33.231, 33.236, 33.240, 33.244, 33.249, 33.254, 33.258, 33.263, 33.269, 33.274, 33.279,
+    33.285, 33.291, 33.298, 33.304, 33.312, 33.319, 33.328, 33.337, 33.347, 33.359, 33.374, 33.394,
+    33.424, 33.483, 33.615, 33.678, 33.697, 33.710, 33.720, 33.729, 33.737, 33.745, 33.752, 33.759,
+    33.766, 33.773, 33.780, 33.787, 33.794, 33.801, 33.809, 33.816, 33.824, 33.832, 33.840, 33.849,
+    33.858, 33.867, 33.878, 33.890, 33.903, 33.919, 33.938, 33.961, 33.998, 34.062, 34.166, 34.266,
+    34.379, 34.587, 34.907, 35.202, 133.985};
+
+/**
+ * Built-in distribution, stored in read-only memory
+ */
+struct BuiltInDistribution
+{
+    std::string_view name;     //!< Name of the distribution
+    const uint32_t* sizes;     //!< Packet sizes
+    std::size_t sizeCount;     //!< Number of packet sizes
+    const double* intervals;   //!< Packet intervals, in ms
+    std::size_t intervalCount; //!< Number of packet intervals
+};
+
+/**
+ * Creates a built-in distribution from its arrays
+ *
+ * \param name Name of the distribution
+ * \param sizes Packet sizes
+ * \param intervals Packet intervals, in ms
+ * \return The built-in distribution
+ */
+template <std::size_t S, std::size_t I>
+constexpr BuiltInDistribution
+MakeBuiltIn(std::string_view name, const uint32_t (&sizes)[S], const double (&intervals)[I])
+{
+    return BuiltInDistribution{name, sizes, S, intervals, I};
+}
+
+/// Built-in distributions, by name
+constexpr BuiltInDistribution BUILT_IN_DISTRIBUTIONS[] = {
+    MakeBuiltIn("1080p-bright", SIZE_1080P_BRIGHT, INTERVAL_1080P_BRIGHT),
+    MakeBuiltIn("1080p-dark", SIZE_1080P_DARK, INTERVAL_1080P_DARK),
+    MakeBuiltIn("720p-bright", SIZE_720P_BRIGHT, INTERVAL_720P_BRIGHT),
+    MakeBuiltIn("720p-dark", SIZE_720P_DARK, INTERVAL_720P_DARK),
+};
+
+/**
+ * Finds a built-in distribution by name
+ *
+ * \param name Name of the distribution
+ * \return The built-in distribution, or nullptr if there is none with that name
+ */
+constexpr const BuiltInDistribution*
+FindBuiltIn(std::string_view name)
+{
+    for (const auto& distribution : BUILT_IN_DISTRIBUTIONS)
+    {
+        if (distribution.name == name)
+        {
+            return &distribution;
+        }
+    }
+    return nullptr;
+}
 
-    switch (distributions[distributionName])
+/**
+ * Checks that values are sorted in non-decreasing order
+ *
+ * \param values The values
+ * \param count The number of values
+ * \return True if the values are sorted
+ */
+template <typename T>
+constexpr bool
+IsSorted(const T* values, std::size_t count)
+{
+    for (std::size_t i = 1; i < count; i++)
     {
-    case 1: // 1080p-bright
-        sizeDistribution[0] = 88;
-        sizeDistribution[0.002] = 145;
-        sizeDistribution[0.004] = 171;
-        sizeDistribution[0.006] = 205;
-        sizeDistribution[0.008] = 258;
-        sizeDistribution[0.01] = 280;
-        sizeDistribution[0.012] = 298;
-        sizeDistribution[0.014] = 310;
-        sizeDistribution[0.016] = 319;
-        sizeDistribution[0.018] = 329;
-        sizeDistribution[0.02] = 337;
-        sizeDistribution[0.022] = 343;
-        sizeDistribution[0.024] = 349;
-        sizeDistribution[0.026] = 355;
-        sizeDistribution[0.028] = 360;
-        sizeDistribution[0.03] = 366;
-        sizeDistribution[0.032] = 370;
-        sizeDistribution[0.034] = 375;
-        sizeDistribution[0.036] = 379;
-        sizeDistribution[0.038] = 383;
-        sizeDistribution[0.04] = 387;
-        sizeDistribution[0.042] = 391;
-        sizeDistribution[0.044] = 394;
-        sizeDistribution[0.046] = 398;
-        sizeDistribution[0.048] = 402;
-        sizeDistribution[0.05] = 405;
-        sizeDistribution[0.052] = 408;
-        sizeDistribution[0.054] = 411;
-        sizeDistribution[0.056] = 415;
-        sizeDistribution[0.058] = 418;
-        sizeDistribution[0.06] = 421;
-        sizeDistribution[0.062] = 424;
-        sizeDistribution[0.064] = 427;
-        sizeDistribution[0.066] = 430;
-        sizeDistribution[0.068] = 433;
-        sizeDistribution[0.07] = 436;
-        sizeDistribution[0.072] = 439;
-        sizeDistribution[0.074] = 442;
-        sizeDistribution[0.076] = 445;
-        sizeDistribution[0.078] = 448;
-        sizeDistribution[0.08] = 451;
-        sizeDistribution[0.082] = 454;
-        sizeDistribution[0.084] = 456;
-        sizeDistribution[0.086] = 459;
-        sizeDistribution[0.088] = 462;
-        sizeDistribution[0.09] = 465;
-        sizeDistribution[0.092] = 468;
-        sizeDistribution[0.094] = 471;
-        sizeDistribution[0.096] = 474;
-        sizeDistribution[0.098] = 477;
-        sizeDistribution[0.1] = 479;
-        sizeDistribution[0.102] = 483;
-        sizeDistribution[0.104] = 486;
-        sizeDistribution[0.106] = 489;
-        sizeDistribution[0.108] = 491;
-        sizeDistribution[0.11] = 494;
-        sizeDistribution[0.112] = 497;
-        sizeDistribution[0.114] = 500;
-        sizeDistribution[0.116] = 503;
-        sizeDistribution[0.118] = 506;
-        sizeDistribution[0.12] = 508;
-        sizeDistribution[0.122] = 512;
-        sizeDistribution[0.124] = 515;
-        sizeDistribution[0.126] = 518;
-        sizeDistribution[0.128] = 521;
-        sizeDistribution[0.13] = 524;
-        sizeDistribution[0.132] = 528;
-        sizeDistribution[0.134] = 531;
-        sizeDistribution[0.136] = 535;
-        sizeDistribution[0.138] = 538;
-        sizeDistribution[0.14] = 541;
-        sizeDistribution[0.142] = 544;
-        sizeDistribution[0.144] = 548;
-        sizeDistribution[0.146] = 551;
-        sizeDistribution[0.148] = 555;
-        sizeDistribution[0.15] = 558;
-        sizeDistribution[0.152] = 561;
-        sizeDistribution[0.154] = 564;
-        sizeDistribution[0.156] = 567;
-        sizeDistribution[0.158] = 571;
-        sizeDistribution[0.16] = 574;
-        sizeDistribution[0.162] = 577;
-        sizeDistribution[0.164] = 581;
-        sizeDistribution[0.166] = 584;
-        sizeDistribution[0.168] = 587;
-        sizeDistribution[0.17] = 590;
-        sizeDistribution[0.172] = 594;
-        sizeDistribution[0.174] = 598;
-        sizeDistribution[0.176] = 601;
-        sizeDistribution[0.178] = 604;
-        sizeDistribution[0.18] = 608;
-        sizeDistribution[0.182] = 611;
-        sizeDistribution[0.184] = 614;
-        sizeDistribution[0.186] = 617;
-        sizeDistribution[0.188] = 620;
-        sizeDistribution[0.19] = 624;
-        sizeDistribution[0.192] = 628;
-        sizeDistribution[0.194] = 631;
-        sizeDistribution[0.196] = 635;
-        sizeDistribution[0.198] = 638;
-        sizeDistribution[0.2] = 641;
-        sizeDistribution[0.202] = 644;
-        sizeDistribution[0.204] = 647;
-        sizeDistribution[0.206] = 651;
-        sizeDistribution[0.208] = 654;
-        sizeDistribution[0.21] = 657;
-        sizeDistribution[0.212] = 660;
-        sizeDistribution[0.214] = 663;
-        sizeDistribution[0.216] = 666;
-        sizeDistribution[0.218] = 669;
-        sizeDistribution[0.22] = 673;
-        sizeDistribution[0.222] = 676;
-        sizeDistribution[0.224] = 679;
-        sizeDistribution[0.226] = 682;
-        sizeDistribution[0.228] = 685;
-        sizeDistribution[0.23] = 688;
-        sizeDistribution[0.232] = 691;
-        sizeDistribution[0.234] = 694;
-        sizeDistribution[0.236] = 697;
-        sizeDistribution[0.238] = 700;
-        sizeDistribution[0.24] = 703;
-        sizeDistribution[0.242] = 706;
-        sizeDistribution[0.244] = 709;
-        sizeDistribution[0.246] = 712;
-        sizeDistribution[0.248] = 715;
-        sizeDistribution[0.25] = 718;
-        sizeDistribution[0.252] = 721;
-        sizeDistribution[0.254] = 724;
-        sizeDistribution[0.256] = 727;
-        sizeDistribution[0.258] = 730;
-        sizeDistribution[0.26] = 733;
-        sizeDistribution[0.262] = 736;
-        sizeDistribution[0.264] = 739;
-        sizeDistribution[0.266] = 743;
-        sizeDistribution[0.268] = 746;
-        sizeDistribution[0.27] = 749;
-        sizeDistribution[0.272] = 752;
-        sizeDistribution[0.274] = 755;
-        sizeDistribution[0.276] = 758;
-        sizeDistribution[0.278] = 760;
-        sizeDistribution[0.28] = 763;
-        sizeDistribution[0.282] = 766;
-        sizeDistribution[0.284] = 769;
-        sizeDistribution[0.286] = 772;
-        sizeDistribution[0.288] = 775;
-        sizeDistribution[0.29] = 778;
-        sizeDistribution[0.292] = 781;
-        sizeDistribution[0.294] = 784;
-        sizeDistribution[0.296] = 787;
-        sizeDistribution[0.298] = 790;
-        sizeDistribution[0.3] = 793;
-        sizeDistribution[0.302] = 795;
-        sizeDistribution[0.304] = 798;
-        sizeDistribution[0.306] = 801;
-        sizeDistribution[0.308] = 804;
-        sizeDistribution[0.31] = 807;
-        sizeDistribution[0.312] = 809;
-        sizeDistribution[0.314] = 812;
-        sizeDistribution[0.316] = 815;
-        sizeDistribution[0.318] = 818;
-        sizeDistribution[0.32] = 821;
-        sizeDistribution[0.322] = 823;
-        sizeDistribution[0.324] = 826;
-        sizeDistribution[0.326] = 829;
-        sizeDistribution[0.328] = 832;
-        sizeDistribution[0.33] = 834;
-        sizeDistribution[0.332] = 838;
-        sizeDistribution[0.334] = 840;
-        sizeDistribution[0.336] = 843;
-        sizeDistribution[0.338] = 845;
-        sizeDistribution[0.34] = 848;
-        sizeDistribution[0.342] = 851;
-        sizeDistribution[0.344] = 854;
-        sizeDistribution[0.346] = 857;
-        sizeDistribution[0.348] = 859;
-        sizeDistribution[0.35] = 862;
-        sizeDistribution[0.352] = 865;
-        sizeDistribution[0.354] = 867;
-        sizeDistribution[0.356] = 870;
-        sizeDistribution[0.358] = 873;
-        sizeDistribution[0.36] = 876;
-        sizeDistribution[0.362] = 878;
-        sizeDistribution[0.364] = 881;
-        sizeDistribution[0.366] = 884;
-        sizeDistribution[0.368] = 886;
-        sizeDistribution[0.37] = 889;
-        sizeDistribution[0.372] = 892;
-        sizeDistribution[0.374] = 894;
-        sizeDistribution[0.376] = 896;
-        sizeDistribution[0.378] = 899;
-        sizeDistribution[0.38] = 902;
-        sizeDistribution[0.382] = 905;
-        sizeDistribution[0.384] = 907;
-        sizeDistribution[0.386] = 910;
-        sizeDistribution[0.388] = 913;
-        sizeDistribution[0.39] = 916;
-        sizeDistribution[0.392] = 918;
-        sizeDistribution[0.394] = 921;
-        sizeDistribution[0.396] = 924;
-        sizeDistribution[0.398] = 927;
-        sizeDistribution[0.4] = 930;
-        sizeDistribution[0.402] = 932;
-        sizeDistribution[0.404] = 935;
-        sizeDistribution[0.406] = 938;
-        sizeDistribution[0.408] = 941;
-        sizeDistribution[0.41] = 944;
-        sizeDistribution[0.412] = 946;
-        sizeDistribution[0.414] = 949;
-        sizeDistribution[0.416] = 952;
-        sizeDistribution[0.418] = 955;
-        sizeDistribution[0.42] = 957;
-        sizeDistribution[0.422] = 960;
-        sizeDistribution[0.424] = 963;
-        sizeDistribution[0.426] = 967;
-        sizeDistribution[0.428] = 970;
-        sizeDistribution[0.43] = 973;
-        sizeDistribution[0.432] = 976;
-        sizeDistribution[0.434] = 979;
-        sizeDistribution[0.436] = 983;
-        sizeDistribution[0.438] = 986;
-        sizeDistribution[0.44] = 989;
-        sizeDistribution[0.442] = 993;
-        sizeDistribution[0.444] = 997;
-        sizeDistribution[0.446] = 1001;
-        sizeDistribution[0.448] = 1006;
-        sizeDistribution[0.45] = 1010;
-        sizeDistribution[0.452] = 1014;
-        sizeDistribution[0.454] = 1019;
-        sizeDistribution[0.456] = 1024;
-        sizeDistribution[0.458] = 1028;
-        sizeDistribution[0.46] = 1033;
-        sizeDistribution[0.462] = 1038;
-        sizeDistribution[0.464] = 1043;
-        sizeDistribution[0.466] = 1048;
-        sizeDistribution[0.468] = 1053;
-        sizeDistribution[0.47] = 1059;
-        sizeDistribution[0.472] = 1064;
-        sizeDistribution[0.474] = 1069;
-        sizeDistribution[0.476] = 1075;
-        sizeDistribution[0.478] = 1081;
-        sizeDistribution[0.48] = 1086;
-        sizeDistribution[0.482] = 1094;
-        sizeDistribution[0.484] = 1101;
-        sizeDistribution[0.486] = 1107;
-        sizeDistribution[0.488] = 1114;
-        sizeDistribution[0.49] = 1122;
-        sizeDistribution[0.492] = 1129;
-        sizeDistribution[0.494] = 1138;
-        sizeDistribution[0.496] = 1146;
-        sizeDistribution[0.498] = 1154;
-        sizeDistribution[0.5] = 1163;
-        sizeDistribution[0.502] = 1171;
-        sizeDistribution[0.504] = 1179;
-        sizeDistribution[0.506] = 1187;
-        sizeDistribution[0.508] = 1198;
-        sizeDistribution[0.51] = 1207;
-        sizeDistribution[0.512] = 1217;
-        sizeDistribution[0.514] = 1227;
-        sizeDistribution[0.516] = 1239;
-        sizeDistribution[0.518] = 1253;
-        sizeDistribution[0.52] = 1267;
-        sizeDistribution[0.522] = 1278;
-        sizeDistribution[0.524] = 1291;
-        sizeDistribution[0.526] = 1303;
-        sizeDistribution[0.528] = 1314;
-        sizeDistribution[0.53] = 1327;
-        sizeDistribution[0.532] = 1340;
-        sizeDistribution[0.534] = 1353;
-        sizeDistribution[0.536] = 1368;
-        sizeDistribution[0.538] = 1384;
-        sizeDistribution[0.54] = 1399;
-        sizeDistribution[0.542] = 1414;
-        sizeDistribution[0.544] = 1431;
-        sizeDistribution[0.546] = 1447;
-        sizeDistribution[0.548] = 1469;
-        sizeDistribution[0.55] = 1490;
-        sizeDistribution[0.552] = 1509;
-        sizeDistribution[0.554] = 1533;
-        sizeDistribution[0.556] = 1553;
-        sizeDistribution[0.558] = 1574;
-        sizeDistribution[0.56] = 1602;
-        sizeDistribution[0.562] = 1628;
-        sizeDistribution[0.564] = 1655;
-        sizeDistribution[0.566] = 1682;
-        sizeDistribution[0.568] = 1711;
-        sizeDistribution[0.57] = 1740;
-        sizeDistribution[0.572] = 1769;
-        sizeDistribution[0.574] = 1798;
-        sizeDistribution[0.576] = 1828;
-        sizeDistribution[0.578] = 1859;
-        sizeDistribution[0.58] = 1893;
-        sizeDistribution[0.582] = 1929;
-        sizeDistribution[0.584] = 1964;
-        sizeDistribution[0.586] = 2000;
-        sizeDistribution[0.588] = 2037;
-        sizeDistribution[0.59] = 2074;
-        sizeDistribution[0.592] = 2111;
-        sizeDistribution[0.594] = 2151;
-        sizeDistribution[0.596] = 2185;
-        sizeDistribution[0.598] = 2228;
-        sizeDistribution[0.6] = 2263;
-        sizeDistribution[0.602] = 2304;
-        sizeDistribution[0.604] = 2341;
-        sizeDistribution[0.606] = 2379;
-        sizeDistribution[0.608] = 2416;
-        sizeDistribution[0.61] = 2454;
-        sizeDistribution[0.612] = 2489;
-        sizeDistribution[0.614] = 2530;
-        sizeDistribution[0.616] = 2569;
-        sizeDistribution[0.618] = 2612;
-        sizeDistribution[0.62] = 2652;
-        sizeDistribution[0.622] = 2689;
-        sizeDistribution[0.624] = 2730;
-        sizeDistribution[0.626] = 2767;
-        sizeDistribution[0.628] = 2807;
-        sizeDistribution[0.63] = 2845;
-        sizeDistribution[0.632] = 2881;
-        sizeDistribution[0.634] = 2921;
-        sizeDistribution[0.636] = 2969;
-        sizeDistribution[0.638] = 3017;
-        sizeDistribution[0.64] = 3065;
-        sizeDistribution[0.642] = 3110;
-        sizeDistribution[0.644] = 3152;
-        sizeDistribution[0.646] = 3204;
-        sizeDistribution[0.648] = 3256;
-        sizeDistribution[0.65] = 3308;
-        sizeDistribution[0.652] = 3354;
-        sizeDistribution[0.654] = 3404;
-        sizeDistribution[0.656] = 3452;
-        sizeDistribution[0.658] = 3501;
-        sizeDistribution[0.66] = 3543;
-        sizeDistribution[0.662] = 3594;
-        sizeDistribution[0.664] = 3652;
-        sizeDistribution[0.666] = 3709;
-        sizeDistribution[0.668] = 3773;
-        sizeDistribution[0.67] = 3842;
-        sizeDistribution[0.672] = 3909;
-        sizeDistribution[0.674] = 3967;
-        sizeDistribution[0.676] = 4030;
-        sizeDistribution[0.678] = 4096;
-        sizeDistribution[0.68] = 4157;
-        sizeDistribution[0.682] = 4218;
-        sizeDistribution[0.684] = 4276;
-        sizeDistribution[0.686] = 4341;
-        sizeDistribution[0.688] = 4402;
-        sizeDistribution[0.69] = 4463;
-        sizeDistribution[0.692] = 4529;
-        sizeDistribution[0.694] = 4580;
-        sizeDistribution[0.696] = 4637;
-        sizeDistribution[0.698] = 4691;
-        sizeDistribution[0.7] = 4746;
-        sizeDistribution[0.702] = 4804;
-        sizeDistribution[0.704] = 4869;
-        sizeDistribution[0.706] = 4934;
-        sizeDistribution[0.708] = 4998;
-        sizeDistribution[0.71] = 5066;
-        sizeDistribution[0.712] = 5132;
-        sizeDistribution[0.714] = 5200;
-        sizeDistribution[0.716] = 5277;
-        sizeDistribution[0.718] = 5344;
-        sizeDistribution[0.72] = 5421;
-        sizeDistribution[0.722] = 5497;
-        sizeDistribution[0.724] = 5576;
-        sizeDistribution[0.726] = 5655;
-        sizeDistribution[0.728] = 5740;
-        sizeDistribution[0.73] = 5822;
-        sizeDistribution[0.732] = 5912;
-        sizeDistribution[0.734] = 6017;
-        sizeDistribution[0.736] = 6109;
-        sizeDistribution[0.738] = 6199;
-        sizeDistribution[0.74] = 6278;
-        sizeDistribution[0.742] = 6379;
-        sizeDistribution[0.744] = 6492;
-        sizeDistribution[0.746] = 6590;
-        sizeDistribution[0.748] = 6700;
-        sizeDistribution[0.75] = 6805;
-        sizeDistribution[0.752] = 6935;
-        sizeDistribution[0.754] = 7080;
-        sizeDistribution[0.756] = 7216;
-        sizeDistribution[0.758] = 7347;
-        sizeDistribution[0.76] = 7473;
-        sizeDistribution[0.762] = 7598;
-        sizeDistribution[0.764] = 7726;
-        sizeDistribution[0.766] = 7831;
-        sizeDistribution[0.768] = 7945;
-        sizeDistribution[0.77] = 8062;
-        sizeDistribution[0.772] = 8175;
-        sizeDistribution[0.774] = 8284;
-        sizeDistribution[0.776] = 8386;
-        sizeDistribution[0.778] = 8503;
-        sizeDistribution[0.78] = 8626;
-        sizeDistribution[0.782] = 8748;
-        sizeDistribution[0.784] = 8850;
-        sizeDistribution[0.786] = 8969;
-        sizeDistribution[0.788] = 9089;
-        sizeDistribution[0.79] = 9193;
-        sizeDistribution[0.792] = 9308;
-        sizeDistribution[0.794] = 9406;
-        sizeDistribution[0.796] = 9509;
-        sizeDistribution[0.798] = 9610;
-        sizeDistribution[0.8] = 9697;
-        sizeDistribution[0.802] = 9795;
-        sizeDistribution[0.804] = 9897;
-        sizeDistribution[0.806] = 9999;
-        sizeDistribution[0.808] = 10107;
-        sizeDistribution[0.81] = 10212;
-        sizeDistribution[0.812] = 10320;
-        sizeDistribution[0.814] = 10425;
-        sizeDistribution[0.816] = 10530;
-        sizeDistribution[0.818] = 10630;
-        sizeDistribution[0.82] = 10741;
-        sizeDistribution[0.822] = 10840;
-        sizeDistribution[0.824] = 10923;
-        sizeDistribution[0.826] = 11024;
-        sizeDistribution[0.828] = 11114;
-        sizeDistribution[0.83] = 11191;
-        sizeDistribution[0.832] = 11288;
-        sizeDistribution[0.834] = 11391;
-        sizeDistribution[0.836] = 11488;
-        sizeDistribution[0.838] = 11590;
-        sizeDistribution[0.84] = 11684;
-        sizeDistribution[0.842] = 11785;
-        sizeDistribution[0.844] = 11885;
-        sizeDistribution[0.846] = 11988;
-        sizeDistribution[0.848] = 12106;
-        sizeDistribution[0.85] = 12179;
-        sizeDistribution[0.852] = 12291;
-        sizeDistribution[0.854] = 12389;
-        sizeDistribution[0.856] = 12487;
-        sizeDistribution[0.858] = 12584;
-        sizeDistribution[0.86] = 12686;
-        sizeDistribution[0.862] = 12802;
-        sizeDistribution[0.864] = 12901;
-        sizeDistribution[0.866] = 12992;
-        sizeDistribution[0.868] = 13082;
-        sizeDistribution[0.87] = 13174;
-        sizeDistribution[0.872] = 13255;
-        sizeDistribution[0.874] = 13339;
-        sizeDistribution[0.876] = 13436;
-        sizeDistribution[0.878] = 13520;
-        sizeDistribution[0.88] = 13630;
-        sizeDistribution[0.882] = 13706;
-        sizeDistribution[0.884] = 13770;
-        sizeDistribution[0.886] = 13856;
-        sizeDistribution[0.888] = 13952;
-        sizeDistribution[0.89] = 14022;
-        sizeDistribution[0.892] = 14124;
-        sizeDistribution[0.894] = 14211;
-        sizeDistribution[0.896] = 14295;
-        sizeDistribution[0.898] = 14383;
-        sizeDistribution[0.9] = 14450;
-        sizeDistribution[0.902] = 14534;
-        sizeDistribution[0.904] = 14616;
-        sizeDistribution[0.906] = 14714;
-        sizeDistribution[0.908] = 14808;
-        sizeDistribution[0.91] = 14887;
-        sizeDistribution[0.912] = 14990;
-        sizeDistribution[0.914] = 15105;
-        sizeDistribution[0.916] = 15208;
-        sizeDistribution[0.918] = 15296;
-        sizeDistribution[0.92] = 15390;
-        sizeDistribution[0.922] = 15506;
-        sizeDistribution[0.924] = 15649;
-        sizeDistribution[0.926] = 15775;
-        sizeDistribution[0.928] = 15937;
-        sizeDistribution[0.93] = 16076;
-        sizeDistribution[0.932] = 16232;
-        sizeDistribution[0.934] = 16387;
-        sizeDistribution[0.936] = 16553;
-        sizeDistribution[0.938] = 16710;
-        sizeDistribution[0.94] = 16868;
-        sizeDistribution[0.942] = 17022;
-        sizeDistribution[0.944] = 17210;
-        sizeDistribution[0.946] = 17385;
-        sizeDistribution[0.948] = 17632;
-        sizeDistribution[0.95] = 17850;
-        sizeDistribution[0.952] = 18071;
-        sizeDistribution[0.954] = 18293;
-        sizeDistribution[0.956] = 18530;
-        sizeDistribution[0.958] = 18804;
-        sizeDistribution[0.96] = 19102;
-        sizeDistribution[0.962] = 19386;
-        sizeDistribution[0.964] = 19708;
-        sizeDistribution[0.966] = 20082;
-        sizeDistribution[0.968] = 20469;
-        sizeDistribution[0.97] = 20807;
-        sizeDistribution[0.972] = 21209;
-        sizeDistribution[0.974] = 21658;
-        sizeDistribution[0.976] = 22160;
-        sizeDistribution[0.978] = 22953;
-        sizeDistribution[0.98] = 24049;
-        sizeDistribution[0.982] = 25508;
-        sizeDistribution[0.984] = 26955;
-        sizeDistribution[0.986] = 28579;
-        sizeDistribution[0.988] = 29736;
-        sizeDistribution[0.99] = 31210;
-        sizeDistribution[0.992] = 33586;
-        sizeDistribution[0.994] = 40969;
-        sizeDistribution[0.996] = 49343;
-        sizeDistribution[0.998] = 136026;
-        sizeDistribution[1] = 316528;
-        break;
-    case 2: // 1080p-dark
-        sizeDistribution[0] = 66;
-        sizeDistribution[0.002] = 85;
-        sizeDistribution[0.004] = 91;
-        sizeDistribution[0.006] = 96;
-        sizeDistribution[0.008] = 101;
-        sizeDistribution[0.01] = 106;
-        sizeDistribution[0.012] = 112;
-        sizeDistribution[0.014] = 119;
-        sizeDistribution[0.016] = 128;
-        sizeDistribution[0.018] = 140;
-        sizeDistribution[0.02] = 152;
-        sizeDistribution[0.022] = 163;
-        sizeDistribution[0.024] = 173;
-        sizeDistribution[0.026] = 180;
-        sizeDistribution[0.028] = 187;
-        sizeDistribution[0.03] = 195;
-        sizeDistribution[0.032] = 200;
-        sizeDistribution[0.034] = 206;
-        sizeDistribution[0.036] = 213;
-        sizeDistribution[0.038] = 219;
-        sizeDistribution[0.04] = 224;
-        sizeDistribution[0.042] = 229;
-        sizeDistribution[0.044] = 233;
-        sizeDistribution[0.046] = 238;
-        sizeDistribution[0.048] = 243;
-        sizeDistribution[0.05] = 248;
-        sizeDistribution[0.052] = 254;
-        sizeDistribution[0.054] = 258;
-        sizeDistribution[0.056] = 263;
-        sizeDistribution[0.058] = 268;
-        sizeDistribution[0.06] = 272;
-        sizeDistribution[0.062] = 277;
-        sizeDistribution[0.064] = 282;
-        sizeDistribution[0.066] = 286;
-        sizeDistribution[0.068] = 291;
-        sizeDistribution[0.07] = 296;
-        sizeDistribution[0.072] = 300;
-        sizeDistribution[0.074] = 305;
-        sizeDistribution[0.076] = 310;
-        sizeDistribution[0.078] = 314;
-        sizeDistribution[0.08] = 319;
-        sizeDistribution[0.082] = 324;
-        sizeDistribution[0.084] = 330;
-        sizeDistribution[0.086] = 335;
-        sizeDistribution[0.088] = 341;
-        sizeDistribution[0.09] = 347;
-        sizeDistribution[0.092] = 353;
-        sizeDistribution[0.094] = 359;
-        sizeDistribution[0.096] = 365;
-        sizeDistribution[0.098] = 371;
-        sizeDistribution[0.1] = 378;
-        sizeDistribution[0.102] = 384;
-        sizeDistribution[0.104] = 390;
-        sizeDistribution[0.106] = 397;
-        sizeDistribution[0.108] = 404;
-        sizeDistribution[0.11] = 410;
-        sizeDistribution[0.112] = 417;
-        sizeDistribution[0.114] = 424;
-        sizeDistribution[0.116] = 431;
-        sizeDistribution[0.118] = 438;
-        sizeDistribution[0.12] = 445;
-        sizeDistribution[0.122] = 452;
-        sizeDistribution[0.124] = 458;
-        sizeDistribution[0.126] = 465;
-        sizeDistribution[0.128] = 472;
-        sizeDistribution[0.13] = 480;
-        sizeDistribution[0.132] = 486;
-        sizeDistribution[0.134] = 493;
-        sizeDistribution[0.136] = 499;
-        sizeDistribution[0.138] = 506;
-        sizeDistribution[0.14] = 513;
-        sizeDistribution[0.142] = 519;
-        sizeDistribution[0.144] = 526;
-        sizeDistribution[0.146] = 532;
-        sizeDistribution[0.148] = 539;
-        sizeDistribution[0.15] = 545;
-        sizeDistribution[0.152] = 552;
-        sizeDistribution[0.154] = 558;
-        sizeDistribution[0.156] = 564;
-        sizeDistribution[0.158] = 572;
-        sizeDistribution[0.16] = 578;
-        sizeDistribution[0.162] = 586;
-        sizeDistribution[0.164] = 593;
-        sizeDistribution[0.166] = 599;
-        sizeDistribution[0.168] = 606;
-        sizeDistribution[0.17] = 613;
-        sizeDistribution[0.172] = 620;
-        sizeDistribution[0.174] = 627;
-        sizeDistribution[0.176] = 633;
-        sizeDistribution[0.178] = 641;
-        sizeDistribution[0.18] = 648;
-        sizeDistribution[0.182] = 655;
-        sizeDistribution[0.184] = 661;
-        sizeDistribution[0.186] = 668;
-        sizeDistribution[0.188] = 676;
-        sizeDistribution[0.19] = 683;
-        sizeDistribution[0.192] = 692;
-        sizeDistribution[0.194] = 700;
-        sizeDistribution[0.196] = 707;
-        sizeDistribution[0.198] = 714;
-        sizeDistribution[0.2] = 722;
-        sizeDistribution[0.202] = 729;
-        sizeDistribution[0.204] = 736;
-        sizeDistribution[0.206] = 743;
-        sizeDistribution[0.208] = 749;
-        sizeDistribution[0.21] = 756;
-        sizeDistribution[0.212] = 763;
-        sizeDistribution[0.214] = 770;
-        sizeDistribution[0.216] = 777;
-        sizeDistribution[0.218] = 783;
-        sizeDistribution[0.22] = 790;
-        sizeDistribution[0.222] = 796;
-        sizeDistribution[0.224] = 801;
-        sizeDistribution[0.226] = 807;
-        sizeDistribution[0.228] = 813;
-        sizeDistribution[0.23] = 818;
-        sizeDistribution[0.232] = 824;
-        sizeDistribution[0.234] = 829;
-        sizeDistribution[0.236] = 834;
-        sizeDistribution[0.238] = 839;
-        sizeDistribution[0.24] = 845;
-        sizeDistribution[0.242] = 850;
-        sizeDistribution[0.244] = 855;
-        sizeDistribution[0.246] = 860;
-        sizeDistribution[0.248] = 865;
-        sizeDistribution[0.25] = 871;
-        sizeDistribution[0.252] = 876;
-        sizeDistribution[0.254] = 881;
-        sizeDistribution[0.256] = 886;
-        sizeDistribution[0.258] = 892;
-        sizeDistribution[0.26] = 898;
-        sizeDistribution[0.262] = 902;
-        sizeDistribution[0.264] = 907;
-        sizeDistribution[0.266] = 913;
-        sizeDistribution[0.268] = 919;
-        sizeDistribution[0.27] = 924;
-        sizeDistribution[0.272] = 929;
-        sizeDistribution[0.274] = 934;
-        sizeDistribution[0.276] = 939;
-        sizeDistribution[0.278] = 944;
-        sizeDistribution[0.28] = 950;
-        sizeDistribution[0.282] = 955;
-        sizeDistribution[0.284] = 960;
-        sizeDistribution[0.286] = 965;
-        sizeDistribution[0.288] = 970;
-        sizeDistribution[0.29] = 975;
-        sizeDistribution[0.292] = 979;
-        sizeDistribution[0.294] = 983;
-        sizeDistribution[0.296] = 989;
-        sizeDistribution[0.298] = 994;
-        sizeDistribution[0.3] = 999;
-        sizeDistribution[0.302] = 1004;
-        sizeDistribution[0.304] = 1009;
-        sizeDistribution[0.306] = 1014;
-        sizeDistribution[0.308] = 1020;
-        sizeDistribution[0.31] = 1026;
-        sizeDistribution[0.312] = 1031;
-        sizeDistribution[0.314] = 1036;
-        sizeDistribution[0.316] = 1042;
-        sizeDistribution[0.318] = 1048;
-        sizeDistribution[0.32] = 1054;
-        sizeDistribution[0.322] = 1060;
-        sizeDistribution[0.324] = 1066;
-        sizeDistribution[0.326] = 1072;
-        sizeDistribution[0.328] = 1078;
-        sizeDistribution[0.33] = 1084;
-        sizeDistribution[0.332] = 1090;
-        sizeDistribution[0.334] = 1097;
-        sizeDistribution[0.336] = 1104;
-        sizeDistribution[0.338] = 1112;
-        sizeDistribution[0.34] = 1118;
-        sizeDistribution[0.342] = 1125;
-        sizeDistribution[0.344] = 1132;
-        sizeDistribution[0.346] = 1140;
-        sizeDistribution[0.348] = 1148;
-        sizeDistribution[0.35] = 1155;
-        sizeDistribution[0.352] = 1163;
-        sizeDistribution[0.354] = 1170;
-        sizeDistribution[0.356] = 1178;
-        sizeDistribution[0.358] = 1185;
-        sizeDistribution[0.36] = 1192;
-        sizeDistribution[0.362] = 1200;
-        sizeDistribution[0.364] = 1208;
-        sizeDistribution[0.366] = 1217;
-        sizeDistribution[0.368] = 1225;
-        sizeDistribution[0.37] = 1233;
-        sizeDistribution[0.372] = 1240;
-        sizeDistribution[0.374] = 1248;
-        sizeDistribution[0.376] = 1256;
-        sizeDistribution[0.378] = 1263;
-        sizeDistribution[0.38] = 1270;
-        sizeDistribution[0.382] = 1277;
-        sizeDistribution[0.384] = 1284;
-        sizeDistribution[0.386] = 1291;
-        sizeDistribution[0.388] = 1298;
-        sizeDistribution[0.39] = 1306;
-        sizeDistribution[0.392] = 1312;
-        sizeDistribution[0.394] = 1318;
-        sizeDistribution[0.396] = 1325;
-        sizeDistribution[0.398] = 1333;
-        sizeDistribution[0.4] = 1340;
-        sizeDistribution[0.402] = 1347;
-        sizeDistribution[0.404] = 1354;
-        sizeDistribution[0.406] = 1361;
-        sizeDistribution[0.408] = 1369;
-        sizeDistribution[0.41] = 1376;
-        sizeDistribution[0.412] = 1384;
-        sizeDistribution[0.414] = 1392;
-        sizeDistribution[0.416] = 1399;
-        sizeDistribution[0.418] = 1406;
-        sizeDistribution[0.42] = 1413;
-        sizeDistribution[0.422] = 1420;
-        sizeDistribution[0.424] = 1427;
-        sizeDistribution[0.426] = 1436;
-        sizeDistribution[0.428] = 1443;
-        sizeDistribution[0.43] = 1451;
-        sizeDistribution[0.432] = 1458;
-        sizeDistribution[0.434] = 1467;
-        sizeDistribution[0.436] = 1475;
-        sizeDistribution[0.438] = 1482;
-        sizeDistribution[0.44] = 1491;
-        sizeDistribution[0.442] = 1499;
-        sizeDistribution[0.444] = 1507;
-        sizeDistribution[0.446] = 1515;
-        sizeDistribution[0.448] = 1523;
-        sizeDistribution[0.45] = 1531;
-        sizeDistribution[0.452] = 1541;
-        sizeDistribution[0.454] = 1551;
-        sizeDistribution[0.456] = 1560;
-        sizeDistribution[0.458] = 1569;
-        sizeDistribution[0.46] = 1578;
-        sizeDistribution[0.462] = 1587;
-        sizeDistribution[0.464] = 1596;
-        sizeDistribution[0.466] = 1604;
-        sizeDistribution[0.468] = 1612;
-        sizeDistribution[0.47] = 1622;
-        sizeDistribution[0.472] = 1630;
-        sizeDistribution[0.474] = 1639;
-        sizeDistribution[0.476] = 1647;
-        sizeDistribution[0.478] = 1657;
-        sizeDistribution[0.48] = 1666;
-        sizeDistribution[0.482] = 1674;
-        sizeDistribution[0.484] = 1683;
-        sizeDistribution[0.486] = 1692;
-        sizeDistribution[0.488] = 1701;
-        sizeDistribution[0.49] = 1711;
-        sizeDistribution[0.492] = 1720;
-        sizeDistribution[0.494] = 1729;
-        sizeDistribution[0.496] = 1739;
-        sizeDistribution[0.498] = 1749;
-        sizeDistribution[0.5] = 1759;
-        sizeDistribution[0.502] = 1769;
-        sizeDistribution[0.504] = 1779;
-        sizeDistribution[0.506] = 1788;
-        sizeDistribution[0.508] = 1798;
-        sizeDistribution[0.51] = 1809;
-        sizeDistribution[0.512] = 1819;
-        sizeDistribution[0.514] = 1829;
-        sizeDistribution[0.516] = 1840;
-        sizeDistribution[0.518] = 1851;
-        sizeDistribution[0.52] = 1862;
-        sizeDistribution[0.522] = 1872;
-        sizeDistribution[0.524] = 1882;
-        sizeDistribution[0.526] = 1892;
-        sizeDistribution[0.528] = 1905;
-        sizeDistribution[0.53] = 1917;
-        sizeDistribution[0.532] = 1928;
-        sizeDistribution[0.534] = 1941;
-        sizeDistribution[0.536] = 1952;
-        sizeDistribution[0.538] = 1966;
-        sizeDistribution[0.54] = 1977;
-        sizeDistribution[0.542] = 1990;
-        sizeDistribution[0.544] = 2004;
-        sizeDistribution[0.546] = 2017;
-        sizeDistribution[0.548] = 2031;
-        sizeDistribution[0.55] = 2044;
-        sizeDistribution[0.552] = 2058;
-        sizeDistribution[0.554] = 2072;
-        sizeDistribution[0.556] = 2087;
-        sizeDistribution[0.558] = 2100;
-        sizeDistribution[0.56] = 2115;
-        sizeDistribution[0.562] = 2131;
-        sizeDistribution[0.564] = 2147;
-        sizeDistribution[0.566] = 2163;
-        sizeDistribution[0.568] = 2176;
-        sizeDistribution[0.57] = 2191;
-        sizeDistribution[0.572] = 2207;
-        sizeDistribution[0.574] = 2224;
-        sizeDistribution[0.576] = 2239;
-        sizeDistribution[0.578] = 2254;
-        sizeDistribution[0.58] = 2271;
-        sizeDistribution[0.582] = 2288;
-        sizeDistribution[0.584] = 2304;
-        sizeDistribution[0.586] = 2323;
-        sizeDistribution[0.588] = 2340;
-        sizeDistribution[0.59] = 2359;
-        sizeDistribution[0.592] = 2379;
-        sizeDistribution[0.594] = 2398;
-        sizeDistribution[0.596] = 2417;
-        sizeDistribution[0.598] = 2433;
-        sizeDistribution[0.6] = 2453;
-        sizeDistribution[0.602] = 2472;
-        sizeDistribution[0.604] = 2492;
-        sizeDistribution[0.606] = 2515;
-        sizeDistribution[0.608] = 2536;
-        sizeDistribution[0.61] = 2557;
-        sizeDistribution[0.612] = 2578;
-        sizeDistribution[0.614] = 2599;
-        sizeDistribution[0.616] = 2621;
-        sizeDistribution[0.618] = 2646;
-        sizeDistribution[0.62] = 2670;
-        sizeDistribution[0.622] = 2694;
-        sizeDistribution[0.624] = 2719;
-        sizeDistribution[0.626] = 2744;
-        sizeDistribution[0.628] = 2770;
-        sizeDistribution[0.63] = 2794;
-        sizeDistribution[0.632] = 2818;
-        sizeDistribution[0.634] = 2841;
-        sizeDistribution[0.636] = 2870;
-        sizeDistribution[0.638] = 2895;
-        sizeDistribution[0.64] = 2923;
-        sizeDistribution[0.642] = 2952;
-        sizeDistribution[0.644] = 2980;
-        sizeDistribution[0.646] = 3006;
-        sizeDistribution[0.648] = 3033;
-        sizeDistribution[0.65] = 3063;
-        sizeDistribution[0.652] = 3092;
-        sizeDistribution[0.654] = 3117;
-        sizeDistribution[0.656] = 3144;
-        sizeDistribution[0.658] = 3174;
-        sizeDistribution[0.66] = 3201;
-        sizeDistribution[0.662] = 3228;
-        sizeDistribution[0.664] = 3254;
-        sizeDistribution[0.666] = 3281;
-        sizeDistribution[0.668] = 3310;
-        sizeDistribution[0.67] = 3340;
-        sizeDistribution[0.672] = 3369;
-        sizeDistribution[0.674] = 3398;
-        sizeDistribution[0.676] = 3427;
-        sizeDistribution[0.678] = 3457;
-        sizeDistribution[0.68] = 3483;
-        sizeDistribution[0.682] = 3513;
-        sizeDistribution[0.684] = 3545;
-        sizeDistribution[0.686] = 3575;
-        sizeDistribution[0.688] = 3606;
-        sizeDistribution[0.69] = 3637;
-        sizeDistribution[0.692] = 3667;
-        sizeDistribution[0.694] = 3697;
-        sizeDistribution[0.696] = 3725;
-        sizeDistribution[0.698] = 3756;
-        sizeDistribution[0.7] = 3791;
-        sizeDistribution[0.702] = 3820;
-        sizeDistribution[0.704] = 3849;
-        sizeDistribution[0.706] = 3880;
-        sizeDistribution[0.708] = 3910;
-        sizeDistribution[0.71] = 3941;
-        sizeDistribution[0.712] = 3975;
-        sizeDistribution[0.714] = 4011;
-        sizeDistribution[0.716] = 4043;
-        sizeDistribution[0.718] = 4079;
-        sizeDistribution[0.72] = 4116;
-        sizeDistribution[0.722] = 4148;
-        sizeDistribution[0.724] = 4186;
-        sizeDistribution[0.726] = 4222;
-        sizeDistribution[0.728] = 4256;
-        sizeDistribution[0.73] = 4289;
-        sizeDistribution[0.732] = 4324;
-        sizeDistribution[0.734] = 4358;
-        sizeDistribution[0.736] = 4390;
-        sizeDistribution[0.738] = 4425;
-        sizeDistribution[0.74] = 4461;
-        sizeDistribution[0.742] = 4497;
-        sizeDistribution[0.744] = 4533;
-        sizeDistribution[0.746] = 4571;
-        sizeDistribution[0.748] = 4610;
-        sizeDistribution[0.75] = 4645;
-        sizeDistribution[0.752] = 4677;
-        sizeDistribution[0.754] = 4714;
-        sizeDistribution[0.756] = 4752;
-        sizeDistribution[0.758] = 4793;
-        sizeDistribution[0.76] = 4830;
-        sizeDistribution[0.762] = 4867;
-        sizeDistribution[0.764] = 4902;
-        sizeDistribution[0.766] = 4939;
-        sizeDistribution[0.768] = 4980;
-        sizeDistribution[0.77] = 5022;
-        sizeDistribution[0.772] = 5060;
-        sizeDistribution[0.774] = 5098;
-        sizeDistribution[0.776] = 5136;
-        sizeDistribution[0.778] = 5177;
-        sizeDistribution[0.78] = 5217;
-        sizeDistribution[0.782] = 5262;
-        sizeDistribution[0.784] = 5304;
-        sizeDistribution[0.786] = 5346;
-        sizeDistribution[0.788] = 5391;
-        sizeDistribution[0.79] = 5433;
-        sizeDistribution[0.792] = 5481;
-        sizeDistribution[0.794] = 5528;
-        sizeDistribution[0.796] = 5574;
-        sizeDistribution[0.798] = 5613;
-        sizeDistribution[0.8] = 5653;
-        sizeDistribution[0.802] = 5692;
-        sizeDistribution[0.804] = 5734;
-        sizeDistribution[0.806] = 5775;
-        sizeDistribution[0.808] = 5811;
-        sizeDistribution[0.81] = 5848;
-        sizeDistribution[0.812] = 5891;
-        sizeDistribution[0.814] = 5933;
-        sizeDistribution[0.816] = 5977;
-        sizeDistribution[0.818] = 6020;
-        sizeDistribution[0.82] = 6063;
-        sizeDistribution[0.822] = 6111;
-        sizeDistribution[0.824] = 6153;
-        sizeDistribution[0.826] = 6200;
-        sizeDistribution[0.828] = 6245;
-        sizeDistribution[0.83] = 6291;
-        sizeDistribution[0.832] = 6340;
-        sizeDistribution[0.834] = 6387;
-        sizeDistribution[0.836] = 6433;
-        sizeDistribution[0.838] = 6483;
-        sizeDistribution[0.84] = 6531;
-        sizeDistribution[0.842] = 6585;
-        sizeDistribution[0.844] = 6636;
-        sizeDistribution[0.846] = 6680;
-        sizeDistribution[0.848] = 6725;
-        sizeDistribution[0.85] = 6774;
-        sizeDistribution[0.852] = 6825;
-        sizeDistribution[0.854] = 6876;
-        sizeDistribution[0.856] = 6923;
-        sizeDistribution[0.858] = 6980;
-        sizeDistribution[0.86] = 7042;
-        sizeDistribution[0.862] = 7099;
-        sizeDistribution[0.864] = 7150;
-        sizeDistribution[0.866] = 7213;
-        sizeDistribution[0.868] = 7264;
-        sizeDistribution[0.87] = 7311;
-        sizeDistribution[0.872] = 7365;
-        sizeDistribution[0.874] = 7421;
-        sizeDistribution[0.876] = 7484;
-        sizeDistribution[0.878] = 7541;
-        sizeDistribution[0.88] = 7604;
-        sizeDistribution[0.882] = 7658;
-        sizeDistribution[0.884] = 7723;
-        sizeDistribution[0.886] = 7789;
-        sizeDistribution[0.888] = 7854;
-        sizeDistribution[0.89] = 7933;
-        sizeDistribution[0.892] = 7994;
-        sizeDistribution[0.894] = 8067;
-        sizeDistribution[0.896] = 8126;
-        sizeDistribution[0.898] = 8184;
-        sizeDistribution[0.9] = 8248;
-        sizeDistribution[0.902] = 8311;
-        sizeDistribution[0.904] = 8384;
-        sizeDistribution[0.906] = 8450;
-        sizeDistribution[0.908] = 8530;
-        sizeDistribution[0.91] = 8611;
-        sizeDistribution[0.912] = 8702;
-        sizeDistribution[0.914] = 8792;
-        sizeDistribution[0.916] = 8887;
-        sizeDistribution[0.918] = 8974;
-        sizeDistribution[0.92] = 9055;
-        sizeDistribution[0.922] = 9129;
-        sizeDistribution[0.924] = 9208;
-        sizeDistribution[0.926] = 9288;
-        sizeDistribution[0.928] = 9367;
-        sizeDistribution[0.93] = 9455;
-        sizeDistribution[0.932] = 9544;
-        sizeDistribution[0.934] = 9633;
-        sizeDistribution[0.936] = 9748;
-        sizeDistribution[0.938] = 9861;
-        sizeDistribution[0.94] = 9965;
-        sizeDistribution[0.942] = 10067;
-        sizeDistribution[0.944] = 10164;
-        sizeDistribution[0.946] = 10281;
-        sizeDistribution[0.948] = 10402;
-        sizeDistribution[0.95] = 10527;
-        sizeDistribution[0.952] = 10687;
-        sizeDistribution[0.954] = 10808;
-        sizeDistribution[0.956] = 10972;
-        sizeDistribution[0.958] = 11117;
-        sizeDistribution[0.96] = 11253;
-        sizeDistribution[0.962] = 11407;
-        sizeDistribution[0.964] = 11573;
-        sizeDistribution[0.966] = 11724;
-        sizeDistribution[0.968] = 11888;
-        sizeDistribution[0.97] = 12075;
-        sizeDistribution[0.972] = 12276;
-        sizeDistribution[0.974] = 12457;
-        sizeDistribution[0.976] = 12670;
-        sizeDistribution[0.978] = 12872;
-        sizeDistribution[0.98] = 13094;
-        sizeDistribution[0.982] = 13330;
-        sizeDistribution[0.984] = 13624;
-        sizeDistribution[0.986] = 13959;
-        sizeDistribution[0.988] = 14483;
-        sizeDistribution[0.99] = 15238;
-        sizeDistribution[0.992] = 16111;
-        sizeDistribution[0.994] = 17013;
-        sizeDistribution[0.996] = 20675;
-        sizeDistribution[0.998] = 45077;
-        sizeDistribution[1] = 124056;
-        break;
-    case 3: // 720p-bright
-        sizeDistribution[0] = 88;
-        sizeDistribution[0.001] = 137;
-        sizeDistribution[0.002] = 151;
-        sizeDistribution[0.003] = 159;
-        sizeDistribution[0.004] = 165;
-        sizeDistribution[0.005] = 170;
-        sizeDistribution[0.006] = 175;
-        sizeDistribution[0.007] = 179;
-        sizeDistribution[0.008] = 182;
-        sizeDistribution[0.009] = 186;
-        sizeDistribution[0.01] = 189;
-        sizeDistribution[0.011] = 193;
-        sizeDistribution[0.012] = 196;
-        sizeDistribution[0.013] = 200;
-        sizeDistribution[0.014] = 203;
-        sizeDistribution[0.015] = 206;
-        sizeDistribution[0.016] = 208;
-        sizeDistribution[0.017] = 211;
-        sizeDistribution[0.018] = 214;
-        sizeDistribution[0.019] = 217;
-        sizeDistribution[0.02] = 220;
-        sizeDistribution[0.021] = 222;
-        sizeDistribution[0.022] = 225;
-        sizeDistribution[0.023] = 227;
-        sizeDistribution[0.024] = 230;
-        sizeDistribution[0.025] = 233;
-        sizeDistribution[0.026] = 235;
-        sizeDistribution[0.027] = 238;
-        sizeDistribution[0.028] = 241;
-        sizeDistribution[0.029] = 243;
-        sizeDistribution[0.03] = 246;
-        sizeDistribution[0.031] = 249;
-        sizeDistribution[0.032] = 251;
-        sizeDistribution[0.033] = 254;
-        sizeDistribution[0.034] = 257;
-        sizeDistribution[0.035] = 259;
-        sizeDistribution[0.036] = 262;
-        sizeDistribution[0.037] = 265;
-        sizeDistribution[0.038] = 267;
-        sizeDistribution[0.039] = 270;
-        sizeDistribution[0.04] = 272;
-        sizeDistribution[0.041] = 275;
-        sizeDistribution[0.042] = 277;
-        sizeDistribution[0.043] = 280;
-        sizeDistribution[0.044] = 283;
-        sizeDistribution[0.045] = 285;
-        sizeDistribution[0.046] = 288;
-        sizeDistribution[0.047] = 291;
-        sizeDistribution[0.048] = 293;
-        sizeDistribution[0.049] = 296;
-        sizeDistribution[0.05] = 298;
-        sizeDistribution[0.051] = 301;
-        sizeDistribution[0.052] = 304;
-        sizeDistribution[0.053] = 306;
-        sizeDistribution[0.054] = 309;
-        sizeDistribution[0.055] = 311;
-        sizeDistribution[0.056] = 314;
-        sizeDistribution[0.057] = 316;
-        sizeDistribution[0.058] = 319;
-        sizeDistribution[0.059] = 322;
-        sizeDistribution[0.06] = 324;
-        sizeDistribution[0.061] = 326;
-        sizeDistribution[0.062] = 329;
-        sizeDistribution[0.063] = 331;
-        sizeDistribution[0.064] = 334;
-        sizeDistribution[0.065] = 336;
-        sizeDistribution[0.066] = 338;
-        sizeDistribution[0.067] = 341;
-        sizeDistribution[0.068] = 343;
-        sizeDistribution[0.069] = 346;
-        sizeDistribution[0.07] = 348;
-        sizeDistribution[0.071] = 351;
-        sizeDistribution[0.072] = 353;
-        sizeDistribution[0.073] = 355;
-        sizeDistribution[0.074] = 358;
-        sizeDistribution[0.075] = 360;
-        sizeDistribution[0.076] = 363;
-        sizeDistribution[0.077] = 365;
-        sizeDistribution[0.078] = 368;
-        sizeDistribution[0.079] = 370;
-        sizeDistribution[0.08] = 373;
-        sizeDistribution[0.081] = 376;
-        sizeDistribution[0.082] = 378;
-        sizeDistribution[0.083] = 381;
-        sizeDistribution[0.084] = 383;
-        sizeDistribution[0.085] = 386;
-        sizeDistribution[0.086] = 389;
-        sizeDistribution[0.087] = 391;
-        sizeDistribution[0.088] = 394;
-        sizeDistribution[0.089] = 397;
-        sizeDistribution[0.09] = 399;
-        sizeDistribution[0.091] = 402;
-        sizeDistribution[0.092] = 404;
-        sizeDistribution[0.093] = 407;
-        sizeDistribution[0.094] = 409;
-        sizeDistribution[0.095] = 412;
-        sizeDistribution[0.096] = 414;
-        sizeDistribution[0.097] = 417;
-        sizeDistribution[0.098] = 420;
-        sizeDistribution[0.099] = 422;
-        sizeDistribution[0.1] = 425;
-        sizeDistribution[0.101] = 427;
-        sizeDistribution[0.102] = 430;
-        sizeDistribution[0.103] = 433;
-        sizeDistribution[0.104] = 435;
-        sizeDistribution[0.105] = 438;
-        sizeDistribution[0.106] = 441;
-        sizeDistribution[0.107] = 443;
-        sizeDistribution[0.108] = 446;
-        sizeDistribution[0.109] = 448;
-        sizeDistribution[0.11] = 451;
-        sizeDistribution[0.111] = 454;
-        sizeDistribution[0.112] = 457;
-        sizeDistribution[0.113] = 460;
-        sizeDistribution[0.114] = 463;
-        sizeDistribution[0.115] = 465;
-        sizeDistribution[0.116] = 468;
-        sizeDistribution[0.117] = 471;
-        sizeDistribution[0.118] = 473;
-        sizeDistribution[0.119] = 476;
-        sizeDistribution[0.12] = 479;
-        sizeDistribution[0.121] = 482;
-        sizeDistribution[0.122] = 485;
-        sizeDistribution[0.123] = 487;
-        sizeDistribution[0.124] = 490;
-        sizeDistribution[0.125] = 493;
-        sizeDistribution[0.126] = 495;
-        sizeDistribution[0.127] = 498;
-        sizeDistribution[0.128] = 500;
-        sizeDistribution[0.129] = 503;
-        sizeDistribution[0.13] = 506;
-        sizeDistribution[0.131] = 509;
-        sizeDistribution[0.132] = 511;
-        sizeDistribution[0.133] = 514;
-        sizeDistribution[0.134] = 517;
-        sizeDistribution[0.135] = 520;
-        sizeDistribution[0.136] = 523;
-        sizeDistribution[0.137] = 525;
-        sizeDistribution[0.138] = 528;
-        sizeDistribution[0.139] = 531;
-        sizeDistribution[0.14] = 534;
-        sizeDistribution[0.141] = 537;
-        sizeDistribution[0.142] = 540;
-        sizeDistribution[0.143] = 542;
-        sizeDistribution[0.144] = 545;
-        sizeDistribution[0.145] = 548;
-        sizeDistribution[0.146] = 550;
-        sizeDistribution[0.147] = 553;
-        sizeDistribution[0.148] = 556;
-        sizeDistribution[0.149] = 558;
-        sizeDistribution[0.15] = 561;
-        sizeDistribution[0.151] = 564;
-        sizeDistribution[0.152] = 566;
-        sizeDistribution[0.153] = 569;
-        sizeDistribution[0.154] = 571;
-        sizeDistribution[0.155] = 574;
-        sizeDistribution[0.156] = 577;
-        sizeDistribution[0.157] = 579;
-        sizeDistribution[0.158] = 582;
-        sizeDistribution[0.159] = 584;
-        sizeDistribution[0.16] = 587;
-        sizeDistribution[0.161] = 589;
-        sizeDistribution[0.162] = 592;
-        sizeDistribution[0.163] = 594;
-        sizeDistribution[0.164] = 596;
-        sizeDistribution[0.165] = 599;
-        sizeDistribution[0.166] = 601;
-        sizeDistribution[0.167] = 603;
-        sizeDistribution[0.168] = 606;
-        sizeDistribution[0.169] = 608;
-        sizeDistribution[0.17] = 610;
-        sizeDistribution[0.171] = 613;
-        sizeDistribution[0.172] = 615;
-        sizeDistribution[0.173] = 617;
-        sizeDistribution[0.174] = 620;
-        sizeDistribution[0.175] = 622;
-        sizeDistribution[0.176] = 624;
-        sizeDistribution[0.177] = 626;
-        sizeDistribution[0.178] = 629;
-        sizeDistribution[0.179] = 631;
-        sizeDistribution[0.18] = 634;
-        sizeDistribution[0.181] = 636;
-        sizeDistribution[0.182] = 638;
-        sizeDistribution[0.183] = 641;
-        sizeDistribution[0.184] = 643;
-        sizeDistribution[0.185] = 646;
-        sizeDistribution[0.186] = 648;
-        sizeDistribution[0.187] = 650;
-        sizeDistribution[0.188] = 653;
-        sizeDistribution[0.189] = 655;
-        sizeDistribution[0.19] = 658;
-        sizeDistribution[0.191] = 660;
-        sizeDistribution[0.192] = 663;
-        sizeDistribution[0.193] = 665;
-        sizeDistribution[0.194] = 668;
-        sizeDistribution[0.195] = 670;
-        sizeDistribution[0.196] = 672;
-        sizeDistribution[0.197] = 675;
-        sizeDistribution[0.198] = 677;
-        sizeDistribution[0.199] = 679;
-        sizeDistribution[0.2] = 682;
-        sizeDistribution[0.201] = 684;
-        sizeDistribution[0.202] = 687;
-        sizeDistribution[0.203] = 690;
-        sizeDistribution[0.204] = 692;
-        sizeDistribution[0.205] = 695;
-        sizeDistribution[0.206] = 697;
-        sizeDistribution[0.207] = 700;
-        sizeDistribution[0.208] = 702;
-        sizeDistribution[0.209] = 705;
-        sizeDistribution[0.21] = 707;
-        sizeDistribution[0.211] = 709;
-        sizeDistribution[0.212] = 712;
-        sizeDistribution[0.213] = 715;
-        sizeDistribution[0.214] = 717;
-        sizeDistribution[0.215] = 719;
-        sizeDistribution[0.216] = 722;
-        sizeDistribution[0.217] = 724;
-        sizeDistribution[0.218] = 727;
-        sizeDistribution[0.219] = 729;
-        sizeDistribution[0.22] = 732;
-        sizeDistribution[0.221] = 734;
-        sizeDistribution[0.222] = 737;
-        sizeDistribution[0.223] = 739;
-        sizeDistribution[0.224] = 742;
-        sizeDistribution[0.225] = 745;
-        sizeDistribution[0.226] = 747;
-        sizeDistribution[0.227] = 750;
-        sizeDistribution[0.228] = 752;
-        sizeDistribution[0.229] = 755;
-        sizeDistribution[0.23] = 757;
-        sizeDistribution[0.231] = 760;
-        sizeDistribution[0.232] = 762;
-        sizeDistribution[0.233] = 765;
-        sizeDistribution[0.234] = 767;
-        sizeDistribution[0.235] = 770;
-        sizeDistribution[0.236] = 772;
-        sizeDistribution[0.237] = 775;
-        sizeDistribution[0.238] = 777;
-        sizeDistribution[0.239] = 780;
-        sizeDistribution[0.24] = 783;
-        sizeDistribution[0.241] = 786;
-        sizeDistribution[0.242] = 788;
-        sizeDistribution[0.243] = 791;
-        sizeDistribution[0.244] = 793;
-        sizeDistribution[0.245] = 795;
-        sizeDistribution[0.246] = 798;
-        sizeDistribution[0.247] = 800;
-        sizeDistribution[0.248] = 803;
-        sizeDistribution[0.249] = 805;
-        sizeDistribution[0.25] = 807;
-        sizeDistribution[0.251] = 810;
-        sizeDistribution[0.252] = 813;
-        sizeDistribution[0.253] = 815;
-        sizeDistribution[0.254] = 817;
-        sizeDistribution[0.255] = 820;
-        sizeDistribution[0.256] = 823;
-        sizeDistribution[0.257] = 825;
-        sizeDistribution[0.258] = 828;
-        sizeDistribution[0.259] = 830;
-        sizeDistribution[0.26] = 832;
-        sizeDistribution[0.261] = 835;
-        sizeDistribution[0.262] = 838;
-        sizeDistribution[0.263] = 840;
-        sizeDistribution[0.264] = 843;
-        sizeDistribution[0.265] = 846;
-        sizeDistribution[0.266] = 848;
-        sizeDistribution[0.267] = 851;
-        sizeDistribution[0.268] = 854;
-        sizeDistribution[0.269] = 857;
-        sizeDistribution[0.27] = 859;
-        sizeDistribution[0.271] = 862;
-        sizeDistribution[0.272] = 865;
-        sizeDistribution[0.273] = 867;
-        sizeDistribution[0.274] = 870;
-        sizeDistribution[0.275] = 872;
-        sizeDistribution[0.276] = 875;
-        sizeDistribution[0.277] = 878;
-        sizeDistribution[0.278] = 881;
-        sizeDistribution[0.279] = 883;
-        sizeDistribution[0.28] = 886;
-        sizeDistribution[0.281] = 889;
-        sizeDistribution[0.282] = 892;
-        sizeDistribution[0.283] = 895;
-        sizeDistribution[0.284] = 897;
-        sizeDistribution[0.285] = 901;
-        sizeDistribution[0.286] = 904;
-        sizeDistribution[0.287] = 906;
-        sizeDistribution[0.288] = 909;
-        sizeDistribution[0.289] = 912;
-        sizeDistribution[0.29] = 915;
-        sizeDistribution[0.291] = 918;
-        sizeDistribution[0.292] = 921;
-        sizeDistribution[0.293] = 925;
-        sizeDistribution[0.294] = 928;
-        sizeDistribution[0.295] = 931;
-        sizeDistribution[0.296] = 934;
-        sizeDistribution[0.297] = 937;
-        sizeDistribution[0.298] = 940;
-        sizeDistribution[0.299] = 943;
-        sizeDistribution[0.3] = 946;
-        sizeDistribution[0.301] = 949;
-        sizeDistribution[0.302] = 952;
-        sizeDistribution[0.303] = 955;
-        sizeDistribution[0.304] = 959;
-        sizeDistribution[0.305] = 962;
-        sizeDistribution[0.306] = 965;
-        sizeDistribution[0.307] = 968;
-        sizeDistribution[0.308] = 971;
-        sizeDistribution[0.309] = 974;
-        sizeDistribution[0.31] = 977;
-        sizeDistribution[0.311] = 981;
-        sizeDistribution[0.312] = 983;
-        sizeDistribution[0.313] = 987;
-        sizeDistribution[0.314] = 990;
-        sizeDistribution[0.315] = 993;
-        sizeDistribution[0.316] = 996;
-        sizeDistribution[0.317] = 999;
-        sizeDistribution[0.318] = 1003;
-        sizeDistribution[0.319] = 1006;
-        sizeDistribution[0.32] = 1009;
-        sizeDistribution[0.321] = 1013;
-        sizeDistribution[0.322] = 1016;
-        sizeDistribution[0.323] = 1020;
-        sizeDistribution[0.324] = 1024;
-        sizeDistribution[0.325] = 1028;
-        sizeDistribution[0.326] = 1031;
-        sizeDistribution[0.327] = 1035;
-        sizeDistribution[0.328] = 1038;
-        sizeDistribution[0.329] = 1042;
-        sizeDistribution[0.33] = 1046;
-        sizeDistribution[0.331] = 1050;
-        sizeDistribution[0.332] = 1054;
-        sizeDistribution[0.333] = 1058;
-        sizeDistribution[0.334] = 1062;
-        sizeDistribution[0.335] = 1066;
-        sizeDistribution[0.336] = 1070;
-        sizeDistribution[0.337] = 1074;
-        sizeDistribution[0.338] = 1078;
-        sizeDistribution[0.339] = 1083;
-        sizeDistribution[0.34] = 1087;
-        sizeDistribution[0.341] = 1091;
-        sizeDistribution[0.342] = 1094;
-        sizeDistribution[0.343] = 1099;
-        sizeDistribution[0.344] = 1103;
-        sizeDistribution[0.345] = 1107;
-        sizeDistribution[0.346] = 1111;
-        sizeDistribution[0.347] = 1115;
-        sizeDistribution[0.348] = 1119;
-        sizeDistribution[0.349] = 1123;
-        sizeDistribution[0.35] = 1127;
-        sizeDistribution[0.351] = 1131;
-        sizeDistribution[0.352] = 1135;
-        sizeDistribution[0.353] = 1139;
-        sizeDistribution[0.354] = 1143;
-        sizeDistribution[0.355] = 1147;
-        sizeDistribution[0.356] = 1151;
-        sizeDistribution[0.357] = 1154;
-        sizeDistribution[0.358] = 1158;
-        sizeDistribution[0.359] = 1162;
-        sizeDistribution[0.36] = 1167;
-        sizeDistribution[0.361] = 1170;
-        sizeDistribution[0.362] = 1174;
-        sizeDistribution[0.363] = 1178;
-        sizeDistribution[0.364] = 1182;
-        sizeDistribution[0.365] = 1186;
-        sizeDistribution[0.366] = 1190;
-        sizeDistribution[0.367] = 1194;
-        sizeDistribution[0.368] = 1198;
-        sizeDistribution[0.369] = 1202;
-        sizeDistribution[0.37] = 1206;
-        sizeDistribution[0.371] = 1210;
-        sizeDistribution[0.372] = 1214;
-        sizeDistribution[0.373] = 1218;
-        sizeDistribution[0.374] = 1223;
-        sizeDistribution[0.375] = 1227;
-        sizeDistribution[0.376] = 1231;
-        sizeDistribution[0.377] = 1236;
-        sizeDistribution[0.378] = 1239;
-        sizeDistribution[0.379] = 1243;
-        sizeDistribution[0.38] = 1247;
-        sizeDistribution[0.381] = 1251;
-        sizeDistribution[0.382] = 1255;
-        sizeDistribution[0.383] = 1259;
-        sizeDistribution[0.384] = 1263;
-        sizeDistribution[0.385] = 1267;
-        sizeDistribution[0.386] = 1272;
-        sizeDistribution[0.387] = 1276;
-        sizeDistribution[0.388] = 1280;
-        sizeDistribution[0.389] = 1284;
-        sizeDistribution[0.39] = 1288;
-        sizeDistribution[0.391] = 1292;
-        sizeDistribution[0.392] = 1297;
-        sizeDistribution[0.393] = 1301;
-        sizeDistribution[0.394] = 1306;
-        sizeDistribution[0.395] = 1310;
-        sizeDistribution[0.396] = 1315;
-        sizeDistribution[0.397] = 1319;
-        sizeDistribution[0.398] = 1324;
-        sizeDistribution[0.399] = 1329;
-        sizeDistribution[0.4] = 1333;
-        sizeDistribution[0.401] = 1337;
-        sizeDistribution[0.402] = 1342;
-        sizeDistribution[0.403] = 1346;
-        sizeDistribution[0.404] = 1351;
-        sizeDistribution[0.405] = 1355;
-        sizeDistribution[0.406] = 1360;
-        sizeDistribution[0.407] = 1364;
-        sizeDistribution[0.408] = 1369;
-        sizeDistribution[0.409] = 1373;
-        sizeDistribution[0.41] = 1378;
-        sizeDistribution[0.411] = 1382;
-        sizeDistribution[0.412] = 1386;
-        sizeDistribution[0.413] = 1391;
-        sizeDistribution[0.414] = 1395;
-        sizeDistribution[0.415] = 1399;
-        sizeDistribution[0.416] = 1404;
-        sizeDistribution[0.417] = 1409;
-        sizeDistribution[0.418] = 1413;
-        sizeDistribution[0.419] = 1417;
-        sizeDistribution[0.42] = 1421;
-        sizeDistribution[0.421] = 1425;
-        sizeDistribution[0.422] = 1429;
-        sizeDistribution[0.423] = 1434;
-        sizeDistribution[0.424] = 1438;
-        sizeDistribution[0.425] = 1443;
-        sizeDistribution[0.426] = 1447;
-        sizeDistribution[0.427] = 1451;
-        sizeDistribution[0.428] = 1455;
-        sizeDistribution[0.429] = 1460;
-        sizeDistribution[0.43] = 1466;
-        sizeDistribution[0.431] = 1470;
-        sizeDistribution[0.432] = 1475;
-        sizeDistribution[0.433] = 1480;
-        sizeDistribution[0.434] = 1485;
-        sizeDistribution[0.435] = 1489;
-        sizeDistribution[0.436] = 1494;
-        sizeDistribution[0.437] = 1499;
-        sizeDistribution[0.438] = 1503;
-        sizeDistribution[0.439] = 1508;
-        sizeDistribution[0.44] = 1513;
-        sizeDistribution[0.441] = 1518;
-        sizeDistribution[0.442] = 1523;
-        sizeDistribution[0.443] = 1528;
-        sizeDistribution[0.444] = 1532;
-        sizeDistribution[0.445] = 1538;
-        sizeDistribution[0.446] = 1543;
-        sizeDistribution[0.447] = 1549;
-        sizeDistribution[0.448] = 1554;
-        sizeDistribution[0.449] = 1560;
-        sizeDistribution[0.45] = 1565;
-        sizeDistribution[0.451] = 1571;
-        sizeDistribution[0.452] = 1576;
-        sizeDistribution[0.453] = 1582;
-        sizeDistribution[0.454] = 1588;
-        sizeDistribution[0.455] = 1594;
-        sizeDistribution[0.456] = 1599;
-        sizeDistribution[0.457] = 1604;
-        sizeDistribution[0.458] = 1609;
-        sizeDistribution[0.459] = 1615;
-        sizeDistribution[0.46] = 1621;
-        sizeDistribution[0.461] = 1627;
-        sizeDistribution[0.462] = 1632;
-        sizeDistribution[0.463] = 1638;
-        sizeDistribution[0.464] = 1643;
-        sizeDistribution[0.465] = 1648;
-        sizeDistribution[0.466] = 1653;
-        sizeDistribution[0.467] = 1659;
-        sizeDistribution[0.468] = 1664;
-        sizeDistribution[0.469] = 1670;
-        sizeDistribution[0.47] = 1676;
-        sizeDistribution[0.471] = 1682;
-        sizeDistribution[0.472] = 1686;
-        sizeDistribution[0.473] = 1693;
-        sizeDistribution[0.474] = 1698;
-        sizeDistribution[0.475] = 1704;
-        sizeDistribution[0.476] = 1710;
-        sizeDistribution[0.477] = 1716;
-        sizeDistribution[0.478] = 1722;
-        sizeDistribution[0.479] = 1728;
-        sizeDistribution[0.48] = 1735;
-        sizeDistribution[0.481] = 1742;
-        sizeDistribution[0.482] = 1748;
-        sizeDistribution[0.483] = 1755;
-        sizeDistribution[0.484] = 1761;
-        sizeDistribution[0.485] = 1768;
-        sizeDistribution[0.486] = 1775;
-        sizeDistribution[0.487] = 1781;
-        sizeDistribution[0.488] = 1787;
-        sizeDistribution[0.489] = 1794;
-        sizeDistribution[0.49] = 1801;
-        sizeDistribution[0.491] = 1809;
-        sizeDistribution[0.492] = 1815;
-        sizeDistribution[0.493] = 1823;
-        sizeDistribution[0.494] = 1830;
-        sizeDistribution[0.495] = 1838;
-        sizeDistribution[0.496] = 1846;
-        sizeDistribution[0.497] = 1853;
-        sizeDistribution[0.498] = 1861;
-        sizeDistribution[0.499] = 1870;
-        sizeDistribution[0.5] = 1878;
-        sizeDistribution[0.501] = 1886;
-        sizeDistribution[0.502] = 1894;
-        sizeDistribution[0.503] = 1902;
-        sizeDistribution[0.504] = 1908;
-        sizeDistribution[0.505] = 1916;
-        sizeDistribution[0.506] = 1923;
-        sizeDistribution[0.507] = 1931;
-        sizeDistribution[0.508] = 1938;
-        sizeDistribution[0.509] = 1946;
-        sizeDistribution[0.51] = 1955;
-        sizeDistribution[0.511] = 1963;
-        sizeDistribution[0.512] = 1970;
-        sizeDistribution[0.513] = 1977;
-        sizeDistribution[0.514] = 1984;
-        sizeDistribution[0.515] = 1992;
-        sizeDistribution[0.516] = 1999;
-        sizeDistribution[0.517] = 2006;
-        sizeDistribution[0.518] = 2014;
-        sizeDistribution[0.519] = 2021;
-        sizeDistribution[0.52] = 2030;
-        sizeDistribution[0.521] = 2036;
-        sizeDistribution[0.522] = 2042;
-        sizeDistribution[0.523] = 2048;
-        sizeDistribution[0.524] = 2055;
-        sizeDistribution[0.525] = 2063;
-        sizeDistribution[0.526] = 2069;
-        sizeDistribution[0.527] = 2078;
-        sizeDistribution[0.528] = 2083;
-        sizeDistribution[0.529] = 2091;
-        sizeDistribution[0.53] = 2096;
-        sizeDistribution[0.531] = 2103;
-        sizeDistribution[0.532] = 2109;
-        sizeDistribution[0.533] = 2117;
-        sizeDistribution[0.534] = 2124;
-        sizeDistribution[0.535] = 2132;
-        sizeDistribution[0.536] = 2138;
-        sizeDistribution[0.537] = 2145;
-        sizeDistribution[0.538] = 2153;
-        sizeDistribution[0.539] = 2159;
-        sizeDistribution[0.54] = 2165;
-        sizeDistribution[0.541] = 2173;
-        sizeDistribution[0.542] = 2179;
-        sizeDistribution[0.543] = 2184;
-        sizeDistribution[0.544] = 2190;
-        sizeDistribution[0.545] = 2196;
-        sizeDistribution[0.546] = 2203;
-        sizeDistribution[0.547] = 2209;
-        sizeDistribution[0.548] = 2214;
-        sizeDistribution[0.549] = 2221;
-        sizeDistribution[0.55] = 2226;
-        sizeDistribution[0.551] = 2232;
-        sizeDistribution[0.552] = 2237;
-        sizeDistribution[0.553] = 2243;
-        sizeDistribution[0.554] = 2248;
-        sizeDistribution[0.555] = 2254;
-        sizeDistribution[0.556] = 2260;
-        sizeDistribution[0.557] = 2266;
-        sizeDistribution[0.558] = 2273;
-        sizeDistribution[0.559] = 2278;
-        sizeDistribution[0.56] = 2283;
-        sizeDistribution[0.561] = 2289;
-        sizeDistribution[0.562] = 2294;
-        sizeDistribution[0.563] = 2299;
-        sizeDistribution[0.564] = 2305;
-        sizeDistribution[0.565] = 2311;
-        sizeDistribution[0.566] = 2318;
-        sizeDistribution[0.567] = 2324;
-        sizeDistribution[0.568] = 2331;
-        sizeDistribution[0.569] = 2337;
-        sizeDistribution[0.57] = 2343;
-        sizeDistribution[0.571] = 2350;
-        sizeDistribution[0.572] = 2356;
-        sizeDistribution[0.573] = 2361;
-        sizeDistribution[0.574] = 2368;
-        sizeDistribution[0.575] = 2374;
-        sizeDistribution[0.576] = 2381;
-        sizeDistribution[0.577] = 2386;
-        sizeDistribution[0.578] = 2394;
-        sizeDistribution[0.579] = 2400;
-        sizeDistribution[0.58] = 2406;
-        sizeDistribution[0.581] = 2414;
-        sizeDistribution[0.582] = 2419;
-        sizeDistribution[0.583] = 2426;
-        sizeDistribution[0.584] = 2432;
-        sizeDistribution[0.585] = 2438;
-        sizeDistribution[0.586] = 2445;
-        sizeDistribution[0.587] = 2452;
-        sizeDistribution[0.588] = 2457;
-        sizeDistribution[0.589] = 2464;
-        sizeDistribution[0.59] = 2470;
-        sizeDistribution[0.591] = 2479;
-        sizeDistribution[0.592] = 2485;
-        sizeDistribution[0.593] = 2492;
-        sizeDistribution[0.594] = 2501;
-        sizeDistribution[0.595] = 2510;
-        sizeDistribution[0.596] = 2516;
-        sizeDistribution[0.597] = 2523;
-        sizeDistribution[0.598] = 2532;
-        sizeDistribution[0.599] = 2539;
-        sizeDistribution[0.6] = 2548;
-        sizeDistribution[0.601] = 2556;
-        sizeDistribution[0.602] = 2563;
-        sizeDistribution[0.603] = 2571;
-        sizeDistribution[0.604] = 2580;
-        sizeDistribution[0.605] = 2587;
-        sizeDistribution[0.606] = 2595;
-        sizeDistribution[0.607] = 2603;
-        sizeDistribution[0.608] = 2610;
-        sizeDistribution[0.609] = 2617;
-        sizeDistribution[0.61] = 2625;
-        sizeDistribution[0.611] = 2632;
-        sizeDistribution[0.612] = 2639;
-        sizeDistribution[0.613] = 2647;
-        sizeDistribution[0.614] = 2654;
-        sizeDistribution[0.615] = 2661;
-        sizeDistribution[0.616] = 2670;
-        sizeDistribution[0.617] = 2677;
-        sizeDistribution[0.618] = 2686;
-        sizeDistribution[0.619] = 2696;
-        sizeDistribution[0.62] = 2702;
-        sizeDistribution[0.621] = 2711;
-        sizeDistribution[0.622] = 2721;
-        sizeDistribution[0.623] = 2729;
-        sizeDistribution[0.624] = 2738;
-        sizeDistribution[0.625] = 2747;
-        sizeDistribution[0.626] = 2753;
-        sizeDistribution[0.627] = 2761;
-        sizeDistribution[0.628] = 2770;
-        sizeDistribution[0.629] = 2779;
-        sizeDistribution[0.63] = 2786;
-        sizeDistribution[0.631] = 2794;
-        sizeDistribution[0.632] = 2803;
-        sizeDistribution[0.633] = 2811;
-        sizeDistribution[0.634] = 2820;
-        sizeDistribution[0.635] = 2828;
-        sizeDistribution[0.636] = 2835;
-        sizeDistribution[0.637] = 2841;
-        sizeDistribution[0.638] = 2850;
-        sizeDistribution[0.639] = 2860;
-        sizeDistribution[0.64] = 2871;
-        sizeDistribution[0.641] = 2881;
-        sizeDistribution[0.642] = 2892;
-        sizeDistribution[0.643] = 2904;
-        sizeDistribution[0.644] = 2911;
-        sizeDistribution[0.645] = 2920;
-        sizeDistribution[0.646] = 2933;
-        sizeDistribution[0.647] = 2944;
-        sizeDistribution[0.648] = 2954;
-        sizeDistribution[0.649] = 2967;
-        sizeDistribution[0.65] = 2977;
-        sizeDistribution[0.651] = 2991;
-        sizeDistribution[0.652] = 2999;
-        sizeDistribution[0.653] = 3011;
-        sizeDistribution[0.654] = 3019;
-        sizeDistribution[0.655] = 3034;
-        sizeDistribution[0.656] = 3046;
-        sizeDistribution[0.657] = 3059;
-        sizeDistribution[0.658] = 3073;
-        sizeDistribution[0.659] = 3088;
-        sizeDistribution[0.66] = 3103;
-        sizeDistribution[0.661] = 3115;
-        sizeDistribution[0.662] = 3130;
-        sizeDistribution[0.663] = 3145;
-        sizeDistribution[0.664] = 3162;
-        sizeDistribution[0.665] = 3180;
-        sizeDistribution[0.666] = 3191;
-        sizeDistribution[0.667] = 3204;
-        sizeDistribution[0.668] = 3214;
-        sizeDistribution[0.669] = 3227;
-        sizeDistribution[0.67] = 3239;
-        sizeDistribution[0.671] = 3258;
-        sizeDistribution[0.672] = 3270;
-        sizeDistribution[0.673] = 3282;
-        sizeDistribution[0.674] = 3293;
-        sizeDistribution[0.675] = 3307;
-        sizeDistribution[0.676] = 3319;
-        sizeDistribution[0.677] = 3335;
-        sizeDistribution[0.678] = 3349;
-        sizeDistribution[0.679] = 3362;
-        sizeDistribution[0.68] = 3376;
-        sizeDistribution[0.681] = 3392;
-        sizeDistribution[0.682] = 3406;
-        sizeDistribution[0.683] = 3418;
-        sizeDistribution[0.684] = 3430;
-        sizeDistribution[0.685] = 3444;
-        sizeDistribution[0.686] = 3456;
-        sizeDistribution[0.687] = 3468;
-        sizeDistribution[0.688] = 3477;
-        sizeDistribution[0.689] = 3492;
-        sizeDistribution[0.69] = 3506;
-        sizeDistribution[0.691] = 3523;
-        sizeDistribution[0.692] = 3540;
-        sizeDistribution[0.693] = 3556;
-        sizeDistribution[0.694] = 3570;
-        sizeDistribution[0.695] = 3587;
-        sizeDistribution[0.696] = 3601;
-        sizeDistribution[0.697] = 3615;
-        sizeDistribution[0.698] = 3636;
-        sizeDistribution[0.699] = 3651;
-        sizeDistribution[0.7] = 3666;
-        sizeDistribution[0.701] = 3675;
-        sizeDistribution[0.702] = 3691;
-        sizeDistribution[0.703] = 3712;
-        sizeDistribution[0.704] = 3725;
-        sizeDistribution[0.705] = 3742;
-        sizeDistribution[0.706] = 3758;
-        sizeDistribution[0.707] = 3774;
-        sizeDistribution[0.708] = 3791;
-        sizeDistribution[0.709] = 3809;
-        sizeDistribution[0.71] = 3816;
-        sizeDistribution[0.711] = 3834;
-        sizeDistribution[0.712] = 3847;
-        sizeDistribution[0.713] = 3860;
-        sizeDistribution[0.714] = 3881;
-        sizeDistribution[0.715] = 3896;
-        sizeDistribution[0.716] = 3917;
-        sizeDistribution[0.717] = 3934;
-        sizeDistribution[0.718] = 3953;
-        sizeDistribution[0.719] = 3970;
-        sizeDistribution[0.72] = 3994;
-        sizeDistribution[0.721] = 4013;
-        sizeDistribution[0.722] = 4031;
-        sizeDistribution[0.723] = 4052;
-        sizeDistribution[0.724] = 4070;
-        sizeDistribution[0.725] = 4093;
-        sizeDistribution[0.726] = 4116;
-        sizeDistribution[0.727] = 4140;
-        sizeDistribution[0.728] = 4156;
-        sizeDistribution[0.729] = 4179;
-        sizeDistribution[0.73] = 4196;
-        sizeDistribution[0.731] = 4217;
-        sizeDistribution[0.732] = 4236;
-        sizeDistribution[0.733] = 4255;
-        sizeDistribution[0.734] = 4281;
-        sizeDistribution[0.735] = 4303;
-        sizeDistribution[0.736] = 4323;
-        sizeDistribution[0.737] = 4350;
-        sizeDistribution[0.738] = 4365;
-        sizeDistribution[0.739] = 4385;
-        sizeDistribution[0.74] = 4406;
-        sizeDistribution[0.741] = 4429;
-        sizeDistribution[0.742] = 4455;
-        sizeDistribution[0.743] = 4476;
-        sizeDistribution[0.744] = 4502;
-        sizeDistribution[0.745] = 4527;
-        sizeDistribution[0.746] = 4542;
-        sizeDistribution[0.747] = 4562;
-        sizeDistribution[0.748] = 4589;
-        sizeDistribution[0.749] = 4613;
-        sizeDistribution[0.75] = 4629;
-        sizeDistribution[0.751] = 4649;
-        sizeDistribution[0.752] = 4671;
-        sizeDistribution[0.753] = 4694;
-        sizeDistribution[0.754] = 4718;
-        sizeDistribution[0.755] = 4733;
-        sizeDistribution[0.756] = 4757;
-        sizeDistribution[0.757] = 4780;
-        sizeDistribution[0.758] = 4807;
-        sizeDistribution[0.759] = 4823;
-        sizeDistribution[0.76] = 4848;
-        sizeDistribution[0.761] = 4871;
-        sizeDistribution[0.762] = 4896;
-        sizeDistribution[0.763] = 4924;
-        sizeDistribution[0.764] = 4952;
-        sizeDistribution[0.765] = 4971;
-        sizeDistribution[0.766] = 4999;
-        sizeDistribution[0.767] = 5020;
-        sizeDistribution[0.768] = 5036;
-        sizeDistribution[0.769] = 5052;
-        sizeDistribution[0.77] = 5072;
-        sizeDistribution[0.771] = 5093;
-        sizeDistribution[0.772] = 5107;
-        sizeDistribution[0.773] = 5132;
-        sizeDistribution[0.774] = 5153;
-        sizeDistribution[0.775] = 5178;
-        sizeDistribution[0.776] = 5196;
-        sizeDistribution[0.777] = 5221;
-        sizeDistribution[0.778] = 5243;
-        sizeDistribution[0.779] = 5264;
-        sizeDistribution[0.78] = 5282;
-        sizeDistribution[0.781] = 5311;
-        sizeDistribution[0.782] = 5333;
-        sizeDistribution[0.783] = 5352;
-        sizeDistribution[0.784] = 5380;
-        sizeDistribution[0.785] = 5401;
-        sizeDistribution[0.786] = 5431;
-        sizeDistribution[0.787] = 5453;
-        sizeDistribution[0.788] = 5473;
-        sizeDistribution[0.789] = 5494;
-        sizeDistribution[0.79] = 5515;
-        sizeDistribution[0.791] = 5544;
-        sizeDistribution[0.792] = 5559;
-        sizeDistribution[0.793] = 5579;
-        sizeDistribution[0.794] = 5595;
-        sizeDistribution[0.795] = 5611;
-        sizeDistribution[0.796] = 5639;
-        sizeDistribution[0.797] = 5675;
-        sizeDistribution[0.798] = 5707;
-        sizeDistribution[0.799] = 5742;
-        sizeDistribution[0.8] = 5773;
-        sizeDistribution[0.801] = 5809;
-        sizeDistribution[0.802] = 5845;
-        sizeDistribution[0.803] = 5878;
-        sizeDistribution[0.804] = 5907;
-        sizeDistribution[0.805] = 5928;
-        sizeDistribution[0.806] = 5956;
-        sizeDistribution[0.807] = 5993;
-        sizeDistribution[0.808] = 6014;
-        sizeDistribution[0.809] = 6046;
-        sizeDistribution[0.81] = 6075;
-        sizeDistribution[0.811] = 6103;
-        sizeDistribution[0.812] = 6138;
-        sizeDistribution[0.813] = 6167;
-        sizeDistribution[0.814] = 6194;
-        sizeDistribution[0.815] = 6217;
-        sizeDistribution[0.816] = 6241;
-        sizeDistribution[0.817] = 6267;
-        sizeDistribution[0.818] = 6298;
-        sizeDistribution[0.819] = 6320;
-        sizeDistribution[0.82] = 6345;
-        sizeDistribution[0.821] = 6373;
-        sizeDistribution[0.822] = 6408;
-        sizeDistribution[0.823] = 6435;
-        sizeDistribution[0.824] = 6461;
-        sizeDistribution[0.825] = 6481;
-        sizeDistribution[0.826] = 6508;
-        sizeDistribution[0.827] = 6538;
-        sizeDistribution[0.828] = 6573;
-        sizeDistribution[0.829] = 6602;
-        sizeDistribution[0.83] = 6630;
-        sizeDistribution[0.831] = 6653;
-        sizeDistribution[0.832] = 6681;
-        sizeDistribution[0.833] = 6710;
-        sizeDistribution[0.834] = 6738;
-        sizeDistribution[0.835] = 6762;
-        sizeDistribution[0.836] = 6781;
-        sizeDistribution[0.837] = 6801;
-        sizeDistribution[0.838] = 6822;
-        sizeDistribution[0.839] = 6848;
-        sizeDistribution[0.84] = 6867;
-        sizeDistribution[0.841] = 6888;
-        sizeDistribution[0.842] = 6907;
-        sizeDistribution[0.843] = 6941;
-        sizeDistribution[0.844] = 6971;
-        sizeDistribution[0.845] = 6993;
-        sizeDistribution[0.846] = 7021;
-        sizeDistribution[0.847] = 7039;
-        sizeDistribution[0.848] = 7066;
-        sizeDistribution[0.849] = 7096;
-        sizeDistribution[0.85] = 7129;
-        sizeDistribution[0.851] = 7157;
-        sizeDistribution[0.852] = 7191;
-        sizeDistribution[0.853] = 7226;
-        sizeDistribution[0.854] = 7250;
-        sizeDistribution[0.855] = 7285;
-        sizeDistribution[0.856] = 7313;
-        sizeDistribution[0.857] = 7335;
-        sizeDistribution[0.858] = 7363;
-        sizeDistribution[0.859] = 7390;
-        sizeDistribution[0.86] = 7425;
-        sizeDistribution[0.861] = 7450;
-        sizeDistribution[0.862] = 7480;
-        sizeDistribution[0.863] = 7506;
-        sizeDistribution[0.864] = 7532;
-        sizeDistribution[0.865] = 7562;
-        sizeDistribution[0.866] = 7590;
-        sizeDistribution[0.867] = 7613;
-        sizeDistribution[0.868] = 7643;
-        sizeDistribution[0.869] = 7678;
-        sizeDistribution[0.87] = 7707;
-        sizeDistribution[0.871] = 7729;
-        sizeDistribution[0.872] = 7754;
-        sizeDistribution[0.873] = 7780;
-        sizeDistribution[0.874] = 7810;
-        sizeDistribution[0.875] = 7835;
-        sizeDistribution[0.876] = 7858;
-        sizeDistribution[0.877] = 7887;
-        sizeDistribution[0.878] = 7920;
-        sizeDistribution[0.879] = 7952;
-        sizeDistribution[0.88] = 7983;
-        sizeDistribution[0.881] = 8013;
-        sizeDistribution[0.882] = 8043;
-        sizeDistribution[0.883] = 8079;
-        sizeDistribution[0.884] = 8108;
-        sizeDistribution[0.885] = 8148;
-        sizeDistribution[0.886] = 8177;
-        sizeDistribution[0.887] = 8209;
-        sizeDistribution[0.888] = 8243;
-        sizeDistribution[0.889] = 8280;
-        sizeDistribution[0.89] = 8319;
-        sizeDistribution[0.891] = 8360;
-        sizeDistribution[0.892] = 8410;
-        sizeDistribution[0.893] = 8472;
-        sizeDistribution[0.894] = 8533;
-        sizeDistribution[0.895] = 8596;
-        sizeDistribution[0.896] = 8648;
-        sizeDistribution[0.897] = 8707;
-        sizeDistribution[0.898] = 8761;
-        sizeDistribution[0.899] = 8819;
-        sizeDistribution[0.9] = 8883;
-        sizeDistribution[0.901] = 8958;
-        sizeDistribution[0.902] = 9036;
-        sizeDistribution[0.903] = 9113;
-        sizeDistribution[0.904] = 9165;
-        sizeDistribution[0.905] = 9221;
-        sizeDistribution[0.906] = 9278;
-        sizeDistribution[0.907] = 9337;
-        sizeDistribution[0.908] = 9390;
-        sizeDistribution[0.909] = 9458;
-        sizeDistribution[0.91] = 9531;
-        sizeDistribution[0.911] = 9604;
-        sizeDistribution[0.912] = 9672;
-        sizeDistribution[0.913] = 9727;
-        sizeDistribution[0.914] = 9795;
-        sizeDistribution[0.915] = 9860;
-        sizeDistribution[0.916] = 9924;
-        sizeDistribution[0.917] = 9997;
-        sizeDistribution[0.918] = 10066;
-        sizeDistribution[0.919] = 10145;
-        sizeDistribution[0.92] = 10220;
-        sizeDistribution[0.921] = 10292;
-        sizeDistribution[0.922] = 10369;
-        sizeDistribution[0.923] = 10445;
-        sizeDistribution[0.924] = 10521;
-        sizeDistribution[0.925] = 10583;
-        sizeDistribution[0.926] = 10652;
-        sizeDistribution[0.927] = 10713;
-        sizeDistribution[0.928] = 10787;
-        sizeDistribution[0.929] = 10860;
-        sizeDistribution[0.93] = 10928;
-        sizeDistribution[0.931] = 11001;
-        sizeDistribution[0.932] = 11065;
-        sizeDistribution[0.933] = 11132;
-        sizeDistribution[0.934] = 11197;
-        sizeDistribution[0.935] = 11247;
-        sizeDistribution[0.936] = 11315;
-        sizeDistribution[0.937] = 11385;
-        sizeDistribution[0.938] = 11466;
-        sizeDistribution[0.939] = 11531;
-        sizeDistribution[0.94] = 11600;
-        sizeDistribution[0.941] = 11660;
-        sizeDistribution[0.942] = 11715;
-        sizeDistribution[0.943] = 11770;
-        sizeDistribution[0.944] = 11838;
-        sizeDistribution[0.945] = 11905;
-        sizeDistribution[0.946] = 11974;
-        sizeDistribution[0.947] = 12034;
-        sizeDistribution[0.948] = 12091;
-        sizeDistribution[0.949] = 12158;
-        sizeDistribution[0.95] = 12225;
-        sizeDistribution[0.951] = 12307;
-        sizeDistribution[0.952] = 12387;
-        sizeDistribution[0.953] = 12466;
-        sizeDistribution[0.954] = 12541;
-        sizeDistribution[0.955] = 12623;
-        sizeDistribution[0.956] = 12699;
-        sizeDistribution[0.957] = 12795;
-        sizeDistribution[0.958] = 12875;
-        sizeDistribution[0.959] = 12961;
-        sizeDistribution[0.96] = 13052;
-        sizeDistribution[0.961] = 13133;
-        sizeDistribution[0.962] = 13207;
-        sizeDistribution[0.963] = 13290;
-        sizeDistribution[0.964] = 13373;
-        sizeDistribution[0.965] = 13458;
-        sizeDistribution[0.966] = 13551;
-        sizeDistribution[0.967] = 13655;
-        sizeDistribution[0.968] = 13781;
-        sizeDistribution[0.969] = 13895;
-        sizeDistribution[0.97] = 14003;
-        sizeDistribution[0.971] = 14121;
-        sizeDistribution[0.972] = 14269;
-        sizeDistribution[0.973] = 14417;
-        sizeDistribution[0.974] = 14519;
-        sizeDistribution[0.975] = 14665;
-        sizeDistribution[0.976] = 14790;
-        sizeDistribution[0.977] = 14932;
-        sizeDistribution[0.978] = 15046;
-        sizeDistribution[0.979] = 15175;
-        sizeDistribution[0.98] = 15354;
-        sizeDistribution[0.981] = 15529;
-        sizeDistribution[0.982] = 15677;
-        sizeDistribution[0.983] = 15873;
-        sizeDistribution[0.984] = 16156;
-        sizeDistribution[0.985] = 16421;
-        sizeDistribution[0.986] = 16755;
-        sizeDistribution[0.987] = 16991;
-        sizeDistribution[0.988] = 17161;
-        sizeDistribution[0.989] = 17436;
-        sizeDistribution[0.99] = 17710;
-        sizeDistribution[0.991] = 18075;
-        sizeDistribution[0.992] = 18420;
-        sizeDistribution[0.993] = 18947;
-        sizeDistribution[0.994] = 19725;
-        sizeDistribution[0.995] = 20728;
-        sizeDistribution[0.996] = 47715;
-        sizeDistribution[0.997] = 65710;
-        sizeDistribution[0.998] = 104961;
-        sizeDistribution[0.999] = 123734;
-        sizeDistribution[1] = 222476;
-        break;
-    case 4: // 720p-dark
-        sizeDistribution[0] = 37;
-        sizeDistribution[0.001] = 46;
-        sizeDistribution[0.002] = 48;
-        sizeDistribution[0.003] = 50;
-        sizeDistribution[0.004] = 52;
-        sizeDistribution[0.005] = 53;
-        sizeDistribution[0.006] = 55;
-        sizeDistribution[0.007] = 56;
-        sizeDistribution[0.008] = 57;
-        sizeDistribution[0.009] = 58;
-        sizeDistribution[0.01] = 59;
-        sizeDistribution[0.011] = 60;
-        sizeDistribution[0.012] = 62;
-        sizeDistribution[0.013] = 63;
-        sizeDistribution[0.014] = 64;
-        sizeDistribution[0.015] = 65;
-        sizeDistribution[0.016] = 66;
-        sizeDistribution[0.017] = 68;
-        sizeDistribution[0.018] = 69;
-        sizeDistribution[0.019] = 71;
-        sizeDistribution[0.02] = 72;
-        sizeDistribution[0.021] = 74;
-        sizeDistribution[0.022] = 75;
-        sizeDistribution[0.023] = 77;
-        sizeDistribution[0.024] = 78;
-        sizeDistribution[0.025] = 80;
-        sizeDistribution[0.026] = 82;
-        sizeDistribution[0.027] = 84;
-        sizeDistribution[0.028] = 85;
-        sizeDistribution[0.029] = 87;
-        sizeDistribution[0.03] = 88;
-        sizeDistribution[0.031] = 90;
-        sizeDistribution[0.032] = 91;
-        sizeDistribution[0.033] = 93;
-        sizeDistribution[0.034] = 95;
-        sizeDistribution[0.035] = 97;
-        sizeDistribution[0.036] = 99;
-        sizeDistribution[0.037] = 101;
-        sizeDistribution[0.038] = 103;
-        sizeDistribution[0.039] = 104;
-        sizeDistribution[0.04] = 106;
-        sizeDistribution[0.041] = 108;
-        sizeDistribution[0.042] = 109;
-        sizeDistribution[0.043] = 111;
-        sizeDistribution[0.044] = 112;
-        sizeDistribution[0.045] = 114;
-        sizeDistribution[0.046] = 115;
-        sizeDistribution[0.047] = 117;
-        sizeDistribution[0.048] = 118;
-        sizeDistribution[0.049] = 120;
-        sizeDistribution[0.05] = 122;
-        sizeDistribution[0.051] = 123;
-        sizeDistribution[0.052] = 125;
-        sizeDistribution[0.053] = 126;
-        sizeDistribution[0.054] = 128;
-        sizeDistribution[0.055] = 130;
-        sizeDistribution[0.056] = 131;
-        sizeDistribution[0.057] = 133;
-        sizeDistribution[0.058] = 134;
-        sizeDistribution[0.059] = 136;
-        sizeDistribution[0.06] = 137;
-        sizeDistribution[0.061] = 139;
-        sizeDistribution[0.062] = 141;
-        sizeDistribution[0.063] = 142;
-        sizeDistribution[0.064] = 144;
-        sizeDistribution[0.065] = 146;
-        sizeDistribution[0.066] = 147;
-        sizeDistribution[0.067] = 149;
-        sizeDistribution[0.068] = 150;
-        sizeDistribution[0.069] = 152;
-        sizeDistribution[0.07] = 153;
-        sizeDistribution[0.071] = 155;
-        sizeDistribution[0.072] = 157;
-        sizeDistribution[0.073] = 159;
-        sizeDistribution[0.074] = 161;
-        sizeDistribution[0.075] = 163;
-        sizeDistribution[0.076] = 164;
-        sizeDistribution[0.077] = 166;
-        sizeDistribution[0.078] = 168;
-        sizeDistribution[0.079] = 170;
-        sizeDistribution[0.08] = 172;
-        sizeDistribution[0.081] = 174;
-        sizeDistribution[0.082] = 176;
-        sizeDistribution[0.083] = 178;
-        sizeDistribution[0.084] = 180;
-        sizeDistribution[0.085] = 183;
-        sizeDistribution[0.086] = 185;
-        sizeDistribution[0.087] = 187;
-        sizeDistribution[0.088] = 189;
-        sizeDistribution[0.089] = 191;
-        sizeDistribution[0.09] = 194;
-        sizeDistribution[0.091] = 196;
-        sizeDistribution[0.092] = 198;
-        sizeDistribution[0.093] = 200;
-        sizeDistribution[0.094] = 202;
-        sizeDistribution[0.095] = 204;
-        sizeDistribution[0.096] = 206;
-        sizeDistribution[0.097] = 208;
-        sizeDistribution[0.098] = 210;
-        sizeDistribution[0.099] = 212;
-        sizeDistribution[0.1] = 214;
-        sizeDistribution[0.101] = 217;
-        sizeDistribution[0.102] = 219;
-        sizeDistribution[0.103] = 221;
-        sizeDistribution[0.104] = 223;
-        sizeDistribution[0.105] = 225;
-        sizeDistribution[0.106] = 227;
-        sizeDistribution[0.107] = 229;
-        sizeDistribution[0.108] = 230;
-        sizeDistribution[0.109] = 232;
-        sizeDistribution[0.11] = 234;
-        sizeDistribution[0.111] = 236;
-        sizeDistribution[0.112] = 238;
-        sizeDistribution[0.113] = 240;
-        sizeDistribution[0.114] = 242;
-        sizeDistribution[0.115] = 244;
-        sizeDistribution[0.116] = 246;
-        sizeDistribution[0.117] = 247;
-        sizeDistribution[0.118] = 249;
-        sizeDistribution[0.119] = 251;
-        sizeDistribution[0.12] = 253;
-        sizeDistribution[0.121] = 254;
-        sizeDistribution[0.122] = 256;
-        sizeDistribution[0.123] = 258;
-        sizeDistribution[0.124] = 260;
-        sizeDistribution[0.125] = 261;
-        sizeDistribution[0.126] = 263;
-        sizeDistribution[0.127] = 264;
-        sizeDistribution[0.128] = 266;
-        sizeDistribution[0.129] = 268;
-        sizeDistribution[0.13] = 271;
-        sizeDistribution[0.131] = 273;
-        sizeDistribution[0.132] = 274;
-        sizeDistribution[0.133] = 276;
-        sizeDistribution[0.134] = 278;
-        sizeDistribution[0.135] = 280;
-        sizeDistribution[0.136] = 282;
-        sizeDistribution[0.137] = 284;
-        sizeDistribution[0.138] = 286;
-        sizeDistribution[0.139] = 288;
-        sizeDistribution[0.14] = 290;
-        sizeDistribution[0.141] = 292;
-        sizeDistribution[0.142] = 294;
-        sizeDistribution[0.143] = 296;
-        sizeDistribution[0.144] = 297;
-        sizeDistribution[0.145] = 299;
-        sizeDistribution[0.146] = 301;
-        sizeDistribution[0.147] = 302;
-        sizeDistribution[0.148] = 304;
-        sizeDistribution[0.149] = 306;
-        sizeDistribution[0.15] = 307;
-        sizeDistribution[0.151] = 309;
-        sizeDistribution[0.152] = 311;
-        sizeDistribution[0.153] = 313;
-        sizeDistribution[0.154] = 315;
-        sizeDistribution[0.155] = 316;
-        sizeDistribution[0.156] = 318;
-        sizeDistribution[0.157] = 320;
-        sizeDistribution[0.158] = 322;
-        sizeDistribution[0.159] = 323;
-        sizeDistribution[0.16] = 325;
-        sizeDistribution[0.161] = 327;
-        sizeDistribution[0.162] = 328;
-        sizeDistribution[0.163] = 330;
-        sizeDistribution[0.164] = 331;
-        sizeDistribution[0.165] = 333;
-        sizeDistribution[0.166] = 335;
-        sizeDistribution[0.167] = 336;
-        sizeDistribution[0.168] = 338;
-        sizeDistribution[0.169] = 340;
-        sizeDistribution[0.17] = 342;
-        sizeDistribution[0.171] = 343;
-        sizeDistribution[0.172] = 345;
-        sizeDistribution[0.173] = 347;
-        sizeDistribution[0.174] = 349;
-        sizeDistribution[0.175] = 351;
-        sizeDistribution[0.176] = 352;
-        sizeDistribution[0.177] = 354;
-        sizeDistribution[0.178] = 356;
-        sizeDistribution[0.179] = 358;
-        sizeDistribution[0.18] = 359;
-        sizeDistribution[0.181] = 361;
-        sizeDistribution[0.182] = 363;
-        sizeDistribution[0.183] = 365;
-        sizeDistribution[0.184] = 367;
-        sizeDistribution[0.185] = 369;
-        sizeDistribution[0.186] = 371;
-        sizeDistribution[0.187] = 373;
-        sizeDistribution[0.188] = 375;
-        sizeDistribution[0.189] = 377;
-        sizeDistribution[0.19] = 379;
-        sizeDistribution[0.191] = 381;
-        sizeDistribution[0.192] = 383;
-        sizeDistribution[0.193] = 386;
-        sizeDistribution[0.194] = 388;
-        sizeDistribution[0.195] = 390;
-        sizeDistribution[0.196] = 392;
-        sizeDistribution[0.197] = 394;
-        sizeDistribution[0.198] = 396;
-        sizeDistribution[0.199] = 399;
-        sizeDistribution[0.2] = 401;
-        sizeDistribution[0.201] = 403;
-        sizeDistribution[0.202] = 406;
-        sizeDistribution[0.203] = 408;
-        sizeDistribution[0.204] = 410;
-        sizeDistribution[0.205] = 413;
-        sizeDistribution[0.206] = 415;
-        sizeDistribution[0.207] = 417;
-        sizeDistribution[0.208] = 419;
-        sizeDistribution[0.209] = 422;
-        sizeDistribution[0.21] = 424;
-        sizeDistribution[0.211] = 427;
-        sizeDistribution[0.212] = 429;
-        sizeDistribution[0.213] = 432;
-        sizeDistribution[0.214] = 434;
-        sizeDistribution[0.215] = 437;
-        sizeDistribution[0.216] = 439;
-        sizeDistribution[0.217] = 441;
-        sizeDistribution[0.218] = 444;
-        sizeDistribution[0.219] = 446;
-        sizeDistribution[0.22] = 449;
-        sizeDistribution[0.221] = 451;
-        sizeDistribution[0.222] = 453;
-        sizeDistribution[0.223] = 456;
-        sizeDistribution[0.224] = 458;
-        sizeDistribution[0.225] = 461;
-        sizeDistribution[0.226] = 463;
-        sizeDistribution[0.227] = 466;
-        sizeDistribution[0.228] = 468;
-        sizeDistribution[0.229] = 470;
-        sizeDistribution[0.23] = 473;
-        sizeDistribution[0.231] = 475;
-        sizeDistribution[0.232] = 477;
-        sizeDistribution[0.233] = 480;
-        sizeDistribution[0.234] = 483;
-        sizeDistribution[0.235] = 485;
-        sizeDistribution[0.236] = 488;
-        sizeDistribution[0.237] = 490;
-        sizeDistribution[0.238] = 493;
-        sizeDistribution[0.239] = 496;
-        sizeDistribution[0.24] = 498;
-        sizeDistribution[0.241] = 500;
-        sizeDistribution[0.242] = 503;
-        sizeDistribution[0.243] = 505;
-        sizeDistribution[0.244] = 508;
-        sizeDistribution[0.245] = 510;
-        sizeDistribution[0.246] = 513;
-        sizeDistribution[0.247] = 515;
-        sizeDistribution[0.248] = 517;
-        sizeDistribution[0.249] = 519;
-        sizeDistribution[0.25] = 522;
-        sizeDistribution[0.251] = 524;
-        sizeDistribution[0.252] = 527;
-        sizeDistribution[0.253] = 530;
-        sizeDistribution[0.254] = 532;
-        sizeDistribution[0.255] = 535;
-        sizeDistribution[0.256] = 537;
-        sizeDistribution[0.257] = 540;
-        sizeDistribution[0.258] = 543;
-        sizeDistribution[0.259] = 545;
-        sizeDistribution[0.26] = 547;
-        sizeDistribution[0.261] = 549;
-        sizeDistribution[0.262] = 552;
-        sizeDistribution[0.263] = 554;
-        sizeDistribution[0.264] = 556;
-        sizeDistribution[0.265] = 559;
-        sizeDistribution[0.266] = 561;
-        sizeDistribution[0.267] = 563;
-        sizeDistribution[0.268] = 566;
-        sizeDistribution[0.269] = 569;
-        sizeDistribution[0.27] = 571;
-        sizeDistribution[0.271] = 573;
-        sizeDistribution[0.272] = 576;
-        sizeDistribution[0.273] = 578;
-        sizeDistribution[0.274] = 581;
-        sizeDistribution[0.275] = 583;
-        sizeDistribution[0.276] = 586;
-        sizeDistribution[0.277] = 589;
-        sizeDistribution[0.278] = 591;
-        sizeDistribution[0.279] = 593;
-        sizeDistribution[0.28] = 596;
-        sizeDistribution[0.281] = 598;
-        sizeDistribution[0.282] = 601;
-        sizeDistribution[0.283] = 603;
-        sizeDistribution[0.284] = 605;
-        sizeDistribution[0.285] = 608;
-        sizeDistribution[0.286] = 610;
-        sizeDistribution[0.287] = 613;
-        sizeDistribution[0.288] = 615;
-        sizeDistribution[0.289] = 617;
-        sizeDistribution[0.29] = 619;
-        sizeDistribution[0.291] = 622;
-        sizeDistribution[0.292] = 624;
-        sizeDistribution[0.293] = 627;
-        sizeDistribution[0.294] = 630;
-        sizeDistribution[0.295] = 632;
-        sizeDistribution[0.296] = 635;
-        sizeDistribution[0.297] = 637;
-        sizeDistribution[0.298] = 639;
-        sizeDistribution[0.299] = 642;
-        sizeDistribution[0.3] = 645;
-        sizeDistribution[0.301] = 647;
-        sizeDistribution[0.302] = 650;
-        sizeDistribution[0.303] = 652;
-        sizeDistribution[0.304] = 655;
-        sizeDistribution[0.305] = 657;
-        sizeDistribution[0.306] = 660;
-        sizeDistribution[0.307] = 662;
-        sizeDistribution[0.308] = 665;
-        sizeDistribution[0.309] = 667;
-        sizeDistribution[0.31] = 669;
-        sizeDistribution[0.311] = 672;
-        sizeDistribution[0.312] = 674;
-        sizeDistribution[0.313] = 677;
-        sizeDistribution[0.314] = 679;
-        sizeDistribution[0.315] = 682;
-        sizeDistribution[0.316] = 685;
-        sizeDistribution[0.317] = 687;
-        sizeDistribution[0.318] = 690;
-        sizeDistribution[0.319] = 693;
-        sizeDistribution[0.32] = 695;
-        sizeDistribution[0.321] = 698;
-        sizeDistribution[0.322] = 701;
-        sizeDistribution[0.323] = 703;
-        sizeDistribution[0.324] = 706;
-        sizeDistribution[0.325] = 708;
-        sizeDistribution[0.326] = 711;
-        sizeDistribution[0.327] = 714;
-        sizeDistribution[0.328] = 716;
-        sizeDistribution[0.329] = 719;
-        sizeDistribution[0.33] = 722;
-        sizeDistribution[0.331] = 725;
-        sizeDistribution[0.332] = 728;
-        sizeDistribution[0.333] = 730;
-        sizeDistribution[0.334] = 733;
-        sizeDistribution[0.335] = 736;
-        sizeDistribution[0.336] = 739;
-        sizeDistribution[0.337] = 742;
-        sizeDistribution[0.338] = 745;
-        sizeDistribution[0.339] = 747;
-        sizeDistribution[0.34] = 750;
-        sizeDistribution[0.341] = 753;
-        sizeDistribution[0.342] = 756;
-        sizeDistribution[0.343] = 759;
-        sizeDistribution[0.344] = 762;
-        sizeDistribution[0.345] = 765;
-        sizeDistribution[0.346] = 767;
-        sizeDistribution[0.347] = 769;
-        sizeDistribution[0.348] = 772;
-        sizeDistribution[0.349] = 775;
-        sizeDistribution[0.35] = 778;
-        sizeDistribution[0.351] = 781;
-        sizeDistribution[0.352] = 784;
-        sizeDistribution[0.353] = 787;
-        sizeDistribution[0.354] = 789;
-        sizeDistribution[0.355] = 792;
-        sizeDistribution[0.356] = 795;
-        sizeDistribution[0.357] = 798;
-        sizeDistribution[0.358] = 801;
-        sizeDistribution[0.359] = 804;
-        sizeDistribution[0.36] = 806;
-        sizeDistribution[0.361] = 810;
-        sizeDistribution[0.362] = 813;
-        sizeDistribution[0.363] = 816;
-        sizeDistribution[0.364] = 819;
-        sizeDistribution[0.365] = 822;
-        sizeDistribution[0.366] = 825;
-        sizeDistribution[0.367] = 828;
-        sizeDistribution[0.368] = 831;
-        sizeDistribution[0.369] = 834;
-        sizeDistribution[0.37] = 837;
-        sizeDistribution[0.371] = 840;
-        sizeDistribution[0.372] = 844;
-        sizeDistribution[0.373] = 847;
-        sizeDistribution[0.374] = 850;
-        sizeDistribution[0.375] = 853;
-        sizeDistribution[0.376] = 856;
-        sizeDistribution[0.377] = 859;
-        sizeDistribution[0.378] = 862;
-        sizeDistribution[0.379] = 865;
-        sizeDistribution[0.38] = 869;
-        sizeDistribution[0.381] = 873;
-        sizeDistribution[0.382] = 876;
-        sizeDistribution[0.383] = 880;
-        sizeDistribution[0.384] = 883;
-        sizeDistribution[0.385] = 886;
-        sizeDistribution[0.386] = 888;
-        sizeDistribution[0.387] = 891;
-        sizeDistribution[0.388] = 893;
-        sizeDistribution[0.389] = 896;
-        sizeDistribution[0.39] = 900;
-        sizeDistribution[0.391] = 904;
-        sizeDistribution[0.392] = 908;
-        sizeDistribution[0.393] = 911;
-        sizeDistribution[0.394] = 915;
-        sizeDistribution[0.395] = 919;
-        sizeDistribution[0.396] = 922;
-        sizeDistribution[0.397] = 926;
-        sizeDistribution[0.398] = 929;
-        sizeDistribution[0.399] = 932;
-        sizeDistribution[0.4] = 936;
-        sizeDistribution[0.401] = 939;
-        sizeDistribution[0.402] = 942;
-        sizeDistribution[0.403] = 946;
-        sizeDistribution[0.404] = 950;
-        sizeDistribution[0.405] = 953;
-        sizeDistribution[0.406] = 957;
-        sizeDistribution[0.407] = 960;
-        sizeDistribution[0.408] = 963;
-        sizeDistribution[0.409] = 967;
-        sizeDistribution[0.41] = 971;
-        sizeDistribution[0.411] = 975;
-        sizeDistribution[0.412] = 978;
-        sizeDistribution[0.413] = 981;
-        sizeDistribution[0.414] = 985;
-        sizeDistribution[0.415] = 989;
-        sizeDistribution[0.416] = 994;
-        sizeDistribution[0.417] = 997;
-        sizeDistribution[0.418] = 1001;
-        sizeDistribution[0.419] = 1004;
-        sizeDistribution[0.42] = 1008;
-        sizeDistribution[0.421] = 1012;
-        sizeDistribution[0.422] = 1016;
-        sizeDistribution[0.423] = 1021;
-        sizeDistribution[0.424] = 1025;
-        sizeDistribution[0.425] = 1029;
-        sizeDistribution[0.426] = 1033;
-        sizeDistribution[0.427] = 1037;
-        sizeDistribution[0.428] = 1042;
-        sizeDistribution[0.429] = 1046;
-        sizeDistribution[0.43] = 1050;
-        sizeDistribution[0.431] = 1054;
-        sizeDistribution[0.432] = 1057;
-        sizeDistribution[0.433] = 1062;
-        sizeDistribution[0.434] = 1066;
-        sizeDistribution[0.435] = 1070;
-        sizeDistribution[0.436] = 1074;
-        sizeDistribution[0.437] = 1078;
-        sizeDistribution[0.438] = 1082;
-        sizeDistribution[0.439] = 1086;
-        sizeDistribution[0.44] = 1090;
-        sizeDistribution[0.441] = 1094;
-        sizeDistribution[0.442] = 1098;
-        sizeDistribution[0.443] = 1102;
-        sizeDistribution[0.444] = 1106;
-        sizeDistribution[0.445] = 1111;
-        sizeDistribution[0.446] = 1115;
-        sizeDistribution[0.447] = 1119;
-        sizeDistribution[0.448] = 1123;
-        sizeDistribution[0.449] = 1127;
-        sizeDistribution[0.45] = 1131;
-        sizeDistribution[0.451] = 1136;
-        sizeDistribution[0.452] = 1139;
-        sizeDistribution[0.453] = 1143;
-        sizeDistribution[0.454] = 1148;
-        sizeDistribution[0.455] = 1152;
-        sizeDistribution[0.456] = 1156;
-        sizeDistribution[0.457] = 1161;
-        sizeDistribution[0.458] = 1164;
-        sizeDistribution[0.459] = 1169;
-        sizeDistribution[0.46] = 1172;
-        sizeDistribution[0.461] = 1177;
-        sizeDistribution[0.462] = 1181;
-        sizeDistribution[0.463] = 1185;
-        sizeDistribution[0.464] = 1189;
-        sizeDistribution[0.465] = 1192;
-        sizeDistribution[0.466] = 1196;
-        sizeDistribution[0.467] = 1200;
-        sizeDistribution[0.468] = 1204;
-        sizeDistribution[0.469] = 1208;
-        sizeDistribution[0.47] = 1213;
-        sizeDistribution[0.471] = 1217;
-        sizeDistribution[0.472] = 1221;
-        sizeDistribution[0.473] = 1226;
-        sizeDistribution[0.474] = 1230;
-        sizeDistribution[0.475] = 1234;
-        sizeDistribution[0.476] = 1239;
-        sizeDistribution[0.477] = 1242;
-        sizeDistribution[0.478] = 1247;
-        sizeDistribution[0.479] = 1250;
-        sizeDistribution[0.48] = 1255;
-        sizeDistribution[0.481] = 1260;
-        sizeDistribution[0.482] = 1264;
-        sizeDistribution[0.483] = 1269;
-        sizeDistribution[0.484] = 1273;
-        sizeDistribution[0.485] = 1277;
-        sizeDistribution[0.486] = 1282;
-        sizeDistribution[0.487] = 1286;
-        sizeDistribution[0.488] = 1291;
-        sizeDistribution[0.489] = 1294;
-        sizeDistribution[0.49] = 1298;
-        sizeDistribution[0.491] = 1303;
-        sizeDistribution[0.492] = 1308;
-        sizeDistribution[0.493] = 1313;
-        sizeDistribution[0.494] = 1317;
-        sizeDistribution[0.495] = 1321;
-        sizeDistribution[0.496] = 1327;
-        sizeDistribution[0.497] = 1331;
-        sizeDistribution[0.498] = 1336;
-        sizeDistribution[0.499] = 1340;
-        sizeDistribution[0.5] = 1345;
-        sizeDistribution[0.501] = 1350;
-        sizeDistribution[0.502] = 1355;
-        sizeDistribution[0.503] = 1360;
-        sizeDistribution[0.504] = 1365;
-        sizeDistribution[0.505] = 1370;
-        sizeDistribution[0.506] = 1375;
-        sizeDistribution[0.507] = 1380;
-        sizeDistribution[0.508] = 1384;
-        sizeDistribution[0.509] = 1389;
-        sizeDistribution[0.51] = 1394;
-        sizeDistribution[0.511] = 1399;
-        sizeDistribution[0.512] = 1404;
-        sizeDistribution[0.513] = 1409;
-        sizeDistribution[0.514] = 1414;
-        sizeDistribution[0.515] = 1419;
-        sizeDistribution[0.516] = 1425;
-        sizeDistribution[0.517] = 1429;
-        sizeDistribution[0.518] = 1435;
-        sizeDistribution[0.519] = 1440;
-        sizeDistribution[0.52] = 1444;
-        sizeDistribution[0.521] = 1449;
-        sizeDistribution[0.522] = 1454;
-        sizeDistribution[0.523] = 1459;
-        sizeDistribution[0.524] = 1464;
-        sizeDistribution[0.525] = 1470;
-        sizeDistribution[0.526] = 1475;
-        sizeDistribution[0.527] = 1480;
-        sizeDistribution[0.528] = 1486;
-        sizeDistribution[0.529] = 1491;
-        sizeDistribution[0.53] = 1496;
-        sizeDistribution[0.531] = 1501;
-        sizeDistribution[0.532] = 1506;
-        sizeDistribution[0.533] = 1511;
-        sizeDistribution[0.534] = 1516;
-        sizeDistribution[0.535] = 1521;
-        sizeDistribution[0.536] = 1526;
-        sizeDistribution[0.537] = 1531;
-        sizeDistribution[0.538] = 1536;
-        sizeDistribution[0.539] = 1541;
-        sizeDistribution[0.54] = 1546;
-        sizeDistribution[0.541] = 1549;
-        sizeDistribution[0.542] = 1554;
-        sizeDistribution[0.543] = 1560;
-        sizeDistribution[0.544] = 1565;
-        sizeDistribution[0.545] = 1570;
-        sizeDistribution[0.546] = 1574;
-        sizeDistribution[0.547] = 1579;
-        sizeDistribution[0.548] = 1584;
-        sizeDistribution[0.549] = 1590;
-        sizeDistribution[0.55] = 1595;
-        sizeDistribution[0.551] = 1601;
-        sizeDistribution[0.552] = 1606;
-        sizeDistribution[0.553] = 1611;
-        sizeDistribution[0.554] = 1615;
-        sizeDistribution[0.555] = 1621;
-        sizeDistribution[0.556] = 1628;
-        sizeDistribution[0.557] = 1634;
-        sizeDistribution[0.558] = 1640;
-        sizeDistribution[0.559] = 1646;
-        sizeDistribution[0.56] = 1651;
-        sizeDistribution[0.561] = 1656;
-        sizeDistribution[0.562] = 1661;
-        sizeDistribution[0.563] = 1667;
-        sizeDistribution[0.564] = 1671;
-        sizeDistribution[0.565] = 1676;
-        sizeDistribution[0.566] = 1682;
-        sizeDistribution[0.567] = 1687;
-        sizeDistribution[0.568] = 1693;
-        sizeDistribution[0.569] = 1699;
-        sizeDistribution[0.57] = 1705;
-        sizeDistribution[0.571] = 1711;
-        sizeDistribution[0.572] = 1717;
-        sizeDistribution[0.573] = 1724;
-        sizeDistribution[0.574] = 1730;
-        sizeDistribution[0.575] = 1736;
-        sizeDistribution[0.576] = 1742;
-        sizeDistribution[0.577] = 1749;
-        sizeDistribution[0.578] = 1755;
-        sizeDistribution[0.579] = 1762;
-        sizeDistribution[0.58] = 1768;
-        sizeDistribution[0.581] = 1773;
-        sizeDistribution[0.582] = 1780;
-        sizeDistribution[0.583] = 1786;
-        sizeDistribution[0.584] = 1791;
-        sizeDistribution[0.585] = 1797;
-        sizeDistribution[0.586] = 1804;
-        sizeDistribution[0.587] = 1811;
-        sizeDistribution[0.588] = 1817;
-        sizeDistribution[0.589] = 1825;
-        sizeDistribution[0.59] = 1832;
-        sizeDistribution[0.591] = 1838;
-        sizeDistribution[0.592] = 1845;
-        sizeDistribution[0.593] = 1850;
-        sizeDistribution[0.594] = 1858;
-        sizeDistribution[0.595] = 1865;
-        sizeDistribution[0.596] = 1872;
-        sizeDistribution[0.597] = 1880;
-        sizeDistribution[0.598] = 1887;
-        sizeDistribution[0.599] = 1894;
-        sizeDistribution[0.6] = 1901;
-        sizeDistribution[0.601] = 1907;
-        sizeDistribution[0.602] = 1915;
-        sizeDistribution[0.603] = 1922;
-        sizeDistribution[0.604] = 1930;
-        sizeDistribution[0.605] = 1937;
-        sizeDistribution[0.606] = 1946;
-        sizeDistribution[0.607] = 1953;
-        sizeDistribution[0.608] = 1962;
-        sizeDistribution[0.609] = 1969;
-        sizeDistribution[0.61] = 1979;
-        sizeDistribution[0.611] = 1987;
-        sizeDistribution[0.612] = 1997;
-        sizeDistribution[0.613] = 2007;
-        sizeDistribution[0.614] = 2015;
-        sizeDistribution[0.615] = 2022;
-        sizeDistribution[0.616] = 2030;
-        sizeDistribution[0.617] = 2037;
-        sizeDistribution[0.618] = 2046;
-        sizeDistribution[0.619] = 2053;
-        sizeDistribution[0.62] = 2062;
-        sizeDistribution[0.621] = 2071;
-        sizeDistribution[0.622] = 2081;
-        sizeDistribution[0.623] = 2091;
-        sizeDistribution[0.624] = 2101;
-        sizeDistribution[0.625] = 2110;
-        sizeDistribution[0.626] = 2118;
-        sizeDistribution[0.627] = 2127;
-        sizeDistribution[0.628] = 2137;
-        sizeDistribution[0.629] = 2146;
-        sizeDistribution[0.63] = 2158;
-        sizeDistribution[0.631] = 2167;
-        sizeDistribution[0.632] = 2177;
-        sizeDistribution[0.633] = 2188;
-        sizeDistribution[0.634] = 2198;
-        sizeDistribution[0.635] = 2207;
-        sizeDistribution[0.636] = 2217;
-        sizeDistribution[0.637] = 2226;
-        sizeDistribution[0.638] = 2235;
-        sizeDistribution[0.639] = 2245;
-        sizeDistribution[0.64] = 2254;
-        sizeDistribution[0.641] = 2266;
-        sizeDistribution[0.642] = 2275;
-        sizeDistribution[0.643] = 2285;
-        sizeDistribution[0.644] = 2295;
-        sizeDistribution[0.645] = 2304;
-        sizeDistribution[0.646] = 2313;
-        sizeDistribution[0.647] = 2323;
-        sizeDistribution[0.648] = 2334;
-        sizeDistribution[0.649] = 2344;
-        sizeDistribution[0.65] = 2355;
-        sizeDistribution[0.651] = 2364;
-        sizeDistribution[0.652] = 2374;
-        sizeDistribution[0.653] = 2386;
-        sizeDistribution[0.654] = 2397;
-        sizeDistribution[0.655] = 2407;
-        sizeDistribution[0.656] = 2418;
-        sizeDistribution[0.657] = 2427;
-        sizeDistribution[0.658] = 2439;
-        sizeDistribution[0.659] = 2448;
-        sizeDistribution[0.66] = 2459;
-        sizeDistribution[0.661] = 2470;
-        sizeDistribution[0.662] = 2480;
-        sizeDistribution[0.663] = 2491;
-        sizeDistribution[0.664] = 2501;
-        sizeDistribution[0.665] = 2513;
-        sizeDistribution[0.666] = 2523;
-        sizeDistribution[0.667] = 2536;
-        sizeDistribution[0.668] = 2548;
-        sizeDistribution[0.669] = 2558;
-        sizeDistribution[0.67] = 2571;
-        sizeDistribution[0.671] = 2582;
-        sizeDistribution[0.672] = 2592;
-        sizeDistribution[0.673] = 2604;
-        sizeDistribution[0.674] = 2615;
-        sizeDistribution[0.675] = 2625;
-        sizeDistribution[0.676] = 2636;
-        sizeDistribution[0.677] = 2647;
-        sizeDistribution[0.678] = 2659;
-        sizeDistribution[0.679] = 2667;
-        sizeDistribution[0.68] = 2679;
-        sizeDistribution[0.681] = 2688;
-        sizeDistribution[0.682] = 2700;
-        sizeDistribution[0.683] = 2709;
-        sizeDistribution[0.684] = 2720;
-        sizeDistribution[0.685] = 2733;
-        sizeDistribution[0.686] = 2745;
-        sizeDistribution[0.687] = 2755;
-        sizeDistribution[0.688] = 2764;
-        sizeDistribution[0.689] = 2775;
-        sizeDistribution[0.69] = 2788;
-        sizeDistribution[0.691] = 2799;
-        sizeDistribution[0.692] = 2810;
-        sizeDistribution[0.693] = 2821;
-        sizeDistribution[0.694] = 2831;
-        sizeDistribution[0.695] = 2842;
-        sizeDistribution[0.696] = 2854;
-        sizeDistribution[0.697] = 2864;
-        sizeDistribution[0.698] = 2874;
-        sizeDistribution[0.699] = 2885;
-        sizeDistribution[0.7] = 2895;
-        sizeDistribution[0.701] = 2906;
-        sizeDistribution[0.702] = 2917;
-        sizeDistribution[0.703] = 2928;
-        sizeDistribution[0.704] = 2940;
-        sizeDistribution[0.705] = 2952;
-        sizeDistribution[0.706] = 2964;
-        sizeDistribution[0.707] = 2976;
-        sizeDistribution[0.708] = 2986;
-        sizeDistribution[0.709] = 2997;
-        sizeDistribution[0.71] = 3009;
-        sizeDistribution[0.711] = 3020;
-        sizeDistribution[0.712] = 3031;
-        sizeDistribution[0.713] = 3040;
-        sizeDistribution[0.714] = 3049;
-        sizeDistribution[0.715] = 3060;
-        sizeDistribution[0.716] = 3071;
-        sizeDistribution[0.717] = 3082;
-        sizeDistribution[0.718] = 3094;
-        sizeDistribution[0.719] = 3106;
-        sizeDistribution[0.72] = 3117;
-        sizeDistribution[0.721] = 3129;
-        sizeDistribution[0.722] = 3140;
-        sizeDistribution[0.723] = 3151;
-        sizeDistribution[0.724] = 3164;
-        sizeDistribution[0.725] = 3176;
-        sizeDistribution[0.726] = 3188;
-        sizeDistribution[0.727] = 3200;
-        sizeDistribution[0.728] = 3211;
-        sizeDistribution[0.729] = 3223;
-        sizeDistribution[0.73] = 3234;
-        sizeDistribution[0.731] = 3245;
-        sizeDistribution[0.732] = 3255;
-        sizeDistribution[0.733] = 3266;
-        sizeDistribution[0.734] = 3275;
-        sizeDistribution[0.735] = 3288;
-        sizeDistribution[0.736] = 3298;
-        sizeDistribution[0.737] = 3311;
-        sizeDistribution[0.738] = 3322;
-        sizeDistribution[0.739] = 3332;
-        sizeDistribution[0.74] = 3344;
-        sizeDistribution[0.741] = 3358;
-        sizeDistribution[0.742] = 3369;
-        sizeDistribution[0.743] = 3381;
-        sizeDistribution[0.744] = 3394;
-        sizeDistribution[0.745] = 3407;
-        sizeDistribution[0.746] = 3421;
-        sizeDistribution[0.747] = 3435;
-        sizeDistribution[0.748] = 3448;
-        sizeDistribution[0.749] = 3461;
-        sizeDistribution[0.75] = 3475;
-        sizeDistribution[0.751] = 3486;
-        sizeDistribution[0.752] = 3501;
-        sizeDistribution[0.753] = 3517;
-        sizeDistribution[0.754] = 3532;
-        sizeDistribution[0.755] = 3547;
-        sizeDistribution[0.756] = 3561;
-        sizeDistribution[0.757] = 3572;
-        sizeDistribution[0.758] = 3587;
-        sizeDistribution[0.759] = 3603;
-        sizeDistribution[0.76] = 3615;
-        sizeDistribution[0.761] = 3625;
-        sizeDistribution[0.762] = 3639;
-        sizeDistribution[0.763] = 3652;
-        sizeDistribution[0.764] = 3668;
-        sizeDistribution[0.765] = 3681;
-        sizeDistribution[0.766] = 3697;
-        sizeDistribution[0.767] = 3713;
-        sizeDistribution[0.768] = 3727;
-        sizeDistribution[0.769] = 3741;
-        sizeDistribution[0.77] = 3758;
-        sizeDistribution[0.771] = 3773;
-        sizeDistribution[0.772] = 3783;
-        sizeDistribution[0.773] = 3796;
-        sizeDistribution[0.774] = 3809;
-        sizeDistribution[0.775] = 3824;
-        sizeDistribution[0.776] = 3836;
-        sizeDistribution[0.777] = 3850;
-        sizeDistribution[0.778] = 3861;
-        sizeDistribution[0.779] = 3875;
-        sizeDistribution[0.78] = 3890;
-        sizeDistribution[0.781] = 3903;
-        sizeDistribution[0.782] = 3916;
-        sizeDistribution[0.783] = 3927;
-        sizeDistribution[0.784] = 3946;
-        sizeDistribution[0.785] = 3960;
-        sizeDistribution[0.786] = 3974;
-        sizeDistribution[0.787] = 3990;
-        sizeDistribution[0.788] = 4003;
-        sizeDistribution[0.789] = 4016;
-        sizeDistribution[0.79] = 4029;
-        sizeDistribution[0.791] = 4041;
-        sizeDistribution[0.792] = 4053;
-        sizeDistribution[0.793] = 4071;
-        sizeDistribution[0.794] = 4086;
-        sizeDistribution[0.795] = 4104;
-        sizeDistribution[0.796] = 4122;
-        sizeDistribution[0.797] = 4140;
-        sizeDistribution[0.798] = 4151;
-        sizeDistribution[0.799] = 4170;
-        sizeDistribution[0.8] = 4184;
-        sizeDistribution[0.801] = 4199;
-        sizeDistribution[0.802] = 4209;
-        sizeDistribution[0.803] = 4223;
-        sizeDistribution[0.804] = 4239;
-        sizeDistribution[0.805] = 4252;
-        sizeDistribution[0.806] = 4266;
-        sizeDistribution[0.807] = 4279;
-        sizeDistribution[0.808] = 4295;
-        sizeDistribution[0.809] = 4308;
-        sizeDistribution[0.81] = 4325;
-        sizeDistribution[0.811] = 4339;
-        sizeDistribution[0.812] = 4356;
-        sizeDistribution[0.813] = 4370;
-        sizeDistribution[0.814] = 4386;
-        sizeDistribution[0.815] = 4401;
-        sizeDistribution[0.816] = 4417;
-        sizeDistribution[0.817] = 4428;
-        sizeDistribution[0.818] = 4446;
-        sizeDistribution[0.819] = 4466;
-        sizeDistribution[0.82] = 4483;
-        sizeDistribution[0.821] = 4497;
-        sizeDistribution[0.822] = 4515;
-        sizeDistribution[0.823] = 4526;
-        sizeDistribution[0.824] = 4545;
-        sizeDistribution[0.825] = 4559;
-        sizeDistribution[0.826] = 4577;
-        sizeDistribution[0.827] = 4593;
-        sizeDistribution[0.828] = 4606;
-        sizeDistribution[0.829] = 4629;
-        sizeDistribution[0.83] = 4646;
-        sizeDistribution[0.831] = 4663;
-        sizeDistribution[0.832] = 4679;
-        sizeDistribution[0.833] = 4694;
-        sizeDistribution[0.834] = 4708;
-        sizeDistribution[0.835] = 4722;
-        sizeDistribution[0.836] = 4737;
-        sizeDistribution[0.837] = 4753;
-        sizeDistribution[0.838] = 4765;
-        sizeDistribution[0.839] = 4774;
-        sizeDistribution[0.84] = 4790;
-        sizeDistribution[0.841] = 4805;
-        sizeDistribution[0.842] = 4817;
-        sizeDistribution[0.843] = 4830;
-        sizeDistribution[0.844] = 4841;
-        sizeDistribution[0.845] = 4855;
-        sizeDistribution[0.846] = 4873;
-        sizeDistribution[0.847] = 4888;
-        sizeDistribution[0.848] = 4905;
-        sizeDistribution[0.849] = 4921;
-        sizeDistribution[0.85] = 4935;
-        sizeDistribution[0.851] = 4958;
-        sizeDistribution[0.852] = 4970;
-        sizeDistribution[0.853] = 4986;
-        sizeDistribution[0.854] = 4996;
-        sizeDistribution[0.855] = 5010;
-        sizeDistribution[0.856] = 5025;
-        sizeDistribution[0.857] = 5041;
-        sizeDistribution[0.858] = 5057;
-        sizeDistribution[0.859] = 5075;
-        sizeDistribution[0.86] = 5094;
-        sizeDistribution[0.861] = 5117;
-        sizeDistribution[0.862] = 5138;
-        sizeDistribution[0.863] = 5157;
-        sizeDistribution[0.864] = 5174;
-        sizeDistribution[0.865] = 5191;
-        sizeDistribution[0.866] = 5209;
-        sizeDistribution[0.867] = 5228;
-        sizeDistribution[0.868] = 5248;
-        sizeDistribution[0.869] = 5270;
-        sizeDistribution[0.87] = 5291;
-        sizeDistribution[0.871] = 5310;
-        sizeDistribution[0.872] = 5324;
-        sizeDistribution[0.873] = 5341;
-        sizeDistribution[0.874] = 5358;
-        sizeDistribution[0.875] = 5374;
-        sizeDistribution[0.876] = 5391;
-        sizeDistribution[0.877] = 5406;
-        sizeDistribution[0.878] = 5429;
-        sizeDistribution[0.879] = 5454;
-        sizeDistribution[0.88] = 5476;
-        sizeDistribution[0.881] = 5501;
-        sizeDistribution[0.882] = 5515;
-        sizeDistribution[0.883] = 5532;
-        sizeDistribution[0.884] = 5547;
-        sizeDistribution[0.885] = 5573;
-        sizeDistribution[0.886] = 5598;
-        sizeDistribution[0.887] = 5624;
-        sizeDistribution[0.888] = 5651;
-        sizeDistribution[0.889] = 5670;
-        sizeDistribution[0.89] = 5689;
-        sizeDistribution[0.891] = 5706;
-        sizeDistribution[0.892] = 5728;
-        sizeDistribution[0.893] = 5748;
-        sizeDistribution[0.894] = 5773;
-        sizeDistribution[0.895] = 5794;
-        sizeDistribution[0.896] = 5819;
-        sizeDistribution[0.897] = 5844;
-        sizeDistribution[0.898] = 5866;
-        sizeDistribution[0.899] = 5888;
-        sizeDistribution[0.9] = 5909;
-        sizeDistribution[0.901] = 5931;
-        sizeDistribution[0.902] = 5957;
-        sizeDistribution[0.903] = 5982;
-        sizeDistribution[0.904] = 6009;
-        sizeDistribution[0.905] = 6028;
-        sizeDistribution[0.906] = 6054;
-        sizeDistribution[0.907] = 6080;
-        sizeDistribution[0.908] = 6109;
-        sizeDistribution[0.909] = 6137;
-        sizeDistribution[0.91] = 6167;
-        sizeDistribution[0.911] = 6194;
-        sizeDistribution[0.912] = 6225;
-        sizeDistribution[0.913] = 6260;
-        sizeDistribution[0.914] = 6296;
-        sizeDistribution[0.915] = 6327;
-        sizeDistribution[0.916] = 6361;
-        sizeDistribution[0.917] = 6396;
-        sizeDistribution[0.918] = 6431;
-        sizeDistribution[0.919] = 6464;
-        sizeDistribution[0.92] = 6505;
-        sizeDistribution[0.921] = 6538;
-        sizeDistribution[0.922] = 6577;
-        sizeDistribution[0.923] = 6615;
-        sizeDistribution[0.924] = 6657;
-        sizeDistribution[0.925] = 6693;
-        sizeDistribution[0.926] = 6732;
-        sizeDistribution[0.927] = 6768;
-        sizeDistribution[0.928] = 6800;
-        sizeDistribution[0.929] = 6837;
-        sizeDistribution[0.93] = 6869;
-        sizeDistribution[0.931] = 6902;
-        sizeDistribution[0.932] = 6940;
-        sizeDistribution[0.933] = 6977;
-        sizeDistribution[0.934] = 7012;
-        sizeDistribution[0.935] = 7056;
-        sizeDistribution[0.936] = 7093;
-        sizeDistribution[0.937] = 7130;
-        sizeDistribution[0.938] = 7166;
-        sizeDistribution[0.939] = 7201;
-        sizeDistribution[0.94] = 7241;
-        sizeDistribution[0.941] = 7289;
-        sizeDistribution[0.942] = 7342;
-        sizeDistribution[0.943] = 7389;
-        sizeDistribution[0.944] = 7438;
-        sizeDistribution[0.945] = 7484;
-        sizeDistribution[0.946] = 7530;
-        sizeDistribution[0.947] = 7580;
-        sizeDistribution[0.948] = 7634;
-        sizeDistribution[0.949] = 7685;
-        sizeDistribution[0.95] = 7747;
-        sizeDistribution[0.951] = 7803;
-        sizeDistribution[0.952] = 7851;
-        sizeDistribution[0.953] = 7899;
-        sizeDistribution[0.954] = 7954;
-        sizeDistribution[0.955] = 8011;
-        sizeDistribution[0.956] = 8074;
-        sizeDistribution[0.957] = 8135;
-        sizeDistribution[0.958] = 8201;
-        sizeDistribution[0.959] = 8264;
-        sizeDistribution[0.96] = 8322;
-        sizeDistribution[0.961] = 8373;
-        sizeDistribution[0.962] = 8419;
-        sizeDistribution[0.963] = 8477;
-        sizeDistribution[0.964] = 8537;
-        sizeDistribution[0.965] = 8603;
-        sizeDistribution[0.966] = 8664;
-        sizeDistribution[0.967] = 8730;
-        sizeDistribution[0.968] = 8804;
-        sizeDistribution[0.969] = 8871;
-        sizeDistribution[0.97] = 8932;
-        sizeDistribution[0.971] = 8988;
-        sizeDistribution[0.972] = 9046;
-        sizeDistribution[0.973] = 9107;
-        sizeDistribution[0.974] = 9173;
-        sizeDistribution[0.975] = 9256;
-        sizeDistribution[0.976] = 9329;
-        sizeDistribution[0.977] = 9429;
-        sizeDistribution[0.978] = 9522;
-        sizeDistribution[0.979] = 9604;
-        sizeDistribution[0.98] = 9702;
-        sizeDistribution[0.981] = 9804;
-        sizeDistribution[0.982] = 9918;
-        sizeDistribution[0.983] = 10036;
-        sizeDistribution[0.984] = 10129;
-        sizeDistribution[0.985] = 10218;
-        sizeDistribution[0.986] = 10314;
-        sizeDistribution[0.987] = 10397;
-        sizeDistribution[0.988] = 10483;
-        sizeDistribution[0.989] = 10623;
-        sizeDistribution[0.99] = 10802;
-        sizeDistribution[0.991] = 11029;
-        sizeDistribution[0.992] = 11223;
-        sizeDistribution[0.993] = 11478;
-        sizeDistribution[0.994] = 11923;
-        sizeDistribution[0.995] = 12404;
-        sizeDistribution[0.996] = 15490;
-        sizeDistribution[0.997] = 22140;
-        sizeDistribution[0.998] = 37817;
-        sizeDistribution[0.999] = 59737;
-        sizeDistribution[1] = 85660;
-        break;
-    default: // Unknown distribution
-        NS_ABORT_MSG("Unknown video streaming distribution '" + distributionName + "'");
+        if (values[i] < values[i - 1])
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    return sizeDistribution;
+/**
+ * Checks that all built-in distributions are valid CDFs
+ *
+ * \return True if all distributions are valid
+ */
+constexpr bool
+ValidateBuiltIns()
+{
+    for (const auto& distribution : BUILT_IN_DISTRIBUTIONS)
+    {
+        if (distribution.sizeCount < 2 || distribution.intervalCount < 2 ||
+            !IsSorted(distribution.sizes, distribution.sizeCount) ||
+            !IsSorted(distribution.intervals, distribution.intervalCount) ||
+            FindBuiltIn(distribution.name) != &distribution)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-std::map<double, double>
-PscVideoStreamingDistributions::GetIntervalDistribution(std::string distributionName)
+static_assert(ValidateBuiltIns(), "Invalid built-in video streaming distribution");
+
+/**
+ * Converts the values of a built-in distribution into a CDF indexed by probability
+ *
+ * \param values The values
+ * \param count The number of values
+ * \return The CDF
+ */
+template <typename T>
+std::map<double, T>
+ToDistribution(const T* values, std::size_t count)
+{
+    std::map<double, T> distribution;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        distribution.emplace_hint(distribution.end(),
+                                  static_cast<double>(i) / (count - 1),
+                                  values[i]);
+    }
+
+    return distribution;
+}
+
+/**
+ * Finds a built-in distribution by name, aborting if it does not exist
+ *
+ * \param distributionName The name of the distribution
+ * \return The built-in distribution
+ */
+const BuiltInDistribution&
+GetBuiltIn(const std::string& distributionName)
+{
+    const BuiltInDistribution* distribution = FindBuiltIn(distributionName);
+    NS_ABORT_MSG_IF(distribution == nullptr,
+                    "Unknown video streaming distribution '" + distributionName + "'");
+
+    return *distribution;
+}
+
+/**
+ * Builds a CDF indexed by probability from values with a fixed probability step
+ *
+ * \param increment The probability step
+ * \param values The values for each probability in ascending order, starting at 0
+ * \return The CDF
+ */
+template <typename T>
+std::map<double, T>
+ToSteppedDistribution(double increment, const std::vector<T>& values)
+{
+    std::map<double, T> distribution;
+    double currProb = 0;
+
+    for (const auto& value : values)
+    {
+        if (currProb > 1)
+        {
+            currProb = 1;
+        }
+        distribution[currProb] = value;
+        currProb += increment;
+    }
+    distribution[1] = values.empty() ? T() : values.back();
+
+    return distribution;
+}
+
+/**
+ * Reads a CDF with a fixed probability step from a text file. The first line
+ * of the file contains the step, and the following lines the values for each
+ * probability in ascending order.
+ *
+ * \param filePath Path to the file
+ * \return The CDF, indexed by probability
+ */
+template <typename T>
+std::map<double, T>
+ReadCdfFile(const std::string& filePath)
+{
+    double increment;
+    std::vector<T> values;
+    T readValue;
+
+    std::ifstream fin(filePath.c_str());
+    NS_ABORT_MSG_IF(!fin.is_open(), "Cannot open file " + filePath);
+
+    fin >> increment;
+    while (fin.good() && fin >> readValue)
+    {
+        values.push_back(readValue);
+    }
+
+    return ToSteppedDistribution(increment, values);
+}
+
+/// Magic string at the start of binary CDF files
+constexpr char BINARY_CDF_MAGIC[8] = {'P', 'S', 'C', 'C', 'D', 'F', '0', '1'};
+
+/// Type of the values stored in binary CDF files
+enum BinaryCdfValueType : uint32_t
+{
+    UINT32_VALUES = 0, //!< Values stored as uint32_t
+    DOUBLE_VALUES = 1  //!< Values stored as double
+};
+
+/**
+ * Header of binary CDF files
+ */
+struct BinaryCdfHeader
+{
+    char magic[8];      //!< Magic string
+    uint32_t valueType; //!< Type of the values
+    uint32_t count;     //!< Number of values
+    double step;        //!< Probability step
+};
+
+static_assert(sizeof(BinaryCdfHeader) == 24, "Unexpected size of the binary CDF header");
+
+/**
+ * Reads a CDF with a fixed probability step from a binary file.
+ *
+ * \param filePath Path to the file
+ * \return The CDF, indexed by probability
+ */
+template <typename T>
+std::map<double, T>
+ReadBinaryCdfFile(const std::string& filePath)
+{
+    std::ifstream fin(filePath.c_str(), std::ios::binary | std::ios::ate);
+    NS_ABORT_MSG_IF(!fin.is_open(), "Cannot open file " + filePath);
+    auto fileSize = static_cast<std::size_t>(fin.tellg());
+    fin.seekg(0);
+
+    BinaryCdfHeader header;
+    NS_ABORT_MSG_IF(!fin.read(reinterpret_cast<char*>(&header), sizeof(header)),
+                    "File " + filePath + " is too short");
+    NS_ABORT_MSG_IF(std::memcmp(header.magic, BINARY_CDF_MAGIC, sizeof(header.magic)) != 0,
+                    "File " + filePath + " is not a binary CDF file");
+    NS_ABORT_MSG_IF(header.valueType != UINT32_VALUES && header.valueType != DOUBLE_VALUES,
+                    "Unknown value type in binary CDF file " + filePath);
+
+    std::size_t valueSize =
+        (header.valueType == UINT32_VALUES ? sizeof(uint32_t) : sizeof(double));
+    NS_ABORT_MSG_IF(fileSize != sizeof(header) + header.count * valueSize,
+                    "Size of binary CDF file " + filePath + " does not match its header");
+
+    // The packed values are read in a single call, without any parsing
+    std::vector<T> values(header.count);
+    if (header.valueType == UINT32_VALUES)
+    {
+        std::vector<uint32_t> packed(header.count);
+        fin.read(reinterpret_cast<char*>(packed.data()), packed.size() * sizeof(uint32_t));
+        std::copy(packed.begin(), packed.end(), values.begin());
+    }
+    else
+    {
+        std::vector<double> packed(header.count);
+        fin.read(reinterpret_cast<char*>(packed.data()), packed.size() * sizeof(double));
+        std::copy(packed.begin(), packed.end(), values.begin());
+    }
+    NS_ABORT_MSG_IF(!fin, "Cannot read the values of file " + filePath);
+
+    return ToSteppedDistribution(header.step, values);
+}
+
+/**
+ * Reads a CDF with a fixed probability step from a file in text or binary format
+ *
+ * \param filePath Path to the file
+ * \return The CDF, indexed by probability
+ */
+template <typename T>
+std::map<double, T>
+ReadAnyCdfFile(const std::string& filePath)
+{
+    if (PscVideoStreamingDistributions::IsBinaryFile(filePath))
+    {
+        return ReadBinaryCdfFile<T>(filePath);
+    }
+
+    return ReadCdfFile<T>(filePath);
+}
+
+} // namespace
+
+PscVideoStreamingDistribution::PscVideoStreamingDistribution(
+    std::map<double, uint32_t> sizeDistribution,
+    std::map<double, double> intervalDistribution)
+    : m_sizeDistribution(std::move(sizeDistribution)),
+      m_intervalDistribution(std::move(intervalDistribution))
+{
+    NS_LOG_FUNCTION(this);
+}
+
+const std::map<double, uint32_t>&
+PscVideoStreamingDistribution::GetSizeDistribution() const
+{
+    return m_sizeDistribution;
+}
+
+const std::map<double, double>&
+PscVideoStreamingDistribution::GetIntervalDistribution() const
+{
+    return m_intervalDistribution;
+}
+
+PscVideoStreamingDistribution::Tables
+PscVideoStreamingDistribution::GetTables(double boostPercentile) const
+{
+    NS_LOG_FUNCTION(this << boostPercentile);
+
+    auto it = m_tables.find(boostPercentile);
+    if (it == m_tables.end())
+    {
+        it = m_tables.emplace(boostPercentile, BuildTables(boostPercentile)).first;
+    }
+
+    return it->second;
+}
+
+PscVideoStreamingDistribution::Tables
+PscVideoStreamingDistribution::BuildTables(double boostPercentile) const
+{
+    NS_LOG_FUNCTION(this << boostPercentile);
+
+    double boostPctSize = (1 - boostPercentile / 100);
+
+    std::vector<std::pair<double, double>> sizePoints;
+    std::vector<std::pair<double, double>> intervalPoints;
+    std::vector<std::pair<double, double>> sizeBoostPoints;
+    std::vector<std::pair<double, double>> intervalBoostPoints;
+    sizePoints.reserve(m_sizeDistribution.size() + 1);
+    intervalPoints.reserve(m_intervalDistribution.size() + 1);
+
+    // Size
+    double oldProb = 0;
+    uint32_t oldSize = 0;
+    bool boostCdfStarted = false;
+
+    for (auto it = m_sizeDistribution.begin(); it != m_sizeDistribution.end(); it++)
+    {
+        sizePoints.emplace_back(it->second, it->first);
+
+        // Check if we are in the probability range of the boost
+        if (it->first >= (boostPercentile / 100))
+        {
+            if (!boostCdfStarted)
+            {
+                auto interpolatedVal = static_cast<uint32_t>(
+                    oldSize + (((boostPercentile / 100) - oldProb) / (it->first - oldProb)) *
+                                  (it->second - oldSize));
+                sizeBoostPoints.emplace_back(interpolatedVal, 0);
+                boostCdfStarted = true;
+            }
+            sizeBoostPoints.emplace_back(it->second,
+                                         (it->first - (boostPercentile / 100)) / boostPctSize);
+        }
+        oldProb = it->first;
+        oldSize = it->second;
+    }
+    sizePoints.emplace_back(oldSize, 1);
+    sizeBoostPoints.emplace_back(oldSize, 1);
+
+    // Interval
+    double oldInterval = 0;
+    bool boostCdfFinished = false;
+
+    for (auto it = m_intervalDistribution.begin(); it != m_intervalDistribution.end(); it++)
+    {
+        intervalPoints.emplace_back(it->second, it->first);
+
+        // Check if we are in the probability range of the boost
+        if (it->first < boostPctSize)
+        {
+            intervalBoostPoints.emplace_back(it->second, it->first / boostPctSize);
+        }
+        else
+        {
+            if (!boostCdfFinished)
+            {
+                intervalBoostPoints.emplace_back(it->second, 1);
+                boostCdfFinished = true;
+            }
+        }
+        oldInterval = it->second;
+    }
+    intervalPoints.emplace_back(oldInterval, 1);
+
+    Tables tables;
+    tables.size = Create<PscCdfTable>(sizePoints);
+    tables.interval = Create<PscCdfTable>(intervalPoints);
+    tables.sizeBoost = Create<PscCdfTable>(sizeBoostPoints);
+    tables.intervalBoost = Create<PscCdfTable>(intervalBoostPoints);
+
+    return tables;
+}
+
+Ptr<const PscVideoStreamingDistribution>
+PscVideoStreamingDistributions::Get(const std::string& distributionName)
 {
     NS_LOG_FUNCTION(distributionName);
 
-    std::map<std::string, uint8_t> distributions;
-    distributions["1080p-bright"] = 1;
-    distributions["1080p-dark"] = 2;
-    distributions["720p-bright"] = 3;
-    distributions["720p-dark"] = 4;
+    static std::map<std::string, Ptr<const PscVideoStreamingDistribution>> registry;
+
+    auto it = registry.find(distributionName);
+    if (it == registry.end())
+    {
+        NS_LOG_DEBUG("Building distribution " << distributionName);
+        auto distribution =
+            Create<PscVideoStreamingDistribution>(GetSizeDistribution(distributionName),
+                                                  GetIntervalDistribution(distributionName));
+        it = registry.emplace(distributionName, distribution).first;
+    }
+
+    return it->second;
+}
+
+Ptr<const PscVideoStreamingDistribution>
+PscVideoStreamingDistributions::Load(const std::string& sizeCdfFilePath,
+                                     const std::string& intervalCdfFilePath)
+{
+    NS_LOG_FUNCTION(sizeCdfFilePath << intervalCdfFilePath);
+
+    static std::map<std::pair<std::string, std::string>, Ptr<const PscVideoStreamingDistribution>>
+        registry;
+
+    auto key = std::make_pair(sizeCdfFilePath, intervalCdfFilePath);
+    auto it = registry.find(key);
+    if (it == registry.end())
+    {
+        NS_LOG_DEBUG("Reading distribution from " << sizeCdfFilePath << " and "
+                                                  << intervalCdfFilePath);
+        auto distribution =
+            Create<PscVideoStreamingDistribution>(ReadAnyCdfFile<uint32_t>(sizeCdfFilePath),
+                                                  ReadAnyCdfFile<double>(intervalCdfFilePath));
+        it = registry.emplace(key, distribution).first;
+    }
 
-    std::map<double, double> intervalDistribution;
+    return it->second;
+}
 
-    switch (distributions[distributionName])
+void
+PscVideoStreamingDistributions::ConvertToBinary(const std::string& textFilePath,
+                                                const std::string& binaryFilePath)
+{
+    NS_LOG_FUNCTION(textFilePath << binaryFilePath);
+
+    std::ifstream fin(textFilePath.c_str());
+    NS_ABORT_MSG_IF(!fin.is_open(), "Cannot open file " + textFilePath);
+
+    BinaryCdfHeader header;
+    std::memcpy(header.magic, BINARY_CDF_MAGIC, sizeof(header.magic));
+    NS_ABORT_MSG_IF(!(fin >> header.step), "Cannot read the step of file " + textFilePath);
+
+    // Keep the values as read, to decide on their type once all are known
+    std::vector<std::string> tokens;
+    std::string token;
+    bool integers = true;
+    while (fin >> token)
     {
-    case 1: // 1080p-bright
-        intervalDistribution[0] = 0.039;
-        intervalDistribution[0.02] = 6.207;
-        intervalDistribution[0.04] = 7.085;
-        intervalDistribution[0.06] = 7.417;
-        intervalDistribution[0.08] = 7.945;
-        intervalDistribution[0.1] = 8.437;
-        intervalDistribution[0.12] = 8.783;
-        intervalDistribution[0.14] = 9.273;
-        intervalDistribution[0.16] = 9.827;
-        intervalDistribution[0.18] = 10.202;
-        intervalDistribution[0.2] = 10.827;
-        intervalDistribution[0.22] = 13.476;
-        intervalDistribution[0.24] = 15.210;
-        intervalDistribution[0.26] = 15.786;
-        intervalDistribution[0.28] = 15.980;
-        intervalDistribution[0.3] = 16.042;
-        intervalDistribution[0.32] = 16.096;
-        intervalDistribution[0.34] = 16.159;
-        intervalDistribution[0.36] = 16.240;
-        intervalDistribution[0.38] = 16.352;
-        intervalDistribution[0.4] = 16.536;
-        intervalDistribution[0.42] = 16.765;
-        intervalDistribution[0.44] = 16.966;
-        intervalDistribution[0.46] = 17.114;
-        intervalDistribution[0.48] = 17.193;
-        intervalDistribution[0.5] = 17.249;
-        intervalDistribution[0.52] = 17.301;
-        intervalDistribution[0.54] = 17.353;
-        intervalDistribution[0.56] = 17.410;
-        intervalDistribution[0.58] = 17.478;
-        intervalDistribution[0.6] = 17.562;
-        intervalDistribution[0.62] = 17.672;
-        intervalDistribution[0.64] = 17.824;
-        intervalDistribution[0.66] = 18.007;
-        intervalDistribution[0.68] = 18.204;
-        intervalDistribution[0.7] = 18.391;
-        intervalDistribution[0.72] = 18.541;
-        intervalDistribution[0.74] = 18.666;
-        intervalDistribution[0.76] = 18.796;
-        intervalDistribution[0.78] = 18.952;
-        intervalDistribution[0.8] = 19.162;
-        intervalDistribution[0.82] = 19.430;
-        intervalDistribution[0.84] = 19.731;
-        intervalDistribution[0.86] = 20.005;
-        intervalDistribution[0.88] = 20.215;
-        intervalDistribution[0.9] = 20.436;
-        intervalDistribution[0.92] = 20.908;
-        intervalDistribution[0.94] = 22.732;
-        intervalDistribution[0.96] = 25.798;
-        intervalDistribution[0.98] = 31.016;
-        intervalDistribution[1] = 198.444;
-        break;
-    case 2: // 1080p-dark
-        intervalDistribution[0] = 6.084;
-        intervalDistribution[0.01] = 6.084;
-        intervalDistribution[0.02] = 6.901;
-        intervalDistribution[0.03] = 7.174;
-        intervalDistribution[0.04] = 7.335;
-        intervalDistribution[0.05] = 7.597;
-        intervalDistribution[0.06] = 8.051;
-        intervalDistribution[0.07] = 8.419;
-        intervalDistribution[0.08] = 8.683;
-        intervalDistribution[0.09] = 8.985;
-        intervalDistribution[0.1] = 9.485;
-        intervalDistribution[0.11] = 10.018;
-        intervalDistribution[0.12] = 10.349;
-        intervalDistribution[0.13] = 11.066;
-        intervalDistribution[0.14] = 13.970;
-        intervalDistribution[0.15] = 15.307;
-        intervalDistribution[0.16] = 15.640;
-        intervalDistribution[0.17] = 15.848;
-        intervalDistribution[0.18] = 15.915;
-        intervalDistribution[0.19] = 15.945;
-        intervalDistribution[0.2] = 15.967;
-        intervalDistribution[0.21] = 15.986;
-        intervalDistribution[0.22] = 16.004;
-        intervalDistribution[0.23] = 16.020;
-        intervalDistribution[0.24] = 16.036;
-        intervalDistribution[0.25] = 16.051;
-        intervalDistribution[0.26] = 16.065;
-        intervalDistribution[0.27] = 16.081;
-        intervalDistribution[0.28] = 16.096;
-        intervalDistribution[0.29] = 16.113;
-        intervalDistribution[0.3] = 16.130;
-        intervalDistribution[0.31] = 16.149;
-        intervalDistribution[0.32] = 16.169;
-        intervalDistribution[0.33] = 16.191;
-        intervalDistribution[0.34] = 16.215;
-        intervalDistribution[0.35] = 16.241;
-        intervalDistribution[0.36] = 16.270;
-        intervalDistribution[0.37] = 16.305;
-        intervalDistribution[0.38] = 16.351;
-        intervalDistribution[0.39] = 16.419;
-        intervalDistribution[0.4] = 16.520;
-        intervalDistribution[0.41] = 16.622;
-        intervalDistribution[0.42] = 16.716;
-        intervalDistribution[0.43] = 16.802;
-        intervalDistribution[0.44] = 16.882;
-        intervalDistribution[0.45] = 16.956;
-        intervalDistribution[0.46] = 17.027;
-        intervalDistribution[0.47] = 17.080;
-        intervalDistribution[0.48] = 17.116;
-        intervalDistribution[0.49] = 17.142;
-        intervalDistribution[0.5] = 17.164;
-        intervalDistribution[0.51] = 17.183;
-        intervalDistribution[0.52] = 17.200;
-        intervalDistribution[0.53] = 17.216;
-        intervalDistribution[0.54] = 17.232;
-        intervalDistribution[0.55] = 17.247;
-        intervalDistribution[0.56] = 17.262;
-        intervalDistribution[0.57] = 17.277;
-        intervalDistribution[0.58] = 17.291;
-        intervalDistribution[0.59] = 17.306;
-        intervalDistribution[0.6] = 17.321;
-        intervalDistribution[0.61] = 17.336;
-        intervalDistribution[0.62] = 17.351;
-        intervalDistribution[0.63] = 17.367;
-        intervalDistribution[0.64] = 17.384;
-        intervalDistribution[0.65] = 17.402;
-        intervalDistribution[0.66] = 17.422;
-        intervalDistribution[0.67] = 17.442;
-        intervalDistribution[0.68] = 17.466;
-        intervalDistribution[0.69] = 17.491;
-        intervalDistribution[0.7] = 17.520;
-        intervalDistribution[0.71] = 17.555;
-        intervalDistribution[0.72] = 17.595;
-        intervalDistribution[0.73] = 17.648;
-        intervalDistribution[0.74] = 17.717;
-        intervalDistribution[0.75] = 17.802;
-        intervalDistribution[0.76] = 17.898;
-        intervalDistribution[0.77] = 17.999;
-        intervalDistribution[0.78] = 18.103;
-        intervalDistribution[0.79] = 18.209;
-        intervalDistribution[0.8] = 18.309;
-        intervalDistribution[0.81] = 18.403;
-        intervalDistribution[0.82] = 18.487;
-        intervalDistribution[0.83] = 18.569;
-        intervalDistribution[0.84] = 18.646;
-        intervalDistribution[0.85] = 18.724;
-        intervalDistribution[0.86] = 18.805;
-        intervalDistribution[0.87] = 18.898;
-        intervalDistribution[0.88] = 19.009;
-        intervalDistribution[0.89] = 19.148;
-        intervalDistribution[0.9] = 19.319;
-        intervalDistribution[0.91] = 19.536;
-        intervalDistribution[0.92] = 19.799;
-        intervalDistribution[0.93] = 20.023;
-        intervalDistribution[0.94] = 20.185;
-        intervalDistribution[0.95] = 20.342;
-        intervalDistribution[0.96] = 20.537;
-        intervalDistribution[0.97] = 21.260;
-        intervalDistribution[0.98] = 26.076;
-        intervalDistribution[0.99] = 27.471;
-        intervalDistribution[1] = 197.934;
-        break;
-    case 3: // 720p-bright
-        intervalDistribution[0] = 0.052;
-        intervalDistribution[0.01] = 13.586;
-        intervalDistribution[0.02] = 23.656;
-        intervalDistribution[0.03] = 23.794;
-        intervalDistribution[0.04] = 24.275;
-        intervalDistribution[0.05] = 25.740;
-        intervalDistribution[0.06] = 33.095;
-        intervalDistribution[0.07] = 33.116;
-        intervalDistribution[0.08] = 33.129;
-        intervalDistribution[0.09] = 33.137;
-        intervalDistribution[0.1] = 33.144;
-        intervalDistribution[0.11] = 33.151;
-        intervalDistribution[0.12] = 33.157;
-        intervalDistribution[0.13] = 33.162;
-        intervalDistribution[0.14] = 33.167;
-        intervalDistribution[0.15] = 33.172;
-        intervalDistribution[0.16] = 33.177;
-        intervalDistribution[0.17] = 33.182;
-        intervalDistribution[0.18] = 33.187;
-        intervalDistribution[0.19] = 33.192;
-        intervalDistribution[0.2] = 33.197;
-        intervalDistribution[0.21] = 33.202;
-        intervalDistribution[0.22] = 33.207;
-        intervalDistribution[0.23] = 33.212;
-        intervalDistribution[0.24] = 33.218;
-        intervalDistribution[0.25] = 33.223;
-        intervalDistribution[0.26] = 33.229;
-        intervalDistribution[0.27] = 33.234;
-        intervalDistribution[0.28] = 33.240;
-        intervalDistribution[0.29] = 33.247;
-        intervalDistribution[0.3] = 33.253;
-        intervalDistribution[0.31] = 33.259;
-        intervalDistribution[0.32] = 33.265;
-        intervalDistribution[0.33] = 33.272;
-        intervalDistribution[0.34] = 33.279;
-        intervalDistribution[0.35] = 33.287;
-        intervalDistribution[0.36] = 33.294;
-        intervalDistribution[0.37] = 33.302;
-        intervalDistribution[0.38] = 33.311;
-        intervalDistribution[0.39] = 33.319;
-        intervalDistribution[0.4] = 33.329;
-        intervalDistribution[0.41] = 33.338;
-        intervalDistribution[0.42] = 33.348;
-        intervalDistribution[0.43] = 33.360;
-        intervalDistribution[0.44] = 33.371;
-        intervalDistribution[0.45] = 33.385;
-        intervalDistribution[0.46] = 33.401;
-        intervalDistribution[0.47] = 33.420;
-        intervalDistribution[0.48] = 33.444;
-        intervalDistribution[0.49] = 33.480;
-        intervalDistribution[0.5] = 33.539;
-        intervalDistribution[0.51] = 33.657;
-        intervalDistribution[0.52] = 33.703;
-        intervalDistribution[0.53] = 33.720;
-        intervalDistribution[0.54] = 33.731;
-        intervalDistribution[0.55] = 33.741;
-        intervalDistribution[0.56] = 33.749;
-        intervalDistribution[0.57] = 33.757;
-        intervalDistribution[0.58] = 33.764;
-        intervalDistribution[0.59] = 33.771;
-        intervalDistribution[0.6] = 33.778;
-        intervalDistribution[0.61] = 33.785;
-        intervalDistribution[0.62] = 33.791;
-        intervalDistribution[0.63] = 33.798;
-        intervalDistribution[0.64] = 33.805;
-        intervalDistribution[0.65] = 33.811;
-        intervalDistribution[0.66] = 33.818;
-        intervalDistribution[0.67] = 33.824;
-        intervalDistribution[0.68] = 33.831;
-        intervalDistribution[0.69] = 33.838;
-        intervalDistribution[0.7] = 33.845;
-        intervalDistribution[0.71] = 33.852;
-        intervalDistribution[0.72] = 33.860;
-        intervalDistribution[0.73] = 33.868;
-        intervalDistribution[0.74] = 33.875;
-        intervalDistribution[0.75] = 33.884;
-        intervalDistribution[0.76] = 33.892;
-        intervalDistribution[0.77] = 33.902;
-        intervalDistribution[0.78] = 33.912;
-        intervalDistribution[0.79] = 33.922;
-        intervalDistribution[0.8] = 33.934;
-        intervalDistribution[0.81] = 33.946;
-        intervalDistribution[0.82] = 33.960;
-        intervalDistribution[0.83] = 33.975;
-        intervalDistribution[0.84] = 33.992;
-        intervalDistribution[0.85] = 34.014;
-        intervalDistribution[0.86] = 34.042;
-        intervalDistribution[0.87] = 34.082;
-        intervalDistribution[0.88] = 34.139;
-        intervalDistribution[0.89] = 34.206;
-        intervalDistribution[0.9] = 34.269;
-        intervalDistribution[0.91] = 34.332;
-        intervalDistribution[0.92] = 34.400;
-        intervalDistribution[0.93] = 34.488;
-        intervalDistribution[0.94] = 34.636;
-        intervalDistribution[0.95] = 34.826;
-        intervalDistribution[0.96] = 34.946;
-        intervalDistribution[0.97] = 35.043;
-        intervalDistribution[0.98] = 35.159;
-        intervalDistribution[0.99] = 35.459;
-        intervalDistribution[1] = 192.686;
-        break;
-    case 4: // 720p-dark
-        intervalDistribution[0] = 0.055;
-        intervalDistribution[0.01] = 23.472;
-        intervalDistribution[0.02] = 23.759;
-        intervalDistribution[0.03] = 25.019;
-        intervalDistribution[0.04] = 33.085;
-        intervalDistribution[0.05] = 33.098;
-        intervalDistribution[0.06] = 33.107;
-        intervalDistribution[0.07] = 33.114;
-        intervalDistribution[0.08] = 33.120;
-        intervalDistribution[0.09] = 33.126;
-        intervalDistribution[0.1] = 33.131;
-        intervalDistribution[0.11] = 33.136;
-        intervalDistribution[0.12] = 33.140;
-        intervalDistribution[0.13] = 33.144;
-        intervalDistribution[0.14] = 33.148;
-        intervalDistribution[0.15] = 33.152;
-        intervalDistribution[0.16] = 33.155;
-        intervalDistribution[0.17] = 33.159;
-        intervalDistribution[0.18] = 33.162;
-        intervalDistribution[0.19] = 33.166;
-        intervalDistribution[0.2] = 33.169;
-        intervalDistribution[0.21] = 33.173;
-        intervalDistribution[0.22] = 33.176;
-        intervalDistribution[0.23] = 33.180;
-        intervalDistribution[0.24] = 33.183;
-        intervalDistribution[0.25] = 33.186;
-        intervalDistribution[0.26] = 33.190;
-        intervalDistribution[0.27] = 33.193;
-        intervalDistribution[0.28] = 33.197;
-        intervalDistribution[0.29] = 33.201;
-        intervalDistribution[0.3] = 33.204;
-        intervalDistribution[0.31] = 33.208;
-        intervalDistribution[0.32] = 33.212;
-        intervalDistribution[0.33] = 33.216;
-        intervalDistribution[0.34] = 33.220;
-        intervalDistribution[0.35] = 33.223;
-        intervalDistribution[0.36] = 33.227;
-        intervalDistribution[0.37] = 33.231;
-        intervalDistribution[0.38] = 33.236;
-        intervalDistribution[0.39] = 33.240;
-        intervalDistribution[0.4] = 33.244;
-        intervalDistribution[0.41] = 33.249;
-        intervalDistribution[0.42] = 33.254;
-        intervalDistribution[0.43] = 33.258;
-        intervalDistribution[0.44] = 33.263;
-        intervalDistribution[0.45] = 33.269;
-        intervalDistribution[0.46] = 33.274;
-        intervalDistribution[0.47] = 33.279;
-        intervalDistribution[0.48] = 33.285;
-        intervalDistribution[0.49] = 33.291;
-        intervalDistribution[0.5] = 33.298;
-        intervalDistribution[0.51] = 33.304;
-        intervalDistribution[0.52] = 33.312;
-        intervalDistribution[0.53] = 33.319;
-        intervalDistribution[0.54] = 33.328;
-        intervalDistribution[0.55] = 33.337;
-        intervalDistribution[0.56] = 33.347;
-        intervalDistribution[0.57] = 33.359;
-        intervalDistribution[0.58] = 33.374;
-        intervalDistribution[0.59] = 33.394;
-        intervalDistribution[0.6] = 33.424;
-        intervalDistribution[0.61] = 33.483;
-        intervalDistribution[0.62] = 33.615;
-        intervalDistribution[0.63] = 33.678;
-        intervalDistribution[0.64] = 33.697;
-        intervalDistribution[0.65] = 33.710;
-        intervalDistribution[0.66] = 33.720;
-        intervalDistribution[0.67] = 33.729;
-        intervalDistribution[0.68] = 33.737;
-        intervalDistribution[0.69] = 33.745;
-        intervalDistribution[0.7] = 33.752;
-        intervalDistribution[0.71] = 33.759;
-        intervalDistribution[0.72] = 33.766;
-        intervalDistribution[0.73] = 33.773;
-        intervalDistribution[0.74] = 33.780;
-        intervalDistribution[0.75] = 33.787;
-        intervalDistribution[0.76] = 33.794;
-        intervalDistribution[0.77] = 33.801;
-        intervalDistribution[0.78] = 33.809;
-        intervalDistribution[0.79] = 33.816;
-        intervalDistribution[0.8] = 33.824;
-        intervalDistribution[0.81] = 33.832;
-        intervalDistribution[0.82] = 33.840;
-        intervalDistribution[0.83] = 33.849;
-        intervalDistribution[0.84] = 33.858;
-        intervalDistribution[0.85] = 33.867;
-        intervalDistribution[0.86] = 33.878;
-        intervalDistribution[0.87] = 33.890;
-        intervalDistribution[0.88] = 33.903;
-        intervalDistribution[0.89] = 33.919;
-        intervalDistribution[0.9] = 33.938;
-        intervalDistribution[0.91] = 33.961;
-        intervalDistribution[0.92] = 33.998;
-        intervalDistribution[0.93] = 34.062;
-        intervalDistribution[0.94] = 34.166;
-        intervalDistribution[0.95] = 34.266;
-        intervalDistribution[0.96] = 34.379;
-        intervalDistribution[0.97] = 34.587;
-        intervalDistribution[0.98] = 34.907;
-        intervalDistribution[0.99] = 35.202;
-        intervalDistribution[1] = 133.985;
-        break;
-    default: // Unknown distribution
-        NS_ABORT_MSG("Unknown video streaming distribution '" + distributionName + "'");
+        if (integers && token.find_first_not_of("0123456789") == std::string::npos)
+        {
+            errno = 0;
+            unsigned long long value = std::strtoull(token.c_str(), nullptr, 10);
+            integers = errno != ERANGE && value <= UINT32_MAX;
+        }
+        else
+        {
+            integers = false;
+        }
+        tokens.push_back(token);
     }
+    header.valueType = integers ? UINT32_VALUES : DOUBLE_VALUES;
+    header.count = static_cast<uint32_t>(tokens.size());
+
+    std::ofstream fout(binaryFilePath.c_str(), std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!fout.is_open(), "Cannot open file " + binaryFilePath);
+    fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& value : tokens)
+    {
+        if (integers)
+        {
+            // Already checked to be an unsigned integer that fits in 32 bits
+            auto packed = static_cast<uint32_t>(std::strtoull(value.c_str(), nullptr, 10));
+            fout.write(reinterpret_cast<const char*>(&packed), sizeof(packed));
+        }
+        else
+        {
+            char* end = nullptr;
+            errno = 0;
+            double packed = std::strtod(value.c_str(), &end);
+            NS_ABORT_MSG_IF(end == value.c_str() || *end != '\0' || errno == ERANGE,
+                            "Invalid value " + value + " in file " + textFilePath);
+            fout.write(reinterpret_cast<const char*>(&packed), sizeof(packed));
+        }
+    }
+    NS_ABORT_MSG_IF(!fout.good(), "Cannot write file " + binaryFilePath);
+}
+
+bool
+PscVideoStreamingDistributions::IsBinaryFile(const std::string& filePath)
+{
+    NS_LOG_FUNCTION(filePath);
+
+    char magic[sizeof(BINARY_CDF_MAGIC)];
+    std::ifstream fin(filePath.c_str(), std::ios::binary);
+
+    return fin.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, BINARY_CDF_MAGIC, sizeof(magic)) == 0;
+}
+
+std::map<double, uint32_t>
+PscVideoStreamingDistributions::GetSizeDistribution(std::string distributionName)
+{
+    NS_LOG_FUNCTION(distributionName);
+
+    const BuiltInDistribution& distribution = GetBuiltIn(distributionName);
+
+    return ToDistribution(distribution.sizes, distribution.sizeCount);
+}
+
+std::map<double, double>
+PscVideoStreamingDistributions::GetIntervalDistribution(std::string distributionName)
+{
+    NS_LOG_FUNCTION(distributionName);
+
+    const BuiltInDistribution& distribution = GetBuiltIn(distributionName);
 
-    return intervalDistribution;
+    return ToDistribution(distribution.intervals, distribution.intervalCount);
 }
 
 } // namespace psc
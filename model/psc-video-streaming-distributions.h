@@ -33,16 +33,94 @@
 #ifndef PSC_VIDEO_STREAMING_DISTRIBUTIONS_H
 #define PSC_VIDEO_STREAMING_DISTRIBUTIONS_H
 
+#include "psc-cdf-random-variable.h"
+
 #include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
 #include <ns3/string.h>
 
 #include <map>
+#include <utility>
 
 namespace ns3
 {
 namespace psc
 {
 
+/**
+ * \ingroup psc
+ *
+ * Immutable data distribution of a video stream, made of the CDF of the packet
+ * sizes and the CDF of the inter-packet intervals.
+ *
+ * Instances are obtained through PscVideoStreamingDistributions::Get and
+ * PscVideoStreamingDistributions::Load, which build each distribution only
+ * once per process and hand the same instance to every application using it.
+ * The sampling tables derived from the distribution for a given boost
+ * percentile are also built on first use and shared afterwards.
+ */
+class PscVideoStreamingDistribution : public SimpleRefCount<PscVideoStreamingDistribution>
+{
+  public:
+    /**
+     * Sampling tables derived from a distribution for a given boost percentile
+     */
+    struct Tables
+    {
+        Ptr<const PscCdfTable> size;          //!< Packet sizes
+        Ptr<const PscCdfTable> interval;      //!< Packet intervals, in ms
+        Ptr<const PscCdfTable> sizeBoost;     //!< Packet sizes during boost
+        Ptr<const PscCdfTable> intervalBoost; //!< Packet intervals during boost, in ms
+    };
+
+    /**
+     * Constructor
+     *
+     * \param sizeDistribution The CDF of the packet sizes, indexed by probability
+     * \param intervalDistribution The CDF of the packet intervals (in ms), indexed
+     * by probability
+     */
+    PscVideoStreamingDistribution(std::map<double, uint32_t> sizeDistribution,
+                                  std::map<double, double> intervalDistribution);
+
+    /**
+     * Get the CDF of the packet sizes
+     *
+     * \return The CDF of the packet sizes, indexed by probability
+     */
+    const std::map<double, uint32_t>& GetSizeDistribution() const;
+
+    /**
+     * Get the CDF of the packet intervals
+     *
+     * \return The CDF of the packet intervals (in ms), indexed by probability
+     */
+    const std::map<double, double>& GetIntervalDistribution() const;
+
+    /**
+     * Get the sampling tables for a boost percentile, building them on first use
+     *
+     * \param boostPercentile CDF percentile (from 0 to 100) from which the values
+     * are generated during boost time
+     * \return The sampling tables
+     */
+    Tables GetTables(double boostPercentile) const;
+
+  private:
+    /**
+     * Build the sampling tables for a boost percentile
+     *
+     * \param boostPercentile CDF percentile (from 0 to 100) from which the values
+     * are generated during boost time
+     * \return The sampling tables
+     */
+    Tables BuildTables(double boostPercentile) const;
+
+    std::map<double, uint32_t> m_sizeDistribution;   //!< CDF of the packet sizes
+    std::map<double, double> m_intervalDistribution; //!< CDF of the packet intervals
+    mutable std::map<double, Tables> m_tables;       //!< Tables built, by boost percentile
+};
+
 /**
  * \ingroup psc
  *
@@ -53,6 +131,12 @@ namespace psc
  * CDFs obtained were simplified to have a constant probability step in such a
  * way that at least 95 % of the points are at most 5 % off when compared with
  * the original value.
+ *
+ * The built-in distributions are stored as constexpr arrays of values for
+ * probabilities evenly spaced in [0, 1], so they live in read-only memory and
+ * require no work until they are requested. The script
+ * examples/video_cdf/generate-builtin-distribution.py converts CDF files in the
+ * format read by Load into this form.
  */
 class PscVideoStreamingDistributions
 {
@@ -79,6 +163,64 @@ class PscVideoStreamingDistributions
      */
     static std::map<double, double> GetIntervalDistribution(std::string distributionName);
 
+    /**
+     * Get the shared instance of the built-in distribution corresponding to
+     * the distribution name passed as a parameter. The distribution is built
+     * on the first call for each name.
+     *
+     * If the model does not recognize the name provided, it will abort the simulation
+     *
+     * \param distributionName The name of the distribution
+     * \return The distribution
+     */
+    static Ptr<const PscVideoStreamingDistribution> Get(const std::string& distributionName);
+
+    /**
+     * Get the shared instance of the distribution read from the CDF files
+     * passed as parameters. The files are read on the first call for each pair
+     * of paths.
+     *
+     * Each file can be either in text format or in binary format (see
+     * ConvertToBinary), which is detected automatically. In text format, the
+     * first line of the file contains the fixed probability step, and the
+     * following lines the values for each probability in ascending order,
+     * starting at 0 and up to 1. Binary files are read in a single pass,
+     * without any parsing.
+     *
+     * \param sizeCdfFilePath Path to the file with the packet size CDF
+     * \param intervalCdfFilePath Path to the file with the packet interval CDF
+     * \return The distribution
+     */
+    static Ptr<const PscVideoStreamingDistribution> Load(const std::string& sizeCdfFilePath,
+                                                         const std::string& intervalCdfFilePath);
+
+    /**
+     * Converts a CDF file from the text format to the binary format.
+     *
+     * The binary format is made of a 24-byte header followed by the packed
+     * values, all in the byte order of the host:
+     * - 8 bytes with the magic string "PSCCDF01"
+     * - 4 bytes with the type of the values: 0 for uint32_t, 1 for double
+     * - 4 bytes with the number of values, as uint32_t
+     * - 8 bytes with the fixed probability step, as double
+     * - The values for each probability in ascending order, starting at 0
+     *
+     * Values are stored as uint32_t if all of them are unsigned integers (e.g.,
+     * packet sizes), and as double otherwise.
+     *
+     * \param textFilePath Path to the CDF file in text format
+     * \param binaryFilePath Path to the CDF file to write in binary format
+     */
+    static void ConvertToBinary(const std::string& textFilePath, const std::string& binaryFilePath);
+
+    /**
+     * Checks if a file is a CDF file in binary format
+     *
+     * \param filePath Path to the file
+     * \return True if the file starts with the magic string of the binary format
+     */
+    static bool IsBinaryFile(const std::string& filePath);
+
 }; // class PscVideoStreamingDistributions
 
 } // namespace psc
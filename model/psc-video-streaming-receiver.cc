@@ -0,0 +1,423 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "psc-video-streaming-receiver.h"
+
+#include <ns3/inet-socket-address.h>
+#include <ns3/inet6-socket-address.h>
+#include <ns3/log.h>
+#include <ns3/packet.h>
+#include <ns3/seq-ts-size-header.h>
+#include <ns3/simulator.h>
+#include <ns3/socket.h>
+#include <ns3/udp-socket-factory.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PscVideoStreamingReceiver");
+
+namespace psc
+{
+
+NS_OBJECT_ENSURE_REGISTERED(PscVideoStreamingReceiver);
+
+double
+PscVideoStreamingReceiver::Stats::GetLossRatio() const
+{
+    return expectedPackets > 0 ? static_cast<double>(lostPackets) / expectedPackets : 0;
+}
+
+Time
+PscVideoStreamingReceiver::Stats::GetMeanDelay() const
+{
+    return rxPackets > 0 ? delaySum / static_cast<int64_t>(rxPackets) : Time(0);
+}
+
+double
+PscVideoStreamingReceiver::Stats::GetFrameCompleteness() const
+{
+    return rxFrames > 0 ? static_cast<double>(completeFrames) / rxFrames : 0;
+}
+
+TypeId
+PscVideoStreamingReceiver::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::psc::PscVideoStreamingReceiver")
+            .SetParent<Application>()
+            .AddConstructor<PscVideoStreamingReceiver>()
+            .AddAttribute("Port",
+                          "The port to listen to",
+                          UintegerValue(5554),
+                          MakeUintegerAccessor(&PscVideoStreamingReceiver::m_port),
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("ReportInterval",
+                          "Interval between the reports of the statistics of each stream. If "
+                          "zero, only a final report is generated when the application stops",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&PscVideoStreamingReceiver::m_reportInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddTraceSource("Rx",
+                            "Trace with packets received",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_rxTrace),
+                            "ns3::Packet::AddressTracedCallback")
+            .AddTraceSource("RxFrame",
+                            "Trace with each frame evaluated, its number of fragments, if it "
+                            "was complete, and its delay",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_rxFrameTrace),
+                            "ns3::psc::PscVideoStreamingReceiver::RxFrameTracedCallback")
+            .AddTraceSource("Report",
+                            "Trace with the statistics of each stream, invoked periodically",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_reportTrace),
+                            "ns3::psc::PscVideoStreamingReceiver::ReportTracedCallback")
+            .AddTraceSource("LostPackets",
+                            "Total number of packets lost in all the streams",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_lostPackets),
+                            "ns3::TracedValueCallback::Uint64")
+            .AddTraceSource("ReorderedPackets",
+                            "Total number of packets received out of order in all the streams",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_reorderedPackets),
+                            "ns3::TracedValueCallback::Uint64")
+            .AddTraceSource("CompleteFrames",
+                            "Total number of frames received without losses in all the streams",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_completeFrames),
+                            "ns3::TracedValueCallback::Uint64")
+            .AddTraceSource("IncompleteFrames",
+                            "Total number of frames received with losses in all the streams",
+                            MakeTraceSourceAccessor(&PscVideoStreamingReceiver::m_incompleteFrames),
+                            "ns3::TracedValueCallback::Uint64");
+
+    return tid;
+}
+
+PscVideoStreamingReceiver::PscVideoStreamingReceiver()
+    : m_lostPackets(0),
+      m_reorderedPackets(0),
+      m_completeFrames(0),
+      m_incompleteFrames(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PscVideoStreamingReceiver::~PscVideoStreamingReceiver()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PscVideoStreamingReceiver::Stats
+PscVideoStreamingReceiver::GetStats(const Address& sender) const
+{
+    NS_LOG_FUNCTION(this << sender);
+
+    auto it = m_streams.find(sender);
+    if (it == m_streams.end())
+    {
+        return Stats();
+    }
+    return it->second.stats;
+}
+
+PscVideoStreamingReceiver::Stats
+PscVideoStreamingReceiver::GetTotalStats() const
+{
+    NS_LOG_FUNCTION(this);
+
+    Stats total;
+    for (const auto& [sender, stream] : m_streams)
+    {
+        const Stats& stats = stream.stats;
+        total.rxPackets += stats.rxPackets;
+        total.rxBytes += stats.rxBytes;
+        total.expectedPackets += stats.expectedPackets;
+        total.lostPackets += stats.lostPackets;
+        total.reorderedPackets += stats.reorderedPackets;
+        total.minDelay = std::min(total.minDelay, stats.minDelay);
+        total.maxDelay = std::max(total.maxDelay, stats.maxDelay);
+        total.delaySum += stats.delaySum;
+        total.jitter = std::max(total.jitter, stats.jitter);
+        total.rxFrames += stats.rxFrames;
+        total.completeFrames += stats.completeFrames;
+    }
+    return total;
+}
+
+uint32_t
+PscVideoStreamingReceiver::GetStreamCount() const
+{
+    return m_streams.size();
+}
+
+void
+PscVideoStreamingReceiver::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_socket = nullptr;
+    m_socket6 = nullptr;
+    m_streams.clear();
+    Application::DoDispose();
+}
+
+void
+PscVideoStreamingReceiver::StartApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_socket == nullptr)
+    {
+        m_socket = Socket::CreateSocket(GetNode(), UdpSocketFactory::GetTypeId());
+        m_socket->Bind(InetSocketAddress(Ipv4Address::GetAny(), m_port));
+    }
+    if (m_socket6 == nullptr)
+    {
+        m_socket6 = Socket::CreateSocket(GetNode(), UdpSocketFactory::GetTypeId());
+        m_socket6->Bind(Inet6SocketAddress(Ipv6Address::GetAny(), m_port));
+    }
+
+    m_socket->SetRecvCallback(MakeCallback(&PscVideoStreamingReceiver::HandleRead, this));
+    m_socket6->SetRecvCallback(MakeCallback(&PscVideoStreamingReceiver::HandleRead, this));
+
+    if (!m_reportInterval.IsZero())
+    {
+        m_reportEvent =
+            Simulator::Schedule(m_reportInterval, &PscVideoStreamingReceiver::Report, this);
+    }
+}
+
+void
+PscVideoStreamingReceiver::StopApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_reportEvent.Cancel();
+
+    if (m_socket)
+    {
+        m_socket->Close();
+        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        m_socket = nullptr;
+    }
+    if (m_socket6)
+    {
+        m_socket6->Close();
+        m_socket6->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        m_socket6 = nullptr;
+    }
+
+    // The last frame of each stream can only be evaluated now
+    for (auto& [sender, stream] : m_streams)
+    {
+        if (stream.frameOpen)
+        {
+            CloseFrame(sender, stream, false);
+        }
+    }
+
+    Report();
+}
+
+void
+PscVideoStreamingReceiver::HandleRead(Ptr<Socket> socket)
+{
+    NS_LOG_FUNCTION(this << socket);
+
+    Ptr<Packet> packet;
+    Address from;
+    while ((packet = socket->RecvFrom(from)))
+    {
+        Receive(from, packet);
+    }
+}
+
+void
+PscVideoStreamingReceiver::Receive(const Address& sender, Ptr<const Packet> packet)
+{
+    NS_LOG_FUNCTION(this << sender << packet);
+
+    SeqTsSizeHeader header;
+    if (packet->GetSize() < header.GetSerializedSize())
+    {
+        NS_LOG_WARN("Ignoring packet without SeqTsSizeHeader from " << sender);
+        return;
+    }
+    packet->PeekHeader(header);
+
+    const uint32_t seq = header.GetSeq();
+    const Time ts = header.GetTs();
+    const Time now = Simulator::Now();
+    const Time transit = now - ts;
+
+    auto [it, isNew] = m_streams.try_emplace(sender);
+    Stream& stream = it->second;
+    Stats& stats = stream.stats;
+
+    stats.rxPackets++;
+    stats.rxBytes += packet->GetSize();
+    stats.minDelay = std::min(stats.minDelay, transit);
+    stats.maxDelay = std::max(stats.maxDelay, transit);
+    stats.delaySum += transit;
+
+    // Interarrival jitter estimator from RFC 3550, Section 6.4.1
+    if (!isNew)
+    {
+        Time d = Abs(transit - stream.lastTransit);
+        stats.jitter += (d - stats.jitter) / 16;
+    }
+    stream.lastTransit = transit;
+
+    bool inOrder = isNew || seq > stream.maxSeq;
+    if (isNew)
+    {
+        stream.baseSeq = seq;
+        stream.maxSeq = seq;
+    }
+    else if (inOrder)
+    {
+        stream.maxSeq = seq;
+    }
+    else
+    {
+        stats.reorderedPackets++;
+        m_reorderedPackets++;
+        stream.baseSeq = std::min(stream.baseSeq, seq);
+    }
+
+    // Duplicated packets may make the received count exceed the expected one
+    uint64_t expected = static_cast<uint64_t>(stream.maxSeq - stream.baseSeq) + 1;
+    uint64_t lost = expected > stats.rxPackets ? expected - stats.rxPackets : 0;
+    if (lost != stats.lostPackets)
+    {
+        m_lostPackets = m_lostPackets - stats.lostPackets + lost;
+    }
+    stats.expectedPackets = expected;
+    stats.lostPackets = lost;
+
+    if (inOrder)
+    {
+        if (stream.frameOpen && ts == stream.frameTs)
+        {
+            stream.frameMissing += seq - stream.frameLastSeq - 1;
+            stream.frameLastSeq = seq;
+            stream.frameFragments++;
+            stream.frameLastRx = now;
+        }
+        else
+        {
+            if (stream.frameOpen)
+            {
+                CloseFrame(sender, stream, seq != stream.frameLastSeq + 1);
+            }
+            stream.frameOpen = true;
+            stream.frameTs = ts;
+            stream.frameFirstSeq = seq;
+            stream.frameLastSeq = seq;
+            stream.frameFragments = 1;
+            stream.frameMissing = 0;
+            stream.frameGapBefore = stream.prevFrame && seq != stream.prevFrameLastSeq + 1;
+            stream.frameLastRx = now;
+        }
+    }
+    else if (stream.frameOpen && ts == stream.frameTs)
+    {
+        // Late fragment of the frame being received, which fills a gap
+        stream.frameFragments++;
+        stream.frameLastRx = now;
+        if (seq < stream.frameFirstSeq)
+        {
+            stream.frameMissing += stream.frameFirstSeq - seq - 1;
+            stream.frameFirstSeq = seq;
+            stream.frameGapBefore = stream.prevFrame && seq != stream.prevFrameLastSeq + 1;
+        }
+        else if (stream.frameMissing > 0)
+        {
+            stream.frameMissing--;
+        }
+    }
+
+    m_rxTrace(packet, sender);
+}
+
+void
+PscVideoStreamingReceiver::CloseFrame(const Address& sender, Stream& stream, bool gapAfter)
+{
+    NS_LOG_FUNCTION(this << sender << gapAfter);
+
+    bool complete = !stream.frameGapBefore && !gapAfter && stream.frameMissing == 0;
+
+    stream.stats.rxFrames++;
+    if (complete)
+    {
+        stream.stats.completeFrames++;
+        m_completeFrames++;
+    }
+    else
+    {
+        m_incompleteFrames++;
+    }
+
+    m_rxFrameTrace(sender, stream.frameFragments, complete, stream.frameLastRx - stream.frameTs);
+
+    stream.prevFrame = true;
+    stream.prevFrameLastSeq = stream.frameLastSeq;
+    stream.frameOpen = false;
+}
+
+void
+PscVideoStreamingReceiver::Report()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (const auto& [sender, stream] : m_streams)
+    {
+        const Stats& stats = stream.stats;
+        NS_LOG_INFO("Stream from " << sender << ": received " << stats.rxPackets
+                                   << " packets, lost " << stats.lostPackets << ", reordered "
+                                   << stats.reorderedPackets << ", mean delay "
+                                   << stats.GetMeanDelay().As(Time::MS) << ", jitter "
+                                   << stats.jitter.As(Time::MS) << ", complete frames "
+                                   << stats.completeFrames << "/" << stats.rxFrames);
+        m_reportTrace(sender, stats);
+    }
+
+    if (m_socket && !m_reportInterval.IsZero())
+    {
+        m_reportEvent =
+            Simulator::Schedule(m_reportInterval, &PscVideoStreamingReceiver::Report, this);
+    }
+}
+
+} // namespace psc
+} // namespace ns3
@@ -0,0 +1,319 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef PSC_VIDEO_STREAMING_RECEIVER_H
+#define PSC_VIDEO_STREAMING_RECEIVER_H
+
+#include <ns3/address.h>
+#include <ns3/application.h>
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+#include <ns3/traced-callback.h>
+#include <ns3/traced-value.h>
+
+#include <map>
+
+namespace ns3
+{
+
+class Packet;
+class Socket;
+
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ *
+ * Receiver for the video streams generated by PscVideoStreaming.
+ *
+ * The receiver uses the SeqTsSizeHeader of each packet to measure, per
+ * stream (i.e., per sender address), the packet loss, reordering, one-way
+ * delay, interarrival jitter and frame completeness. All the metrics are
+ * updated incrementally in constant time per packet, and the state kept for
+ * each stream has a fixed size, regardless of the length of the stream.
+ *
+ * A stream is considered to start with the first packet received from the
+ * sender. Packets received with a sequence number lower than or equal to the
+ * highest one received so far are counted as reordered.
+ *
+ * The fragments of a frame are identified by sharing the same timestamp.
+ * A frame is considered complete when no sequence number is missing between
+ * the last fragment of the previous frame and the first fragment of the next
+ * one. Therefore, frames are evaluated when the first fragment of the next
+ * frame arrives (or when the application stops), and losses at the boundary
+ * between two frames are attributed to both of them.
+ */
+class PscVideoStreamingReceiver : public Application
+{
+  public:
+    /**
+     * Statistics of a video stream
+     */
+    struct Stats
+    {
+        uint64_t rxPackets{0};        //!< Number of packets received
+        uint64_t rxBytes{0};          //!< Number of bytes received, including headers
+        uint64_t expectedPackets{0};  //!< Number of packets sent by the sender
+        uint64_t lostPackets{0};      //!< Number of packets not received
+        uint64_t reorderedPackets{0}; //!< Number of packets received out of order
+        Time minDelay{Time::Max()};   //!< Minimum one-way delay
+        Time maxDelay{Time::Min()};   //!< Maximum one-way delay
+        Time delaySum{0};             //!< Sum of the one-way delays of all packets
+        Time jitter{0};               //!< Interarrival jitter, as defined in RFC 3550
+        uint64_t rxFrames{0};         //!< Number of frames evaluated
+        uint64_t completeFrames{0};   //!< Number of frames received without losses
+
+        /**
+         * Get the ratio of lost packets
+         *
+         * \return The ratio of lost packets, between 0 and 1
+         */
+        double GetLossRatio() const;
+
+        /**
+         * Get the mean one-way delay
+         *
+         * \return The mean one-way delay of the packets received
+         */
+        Time GetMeanDelay() const;
+
+        /**
+         * Get the ratio of frames received without losses
+         *
+         * \return The ratio of complete frames, between 0 and 1
+         */
+        double GetFrameCompleteness() const;
+    };
+
+    /**
+     * Get the TypeId for this class
+     *
+     * \return The TypeId for this class
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * Default constructor
+     */
+    PscVideoStreamingReceiver();
+
+    /**
+     * Default destructor
+     */
+    ~PscVideoStreamingReceiver() override;
+
+    /**
+     * Get the statistics of the stream received from a sender
+     *
+     * \param sender The address (and port) of the sender
+     * \return The statistics of the stream, or empty statistics if nothing
+     *         has been received from the sender
+     */
+    Stats GetStats(const Address& sender) const;
+
+    /**
+     * Get the statistics aggregated for all the streams received. The jitter
+     * reported is the largest one among all the streams
+     *
+     * \return The aggregated statistics
+     */
+    Stats GetTotalStats() const;
+
+    /**
+     * Get the number of streams received
+     *
+     * \return The number of different senders heard so far
+     */
+    uint32_t GetStreamCount() const;
+
+    /**
+     * TracedCallback signature for frames evaluated.
+     *
+     * \param sender The address of the sender of the frame
+     * \param fragments The number of fragments of the frame received
+     * \param complete True if the frame was received without losses
+     * \param delay The time from the transmission of the frame to the
+     *              reception of its last fragment
+     */
+    typedef void (*RxFrameTracedCallback)(const Address& sender,
+                                          uint32_t fragments,
+                                          bool complete,
+                                          Time delay);
+
+    /**
+     * TracedCallback signature for periodic reports.
+     *
+     * \param sender The address of the sender of the stream
+     * \param stats The statistics of the stream
+     */
+    typedef void (*ReportTracedCallback)(const Address& sender, const Stats& stats);
+
+  protected:
+    /**
+     * Clean up the instance being removed
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * State kept for each stream received
+     */
+    struct Stream
+    {
+        Stats stats;                  //!< Statistics of the stream
+        uint32_t baseSeq{0};          //!< Lowest sequence number received
+        uint32_t maxSeq{0};           //!< Highest sequence number received
+        Time lastTransit{0};          //!< Transit time of the previous packet
+        bool frameOpen{false};        //!< True if a frame is being received
+        Time frameTs{0};              //!< Timestamp of the current frame
+        uint32_t frameFirstSeq{0};    //!< First sequence number of the current frame
+        uint32_t frameLastSeq{0};     //!< Last sequence number of the current frame
+        uint32_t frameFragments{0};   //!< Fragments of the current frame received
+        uint32_t frameMissing{0};     //!< Fragments missing inside the current frame
+        bool frameGapBefore{false};   //!< True if packets are missing before the frame
+        Time frameLastRx{0};          //!< Reception time of the last fragment
+        uint32_t prevFrameLastSeq{0}; //!< Last sequence number of the previous frame
+        bool prevFrame{false};        //!< True if a frame has been evaluated
+    };
+
+    /**
+     * Starts the application
+     */
+    void StartApplication() override;
+
+    /**
+     * Stops the application
+     */
+    void StopApplication() override;
+
+    /**
+     * Handles the packets received
+     *
+     * \param socket The socket with packets pending
+     */
+    void HandleRead(Ptr<Socket> socket);
+
+    /**
+     * Updates the statistics of a stream with a new packet
+     *
+     * \param sender The address of the sender
+     * \param packet The packet received
+     */
+    void Receive(const Address& sender, Ptr<const Packet> packet);
+
+    /**
+     * Evaluates the current frame of a stream
+     *
+     * \param sender The address of the sender
+     * \param stream The stream
+     * \param gapAfter True if packets are missing after the frame
+     */
+    void CloseFrame(const Address& sender, Stream& stream, bool gapAfter);
+
+    /**
+     * Reports the statistics of all the streams, and schedules the next report
+     */
+    void Report();
+
+    /**
+     * Port to listen to
+     */
+    uint16_t m_port;
+
+    /**
+     * Interval between reports. If zero, only a final report is generated
+     * when the application stops
+     */
+    Time m_reportInterval;
+
+    /**
+     * Socket to receive IPv4 packets
+     */
+    Ptr<Socket> m_socket;
+
+    /**
+     * Socket to receive IPv6 packets
+     */
+    Ptr<Socket> m_socket6;
+
+    /**
+     * Streams received, by sender address
+     */
+    std::map<Address, Stream> m_streams;
+
+    /**
+     * Event for the next report
+     */
+    EventId m_reportEvent;
+
+    /**
+     * Total number of packets lost in all the streams
+     */
+    TracedValue<uint64_t> m_lostPackets;
+
+    /**
+     * Total number of packets reordered in all the streams
+     */
+    TracedValue<uint64_t> m_reorderedPackets;
+
+    /**
+     * Total number of frames received without losses in all the streams
+     */
+    TracedValue<uint64_t> m_completeFrames;
+
+    /**
+     * Total number of frames received with losses in all the streams
+     */
+    TracedValue<uint64_t> m_incompleteFrames;
+
+    /**
+     * Trace for packets received
+     */
+    TracedCallback<Ptr<const Packet>, const Address&> m_rxTrace;
+
+    /**
+     * Trace for frames evaluated
+     */
+    TracedCallback<const Address&, uint32_t, bool, Time> m_rxFrameTrace;
+
+    /**
+     * Trace for periodic reports
+     */
+    TracedCallback<const Address&, const Stats&> m_reportTrace;
+}; // class PscVideoStreamingReceiver
+
+} // namespace psc
+} // namespace ns3
+
+#endif // PSC_VIDEO_STREAMING_RECEIVER_H
@@ -32,6 +32,8 @@
 
 #include "psc-video-streaming.h"
 
+#include "psc-cdf-random-variable.h"
+#include "psc-video-frame-trace.h"
 #include "psc-video-streaming-distributions.h"
 
 #include <ns3/boolean.h>
@@ -44,7 +46,7 @@
 #include <ns3/udp-socket-factory.h>
 #include <ns3/uinteger.h>
 
-#include <fstream>
+#include <algorithm>
 
 namespace ns3
 {
@@ -95,10 +97,40 @@ PscVideoStreaming::GetTypeId()
                           UintegerValue(1500),
                           MakeUintegerAccessor(&PscVideoStreaming::m_maxUdpPayloadSize),
                           MakeUintegerChecker<uint16_t>(12, 65500))
+            .AddAttribute("FragmentInterval",
+                          "Interval between the fragments of a frame. If zero, all the fragments "
+                          "of a frame are sent back to back",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&PscVideoStreaming::m_fragmentInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("FrameTrace",
+                          "Path to a binary frame trace to replay instead of generating frames "
+                          "from the data distribution. If empty, the data distribution is used",
+                          StringValue(""),
+                          MakeStringAccessor(&PscVideoStreaming::SetFrameTracePath,
+                                             &PscVideoStreaming::GetFrameTracePath),
+                          MakeStringChecker())
+            .AddAttribute("FrameTraceLoop",
+                          "If true, the frame trace is replayed again from the start once its "
+                          "end is reached",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&PscVideoStreaming::m_frameTraceLoop),
+                          MakeBooleanChecker())
+            .AddAttribute("FrameTraceRandomStart",
+                          "If true, the frame trace is replayed from a random frame instead of "
+                          "from the first one",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PscVideoStreaming::m_frameTraceRandomStart),
+                          MakeBooleanChecker())
             .AddTraceSource("Tx",
                             "Trace with packets transmitted",
                             MakeTraceSourceAccessor(&PscVideoStreaming::m_txTrace),
-                            "ns3::psc::PscVideoStreaming::TxTracedCallback");
+                            "ns3::psc::PscVideoStreaming::TxTracedCallback")
+            .AddTraceSource("TxFrame",
+                            "Trace with the number of fragments and bytes of each frame "
+                            "transmitted, invoked once all its fragments have been sent",
+                            MakeTraceSourceAccessor(&PscVideoStreaming::m_txFrameTrace),
+                            "ns3::psc::PscVideoStreaming::TxFrameTracedCallback");
 
     return tid;
 }
@@ -108,6 +140,19 @@ PscVideoStreaming::PscVideoStreaming()
     NS_LOG_FUNCTION(this);
 
     m_socket = nullptr;
+    m_frameBytesLeft = 0;
+    m_frameFragments = 0;
+    m_frameBytes = 0;
+    m_frameTraceIndex = 0;
+
+    m_sizeErv = CreateObjectWithAttributes<PscCdfRandomVariable>("Interpolate", BooleanValue(true));
+    m_intervalErv =
+        CreateObjectWithAttributes<PscCdfRandomVariable>("Interpolate", BooleanValue(true));
+    m_sizeErvBoost =
+        CreateObjectWithAttributes<PscCdfRandomVariable>("Interpolate", BooleanValue(true));
+    m_intervalErvBoost =
+        CreateObjectWithAttributes<PscCdfRandomVariable>("Interpolate", BooleanValue(true));
+    m_frameTraceStart = CreateObject<UniformRandomVariable>();
 }
 
 PscVideoStreaming::~PscVideoStreaming()
@@ -123,12 +168,33 @@ PscVideoStreaming::SetReceiver(Address recvAddress, uint16_t recvPort)
     m_receiverPort = recvPort;
 }
 
+int64_t
+PscVideoStreaming::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+
+    m_sizeErv->SetStream(stream);
+    m_intervalErv->SetStream(stream + 1);
+    m_sizeErvBoost->SetStream(stream + 2);
+    m_intervalErvBoost->SetStream(stream + 3);
+    m_frameTraceStart->SetStream(stream + 4);
+
+    return 5;
+}
+
 void
 PscVideoStreaming::DoDispose()
 {
     NS_LOG_FUNCTION(this);
 
     m_socket = nullptr;
+    m_distribution = nullptr;
+    m_sizeErv = nullptr;
+    m_intervalErv = nullptr;
+    m_sizeErvBoost = nullptr;
+    m_intervalErvBoost = nullptr;
+    m_frameTrace = nullptr;
+    m_frameTraceStart = nullptr;
     Application::DoDispose();
 }
 
@@ -138,48 +204,7 @@ PscVideoStreaming::ReadCustomDistribution(std::string sizeCdfFilePath,
 {
     NS_LOG_FUNCTION(this << sizeCdfFilePath << intervalCdfFilePath);
 
-    // Clear the distribution maps
-    m_sizeDistribution.clear();
-    m_intervalDistribution.clear();
-
-    double increment;
-    double currProb;
-    uint32_t readSize;
-    double readInterval;
-
-    // Read the file with the distribution for the size
-    std::ifstream finSize(sizeCdfFilePath.c_str());
-    NS_ABORT_MSG_IF(!finSize.is_open(), "Cannot open file " + sizeCdfFilePath);
-
-    finSize >> increment;
-    currProb = 0;
-    while (finSize.good() && finSize >> readSize)
-    {
-        if (currProb > 1)
-        {
-            currProb = 1;
-        }
-        m_sizeDistribution[currProb] = readSize;
-        currProb += increment;
-    }
-    m_sizeDistribution[1] = readSize;
-
-    // Read the file with the distribution for the interval
-    std::ifstream finInterval(intervalCdfFilePath.c_str());
-    NS_ABORT_MSG_IF(!finInterval.is_open(), "Cannot open file " + intervalCdfFilePath);
-
-    finInterval >> increment;
-    currProb = 0;
-    while (finInterval.good() && finInterval >> readInterval)
-    {
-        if (currProb > 1)
-        {
-            currProb = 1;
-        }
-        m_intervalDistribution[currProb] = readInterval;
-        currProb += increment;
-    }
-    m_intervalDistribution[1] = readInterval;
+    m_distribution = PscVideoStreamingDistributions::Load(sizeCdfFilePath, intervalCdfFilePath);
 }
 
 void
@@ -187,70 +212,15 @@ PscVideoStreaming::LoadCdfs()
 {
     NS_LOG_FUNCTION(this);
 
-    double boostPctSize = (1 - m_boostPercentile / 100);
-
-    m_sizeErv =
-        CreateObjectWithAttributes<EmpiricalRandomVariable>("Interpolate", BooleanValue(true));
-    m_intervalErv =
-        CreateObjectWithAttributes<EmpiricalRandomVariable>("Interpolate", BooleanValue(true));
-    m_sizeErvBoost =
-        CreateObjectWithAttributes<EmpiricalRandomVariable>("Interpolate", BooleanValue(true));
-    m_intervalErvBoost =
-        CreateObjectWithAttributes<EmpiricalRandomVariable>("Interpolate", BooleanValue(true));
-
-    // Size
-    double oldProb = 0;
-    uint32_t oldSize = 0;
-    bool boostCdfStarted = false;
-
-    for (auto it = m_sizeDistribution.begin(); it != m_sizeDistribution.end(); it++)
-    {
-        m_sizeErv->CDF(it->second, it->first);
-
-        // Check if we are in the probability range of the boost
-        if (it->first >= (m_boostPercentile / 100))
-        {
-            if (!boostCdfStarted)
-            {
-                auto interpolatedVal = static_cast<uint32_t>(
-                    oldSize + (((m_boostPercentile / 100) - oldProb) / (it->first - oldProb)) *
-                                  (it->second - oldSize));
-                m_sizeErvBoost->CDF(interpolatedVal, 0);
-                boostCdfStarted = true;
-            }
-            m_sizeErvBoost->CDF(it->second, (it->first - (m_boostPercentile / 100)) / boostPctSize);
-        }
-        oldProb = it->first;
-        oldSize = it->second;
-    }
-    m_sizeErv->CDF(oldSize, 1);
-    m_sizeErvBoost->CDF(oldSize, 1);
-
-    // Interval
-    double oldInterval = 0;
-    bool boostCdfFinished = false;
-
-    for (auto it = m_intervalDistribution.begin(); it != m_intervalDistribution.end(); it++)
-    {
-        m_intervalErv->CDF(it->second, it->first);
-
-        // Check if we are in the probability range of the boost
-        if (it->first < boostPctSize)
-        {
-            m_intervalErvBoost->CDF(it->second, it->first / boostPctSize);
-        }
-        else
-        {
-            if (!boostCdfFinished)
-            {
-                m_intervalErvBoost->CDF(it->second, 1);
-                boostCdfFinished = true;
-            }
-        }
-        oldInterval = it->second;
-    }
+    // The tables are shared by all the applications using the same
+    // distribution and boost percentile. The random variables (and the
+    // streams assigned to them) are kept across reloads
+    PscVideoStreamingDistribution::Tables tables = m_distribution->GetTables(m_boostPercentile);
 
-    m_intervalErv->CDF(oldInterval, 1);
+    m_sizeErv->SetTable(tables.size);
+    m_intervalErv->SetTable(tables.interval);
+    m_sizeErvBoost->SetTable(tables.sizeBoost);
+    m_intervalErvBoost->SetTable(tables.intervalBoost);
 }
 
 void
@@ -286,13 +256,26 @@ PscVideoStreaming::StartApplication()
 
     m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
 
-    Send();
+    if (m_frameTrace)
+    {
+        uint32_t frames = m_frameTrace->GetFrameCount();
+        NS_ABORT_MSG_IF(m_frameTraceLoop && m_frameTrace->GetInterval(frames - 1).IsZero(),
+                        "A frame trace must span some time to be replayed in a loop");
+        m_frameTraceIndex =
+            m_frameTraceRandomStart ? m_frameTraceStart->GetInteger(0, frames - 1) : 0;
+        SendTraceFrame();
+    }
+    else
+    {
+        Send();
+    }
 }
 
 void
 PscVideoStreaming::StopApplication()
 {
     NS_LOG_FUNCTION(this);
+    m_fragmentEvent.Cancel();
     m_socket->Close();
     m_socket = nullptr;
 }
@@ -304,43 +287,10 @@ PscVideoStreaming::Send()
 
     if (Simulator::Now() < m_stopTime && m_socket)
     {
-        uint32_t pending =
+        uint32_t frameSize =
             m_boostPacketsLeft > 0 ? m_sizeErvBoost->GetInteger() : m_sizeErv->GetInteger();
-        Ptr<Packet> p;
-
-        while (pending > 0)
-        {
-            SeqTsSizeHeader stsh;
-            if (pending <= stsh.GetSerializedSize())
-            {
-                p = Create<Packet>(0); // minimum packet size will be header size
-            }
-            else if (pending < m_maxUdpPayloadSize)
-            {
-                p = Create<Packet>(pending - stsh.GetSerializedSize());
-            }
-            else
-            {
-                p = Create<Packet>(m_maxUdpPayloadSize - stsh.GetSerializedSize());
-            }
 
-            stsh.SetSeq(++m_sequenceNumber);
-            stsh.SetSize(p->GetSize());
-            p->AddHeader(stsh);
-
-            m_socket->Send(p);
-            m_txTrace(p);
-            NS_LOG_DEBUG("Sending packet with size " << p->GetSize() << " Bytes");
-
-            if (pending > p->GetSize())
-            {
-                pending -= p->GetSize();
-            }
-            else
-            {
-                pending = 0;
-            }
-        }
+        SendFrame(frameSize);
 
         Time interval;
         if (m_boostPacketsLeft > 0)
@@ -360,6 +310,106 @@ PscVideoStreaming::Send()
     }
 }
 
+void
+PscVideoStreaming::SendTraceFrame()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (Simulator::Now() < m_stopTime && m_socket)
+    {
+        uint32_t index = m_frameTraceIndex;
+        SendFrame(m_frameTrace->GetFrame(index).size);
+        Time interval = m_frameTrace->GetInterval(index);
+
+        m_frameTraceIndex = index + 1;
+        if (m_frameTraceIndex == m_frameTrace->GetFrameCount())
+        {
+            if (!m_frameTraceLoop)
+            {
+                NS_LOG_INFO("End of the frame trace reached");
+                return;
+            }
+            m_frameTraceIndex = 0;
+        }
+
+        if (Simulator::Now() + interval < m_stopTime)
+        {
+            Simulator::Schedule(interval, &PscVideoStreaming::SendTraceFrame, this);
+        }
+    }
+}
+
+void
+PscVideoStreaming::SendFrame(uint32_t frameSize)
+{
+    NS_LOG_FUNCTION(this << frameSize);
+
+    NS_ABORT_MSG_UNLESS(m_socket, "The application must be started to send frames");
+
+    // If the fragments of the previous frame are still being paced, send the
+    // rest of them right away so that frames are not interleaved
+    if (m_fragmentEvent.IsPending())
+    {
+        m_fragmentEvent.Cancel();
+        SendFragments(true);
+    }
+
+    // All the fragments of the frame carry the timestamp of the frame start
+    m_frameHeader = SeqTsSizeHeader();
+    m_frameBytesLeft = frameSize;
+    m_frameFragments = 0;
+    m_frameBytes = 0;
+
+    SendFragments(m_fragmentInterval.IsZero());
+}
+
+void
+PscVideoStreaming::SendFragments(bool all)
+{
+    NS_LOG_FUNCTION(this << all);
+
+    const uint32_t headerSize = m_frameHeader.GetSerializedSize();
+
+    while (m_frameBytesLeft > 0)
+    {
+        // The minimum packet size is the header size
+        uint32_t payloadSize = 0;
+        if (m_frameBytesLeft > headerSize)
+        {
+            payloadSize = std::min<uint32_t>(m_frameBytesLeft, m_maxUdpPayloadSize) - headerSize;
+        }
+
+        Ptr<Packet> p = Create<Packet>(payloadSize);
+        m_frameHeader.SetSeq(++m_sequenceNumber);
+        m_frameHeader.SetSize(payloadSize);
+        p->AddHeader(m_frameHeader);
+
+        uint32_t fragmentSize = p->GetSize();
+        m_socket->Send(p);
+        m_txTrace(p);
+        NS_LOG_DEBUG("Sending packet with size " << fragmentSize << " Bytes");
+
+        m_frameFragments++;
+        m_frameBytes += fragmentSize;
+        m_frameBytesLeft -= std::min(m_frameBytesLeft, fragmentSize);
+
+        if (!all)
+        {
+            break;
+        }
+    }
+
+    if (m_frameBytesLeft > 0)
+    {
+        m_fragmentEvent =
+            Simulator::Schedule(m_fragmentInterval, &PscVideoStreaming::SendFragments, this, false);
+    }
+    else if (m_frameFragments > 0)
+    {
+        m_txFrameTrace(m_frameFragments, m_frameBytes);
+    }
+}
+
 void
 PscVideoStreaming::SetDistributionName(std::string distributionName)
 {
@@ -367,9 +417,7 @@ PscVideoStreaming::SetDistributionName(std::string distributionName)
 
     m_distributionName = distributionName;
 
-    m_sizeDistribution = PscVideoStreamingDistributions::GetSizeDistribution(m_distributionName);
-    m_intervalDistribution =
-        PscVideoStreamingDistributions::GetIntervalDistribution(m_distributionName);
+    m_distribution = PscVideoStreamingDistributions::Get(m_distributionName);
 }
 
 std::string
@@ -380,5 +428,22 @@ PscVideoStreaming::GetDistributionName() const
     return m_distributionName;
 }
 
+void
+PscVideoStreaming::SetFrameTracePath(std::string frameTracePath)
+{
+    NS_LOG_FUNCTION(this << frameTracePath);
+
+    m_frameTracePath = frameTracePath;
+    m_frameTrace = frameTracePath.empty() ? nullptr : PscVideoFrameTrace::Load(frameTracePath);
+}
+
+std::string
+PscVideoStreaming::GetFrameTracePath() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_frameTracePath;
+}
+
 } // namespace psc
 } // namespace ns3
@@ -34,13 +34,14 @@
 #define PSC_VIDEO_STREAMING_H
 
 #include <ns3/application.h>
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
 #include <ns3/ptr.h>
 #include <ns3/random-variable-stream.h>
+#include <ns3/seq-ts-size-header.h>
 #include <ns3/string.h>
 #include <ns3/traced-callback.h>
 
-#include <map>
-
 namespace ns3
 {
 
@@ -50,10 +51,18 @@ class Socket;
 namespace psc
 {
 
+class PscCdfRandomVariable;
+class PscVideoFrameTrace;
+class PscVideoStreamingDistribution;
+
 /**
  * \ingroup psc
  *
- * Class providing video streaming model based on CDF curves
+ * Class providing video streaming model based on CDF curves.
+ *
+ * Alternatively, the model can replay the frames of a PscVideoFrameTrace,
+ * set with the FrameTrace attribute, instead of generating them from the
+ * CDF curves.
  */
 class PscVideoStreaming : public Application
 {
@@ -87,7 +96,8 @@ class PscVideoStreaming : public Application
     /**
      * Reads a custom data distribution for size and interval from the files passed as parameters.
      * Note that these distributions will not be actually used by the application until the
-     * LoadCdfs () method is called.
+     * LoadCdfs () method is called. The files are only read the first time they are requested by
+     * any application, and the data is shared afterwards.
      *
      * \param sizeCdfFilePath Path to the file with the packet size CDF
      * \param intervalCdfFilePath Path to the file with the packet interval CDF
@@ -99,6 +109,40 @@ class PscVideoStreaming : public Application
      */
     void LoadCdfs();
 
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this application.
+     *
+     * \param stream The first stream index to use
+     * \return The number of stream indices assigned by this application
+     */
+    int64_t AssignStreams(int64_t stream) override;
+
+    /**
+     * Sends a video frame as a train of UDP packets of up to m_maxUdpPayloadSize
+     * bytes each. All the fragments carry the same SeqTsSizeHeader timestamp,
+     * with consecutive sequence numbers.
+     *
+     * If the FragmentInterval attribute is zero, all the fragments are sent
+     * immediately, otherwise they are paced with that interval. In the latter
+     * case, if the fragments of a previous frame are still pending when this
+     * method is called, they are sent immediately before the new frame.
+     *
+     * The Tx trace is invoked for each fragment, and the TxFrame trace once
+     * all the fragments of the frame have been sent.
+     *
+     * \param frameSize The size of the frame, in bytes
+     */
+    void SendFrame(uint32_t frameSize);
+
+    /**
+     * TracedCallback signature for frames transmitted.
+     *
+     * \param fragments The number of fragments (UDP packets) of the frame
+     * \param bytes The total number of bytes of the fragments, including headers
+     */
+    typedef void (*TxFrameTracedCallback)(uint32_t fragments, uint32_t bytes);
+
   protected:
     /**
      * Clean up the instance being removed
@@ -127,6 +171,20 @@ class PscVideoStreaming : public Application
      */
     void Send();
 
+    /**
+     * Sends the next frame of the frame trace, and schedules the following one
+     * at the time indicated by the trace
+     */
+    void SendTraceFrame();
+
+    /**
+     * Sends the next fragment of the current frame, or all of the remaining
+     * ones, and schedules the next fragment if any remains.
+     *
+     * \param all If true, all the remaining fragments are sent back to back
+     */
+    void SendFragments(bool all);
+
     /**
      * Setter for the distribution attribute. This will allow to swap custom and
      * default distributions easily
@@ -142,6 +200,22 @@ class PscVideoStreaming : public Application
      */
     std::string GetDistributionName() const;
 
+    /**
+     * Setter for the frame trace attribute. The trace is only mapped the first
+     * time it is requested by any application, and shared afterwards
+     *
+     * \param frameTracePath The path to the frame trace file, or an empty
+     *                       string to use the data distribution
+     */
+    void SetFrameTracePath(std::string frameTracePath);
+
+    /**
+     * Getter for the frame trace attribute.
+     *
+     * \return The path to the frame trace file
+     */
+    std::string GetFrameTracePath() const;
+
     /**
      * Video Streaming Model data distribution,
      * from psc-video-streaming-distributions
@@ -151,22 +225,22 @@ class PscVideoStreaming : public Application
     /**
      * CDF values of packet size
      */
-    Ptr<EmpiricalRandomVariable> m_sizeErv;
+    Ptr<PscCdfRandomVariable> m_sizeErv;
 
     /**
      * CDF values of packet interval
      */
-    Ptr<EmpiricalRandomVariable> m_intervalErv;
+    Ptr<PscCdfRandomVariable> m_intervalErv;
 
     /**
      * CDF values of packet size during boost
      */
-    Ptr<EmpiricalRandomVariable> m_sizeErvBoost;
+    Ptr<PscCdfRandomVariable> m_sizeErvBoost;
 
     /**
      * CDF values of packet interval during boost
      */
-    Ptr<EmpiricalRandomVariable> m_intervalErvBoost;
+    Ptr<PscCdfRandomVariable> m_intervalErvBoost;
 
     /**
      * Address of the destination node
@@ -220,24 +294,85 @@ class PscVideoStreaming : public Application
     uint16_t m_maxUdpPayloadSize;
 
     /**
-     * Map with the data distribution for the packet sizes
-     * These values have been loaded from the source (built-in distributions
-     * or custom files), but are not used until LoadDistributions () is called
+     * Data distribution for the packet sizes and intervals, shared with all
+     * the applications using the same built-in distribution or custom files.
+     * These values have been loaded from the source, but are not used until
+     * LoadCdfs () is called
+     */
+    Ptr<const PscVideoStreamingDistribution> m_distribution;
+
+    /**
+     * Interval between the fragments of a frame. If zero, the fragments are
+     * sent back to back
+     */
+    Time m_fragmentInterval;
+
+    /**
+     * Header of the current frame, holding the timestamp of all its fragments
+     */
+    SeqTsSizeHeader m_frameHeader;
+
+    /**
+     * Bytes of the current frame that have not been sent yet
+     */
+    uint32_t m_frameBytesLeft;
+
+    /**
+     * Number of fragments of the current frame sent so far
+     */
+    uint32_t m_frameFragments;
+
+    /**
+     * Bytes of the current frame sent so far, including headers
+     */
+    uint32_t m_frameBytes;
+
+    /**
+     * Event for sending the next fragment of the current frame
+     */
+    EventId m_fragmentEvent;
+
+    /**
+     * Path to the frame trace file
+     */
+    std::string m_frameTracePath;
+
+    /**
+     * Frame trace to replay, shared with all the applications using the same
+     * file. If null, the frames are generated from the data distribution
      */
-    std::map<double, uint32_t> m_sizeDistribution;
+    Ptr<const PscVideoFrameTrace> m_frameTrace;
 
     /**
-     * Map with the data distribution for the packet intervals (double type in ms)
-     * These values have been loaded from the source (built-in distributions
-     * or custom files), but are not used until LoadDistributions () is called
+     * Index of the next frame of the frame trace to send
      */
-    std::map<double, double> m_intervalDistribution;
+    uint32_t m_frameTraceIndex;
+
+    /**
+     * If true, the frame trace is replayed in a loop
+     */
+    bool m_frameTraceLoop;
+
+    /**
+     * If true, the frame trace is replayed from a random frame
+     */
+    bool m_frameTraceRandomStart;
+
+    /**
+     * Random variable to select the first frame of the frame trace
+     */
+    Ptr<UniformRandomVariable> m_frameTraceStart;
 
     /**
      * Trace for packets sent
      */
     TracedCallback<Ptr<const Packet>> m_txTrace;
 
+    /**
+     * Trace for frames sent
+     */
+    TracedCallback<uint32_t, uint32_t> m_txFrameTrace;
+
     /**
      * Callback format for packets sent
      */
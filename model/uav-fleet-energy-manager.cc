@@ -0,0 +1,280 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include "uav-fleet-energy-manager.h"
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/trace-source-accessor.h>
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("UavFleetEnergyManager");
+
+namespace psc
+{
+
+NS_OBJECT_ENSURE_REGISTERED(UavFleetEnergyManager);
+
+TypeId
+UavFleetEnergyManager::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::psc::UavFleetEnergyManager")
+            .SetParent<Object>()
+            .SetGroupName("Psc")
+            .AddConstructor<UavFleetEnergyManager>()
+            .AddAttribute("SyncInterval",
+                          "Interval between the updates of the energy sources of the fleet, "
+                          "which are charged the energy consumed up to each update",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&UavFleetEnergyManager::SetSyncInterval,
+                                           &UavFleetEnergyManager::GetSyncInterval),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddTraceSource(
+                "TotalEnergyConsumption",
+                "The total energy consumed by the fleet at the last sync point (in Joules)",
+                MakeTraceSourceAccessor(&UavFleetEnergyManager::m_totalEnergyConsumption),
+                "ns3::TracedValueCallback::Double");
+    return tid;
+}
+
+UavFleetEnergyManager::UavFleetEnergyManager()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+UavFleetEnergyManager::~UavFleetEnergyManager()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint32_t
+UavFleetEnergyManager::AppendModel(Ptr<UavMobilityEnergyModel> model,
+                                   Time lastUpdateTime,
+                                   double totalEnergy)
+{
+    NS_LOG_FUNCTION(this << model << lastUpdateTime << totalEnergy);
+    Ptr<energy::EnergySource> source = model->GetEnergySource();
+    NS_ABORT_MSG_UNLESS(source, "The model must have an energy source to join a fleet");
+
+    // Bring the source up to date with the current drawn so far, so from
+    // now on it only has to account for the charge drawn within the fleet
+    source->UpdateEnergySource();
+
+    int64_t now = Simulator::Now().GetTimeStep();
+    uint32_t index = m_models.size();
+    m_models.push_back(model);
+    m_modelSources.push_back(source);
+    m_state.push_back(model->GetState());
+    m_current.push_back(model->GetCurrentA());
+    m_lastUpdate.push_back(lastUpdateTime.GetTimeStep());
+    m_energy.push_back(totalEnergy);
+    m_voltage.push_back(source->GetSupplyVoltage());
+    m_charge.push_back(0);
+    m_lastCharge.push_back(now);
+    m_lastReport.push_back(now);
+
+    if (std::find(m_sources.begin(), m_sources.end(), source) == m_sources.end())
+    {
+        m_sources.push_back(source);
+    }
+    // The sync points start with the first model of the fleet
+    if (!m_syncEvent.IsPending())
+    {
+        m_syncEvent = Simulator::Schedule(m_syncInterval, &UavFleetEnergyManager::Sync, this);
+    }
+    return index;
+}
+
+uint32_t
+UavFleetEnergyManager::GetN() const
+{
+    return m_models.size();
+}
+
+Ptr<UavMobilityEnergyModel>
+UavFleetEnergyManager::Get(uint32_t index) const
+{
+    NS_ABORT_MSG_IF(index >= m_models.size(), "Invalid model index " << index);
+    return m_models[index];
+}
+
+void
+UavFleetEnergyManager::UpdateState(uint32_t index, UavMobilityEnergyModel::State state)
+{
+    NS_LOG_FUNCTION(this << index << state);
+    m_state[index] = state;
+}
+
+double
+UavFleetEnergyManager::UpdateCurrent(uint32_t index, double current)
+{
+    NS_LOG_FUNCTION(this << index << current);
+    int64_t now = Simulator::Now().GetTimeStep();
+
+    // Same arithmetic as UavMobilityEnergyModel::UpdateTotalEnergyConsumption (),
+    // so the totals do not depend on whether the model is part of a fleet
+    double deltaEnergy =
+        TimeStep(now - m_lastUpdate[index]).GetSeconds() * m_current[index] * m_voltage[index];
+    m_energy[index] += deltaEnergy;
+    m_lastUpdate[index] = now;
+
+    IntegrateCharge(index, now);
+    m_current[index] = current;
+    return m_energy[index];
+}
+
+double
+UavFleetEnergyManager::ReportSourceCurrent(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+    int64_t now = Simulator::Now().GetTimeStep();
+    if (now == m_lastReport[index])
+    {
+        // Nothing to charge, so report the current drawn from now on
+        return m_current[index];
+    }
+
+    // The source multiplies the current by the time since its previous
+    // update, so it is charged exactly the charge drawn up to now
+    IntegrateCharge(index, now);
+    double current = m_charge[index] / TimeStep(now - m_lastReport[index]).GetSeconds();
+    m_charge[index] = 0;
+    m_lastReport[index] = now;
+    return current;
+}
+
+UavMobilityEnergyModel::State
+UavFleetEnergyManager::GetState(uint32_t index) const
+{
+    return m_state[index];
+}
+
+double
+UavFleetEnergyManager::GetTotalEnergyConsumption(uint32_t index) const
+{
+    NS_LOG_FUNCTION(this << index);
+    int64_t now = Simulator::Now().GetTimeStep();
+    double deltaEnergy =
+        TimeStep(now - m_lastUpdate[index]).GetSeconds() * m_current[index] * m_voltage[index];
+    return m_energy[index] + deltaEnergy;
+}
+
+double
+UavFleetEnergyManager::GetTotalEnergyConsumption() const
+{
+    NS_LOG_FUNCTION(this);
+    const int64_t now = Simulator::Now().GetTimeStep();
+    const double stepsPerSecond = static_cast<double>(Seconds(1).GetTimeStep());
+    const std::size_t count = m_energy.size();
+    const int64_t* lastUpdate = m_lastUpdate.data();
+    const double* energy = m_energy.data();
+    const double* current = m_current.data();
+    const double* voltage = m_voltage.data();
+
+    // Plain loop over the arrays, so it can be vectorized
+    double total = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double elapsed = static_cast<double>(now - lastUpdate[i]) / stepsPerSecond;
+        total += energy[i] + elapsed * current[i] * voltage[i];
+    }
+    return total;
+}
+
+void
+UavFleetEnergyManager::Sync()
+{
+    NS_LOG_FUNCTION(this);
+    m_syncEvent.Cancel();
+    if (m_models.empty())
+    {
+        return;
+    }
+
+    // Each source queries its models, which report the charge drawn since
+    // the previous update of the source
+    for (auto& source : m_sources)
+    {
+        source->UpdateEnergySource();
+    }
+    for (std::size_t i = 0; i < m_models.size(); i++)
+    {
+        m_voltage[i] = m_modelSources[i]->GetSupplyVoltage();
+    }
+    m_totalEnergyConsumption = GetTotalEnergyConsumption();
+
+    m_syncEvent = Simulator::Schedule(m_syncInterval, &UavFleetEnergyManager::Sync, this);
+}
+
+void
+UavFleetEnergyManager::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_syncEvent.Cancel();
+    m_models.clear();
+    m_modelSources.clear();
+    m_sources.clear();
+    Object::DoDispose();
+}
+
+void
+UavFleetEnergyManager::IntegrateCharge(uint32_t index, int64_t now)
+{
+    m_charge[index] += TimeStep(now - m_lastCharge[index]).GetSeconds() * m_current[index];
+    m_lastCharge[index] = now;
+}
+
+void
+UavFleetEnergyManager::SetSyncInterval(Time interval)
+{
+    NS_LOG_FUNCTION(this << interval);
+    m_syncInterval = interval;
+    if (m_syncEvent.IsPending())
+    {
+        m_syncEvent.Cancel();
+        m_syncEvent = Simulator::Schedule(m_syncInterval, &UavFleetEnergyManager::Sync, this);
+    }
+}
+
+Time
+UavFleetEnergyManager::GetSyncInterval() const
+{
+    return m_syncInterval;
+}
+
+} // namespace psc
+} // namespace ns3
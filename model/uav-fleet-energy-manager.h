@@ -0,0 +1,224 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef UAV_FLEET_ENERGY_MANAGER_H
+#define UAV_FLEET_ENERGY_MANAGER_H
+
+#include <ns3/energy-source.h>
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
+#include <ns3/object.h>
+#include <ns3/traced-value.h>
+#include <ns3/uav-mobility-energy-model.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+namespace psc
+{
+
+/**
+ * \ingroup psc
+ * \brief Energy accounting for a fleet of UavMobilityEnergyModels
+ *
+ * By default, each UavMobilityEnergyModel integrates its energy consumption
+ * and updates its EnergySource every time its current changes, which, for
+ * large fleets with frequent course changes, is dominated by the updates of
+ * the energy sources (each one querying all its models and rescheduling its
+ * periodic update).
+ *
+ * The models added to a fleet energy manager keep their state, current,
+ * last update time, consumed energy and supply voltage in arrays of the
+ * manager instead. A course change then only integrates the energy of that
+ * UAV, with the same arithmetic as the standalone model, so the totals
+ * are identical. The energy sources are updated at the sync points, every
+ * SyncInterval, and whenever they update themselves (e.g., when their
+ * remaining energy is queried). On each update, a model reports to its
+ * source the mean current it has drawn since the previous one, so the
+ * source is charged exactly the energy consumed up to then.
+ *
+ * Also, the low and high energy thresholds of the sources are only
+ * checked when they are updated, instead of at every course change. The supply
+ * voltage of each source is sampled when the model is added and at the
+ * sync points, so the totals are only identical to those of the standalone
+ * models with a constant supply voltage (e.g., with a BasicEnergySource).
+ */
+class UavFleetEnergyManager : public Object
+{
+  public:
+    /**
+     * \brief Get the class TypeId
+     *
+     * \return the TypeId
+     */
+    static TypeId GetTypeId();
+
+    UavFleetEnergyManager();
+
+    ~UavFleetEnergyManager() override;
+
+    /**
+     * \brief Appends a model to the fleet
+     *
+     * Called by UavMobilityEnergyModel::SetFleetEnergyManager(), which is the
+     * method to use to add a model to the fleet. From now on, the energy
+     * consumption of the model is integrated by the manager.
+     *
+     * \param model The model to append, with an energy source
+     * \param lastUpdateTime The time of the last energy update of the model
+     * \param totalEnergy The energy consumed by the model up to lastUpdateTime
+     * \return The index of the model in the fleet
+     */
+    uint32_t AppendModel(Ptr<UavMobilityEnergyModel> model,
+                         Time lastUpdateTime,
+                         double totalEnergy);
+
+    /**
+     * \return The number of models in the fleet
+     */
+    uint32_t GetN() const;
+
+    /**
+     * \param index The index of a model in the fleet
+     * \return The model
+     */
+    Ptr<UavMobilityEnergyModel> Get(uint32_t index) const;
+
+    /**
+     * \brief Sets the state of a model
+     *
+     * \param index The index of the model in the fleet
+     * \param state The new state of the model
+     */
+    void UpdateState(uint32_t index, UavMobilityEnergyModel::State state);
+
+    /**
+     * \brief Sets the current of a model, integrating its energy consumption
+     * with the previous current up to now
+     *
+     * Called by the models in the fleet when their current changes.
+     *
+     * \param index The index of the model in the fleet
+     * \param current The new current, in amperes
+     * \return The total energy consumed by the model, in joules
+     */
+    double UpdateCurrent(uint32_t index, double current);
+
+    /**
+     * \brief Reports the current of a model to its energy source
+     *
+     * Called by the models in the fleet when their current is queried, which
+     * the energy source does when it updates itself. The charge drawn by the
+     * model since the previous report is flushed to the source, as the mean
+     * current over that time. Therefore, the current of a model in a fleet
+     * should only be queried by its source. If no time has elapsed since the
+     * previous report, the current of the model is returned.
+     *
+     * \param index The index of the model in the fleet
+     * \return The current, in amperes
+     */
+    double ReportSourceCurrent(uint32_t index);
+
+    /**
+     * \param index The index of a model in the fleet
+     * \return The state of the model
+     */
+    UavMobilityEnergyModel::State GetState(uint32_t index) const;
+
+    /**
+     * \param index The index of a model in the fleet
+     * \return The total energy consumed by the model up to now, in joules
+     */
+    double GetTotalEnergyConsumption(uint32_t index) const;
+
+    /**
+     * \return The total energy consumed by the fleet up to now, in joules
+     */
+    double GetTotalEnergyConsumption() const;
+
+    /**
+     * \brief Updates the energy sources of the fleet
+     *
+     * Also refreshes the supply voltages and the TotalEnergyConsumption trace.
+     * Called every SyncInterval from the time the first model is appended,
+     * which restarts from a call to this method, while the fleet has models.
+     */
+    void Sync();
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * \brief Integrates the charge drawn by a model up to now
+     *
+     * \param index The index of the model in the fleet
+     * \param now The current simulation time, in time steps
+     */
+    void IntegrateCharge(uint32_t index, int64_t now);
+
+    /**
+     * \brief Sets the interval between sync points, and reschedules the next
+     * one if it is pending
+     *
+     * \param interval The new interval
+     */
+    void SetSyncInterval(Time interval);
+
+    /**
+     * \return The interval between sync points
+     */
+    Time GetSyncInterval() const;
+
+    std::vector<Ptr<UavMobilityEnergyModel>> m_models;     //!< Models in the fleet
+    std::vector<Ptr<energy::EnergySource>> m_modelSources; //!< Energy source of each model
+    std::vector<UavMobilityEnergyModel::State> m_state;    //!< State of each model
+    std::vector<double> m_current;                         //!< Current of each model, in A
+    std::vector<int64_t> m_lastUpdate;                     //!< Last energy update, in steps
+    std::vector<double> m_energy;                          //!< Energy up to m_lastUpdate, in J
+    std::vector<double> m_voltage;                         //!< Supply voltage of each model, in V
+    std::vector<double> m_charge;                          //!< Charge owed to the source, in C
+    std::vector<int64_t> m_lastCharge;                     //!< End of m_charge, in steps
+    std::vector<int64_t> m_lastReport;                     //!< Last report to source, in steps
+    std::vector<Ptr<energy::EnergySource>> m_sources;      //!< Distinct sources of the fleet
+    Time m_syncInterval{Seconds(1)};                       //!< Interval between sync points
+    EventId m_syncEvent;                                   //!< Next sync point
+    TracedValue<double> m_totalEnergyConsumption{0};       //!< Fleet energy at last sync, in J
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif /* UAV_FLEET_ENERGY_MANAGER_H */
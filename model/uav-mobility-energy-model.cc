@@ -34,6 +34,11 @@
 
 #include "uav-mobility-energy-model.h"
 
+#include "uav-fleet-energy-manager.h"
+
+#include <ns3/boolean.h>
+#include <ns3/device-energy-model-container.h>
+#include <ns3/double.h>
 #include <ns3/energy-source.h>
 #include <ns3/log.h>
 #include <ns3/mobility-model.h>
@@ -42,6 +47,7 @@
 #include <ns3/trace-source-accessor.h>
 
 #include <cmath>
+#include <vector>
 
 namespace ns3
 {
@@ -51,6 +57,35 @@ NS_LOG_COMPONENT_DEFINE("UavMobilityEnergyModel");
 namespace psc
 {
 
+namespace
+{
+
+/**
+ * Gets the types of the device energy models. The energy sources only find
+ * their models by exact type, so all these types are needed to find them all.
+ * \returns The TypeIds of the subclasses of DeviceEnergyModel.
+ */
+const std::vector<TypeId>&
+GetDeviceEnergyModelTypeIds()
+{
+    static const std::vector<TypeId> tids = []() {
+        std::vector<TypeId> subclasses;
+        TypeId base = energy::DeviceEnergyModel::GetTypeId();
+        for (uint16_t i = 0; i < TypeId::GetRegisteredN(); i++)
+        {
+            TypeId tid = TypeId::GetRegistered(i);
+            if (tid != base && tid.IsChildOf(base))
+            {
+                subclasses.push_back(tid);
+            }
+        }
+        return subclasses;
+    }();
+    return tids;
+}
+
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(UavMobilityEnergyModel);
 
 TypeId
@@ -92,6 +127,15 @@ UavMobilityEnergyModel::GetTypeId()
                           MakeDoubleAccessor(&UavMobilityEnergyModel::SetHoverCurrent,
                                              &UavMobilityEnergyModel::GetHoverCurrent),
                           MakeDoubleChecker<double>())
+            .AddAttribute("ExactEnergyDepletion",
+                          "Schedule the update of the energy source at the exact time it "
+                          "crosses its low energy threshold with the present currents of its "
+                          "models, instead of relying on its periodic updates to detect it. "
+                          "Only supported for sources with a BasicEnergyLowBatteryThreshold "
+                          "attribute. Disabled by default",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&UavMobilityEnergyModel::m_exactEnergyDepletion),
+                          MakeBooleanChecker())
             .AddAttribute("EnergySource",
                           "The energy source this model draws from",
                           PointerValue(),
@@ -165,10 +209,33 @@ UavMobilityEnergyModel::GetEnergySource() const
     return m_source;
 }
 
+void
+UavMobilityEnergyModel::SetFleetEnergyManager(Ptr<UavFleetEnergyManager> fleet)
+{
+    NS_LOG_FUNCTION(this << fleet);
+    NS_ABORT_MSG_UNLESS(fleet, "Cannot join a NULL fleet");
+    NS_ABORT_MSG_IF(m_fleet, "The model is already part of a fleet");
+    NS_ABORT_MSG_UNLESS(m_source, "The energy source must be set before joining a fleet");
+
+    m_fleetIndex = fleet->AppendModel(this, m_lastUpdateTime, m_totalEnergyConsumption);
+    m_fleet = fleet;
+}
+
+Ptr<UavFleetEnergyManager>
+UavMobilityEnergyModel::GetFleetEnergyManager() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_fleet;
+}
+
 double
 UavMobilityEnergyModel::GetTotalEnergyConsumption() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_fleet)
+    {
+        return m_fleet->GetTotalEnergyConsumption(m_fleetIndex);
+    }
     Time deltaUpdate = Simulator::Now() - m_lastUpdateTime;
 
     double deltaEnergy = deltaUpdate.GetSeconds() * m_current * m_source->GetSupplyVoltage();
@@ -254,6 +321,8 @@ UavMobilityEnergyModel::HandleEnergyDepletion()
     NS_LOG_FUNCTION(this);
     NS_LOG_DEBUG("UavMobilityEnergyModel: Energy depleted");
 
+    m_depleted = true;
+    m_energyDepletionEvent.Cancel();
     m_energyDepletionTrace(this);
 }
 
@@ -263,7 +332,9 @@ UavMobilityEnergyModel::HandleEnergyRecharged()
     NS_LOG_FUNCTION(this);
     NS_LOG_DEBUG("UavMobilityEnergyModel: Energy recharged");
 
+    m_depleted = false;
     m_energyRechargedTrace(this);
+    ScheduleEnergyDepletion();
 }
 
 double
@@ -371,14 +442,21 @@ double
 UavMobilityEnergyModel::DoGetCurrentA() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_fleet)
+    {
+        // Flushes the charge drawn since the previous update of the source
+        return m_fleet->ReportSourceCurrent(m_fleetIndex);
+    }
     return m_current;
 }
 
 void
 UavMobilityEnergyModel::DoDispose()
 {
+    m_energyDepletionEvent.Cancel();
     m_mobility = nullptr;
     m_source = nullptr;
+    m_fleet = nullptr;
     // Implementations of DoDispose () are expected to chain
     // to their parrent, even though DeviceEnergyModel::DoDispose
     // is currently unimplemented
@@ -395,11 +473,36 @@ UavMobilityEnergyModel::UpdateCurrent(double current)
     // calling the handlers again
     if (m_current != current)
     {
-        UpdateTotalEnergyConsumption();
-        m_source->UpdateEnergySource();
+        double thresholdEnergy = 0;
+        double remainingEnergy = 0;
+        const bool scheduleDepletion = GetDepletionThreshold(thresholdEnergy);
+        if (m_fleet)
+        {
+            // The source is updated at the sync points of the fleet
+            m_totalEnergyConsumption = m_fleet->UpdateCurrent(m_fleetIndex, current);
+        }
+        else
+        {
+            UpdateTotalEnergyConsumption();
+            if (scheduleDepletion)
+            {
+                // Also brings the source up to date, so its remaining
+                // energy is reused to schedule the depletion
+                remainingEnergy = m_source->GetRemainingEnergy();
+            }
+            else
+            {
+                m_source->UpdateEnergySource();
+            }
+        }
         double oldCurrent = m_current;
         m_current = current;
         m_currentChangedTrace(oldCurrent, current, m_mobility->GetVelocity());
+        m_energyDepletionEvent.Cancel();
+        if (scheduleDepletion)
+        {
+            ScheduleEnergyDepletionFrom(remainingEnergy, thresholdEnergy);
+        }
     }
 }
 
@@ -450,6 +553,10 @@ UavMobilityEnergyModel::UpdateState(UavMobilityEnergyModel::State newState)
     NS_LOG_FUNCTION(this << newState);
     UavMobilityEnergyModel::State oldState = m_state;
     m_state = newState;
+    if (m_fleet)
+    {
+        m_fleet->UpdateState(m_fleetIndex, newState);
+    }
 
     // Only notify if the state is different
     if (oldState != newState)
@@ -502,5 +609,82 @@ UavMobilityEnergyModel::UpdateTotalEnergyConsumption()
     m_lastUpdateTime = Simulator::Now();
 }
 
+bool
+UavMobilityEnergyModel::GetDepletionThreshold(double& thresholdEnergy) const
+{
+    // In a fleet, the source is only updated at the sync points of the fleet
+    if (!m_exactEnergyDepletion || m_fleet || !m_source)
+    {
+        return false;
+    }
+
+    // Other sources do not deplete linearly, so rely on their own updates
+    DoubleValue lowBatteryThreshold;
+    if (!m_source->GetAttributeFailSafe("BasicEnergyLowBatteryThreshold", lowBatteryThreshold))
+    {
+        return false;
+    }
+    thresholdEnergy = lowBatteryThreshold.Get() * m_source->GetInitialEnergy();
+    return true;
+}
+
+double
+UavMobilityEnergyModel::GetSourceCurrent() const
+{
+    double current = 0;
+    for (const auto& tid : GetDeviceEnergyModelTypeIds())
+    {
+        energy::DeviceEnergyModelContainer models = m_source->FindDeviceEnergyModels(tid);
+        for (auto it = models.Begin(); it != models.End(); it++)
+        {
+            current += (*it)->GetCurrentA();
+        }
+    }
+    return current;
+}
+
+void
+UavMobilityEnergyModel::ScheduleEnergyDepletion()
+{
+    NS_LOG_FUNCTION(this);
+    m_energyDepletionEvent.Cancel();
+    double thresholdEnergy = 0;
+    if (GetDepletionThreshold(thresholdEnergy))
+    {
+        // Also brings the source up to date, which may detect the depletion
+        ScheduleEnergyDepletionFrom(m_source->GetRemainingEnergy(), thresholdEnergy);
+    }
+}
+
+void
+UavMobilityEnergyModel::ScheduleEnergyDepletionFrom(double remainingEnergy, double thresholdEnergy)
+{
+    NS_LOG_FUNCTION(this << remainingEnergy << thresholdEnergy);
+    if (m_depleted || remainingEnergy <= thresholdEnergy)
+    {
+        return;
+    }
+
+    // The currents of the models of the source are expected to be constant
+    // until the next call, or until the source is updated by the model whose
+    // current changes (and the depletion is checked again when the event
+    // expires), so the remaining energy decreases linearly until then
+    double power = GetSourceCurrent() * m_source->GetSupplyVoltage();
+    if (power <= 0)
+    {
+        return;
+    }
+    double seconds = (remainingEnergy - thresholdEnergy) / power;
+    Time delay = Seconds(seconds);
+    // Round up, so the threshold has been crossed when the event expires
+    if (delay.GetSeconds() < seconds)
+    {
+        delay += TimeStep(1);
+    }
+    NS_LOG_DEBUG("Energy source expected to deplete in " << delay.As(Time::S));
+    m_energyDepletionEvent =
+        Simulator::Schedule(delay, &UavMobilityEnergyModel::ScheduleEnergyDepletion, this);
+}
+
 } // namespace psc
 } // namespace ns3
@@ -35,6 +35,7 @@
 #ifndef UAV_MOBILITY_ENERGY_MODEL_H
 #define UAV_MOBILITY_ENERGY_MODEL_H
 
+#include <ns3/event-id.h>
 #include <ns3/mobility-model.h>
 #include <ns3/nstime.h>
 #include <ns3/simple-device-energy-model.h>
@@ -46,6 +47,8 @@ namespace ns3
 namespace psc
 {
 
+class UavFleetEnergyManager;
+
 /**
  * \ingroup psc
  * \brief NIST Model of UAV energy consumption from movement
@@ -139,6 +142,25 @@ class UavMobilityEnergyModel : public energy::DeviceEnergyModel
      */
     Ptr<energy::EnergySource> GetEnergySource() const;
 
+    /**
+     * \brief Moves the energy accounting of this model to a fleet energy manager
+     *
+     * The energy source must have been set. From now on, the energy consumption
+     * is integrated by the manager, and the energy source is only updated at
+     * the sync points of the manager (or when it updates itself).
+     * A model can not leave a fleet, or join another one.
+     *
+     * \param fleet The fleet energy manager
+     */
+    void SetFleetEnergyManager(Ptr<UavFleetEnergyManager> fleet);
+
+    /**
+     * \brief Get the fleet energy manager of this model
+     *
+     * \return The fleet energy manager, or nullptr if the model is standalone
+     */
+    Ptr<UavFleetEnergyManager> GetFleetEnergyManager() const;
+
     /**
      * \brief Calculates the total energy consumed by this model over its lifetime
      *
@@ -302,6 +324,8 @@ class UavMobilityEnergyModel : public energy::DeviceEnergyModel
     Ptr<energy::EnergySource> m_source;              //!< Ptr to the energy source
     State m_state{State::STOP};                      //!< The state of the model
     double m_current{0};                             //!< The current in amperes
+    Ptr<UavFleetEnergyManager> m_fleet;              //!< Fleet energy manager, if any
+    uint32_t m_fleetIndex{0};                        //!< Index of the model in m_fleet
     TracedValue<double> m_totalEnergyConsumption{0}; //!< Trace of energy consumption
     double m_ascendEnergyConversionFactor;  //!< variable implementing AscendEnergyConversionFactor
                                             //!< attribute
@@ -310,6 +334,10 @@ class UavMobilityEnergyModel : public energy::DeviceEnergyModel
     double m_moveEnergyConversionFactor;    //!< variable implementing MoveEnergyConversionFactor
                                             //!< attribute
     double m_hoverEnergyCurrent;            //!< variable implementing HoverCurrent attribute
+    bool m_exactEnergyDepletion;            //!< variable implementing ExactEnergyDepletion
+                                            //!< attribute
+    bool m_depleted{false};                 //!< the energy source has reported its depletion
+    EventId m_energyDepletionEvent;         //!< expected depletion of the energy source
 
     TracedCallback<State, State, Vector>
         m_stateChangedTrace; //!< Variable storing state change callback
@@ -322,6 +350,11 @@ class UavMobilityEnergyModel : public energy::DeviceEnergyModel
 
     /**
      * Gets the current draw of this model in amperes
+     *
+     * For a model in a fleet, this is the mean current drawn since the
+     * previous update of the energy source, see
+     * UavFleetEnergyManager::ReportSourceCurrent().
+     *
      * \return the current draw in amperes
      */
     double DoGetCurrentA() const override;
@@ -384,6 +417,45 @@ class UavMobilityEnergyModel : public energy::DeviceEnergyModel
      * Refreshes the total energy consumed by this model
      */
     void UpdateTotalEnergyConsumption();
+
+    /**
+     * \brief Gets the energy at which the energy source is depleted, if its
+     * depletion is to be scheduled
+     *
+     * Only supported for sources with a BasicEnergyLowBatteryThreshold
+     * attribute (i.e., that deplete linearly), and for models that are not
+     * in a fleet.
+     *
+     * \param thresholdEnergy The energy at which the source is depleted, in joules
+     * \return True if the depletion of the source is to be scheduled
+     */
+    bool GetDepletionThreshold(double& thresholdEnergy) const;
+
+    /**
+     * \brief Gets the current drawn from the energy source by all its models
+     *
+     * \return The current, in amperes
+     */
+    double GetSourceCurrent() const;
+
+    /**
+     * \brief Schedules the update of the energy source at the time it
+     * crosses its low energy threshold with the present currents
+     *
+     * Brings the energy source up to date, so when the event expires the
+     * source detects its depletion and notifies its models.
+     */
+    void ScheduleEnergyDepletion();
+
+    /**
+     * \brief Schedules the update of the energy source at the time it
+     * crosses its low energy threshold with the present currents, from an
+     * up to date remaining energy
+     *
+     * \param remainingEnergy The remaining energy of the source, in joules
+     * \param thresholdEnergy The energy at which the source is depleted, in joules
+     */
+    void ScheduleEnergyDepletionFrom(double remainingEnergy, double thresholdEnergy);
 };
 
 } // namespace psc
@@ -75,6 +75,33 @@ ModeToString(UdpGroupEchoServer::Mode_t mode)
     }
 }
 
+bool
+UdpGroupEchoClientKey::operator==(const UdpGroupEchoClientKey& other) const
+{
+    return m_port == other.m_port && m_ipv6 == other.m_ipv6 && m_ip == other.m_ip;
+}
+
+std::size_t
+UdpGroupEchoClientKeyHash::operator()(const UdpGroupEchoClientKey& key) const
+{
+    // FNV-1a over the address bytes and the port
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto byte : key.m_ip)
+    {
+        hash = (hash ^ byte) * 1099511628211ULL;
+    }
+    hash = (hash ^ (key.m_port & 0xff)) * 1099511628211ULL;
+    hash = (hash ^ (key.m_port >> 8)) * 1099511628211ULL;
+    hash = (hash ^ key.m_ipv6) * 1099511628211ULL;
+    return static_cast<std::size_t>(hash);
+}
+
+bool
+UdpGroupEchoServer::Expiration::operator>(const Expiration& other) const
+{
+    return m_time > other.m_time;
+}
+
 TypeId
 UdpGroupEchoServer::GetTypeId()
 {
@@ -107,6 +134,24 @@ UdpGroupEchoServer::GetTypeId()
                                           TimeValue(Seconds(0)),
                                           MakeTimeAccessor(&UdpGroupEchoServer::m_timeout),
                                           MakeTimeChecker())
+                            .AddAttribute("Groups",
+                                          "Number of independent groups served, each one on its "
+                                          "own port, from Port to Port + Groups - 1.",
+                                          UintegerValue(1),
+                                          MakeUintegerAccessor(&UdpGroupEchoServer::m_groupCount),
+                                          MakeUintegerChecker<uint32_t>(1))
+                            .AddAttribute("MulticastBase",
+                                          "Multicast address of the first group. If set, the "
+                                          "echoes to the IPv4 clients of each group are sent as a "
+                                          "single datagram to this address plus the index of the "
+                                          "group, on the EchoPort, which must then be set, and "
+                                          "EchoClient must be true. All the group addresses must "
+                                          "be multicast addresses. The any address disables "
+                                          "multicast.",
+                                          Ipv4AddressValue(Ipv4Address::GetAny()),
+                                          MakeIpv4AddressAccessor(
+                                              &UdpGroupEchoServer::m_multicastBase),
+                                          MakeIpv4AddressChecker())
                             .AddAttribute("EchoClient",
                                           "Server echoes back to the sending client",
 
@@ -128,104 +173,264 @@ UdpGroupEchoServer::UdpGroupEchoServer()
 UdpGroupEchoServer::~UdpGroupEchoServer()
 {
     NS_LOG_FUNCTION(this);
-    m_socket = nullptr;
-    m_socket6 = nullptr;
 }
 
 void
 UdpGroupEchoServer::AddClient(const Address& address)
 {
-    UdpGroupEchoClient src_client;
-    std::ostringstream os;
-    std::string ipaddrskey;
+    AddClient(address, 0);
+}
 
-    src_client.m_address = address;
-    src_client.m_timestamp = Simulator::Now();
+void
+UdpGroupEchoServer::AddClient(const Address& address, uint32_t groupId)
+{
+    UdpGroupEchoClientKey key;
+    Address echoAddress;
 
+    NS_ABORT_MSG_IF(groupId >= m_groupCount, "Invalid group " << groupId);
+    NS_ABORT_MSG_IF(!MakeClientKey(address, key), "Invalid address type");
     if (InetSocketAddress::IsMatchingType(address))
     {
-        InetSocketAddress clientAddress = InetSocketAddress::ConvertFrom(address);
+        echoAddress =
+            InetSocketAddress(InetSocketAddress::ConvertFrom(address).GetIpv4(), m_port_client);
+    }
+    else
+    {
+        echoAddress =
+            Inet6SocketAddress(Inet6SocketAddress::ConvertFrom(address).GetIpv6(), m_port_client);
+    }
+    CreateGroups();
+    UpdateClient(m_groups[groupId], key, address, echoAddress);
+
+    LogClients(groupId);
+}
 
-        os << clientAddress.GetIpv4() << ":" << clientAddress.GetPort();
-        ipaddrskey = os.str();
+uint32_t
+UdpGroupEchoServer::GetGroupCount() const
+{
+    return m_groupCount;
+}
 
-        src_client.m_echo_address = InetSocketAddress(clientAddress.GetIpv4(), m_port_client);
+uint32_t
+UdpGroupEchoServer::GetGroupSize(uint32_t groupId) const
+{
+    return groupId < m_groups.size() ? m_groups[groupId].m_clients.size() : 0;
+}
+
+void
+UdpGroupEchoServer::CreateGroups()
+{
+    if (m_groups.size() < m_groupCount)
+    {
+        m_groups.resize(m_groupCount);
+    }
+}
+
+bool
+UdpGroupEchoServer::MakeClientKey(const Address& address, UdpGroupEchoClientKey& key)
+{
+    key = UdpGroupEchoClientKey();
+    if (InetSocketAddress::IsMatchingType(address))
+    {
+        InetSocketAddress clientAddress = InetSocketAddress::ConvertFrom(address);
+        clientAddress.GetIpv4().Serialize(key.m_ip.data());
+        key.m_port = clientAddress.GetPort();
+        key.m_ipv6 = false;
+        return true;
     }
     else if (Inet6SocketAddress::IsMatchingType(address))
     {
         Inet6SocketAddress clientAddress = Inet6SocketAddress::ConvertFrom(address);
+        clientAddress.GetIpv6().GetBytes(key.m_ip.data());
+        key.m_port = clientAddress.GetPort();
+        key.m_ipv6 = true;
+        return true;
+    }
+    return false;
+}
 
-        os << clientAddress.GetIpv6() << ":" << clientAddress.GetPort();
-        ipaddrskey = os.str();
+std::size_t
+UdpGroupEchoServer::UpdateClient(Group& group,
+                                 const UdpGroupEchoClientKey& key,
+                                 const Address& address,
+                                 const Address& echoAddress)
+{
+    auto it = group.m_clientIndex.find(key);
+    if (it != group.m_clientIndex.end())
+    {
+        // Client is a group member. Update timestamp. Its entry in the heap
+        // is pushed back with the new expiration time when it is due
+        UdpGroupEchoClient& client = group.m_clients[it->second];
+        NS_LOG_DEBUG("Client found; old timestamp: " << client.m_timestamp.GetSeconds());
+        client.m_timestamp = Simulator::Now();
+        NS_LOG_DEBUG("New timestamp: " << client.m_timestamp.GetSeconds());
+        return it->second;
+    }
 
-        src_client.m_echo_address = Inet6SocketAddress(clientAddress.GetIpv6(), m_port_client);
+    UdpGroupEchoClient client;
+    client.m_key = key;
+    client.m_address = address;
+    client.m_echo_address = echoAddress;
+    client.m_timestamp = Simulator::Now();
+    group.m_clients.push_back(client);
+    group.m_clientIndex.emplace(key, group.m_clients.size() - 1);
+    if (m_mode == TIMEOUT_LIMITED)
+    {
+        group.m_expirations.push({client.m_timestamp + m_timeout, key});
     }
-    else
+    return group.m_clients.size() - 1;
+}
+
+void
+UdpGroupEchoServer::RemoveClient(Group& group, std::size_t index)
+{
+    group.m_clientIndex.erase(group.m_clients[index].m_key);
+    if (index != group.m_clients.size() - 1)
     {
-        NS_ABORT_MSG("Invalid address type");
+        group.m_clients[index] = group.m_clients.back();
+        group.m_clientIndex[group.m_clients[index].m_key] = index;
     }
-    m_clients[ipaddrskey] = src_client;
+    group.m_clients.pop_back();
+}
 
-    LogClients();
+void
+UdpGroupEchoServer::ExpireClients(Group& group)
+{
+    Time now = Simulator::Now();
+    while (!group.m_expirations.empty() && group.m_expirations.top().m_time <= now)
+    {
+        Expiration expiration = group.m_expirations.top();
+        group.m_expirations.pop();
+
+        auto it = group.m_clientIndex.find(expiration.m_key);
+        if (it == group.m_clientIndex.end())
+        {
+            continue;
+        }
+        Time expirationTime = group.m_clients[it->second].m_timestamp + m_timeout;
+        if (expirationTime <= now)
+        {
+            NS_LOG_DEBUG("Session of client " << it->second << " expired");
+            RemoveClient(group, it->second);
+        }
+        else
+        {
+            // The client was heard from after the entry was pushed
+            expiration.m_time = expirationTime;
+            group.m_expirations.push(expiration);
+        }
+    }
+}
+
+void
+UdpGroupEchoServer::EchoToClient(Group& group, Ptr<Packet> packet, const UdpGroupEchoClient& client)
+{
+    // Set destination address with the agreed client port.
+    const Address& addrs_dest = m_port_client ? client.m_echo_address : client.m_address;
+
+    // Forward packet
+    NS_LOG_LOGIC("Echoing packet");
+    if (InetSocketAddress::IsMatchingType(addrs_dest))
+    {
+        group.m_socket->SendTo(packet, 0, addrs_dest);
+        NS_LOG_INFO("Server sent " << packet->GetSize() << " bytes to "
+                                   << InetSocketAddress::ConvertFrom(addrs_dest).GetIpv4()
+                                   << " port "
+                                   << InetSocketAddress::ConvertFrom(addrs_dest).GetPort());
+    }
+    else if (Inet6SocketAddress::IsMatchingType(addrs_dest))
+    {
+        group.m_socket6->SendTo(packet, 0, addrs_dest);
+        NS_LOG_INFO("Server sent " << packet->GetSize() << " bytes to "
+                                   << Inet6SocketAddress::ConvertFrom(addrs_dest).GetIpv6()
+                                   << " port "
+                                   << Inet6SocketAddress::ConvertFrom(addrs_dest).GetPort());
+    }
 }
 
 void
 UdpGroupEchoServer::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_groups.clear();
+    m_socketGroups.clear();
     Application::DoDispose();
 }
 
+Ptr<Socket>
+UdpGroupEchoServer::CreateSocket(const Address& local, const Address& multicastGroup)
+{
+    TypeId tid = TypeId::LookupByName("ns3::UdpSocketFactory");
+    Ptr<Socket> socket = Socket::CreateSocket(GetNode(), tid);
+    socket->Bind(local);
+    if (addressUtils::IsMulticast(multicastGroup))
+    {
+        Ptr<UdpSocket> udpSocket = DynamicCast<UdpSocket>(socket);
+        if (udpSocket)
+        {
+            // equivalent to setsockopt (MCAST_JOIN_GROUP)
+            udpSocket->MulticastJoinGroup(0, multicastGroup);
+        }
+        else
+        {
+            NS_FATAL_ERROR("Error: Failed to join multicast group");
+        }
+    }
+    socket->SetRecvCallback(MakeCallback(&UdpGroupEchoServer::HandleRead, this));
+    return socket;
+}
+
 void
 UdpGroupEchoServer::StartApplication()
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_INFO("Starting UdpGroupEchoServer with mode " << ModeToString(m_mode) << " session time "
-                                                         << m_timeout.GetSeconds());
-    if (!m_socket)
+                                                         << m_timeout.GetSeconds() << " groups "
+                                                         << m_groupCount);
+    NS_ABORT_MSG_IF(m_port + m_groupCount - 1 > UINT16_MAX,
+                    "The ports of the groups exceed the maximum port number");
+    // The clients listen for the multicast echoes on a port of their own,
+    // while the ports of the groups are those of the server
+    if (!m_multicastBase.IsAny())
     {
-        TypeId tid = TypeId::LookupByName("ns3::UdpSocketFactory");
-        m_socket = Socket::CreateSocket(GetNode(), tid);
-        InetSocketAddress local = InetSocketAddress(Ipv4Address::GetAny(), m_port);
-        m_socket->Bind(local);
-        if (addressUtils::IsMulticast(m_local))
-        {
-            Ptr<UdpSocket> udpSocket = DynamicCast<UdpSocket>(m_socket);
-            if (udpSocket)
-            {
-                // equivalent to setsockopt (MCAST_JOIN_GROUP)
-                udpSocket->MulticastJoinGroup(0, m_local);
-            }
-            else
-            {
-                NS_FATAL_ERROR("Error: Failed to join multicast group");
-            }
-        }
+        // All the group addresses must be in the multicast range, which
+        // ends at 239.255.255.255
+        NS_ABORT_MSG_IF(!m_multicastBase.IsMulticast() ||
+                            uint64_t(m_multicastBase.Get()) + m_groupCount - 1 > 0xEFFFFFFF,
+                        "The multicast addresses of the groups exceed the multicast range");
+        NS_ABORT_MSG_IF(m_port_client == 0,
+                        "The EchoPort must be set to send the echoes to a multicast group");
+        // The sender listens on the group address too, so the multicast
+        // datagram cannot skip it
+        NS_ABORT_MSG_IF(!m_echoClient,
+                        "The echo to the sender cannot be disabled with multicast echoes");
     }
 
-    if (!m_socket6)
+    CreateGroups();
+    for (uint32_t groupId = 0; groupId < m_groupCount; groupId++)
     {
-        TypeId tid = TypeId::LookupByName("ns3::UdpSocketFactory");
-        m_socket6 = Socket::CreateSocket(GetNode(), tid);
-        Inet6SocketAddress local6 = Inet6SocketAddress(Ipv6Address::GetAny(), m_port);
-        m_socket6->Bind(local6);
-        if (addressUtils::IsMulticast(local6))
+        Group& group = m_groups[groupId];
+        uint16_t port = m_port + groupId;
+        if (!group.m_socket)
         {
-            Ptr<UdpSocket> udpSocket = DynamicCast<UdpSocket>(m_socket6);
-            if (udpSocket)
-            {
-                // equivalent to setsockopt (MCAST_JOIN_GROUP)
-                udpSocket->MulticastJoinGroup(0, local6);
-            }
-            else
-            {
-                NS_FATAL_ERROR("Error: Failed to join multicast group");
-            }
+            group.m_socket = CreateSocket(InetSocketAddress(Ipv4Address::GetAny(), port), m_local);
+            m_socketGroups[group.m_socket] = groupId;
+        }
+        else
+        {
+            group.m_socket->SetRecvCallback(MakeCallback(&UdpGroupEchoServer::HandleRead, this));
+        }
+        if (!group.m_socket6)
+        {
+            Inet6SocketAddress local6 = Inet6SocketAddress(Ipv6Address::GetAny(), port);
+            group.m_socket6 = CreateSocket(local6, local6);
+            m_socketGroups[group.m_socket6] = groupId;
+        }
+        else
+        {
+            group.m_socket6->SetRecvCallback(MakeCallback(&UdpGroupEchoServer::HandleRead, this));
         }
     }
-
-    m_socket->SetRecvCallback(MakeCallback(&UdpGroupEchoServer::HandleRead, this));
-    m_socket6->SetRecvCallback(MakeCallback(&UdpGroupEchoServer::HandleRead, this));
 }
 
 void
@@ -233,15 +438,18 @@ UdpGroupEchoServer::StopApplication()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_socket)
+    for (auto& group : m_groups)
     {
-        m_socket->Close();
-        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
-    }
-    if (m_socket6)
-    {
-        m_socket6->Close();
-        m_socket6->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        if (group.m_socket)
+        {
+            group.m_socket->Close();
+            group.m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        }
+        if (group.m_socket6)
+        {
+            group.m_socket6->Close();
+            group.m_socket6->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        }
     }
 }
 
@@ -250,15 +458,15 @@ UdpGroupEchoServer::HandleRead(Ptr<Socket> socket)
 {
     NS_LOG_FUNCTION(this << socket);
 
+    auto socketGroup = m_socketGroups.find(socket);
+    NS_ABORT_MSG_IF(socketGroup == m_socketGroups.end(), "Packet received on an unknown socket");
+    const uint32_t groupId = socketGroup->second;
+    Group& group = m_groups[groupId];
+
     Ptr<Packet> packet;
     Address from;
     Address echo_address;
-    std::map<std::string, UdpGroupEchoClient>::iterator it;
-    std::map<std::string, UdpGroupEchoClient>::iterator tempit;
-    std::string ipaddrskey;
-    std::ostringstream os;
-    UdpGroupEchoClient src_client;
-    Time lapse;
+    UdpGroupEchoClientKey key;
 
     while ((packet = socket->RecvFrom(from)))
     {
@@ -268,10 +476,8 @@ UdpGroupEchoServer::HandleRead(Ptr<Socket> socket)
             NS_LOG_INFO("Server received " << packet->GetSize() << " bytes from "
                                            << InetSocketAddress::ConvertFrom(from).GetIpv4()
                                            << " port "
-                                           << InetSocketAddress::ConvertFrom(from).GetPort());
-
-            os << InetSocketAddress::ConvertFrom(from).GetIpv4() << ":"
-               << InetSocketAddress::ConvertFrom(from).GetPort();
+                                           << InetSocketAddress::ConvertFrom(from).GetPort()
+                                           << " for group " << groupId);
 
             InetSocketAddress inet_addrs = InetSocketAddress::ConvertFrom(from);
             inet_addrs.SetPort(m_port_client);
@@ -282,202 +488,98 @@ UdpGroupEchoServer::HandleRead(Ptr<Socket> socket)
             NS_LOG_INFO("Server received " << packet->GetSize() << " bytes from "
                                            << Inet6SocketAddress::ConvertFrom(from).GetIpv6()
                                            << " port "
-                                           << Inet6SocketAddress::ConvertFrom(from).GetPort());
-            os << Inet6SocketAddress::ConvertFrom(from).GetIpv6() << ":"
-               << Inet6SocketAddress::ConvertFrom(from).GetPort();
+                                           << Inet6SocketAddress::ConvertFrom(from).GetPort()
+                                           << " for group " << groupId);
 
             Inet6SocketAddress inet6_addrs = Inet6SocketAddress::ConvertFrom(from);
             inet6_addrs.SetPort(m_port_client);
             echo_address = inet6_addrs;
         }
+        if (!MakeClientKey(from, key))
+        {
+            NS_LOG_WARN("Ignoring packet from an address that is not a socket address");
+            continue;
+        }
 
         packet->RemoveAllPacketTags();
         packet->RemoveAllByteTags();
 
+        /* m_mode == INF_SESSION      : Server serves group clients indefinitely
+         * m_mode == NO_GROUP_SESSION : Server behaves as single echo-client (no group echo)
+         * m_mode == TIMEOUT_LIMITED  : Server group echo clients that have been active within
+         *                 the m_timeout elapsed time.
+         */
+
         /* Update clients group with new/existing client.
          * If exist, update timestamp. Else, add client to group with new timestamp.
          * Echo packet.
          */
-
-        ipaddrskey = os.str();
-
-        it = m_clients.find(ipaddrskey);
-        if (it != m_clients.end())
-        {
-            // Client is a group member. Udate timestamp.
-            NS_LOG_DEBUG("Client found; old timestamp: " << it->second.m_timestamp.GetSeconds());
-            it->second.m_timestamp = Simulator::Now();
-            NS_LOG_DEBUG("New timestamp: " << it->second.m_timestamp.GetSeconds());
-        }
-        else // Add client to group
-        {
-            src_client.m_address = from;
-            src_client.m_echo_address = echo_address;
-            src_client.m_timestamp = Simulator::Now();
-            m_clients[ipaddrskey] = src_client;
-        }
+        std::size_t sender = UpdateClient(group, key, from, echo_address);
 
         if (g_log.IsEnabled(LOG_DEBUG))
         {
-            LogClients();
+            LogClients(groupId);
         }
 
-        /* Echoing packet to group.
-         * Iterate through all the clients, check timestamp.
-         * If timestamp has expired, remove client.
-         * Else, echo/fwd packet to client.*/
-
-        /* m_mode == INF_SESSION      : Server serves group clients indefinitely
-         * m_mode == NO_GROUP_SESSION : Server behaves as single echo-client (no group echo)
-         * m_mode == TIMEOUT_LIMITED  : Server group echo clients that have been active within
-         *                 the m_timeout elapsed time.
-         */
-        Address addrs_dest;
-        if (m_mode == INF_SESSION)
+        if (m_mode == TIMEOUT_LIMITED)
         {
-            // Server serves group clients indefinitely.
-            for (it = m_clients.begin(); it != m_clients.end(); ++it)
-            {
-                // If no echo back to client, neglect client source
-                if (!m_echoClient && it->first == ipaddrskey)
-                {
-                    continue;
-                }
-
-                // Check elapsed time
-                lapse = Simulator::Now() - it->second.m_timestamp;
-
-                // Set destination address with the agreed client port.
-                if (m_port_client)
-                {
-                    addrs_dest = it->second.m_echo_address;
-                }
-                else
-                {
-                    addrs_dest = it->second.m_address;
-                }
-
-                // Forward packet
-                NS_LOG_LOGIC("Echoing packet");
-                socket->SendTo(packet, 0, addrs_dest);
-
-                if (InetSocketAddress::IsMatchingType(addrs_dest))
-                {
-                    NS_LOG_INFO("Server sent "
-                                << packet->GetSize() << " bytes to "
-                                << InetSocketAddress::ConvertFrom(addrs_dest).GetIpv4() << " port "
-                                << InetSocketAddress::ConvertFrom(addrs_dest).GetPort());
-                }
-                else if (Inet6SocketAddress::IsMatchingType(addrs_dest))
-                {
-                    NS_LOG_INFO("Server sent "
-                                << packet->GetSize() << " bytes to "
-                                << Inet6SocketAddress::ConvertFrom(addrs_dest).GetIpv6() << " port "
-                                << Inet6SocketAddress::ConvertFrom(addrs_dest).GetPort());
-                }
-            }
+            // Remove the clients whose session has expired, so all the
+            // clients left in the group are active. The sender may have
+            // been moved (or removed, with a null timeout)
+            ExpireClients(group);
+            auto it = group.m_clientIndex.find(key);
+            sender = it != group.m_clientIndex.end() ? it->second : group.m_clients.size();
         }
-        else if (m_mode == NO_GROUP_SESSION)
+
+        if (m_mode == NO_GROUP_SESSION)
         {
             // Only one client allowed in group.
-            it = m_clients.find(ipaddrskey);
             if (m_echoClient)
             {
-                // Set destination address with the agreed client port.
-                if (m_port_client)
-                {
-                    addrs_dest = it->second.m_echo_address;
-                }
-                else
-                {
-                    addrs_dest = it->second.m_address;
-                }
-
-                // Forward packet
-                NS_LOG_LOGIC("Echoing packet");
-                socket->SendTo(packet, 0, addrs_dest);
-
-                if (InetSocketAddress::IsMatchingType(addrs_dest))
-                {
-                    NS_LOG_INFO("Server sent "
-                                << packet->GetSize() << " bytes to "
-                                << InetSocketAddress::ConvertFrom(addrs_dest).GetIpv4() << " port "
-                                << InetSocketAddress::ConvertFrom(addrs_dest).GetPort());
-                }
-                else if (Inet6SocketAddress::IsMatchingType(addrs_dest))
-                {
-                    NS_LOG_INFO("Server sent "
-                                << packet->GetSize() << " bytes to "
-                                << Inet6SocketAddress::ConvertFrom(addrs_dest).GetIpv6() << " port "
-                                << Inet6SocketAddress::ConvertFrom(addrs_dest).GetPort());
-                }
+                EchoToClient(group, packet, group.m_clients[sender]);
             }
             // Remove client
-            m_clients.erase(it);
+            RemoveClient(group, sender);
+            continue;
         }
-        else // if (m_mode == TIMEOUT_LIMITED)
+
+        // Echo the packet to the group. With multicast, the IPv4 clients
+        // are reached with a single datagram
+        const bool multicast = !m_multicastBase.IsAny();
+        bool multicastRecipients = false;
+        for (std::size_t i = 0; i < group.m_clients.size(); i++)
         {
-            for (it = m_clients.begin(); it != m_clients.end(); ++it)
+            // If no echo back to client, neglect client source
+            if (!m_echoClient && i == sender)
             {
-                // If no echo back, neglect client source
-                if (!m_echoClient && it->first == ipaddrskey)
-                {
-                    continue;
-                }
-
-                // Check elapsed time
-                lapse = Simulator::Now() - it->second.m_timestamp;
-
-                if (lapse < m_timeout)
-                {
-                    // Set destination address with the agreed client port.
-                    if (m_port_client)
-                    {
-                        addrs_dest = it->second.m_echo_address;
-                    }
-                    else
-                    {
-                        addrs_dest = it->second.m_address;
-                    }
-
-                    // Forward packet
-                    NS_LOG_LOGIC("Echoing packet");
-                    socket->SendTo(packet, 0, addrs_dest);
-
-                    if (InetSocketAddress::IsMatchingType(addrs_dest))
-                    {
-                        NS_LOG_INFO("Server sent "
-                                    << packet->GetSize() << " bytes to "
-                                    << InetSocketAddress::ConvertFrom(addrs_dest).GetIpv4()
-                                    << " port "
-                                    << InetSocketAddress::ConvertFrom(addrs_dest).GetPort());
-                    }
-                    else if (Inet6SocketAddress::IsMatchingType(addrs_dest))
-                    {
-                        NS_LOG_INFO("Server sent "
-                                    << packet->GetSize() << " bytes to "
-                                    << Inet6SocketAddress::ConvertFrom(addrs_dest).GetIpv6()
-                                    << " port "
-                                    << Inet6SocketAddress::ConvertFrom(addrs_dest).GetPort());
-                    }
-                }
-                else // Time has expired. Remove client.
-                {
-                    tempit = it;
-                    --it;
-                    m_clients.erase(tempit);
-                }
+                continue;
             }
-        } // end for
-    }     // end while
+            if (multicast && !group.m_clients[i].m_key.m_ipv6)
+            {
+                multicastRecipients = true;
+                continue;
+            }
+            EchoToClient(group, packet, group.m_clients[i]);
+        }
+        if (multicastRecipients)
+        {
+            InetSocketAddress destination(Ipv4Address(m_multicastBase.Get() + groupId),
+                                          m_port_client);
+            group.m_socket->SendTo(packet, 0, destination);
+            NS_LOG_INFO("Server sent " << packet->GetSize() << " bytes to multicast group "
+                                       << destination.GetIpv4() << " port "
+                                       << destination.GetPort());
+        }
+    }
 }
 
 void
-UdpGroupEchoServer::LogClients()
+UdpGroupEchoServer::LogClients(uint32_t groupId)
 {
-    NS_LOG_FUNCTION(this);
-    NS_LOG_INFO("Number of clients: " << m_clients.size());
-    if (!m_clients.empty())
+    NS_LOG_FUNCTION(this << groupId);
+    const std::vector<UdpGroupEchoClient>& clients = m_groups[groupId].m_clients;
+    NS_LOG_INFO("Number of clients: " << clients.size());
+    if (!clients.empty())
     {
         // Check time lapse
         Time tstamp = Simulator::Now();
@@ -485,18 +587,29 @@ UdpGroupEchoServer::LogClients()
         NS_LOG_INFO(std::setfill('-') << std::setw(57) << "-" << std::setfill(' '));
         NS_LOG_INFO(std::setw(23) << "Client  " << std::setw(10) << "Session");
         NS_LOG_INFO(std::setfill('-') << std::setw(57) << "-" << std::setfill(' '));
-        for (auto it = m_clients.begin(); it != m_clients.end(); ++it)
+        for (const auto& client : clients)
         {
-            lapse = tstamp - it->second.m_timestamp;
+            std::ostringstream os;
+            if (InetSocketAddress::IsMatchingType(client.m_address))
+            {
+                os << InetSocketAddress::ConvertFrom(client.m_address).GetIpv4() << ":"
+                   << InetSocketAddress::ConvertFrom(client.m_address).GetPort();
+            }
+            else
+            {
+                os << Inet6SocketAddress::ConvertFrom(client.m_address).GetIpv6() << ":"
+                   << Inet6SocketAddress::ConvertFrom(client.m_address).GetPort();
+            }
+            lapse = tstamp - client.m_timestamp;
             if (m_mode == INF_SESSION || m_mode == NO_GROUP_SESSION ||
                 (m_mode == TIMEOUT_LIMITED && lapse < m_timeout))
             {
-                NS_LOG_INFO(std::setw(23)
-                            << it->first << " " << std::setw(10) << lapse.GetSeconds());
+                NS_LOG_INFO(std::setw(23) << os.str() << " " << std::setw(10)
+                                          << lapse.GetSeconds());
             }
             else
             {
-                NS_LOG_INFO(std::setw(23) << it->first << " " << std::setw(10) << lapse.GetSeconds()
+                NS_LOG_INFO(std::setw(23) << os.str() << " " << std::setw(10) << lapse.GetSeconds()
                                           << " **Session Expired!**");
             }
         }
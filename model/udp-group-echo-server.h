@@ -26,12 +26,19 @@
 
 #include "ns3/address.h"
 #include "ns3/application.h"
+#include "ns3/ipv4-address.h"
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
 #include "ns3/traced-callback.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
-#include <string>
+#include <queue>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -42,14 +49,45 @@ class Packet;
 namespace psc
 {
 
+/**
+ * Binary key that identifies a client by its IP address and port
+ */
+struct UdpGroupEchoClientKey
+{
+    std::array<uint8_t, 16> m_ip{}; //!< The IPv6 address, or the IPv4 address in the first bytes
+    uint16_t m_port{0};             //!< The port of the client
+    bool m_ipv6{false};             //!< True if the address is an IPv6 address
+
+    /**
+     * Compares two keys
+     * \param other The other key
+     * \return True if both keys identify the same client
+     */
+    bool operator==(const UdpGroupEchoClientKey& other) const;
+};
+
+/**
+ * Hash function of the client keys, to index the table of clients
+ */
+struct UdpGroupEchoClientKeyHash
+{
+    /**
+     * Computes the hash of a key
+     * \param key The key
+     * \return The hash of the key
+     */
+    std::size_t operator()(const UdpGroupEchoClientKey& key) const;
+};
+
 /**
  * Structure to store information about the client
  */
 struct UdpGroupEchoClient
 {
-    Address m_address;      //!< The remote address of the client
-    Address m_echo_address; //!< The address where to send a response
-    Time m_timestamp;       //!< Last time the server heard from the client
+    UdpGroupEchoClientKey m_key; //!< The key of the client
+    Address m_address;           //!< The remote address of the client
+    Address m_echo_address;      //!< The address where to send a response
+    Time m_timestamp;            //!< Last time the server heard from the client
 };
 
 /**
@@ -57,6 +95,11 @@ struct UdpGroupEchoClient
  * \brief A Udp Group Echo server
  *
  * Every packet received is sent back to active group members.
+ *
+ * The server can host several independent groups, each one listening on its
+ * own port (from Port to Port + Groups - 1) with its own table of members.
+ * Optionally, the echoes to the IPv4 members of a group are sent as a single
+ * multicast datagram instead of a unicast datagram per member.
  */
 class UdpGroupEchoServer : public Application
 {
@@ -81,9 +124,29 @@ class UdpGroupEchoServer : public Application
     ~UdpGroupEchoServer() override;
     /**
      * Adds a new client to the list of clients to echo messages
+     * of the first group
      * \param client The new client address to add
      */
     virtual void AddClient(const Address& client);
+    /**
+     * Adds a new client to the list of clients to echo messages of a group
+     * \param client The new client address to add
+     * \param group The index of the group
+     */
+    void AddClient(const Address& client, uint32_t group);
+    /**
+     * Gets the number of groups served
+     * \return The number of groups
+     */
+    uint32_t GetGroupCount() const;
+    /**
+     * Gets the number of clients in the table of a group. In TIMEOUT_LIMITED
+     * mode, the table may include clients whose session has expired since
+     * the last packet was received for the group.
+     * \param group The index of the group
+     * \return The number of clients of the group
+     */
+    uint32_t GetGroupSize(uint32_t group) const;
 
   protected:
     void DoDispose() override;
@@ -92,6 +155,36 @@ class UdpGroupEchoServer : public Application
     void StartApplication() override;
     void StopApplication() override;
 
+    /**
+     * Entry of the heap of session expiration times
+     */
+    struct Expiration
+    {
+        Time m_time;                 //!< Time at which the session may expire
+        UdpGroupEchoClientKey m_key; //!< The key of the client
+
+        /**
+         * Compares the entries by time
+         * \param other The other entry
+         * \return True if this entry expires after the other one
+         */
+        bool operator>(const Expiration& other) const;
+    };
+
+    /**
+     * State of an echo group
+     */
+    struct Group
+    {
+        Ptr<Socket> m_socket;                      //!< IPv4 Socket
+        Ptr<Socket> m_socket6;                     //!< IPv6 Socket
+        std::vector<UdpGroupEchoClient> m_clients; //!< Clients of the group
+        std::unordered_map<UdpGroupEchoClientKey, std::size_t, UdpGroupEchoClientKeyHash>
+            m_clientIndex; //!< Index of each client in m_clients
+        std::priority_queue<Expiration, std::vector<Expiration>, std::greater<>>
+            m_expirations; //!< Session expiration times, earliest first
+    };
+
     /**
      * \brief Handle a packet reception.
      *
@@ -100,24 +193,95 @@ class UdpGroupEchoServer : public Application
      * \param socket the socket the packet was received to.
      */
     void HandleRead(Ptr<Socket> socket);
+
+    /**
+     * \brief Creates the groups that have not been created yet.
+     */
+    void CreateGroups();
+
+    /**
+     * \brief Creates a socket bound to a local address.
+     *
+     * \param local The local address.
+     * \param multicastGroup The multicast group to join, if it is a multicast address.
+     * \return The socket.
+     */
+    Ptr<Socket> CreateSocket(const Address& local, const Address& multicastGroup);
+
+    /**
+     * \brief Builds the key of a client from its address.
+     *
+     * \param address The address of the client.
+     * \param key The key built.
+     * \return True if the address is an IPv4 or IPv6 socket address.
+     */
+    static bool MakeClientKey(const Address& address, UdpGroupEchoClientKey& key);
+
+    /**
+     * \brief Adds a client, or refreshes its timestamp if it already exists.
+     *
+     * \param group The group of the client.
+     * \param key The key of the client.
+     * \param address The remote address of the client.
+     * \param echoAddress The address where to send a response.
+     * \return The index of the client in the table of clients of the group.
+     */
+    std::size_t UpdateClient(Group& group,
+                             const UdpGroupEchoClientKey& key,
+                             const Address& address,
+                             const Address& echoAddress);
+
+    /**
+     * \brief Removes a client from the table of clients of a group.
+     *
+     * The last client of the table takes the place of the client removed.
+     *
+     * \param group The group of the client.
+     * \param index The index of the client in the table of clients.
+     */
+    void RemoveClient(Group& group, std::size_t index);
+
+    /**
+     * \brief Removes the clients of a group whose session has expired.
+     *
+     * Only the heads of the heap of expiration times that are due are
+     * checked, and the entries of clients heard from since then are pushed
+     * back with their new expiration time.
+     *
+     * \param group The group.
+     */
+    void ExpireClients(Group& group);
+
+    /**
+     * \brief Sends a packet to a client.
+     *
+     * \param group The group of the client.
+     * \param packet The packet.
+     * \param client The client.
+     */
+    void EchoToClient(Group& group, Ptr<Packet> packet, const UdpGroupEchoClient& client);
+
     /**
      * \brief Log client information.
      *
-     * This function logs the number of clients and their session information.
-     * To log the output, at least NS_LOG_INFO must be enabled for this class.
+     * This function logs the number of clients of a group and their session
+     * information. To log the output, at least NS_LOG_INFO must be enabled
+     * for this class.
      *
+     * \param groupId The index of the group.
      */
-    void LogClients();
-
-    Mode_t m_mode;          ///< Mode of echo operation
-    uint16_t m_port;        ///< Port on which we listen for incoming packets.
-    uint16_t m_port_client; ///< Port on which we echo packets to client.
-    Ptr<Socket> m_socket;   ///< IPv4 Socket
-    Ptr<Socket> m_socket6;  ///< IPv6 Socket
-    Address m_local;        ///< local multicast address
-    std::map<std::string, UdpGroupEchoClient> m_clients; ///< Group of clients
-    Time m_timeout;    ///< Inactive client session expiration time
-    bool m_echoClient; ///< Set server to echo back to the client.
+    void LogClients(uint32_t groupId);
+
+    Mode_t m_mode;                                  ///< Mode of echo operation
+    uint16_t m_port;                                ///< Port on which we listen for packets
+    uint16_t m_port_client;                         ///< Port on which we echo packets to client.
+    Address m_local;                                ///< local multicast address
+    uint32_t m_groupCount;                          ///< Number of groups, each one on its own port
+    Ipv4Address m_multicastBase;                    ///< Multicast address of the first group
+    std::vector<Group> m_groups;                    ///< Groups of clients
+    std::map<Ptr<Socket>, uint32_t> m_socketGroups; ///< Group of each socket
+    Time m_timeout;                                 ///< Inactive client session expiration time
+    bool m_echoClient;                              ///< Set server to echo back to the client.
     TracedCallback<Ptr<const Packet>, const Address&>
         m_rxTrace; ///< Callbacks for tracing the packet Rx events
 };
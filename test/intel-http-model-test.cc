@@ -45,6 +45,11 @@
 #include <ns3/simulator.h>
 #include <ns3/test.h>
 
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
 NS_LOG_COMPONENT_DEFINE("IntelHttpModelTestSuite");
 
 /**
@@ -1740,6 +1745,364 @@ IntelHttpTestCaseHeaderContent::DoRun()
                           "Client never received an embedded object");
 }
 
+/**
+ * \ingroup intel-http-model-tests
+ *
+ * Tests that the client spreads the requests for the embedded objects between
+ * the parallel connections, and that it only has one request per connection
+ * without a response when pipelining is disabled.
+ */
+class IntelHttpTestCaseParallelConnections : public IntelHttpBaseTestCase
+{
+    const uint16_t EMBEDDED_OBJECTS{12u};
+    uint16_t m_connections;
+    bool m_pipelining;
+    bool m_isFirstMainObject{true};
+
+    std::set<Address> m_requestSources;
+    uint16_t m_requests{0u};
+    uint16_t m_responses{0u};
+    uint16_t m_maxOutstandingRequests{0u};
+    uint16_t m_pageLoads{0u};
+    Time m_pageLoadTime;
+
+  public:
+    IntelHttpTestCaseParallelConnections(uint16_t connections, bool pipelining);
+    void RequestMainObject(Ptr<const Packet> /*unused*/);
+    void RequestEmbeddedObject(Ptr<const Packet> /*unused*/);
+    void ReceiveRequest(Ptr<const Packet> /*unused*/, const Address& from);
+    void ReceiveEmbeddedObject(Ptr<const Packet> /*unused*/, const Address& /*unused*/);
+    void PageLoadTime(Time /*oldValue*/, Time newValue);
+    void DoRun() override;
+};
+
+IntelHttpTestCaseParallelConnections::IntelHttpTestCaseParallelConnections(uint16_t connections,
+                                                                           bool pipelining)
+    : IntelHttpBaseTestCase("Intel HTTP Model Test Case - Verify the requests are spread between " +
+                            std::to_string(connections) + " connections with pipelining " +
+                            (pipelining ? "enabled" : "disabled")),
+      m_connections(connections),
+      m_pipelining(pipelining)
+{
+}
+
+void
+IntelHttpTestCaseParallelConnections::RequestMainObject(Ptr<const Packet> /*unused*/)
+{
+    if (m_isFirstMainObject)
+    {
+        m_isFirstMainObject = false;
+    }
+    else
+    {
+        Simulator::Stop();
+    }
+}
+
+void
+IntelHttpTestCaseParallelConnections::RequestEmbeddedObject(Ptr<const Packet> /*unused*/)
+{
+    m_requests++;
+    m_maxOutstandingRequests =
+        std::max<uint16_t>(m_maxOutstandingRequests, m_requests - m_responses);
+}
+
+void
+IntelHttpTestCaseParallelConnections::ReceiveRequest(Ptr<const Packet> /*unused*/,
+                                                     const Address& from)
+{
+    m_requestSources.insert(from);
+}
+
+void
+IntelHttpTestCaseParallelConnections::ReceiveEmbeddedObject(Ptr<const Packet> /*unused*/,
+                                                            const Address& /*unused*/)
+{
+    m_responses++;
+}
+
+void
+IntelHttpTestCaseParallelConnections::PageLoadTime(Time /*oldValue*/, Time newValue)
+{
+    m_pageLoads++;
+    m_pageLoadTime = newValue;
+}
+
+void
+IntelHttpTestCaseParallelConnections::DoRun()
+{
+    client->SetAttribute("MaxConnections", UintegerValue(m_connections));
+    client->SetAttribute("Pipelining", BooleanValue(m_pipelining));
+    client->SetAttribute("CacheThreshold", DoubleValue(0.0));
+
+    client->TraceConnectWithoutContext(
+        "TxRequestMainObject",
+        MakeCallback(&IntelHttpTestCaseParallelConnections::RequestMainObject, this));
+    client->TraceConnectWithoutContext(
+        "TxRequestEmbeddedObject",
+        MakeCallback(&IntelHttpTestCaseParallelConnections::RequestEmbeddedObject, this));
+    client->TraceConnectWithoutContext(
+        "RxEmbeddedObject",
+        MakeCallback(&IntelHttpTestCaseParallelConnections::ReceiveEmbeddedObject, this));
+    client->TraceConnectWithoutContext(
+        "PageLoadTime",
+        MakeCallback(&IntelHttpTestCaseParallelConnections::PageLoadTime, this));
+    server->TraceConnectWithoutContext(
+        "Rx",
+        MakeCallback(&IntelHttpTestCaseParallelConnections::ReceiveRequest, this));
+
+    server->SetAttribute("EmbeddedObjectAmountRvs",
+                         PointerValue(MakeConstantStream(EMBEDDED_OBJECTS)));
+
+    // Keep the server busy for a while with each request, so the client
+    // sends all the requests it can before receiving the first response
+    auto constantZeroStream = MakeConstantStream(0);
+    client->SetAttribute("ParseTimeRvs", PointerValue(constantZeroStream));
+    client->SetAttribute("ReadTimeRvs", PointerValue(constantZeroStream));
+    server->SetAttribute("EmbeddedObjectIatRvs", PointerValue(MakeConstantStream(0.01)));
+
+    Simulator::Stop(DEFAULT_STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_responses,
+                          EMBEDDED_OBJECTS,
+                          "All the embedded objects should have been received");
+    NS_TEST_ASSERT_MSG_EQ(m_requestSources.size(),
+                          std::min(m_connections, EMBEDDED_OBJECTS),
+                          "The requests should come from every connection used");
+    if (m_pipelining)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_maxOutstandingRequests,
+                              EMBEDDED_OBJECTS,
+                              "All the requests should be sent before receiving any response");
+    }
+    else
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_maxOutstandingRequests,
+                              std::min(m_connections, EMBEDDED_OBJECTS),
+                              "There should be one outstanding request per connection");
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_pageLoads, 1, "The page load time should be reported once");
+    NS_TEST_ASSERT_MSG_GT(m_pageLoadTime, Time(0), "The page load time should be positive");
+}
+
+/**
+ * \ingroup intel-http-model-tests
+ *
+ * Tests that the population client loads the pages of all the clients it
+ * emulates, requesting the embedded objects of each page, and that it does
+ * not open more connections than allowed.
+ */
+class IntelHttpTestCasePopulation : public TestCase
+{
+    const uint32_t CLIENTS{10u};
+    const uint16_t EMBEDDED_OBJECTS{3u};
+    uint32_t m_maxConnections;
+
+    std::vector<uint32_t> m_pageLoads;
+    uint32_t m_mainRequests{0u};
+    uint32_t m_embeddedRequests{0u};
+    uint32_t m_connections{0u};
+
+  public:
+    IntelHttpTestCasePopulation(uint32_t maxConnections);
+    void PageLoad(uint32_t client, Time loadTime);
+    void ReceiveMainObjectRequest(Ptr<const Packet> /* unused */, const Address& /* unused */);
+    void ReceiveEmbeddedObjectRequest(Ptr<const Packet> /* unused */,
+                                      const Address& /* unused */);
+    void CheckConnections(Ptr<psc::IntelHttpPopulationClient> client);
+    void DoRun() override;
+};
+
+IntelHttpTestCasePopulation::IntelHttpTestCasePopulation(uint32_t maxConnections)
+    : TestCase("Intel HTTP Model Test Case - Verify the population client with up to " +
+               std::to_string(maxConnections) + " connections"),
+      m_maxConnections(maxConnections)
+{
+}
+
+void
+IntelHttpTestCasePopulation::PageLoad(uint32_t client, Time loadTime)
+{
+    NS_TEST_ASSERT_MSG_LT(client, CLIENTS, "Page loaded by an unknown client");
+    NS_TEST_ASSERT_MSG_GT(loadTime, Time(0), "The page load time should be positive");
+    m_pageLoads[client]++;
+}
+
+void
+IntelHttpTestCasePopulation::ReceiveMainObjectRequest(Ptr<const Packet> /* unused */,
+                                                      const Address& /* unused */)
+{
+    m_mainRequests++;
+}
+
+void
+IntelHttpTestCasePopulation::ReceiveEmbeddedObjectRequest(Ptr<const Packet> /* unused */,
+                                                          const Address& /* unused */)
+{
+    m_embeddedRequests++;
+}
+
+void
+IntelHttpTestCasePopulation::CheckConnections(Ptr<psc::IntelHttpPopulationClient> client)
+{
+    m_connections = client->GetConnectionCount();
+}
+
+void
+IntelHttpTestCasePopulation::DoRun()
+{
+    const auto STOP_TIME = Seconds(10.5);
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("100Gbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("0ms"));
+
+    auto devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    auto interfaces = address.Assign(devices);
+
+    auto server = CreateObject<psc::IntelHttpServer>();
+    server->SetStartTime(Seconds(0));
+    server->SetStopTime(STOP_TIME);
+    server->SetAttribute("EmbeddedObjectAmountRvs",
+                         PointerValue(MakeConstantStream(EMBEDDED_OBJECTS)));
+    server->SetAttribute("EmbeddedObjectIatRvs", PointerValue(MakeConstantStream(0)));
+    nodes.Get(0)->AddApplication(server);
+
+    // Each client loads a page every second
+    auto client = CreateObject<psc::IntelHttpPopulationClient>();
+    client->SetStartTime(Seconds(1));
+    client->SetStopTime(STOP_TIME);
+    client->SetAttribute("RemoteAddress", AddressValue(interfaces.GetAddress(0)));
+    client->SetAttribute("Clients", UintegerValue(CLIENTS));
+    client->SetAttribute("MaxConnections", UintegerValue(m_maxConnections));
+    client->SetAttribute("CacheThreshold", DoubleValue(0.0));
+    client->SetAttribute("ParseTimeRvs", PointerValue(MakeConstantStream(0)));
+    client->SetAttribute("ReadTimeRvs", PointerValue(MakeConstantStream(1)));
+    nodes.Get(1)->AddApplication(client);
+
+    m_pageLoads.assign(CLIENTS, 0);
+    client->TraceConnectWithoutContext("PageLoad",
+                                       MakeCallback(&IntelHttpTestCasePopulation::PageLoad, this));
+    server->TraceConnectWithoutContext(
+        "RxRequestMainObject",
+        MakeCallback(&IntelHttpTestCasePopulation::ReceiveMainObjectRequest, this));
+    server->TraceConnectWithoutContext(
+        "RxRequestEmbeddedObject",
+        MakeCallback(&IntelHttpTestCasePopulation::ReceiveEmbeddedObjectRequest, this));
+    Simulator::Schedule(Seconds(10),
+                        &IntelHttpTestCasePopulation::CheckConnections,
+                        this,
+                        client);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    uint32_t pages = 0;
+    for (uint32_t i = 0; i < CLIENTS; i++)
+    {
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(m_pageLoads[i], 9, "Client " << i << " loaded too few pages");
+        pages += m_pageLoads[i];
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_mainRequests, pages, "Every page requested should have been loaded");
+    NS_TEST_ASSERT_MSG_EQ(m_embeddedRequests,
+                          pages * EMBEDDED_OBJECTS,
+                          "All the embedded objects of each page should have been requested");
+    NS_TEST_ASSERT_MSG_GT(m_connections, 0, "The clients should have opened connections");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(m_connections,
+                                m_maxConnections > 0 ? m_maxConnections : CLIENTS,
+                                "The clients opened too many connections");
+}
+
+/**
+ * \ingroup intel-http-model-tests
+ *
+ * Verify that the message parser extracts the same messages regardless of
+ * how the stream is split into segments
+ */
+class IntelHttpTestCaseMessageParser : public TestCase
+{
+  public:
+    IntelHttpTestCaseMessageParser();
+
+    void DoRun() override;
+};
+
+IntelHttpTestCaseMessageParser::IntelHttpTestCaseMessageParser()
+    : TestCase("Intel HTTP Model Test Case - Verify the Message Parser With Split Segments")
+{
+}
+
+void
+IntelHttpTestCaseMessageParser::DoRun()
+{
+    // Main object with 3 embedded objects, an empty embedded object, and a
+    // large embedded object
+    const std::vector<std::pair<psc::IntelHttpHeader::Type, uint32_t>> messages = {
+        {psc::IntelHttpHeader::Type::Main, 10},
+        {psc::IntelHttpHeader::Type::Embedded, 0},
+        {psc::IntelHttpHeader::Type::Embedded, 5000}};
+
+    Ptr<Packet> stream = Create<Packet>();
+    for (std::size_t i = 0; i < messages.size(); i++)
+    {
+        Ptr<Packet> message = Create<Packet>(messages[i].second);
+        psc::IntelHttpHeader header;
+        header.SetRequestType(messages[i].first);
+        header.SetNumberEmbeddedObjects(i == 0 ? 3 : i);
+        header.SetPayloadSize(messages[i].second);
+        message->AddHeader(header);
+        stream->AddAtEnd(message);
+    }
+
+    for (uint32_t segmentSize : {1u, 3u, 6u, 7u, 1000u, stream->GetSize()})
+    {
+        psc::IntelHttpMessageParser parser;
+        std::size_t received = 0;
+        for (uint32_t offset = 0; offset < stream->GetSize(); offset += segmentSize)
+        {
+            uint32_t size = std::min(segmentSize, stream->GetSize() - offset);
+            parser.Feed(stream->CreateFragment(offset, size));
+
+            psc::IntelHttpHeader header;
+            Ptr<Packet> message;
+            while (parser.Next(header, &message))
+            {
+                NS_TEST_ASSERT_MSG_LT(received, messages.size(), "Too many messages parsed");
+                NS_TEST_ASSERT_MSG_EQ(header.GetRequestType(),
+                                      messages[received].first,
+                                      "Unexpected message type");
+                NS_TEST_ASSERT_MSG_EQ(header.GetPayloadSize(),
+                                      messages[received].second,
+                                      "Unexpected payload size");
+                NS_TEST_ASSERT_MSG_EQ(header.GetNumberEmbeddedObjects(),
+                                      (received == 0 ? 3 : received),
+                                      "Unexpected number of embedded objects");
+                NS_TEST_ASSERT_MSG_EQ(message->GetSize(),
+                                      messages[received].second +
+                                          psc::IntelHttpHeader::GetHeaderSize(),
+                                      "Unexpected message size");
+                received++;
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ(received,
+                              messages.size(),
+                              "Not all the messages were parsed with segments of "
+                                  << segmentSize << " Bytes");
+        NS_TEST_ASSERT_MSG_EQ(parser.GetPendingBytes(), 0, "Unexpected pending Bytes");
+    }
+}
+
 /**
  * \ingroup intel-http-model-tests
  */
@@ -1763,6 +2126,13 @@ IntelHttpTestSuite::IntelHttpTestSuite()
     AddTestCase(new IntelHttpTestCaseObjectInterArrival());
     AddTestCase(new IntelHttpTestCaseIpv6());
     AddTestCase(new IntelHttpTestCaseHeaderContent());
+    AddTestCase(new IntelHttpTestCaseMessageParser());
+    AddTestCase(new IntelHttpTestCaseParallelConnections(1, true));
+    AddTestCase(new IntelHttpTestCaseParallelConnections(6, true));
+    AddTestCase(new IntelHttpTestCaseParallelConnections(1, false));
+    AddTestCase(new IntelHttpTestCaseParallelConnections(6, false));
+    AddTestCase(new IntelHttpTestCasePopulation(0));
+    AddTestCase(new IntelHttpTestCasePopulation(2));
 }
 
 /**
@@ -36,8 +36,11 @@
 
 #include <ns3/callback.h>
 #include <ns3/core-module.h>
+#include <ns3/ipv4-address.h>
 #include <ns3/mcptt-call-machine-grp-basic.h>
 #include <ns3/mcptt-call-msg.h>
+#include <ns3/mcptt-floor-participant.h>
+#include <ns3/mcptt-off-network-floor-participant.h>
 #include <ns3/mcptt-ptt-app.h>
 
 namespace ns3
@@ -512,6 +515,39 @@ class McpttCallReject : public McpttTestCase
     bool m_ueCTfg4Exp;
 };
 
+class McpttCallRecycleReleased : public McpttTestCase
+{
+  public:
+    McpttCallRecycleReleased(
+        const std::string& name = "Call Recycle - Released Call Reused",
+        Ptr<McpttTestCaseConfig> config = Create<McpttTestCaseConfig>());
+
+  protected:
+    void Configure() override;
+    void Execute() override;
+    virtual Ptr<McpttCall> AddGrpCall(uint32_t index, uint16_t callId, Time start, Time stop);
+    virtual void CheckCallOngoing(uint16_t callId);
+    virtual void CheckCallsRecycled();
+    virtual void SetupCallAgain();
+
+  private:
+    Ptr<McpttCall> m_ueACall;
+    bool m_ueACallReused;
+    uint32_t m_ongoingCount;
+    uint32_t m_recycledCount;
+};
+
+class McpttCallRecyclePoolOverflow : public McpttTestCase
+{
+  public:
+    McpttCallRecyclePoolOverflow(
+        const std::string& name = "Call Recycle - Pool Overflow",
+        Ptr<McpttTestCaseConfig> config = Create<McpttTestCaseConfig>());
+
+  protected:
+    void Execute() override;
+};
+
 class McpttCallControlTestSuite : public TestSuite
 {
   public:
@@ -6643,6 +6679,191 @@ McpttCallReject::UeCStateChangeCb(const TestCallMachine& machine,
                           "UE C timer " << tfg6->GetId() << " is running.");
 }
 
+McpttCallRecycleReleased::McpttCallRecycleReleased(const std::string& name,
+                                                   Ptr<McpttTestCaseConfig> config)
+    : McpttTestCase(name, config),
+      m_ueACall(nullptr),
+      m_ueACallReused(false),
+      m_ongoingCount(0),
+      m_recycledCount(0)
+{
+}
+
+void
+McpttCallRecycleReleased::Configure()
+{
+    McpttTestCase::Configure();
+
+    // A group call, set up by UE A and joined by UE B, is recycled when it is
+    // released at its stop time, and then reused for the same group call
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        GetApp(index)->SetAttribute("RecycleReleasedCalls", BooleanValue(true));
+        AddGrpCall(index, 1, Seconds(2.1), Seconds(2.5));
+    }
+    m_ueACall = GetApp(0)->GetCall(1);
+
+    Ptr<McpttCallMachine> ueAMachine = m_ueACall->GetCallMachine();
+
+    Simulator::Schedule(Seconds(2.2), &McpttCallMachine::InitiateCall, ueAMachine);
+    Simulator::Schedule(Seconds(2.45), &McpttCallRecycleReleased::CheckCallOngoing, this, 1);
+    Simulator::Schedule(Seconds(2.6), &McpttCallRecycleReleased::SetupCallAgain, this);
+    Simulator::Schedule(Seconds(3.1), &McpttCallRecycleReleased::CheckCallOngoing, this, 2);
+    Simulator::Schedule(Seconds(3.3), &McpttCallRecycleReleased::CheckCallsRecycled, this);
+}
+
+void
+McpttCallRecycleReleased::Execute()
+{
+    NS_LOG_LOGIC("Starting " << GetName() << "...");
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_ueACallReused, true, "UE A did not reuse its released call.");
+    NS_TEST_ASSERT_MSG_EQ(m_ongoingCount, 4, "The calls were not all set up twice.");
+    NS_TEST_ASSERT_MSG_EQ(m_recycledCount, 4, "The released calls were not all recycled.");
+}
+
+Ptr<McpttCall>
+McpttCallRecycleReleased::AddGrpCall(uint32_t index, uint16_t callId, Time start, Time stop)
+{
+    Ptr<McpttPttApp> app = GetApp(index);
+    Ptr<McpttCallMachine> callMachine =
+        CreateObjectWithAttributes<McpttCallMachineGrpBasic>("GroupId", UintegerValue(2));
+    Ptr<McpttFloorParticipant> floorMachine = CreateObject<McpttFloorParticipantNull>();
+
+    Ptr<McpttCall> call =
+        app->AllocateCall(McpttCall::NetworkCallType::OFF_NETWORK, callMachine, floorMachine);
+    call->SetAttribute("PeerAddress", AddressValue(Ipv4Address("255.255.255.255")));
+    call->SetCallId(callId);
+    call->SetStartTime(start);
+    call->SetStopTime(stop);
+    app->AddCall(call);
+
+    return call;
+}
+
+void
+McpttCallRecycleReleased::CheckCallOngoing(uint16_t callId)
+{
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        Ptr<McpttCall> call = GetApp(index)->GetCall(callId);
+
+        NS_TEST_ASSERT_MSG_NE(call, nullptr, "UE " << index << " has no call " << callId << ".");
+        if (call->GetCallMachine()->IsCallOngoing())
+        {
+            m_ongoingCount++;
+        }
+    }
+}
+
+void
+McpttCallRecycleReleased::CheckCallsRecycled()
+{
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        for (uint16_t callId = 1; callId <= 2; callId++)
+        {
+            if (!GetApp(index)->GetCall(callId))
+            {
+                m_recycledCount++;
+            }
+        }
+        NS_TEST_ASSERT_MSG_NE(GetApp(index)->GetCall(0),
+                              nullptr,
+                              "UE " << index << " lost a call that was not released.");
+    }
+}
+
+void
+McpttCallRecycleReleased::SetupCallAgain()
+{
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        Ptr<McpttCall> call = AddGrpCall(index, 2, Seconds(2.7), Seconds(3.2));
+        if (index == 0)
+        {
+            m_ueACallReused = (call == m_ueACall);
+            Simulator::Schedule(Seconds(0.2),
+                                &McpttCallMachine::InitiateCall,
+                                call->GetCallMachine());
+        }
+        // The calls added to a running application are started by hand
+        call->Start();
+    }
+}
+
+McpttCallRecyclePoolOverflow::McpttCallRecyclePoolOverflow(const std::string& name,
+                                                           Ptr<McpttTestCaseConfig> config)
+    : McpttTestCase(name, config)
+{
+}
+
+void
+McpttCallRecyclePoolOverflow::Execute()
+{
+    NS_LOG_LOGIC("Starting " << GetName() << "...");
+
+    Ptr<McpttPttApp> app = GetApp();
+    app->SetAttribute("MaxPooledCalls", UintegerValue(1));
+
+    ObjectFactory callFac;
+    callFac.SetTypeId(McpttCallMachineGrpBasic::GetTypeId());
+    ObjectFactory floorFac;
+    floorFac.SetTypeId(McpttFloorParticipantNull::GetTypeId());
+    ObjectFactory otherFloorFac;
+    otherFloorFac.SetTypeId(McpttOffNetworkFloorParticipant::GetTypeId());
+
+    Ptr<McpttCall> pooledCall =
+        app->CreateCall(callFac, floorFac, McpttCall::NetworkCallType::OFF_NETWORK, 1);
+    Ptr<McpttCall> disposedCall =
+        app->CreateCall(callFac, floorFac, McpttCall::NetworkCallType::OFF_NETWORK, 2);
+
+    app->RecycleCall(1);
+    app->RecycleCall(2);
+
+    NS_TEST_ASSERT_MSG_EQ(app->GetCall(1), nullptr, "Call 1 was not removed.");
+    NS_TEST_ASSERT_MSG_EQ(app->GetCall(2), nullptr, "Call 2 was not removed.");
+    NS_TEST_ASSERT_MSG_EQ(pooledCall->GetCallMachine(),
+                          nullptr,
+                          "The machine of the pooled call was kept.");
+    NS_TEST_ASSERT_MSG_NE(pooledCall->GetFloorChannel(),
+                          nullptr,
+                          "The pooled call lost its channels.");
+    NS_TEST_ASSERT_MSG_EQ(disposedCall->GetFloorChannel(),
+                          nullptr,
+                          "The call beyond the size of the pool was not disposed of.");
+
+    Ptr<McpttCall> otherCall =
+        app->CreateCall(callFac, otherFloorFac, McpttCall::NetworkCallType::OFF_NETWORK, 3);
+    NS_TEST_ASSERT_MSG_NE(otherCall,
+                          pooledCall,
+                          "A call was reused with a floor machine of another type.");
+
+    Ptr<McpttCall> reusedCall =
+        app->CreateCall(callFac, floorFac, McpttCall::NetworkCallType::OFF_NETWORK, 4);
+    NS_TEST_ASSERT_MSG_EQ(reusedCall, pooledCall, "The pooled call was not reused.");
+    NS_TEST_ASSERT_MSG_EQ(app->GetCall(4), pooledCall, "The reused call was not added.");
+    NS_TEST_ASSERT_MSG_NE(reusedCall->GetCallMachine(),
+                          nullptr,
+                          "The reused call has no call machine.");
+
+    Ptr<McpttCall> newCall =
+        app->CreateCall(callFac, floorFac, McpttCall::NetworkCallType::OFF_NETWORK, 5);
+    NS_TEST_ASSERT_MSG_NE(newCall, pooledCall, "The pooled call was reused twice.");
+    NS_TEST_ASSERT_MSG_NE(newCall, disposedCall, "The disposed call was reused.");
+
+    for (uint16_t callId = 3; callId <= 5; callId++)
+    {
+        app->RecycleCall(callId);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 McpttCallControlTestSuite::McpttCallControlTestSuite()
     : TestSuite("mcptt-call-control", TestSuite::Type::SYSTEM)
 {
@@ -6656,6 +6877,8 @@ McpttCallControlTestSuite::McpttCallControlTestSuite()
     AddTestCase(new McpttCallReleaseMaxDuration(), TestCase::Duration::QUICK);
     AddTestCase(new McpttCallReleaseAndSetup(), TestCase::Duration::QUICK);
     AddTestCase(new McpttCallReject(), TestCase::Duration::QUICK);
+    AddTestCase(new McpttCallRecycleReleased(), TestCase::Duration::QUICK);
+    AddTestCase(new McpttCallRecyclePoolOverflow(), TestCase::Duration::QUICK);
 }
 
 } // namespace tests
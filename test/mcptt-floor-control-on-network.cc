@@ -892,7 +892,7 @@ McpttTestCaseOnNetworkFloorRevoke::Configure()
     Ptr<McpttPusher> ue2Pusher = ue2App->GetPusher();
     ue2Pusher->SchedulePush(Seconds(5.0));
 
-    std::map<uint16_t, Ptr<McpttCall>> calls = ue2App->GetCalls();
+    const McpttPttApp::CallTable& calls = ue2App->GetCalls();
     Ptr<McpttCall> ue2Call = calls.begin()->second;
     Ptr<McpttFloorParticipant> ue2FloorParticipant = ue2Call->GetFloorMachine();
     Ptr<McpttOnNetworkFloorParticipant> ue2OnNetworkFloorParticipant =
@@ -1264,7 +1264,7 @@ McpttTestCaseOnNetworkFloorQueueAndCancel::Configure()
     ue2Pusher->SchedulePush(Seconds(4.0));
     ue2Pusher->ScheduleRelease(Seconds(6.0));
 
-    std::map<uint16_t, Ptr<McpttCall>> calls = ue2App->GetCalls();
+    const McpttPttApp::CallTable& calls = ue2App->GetCalls();
     Ptr<McpttCall> ue2Call = calls.begin()->second;
     Ptr<McpttFloorParticipant> ue2FloorParticipant = ue2Call->GetFloorMachine();
     Ptr<McpttOnNetworkFloorParticipant> ue2OnNetworkFloorParticipant =
@@ -1770,7 +1770,7 @@ McpttTestCaseOnNetworkDualFloorControl::Configure()
     ue3Pusher->SchedulePush(Seconds(6.0));
     ue3Pusher->ScheduleRelease(Seconds(8.0));
 
-    std::map<uint16_t, Ptr<McpttCall>> calls = ue3App->GetCalls();
+    const McpttPttApp::CallTable& calls = ue3App->GetCalls();
     Ptr<McpttCall> ue3Call = calls.begin()->second;
     Ptr<McpttFloorParticipant> ue3FloorParticipant = ue3Call->GetFloorMachine();
     Ptr<McpttOnNetworkFloorParticipant> ue3OnNetworkFloorParticipant =
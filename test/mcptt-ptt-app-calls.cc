@@ -0,0 +1,273 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/mcptt-call-machine-grp-basic.h>
+#include <ns3/mcptt-call-machine.h>
+#include <ns3/mcptt-floor-participant.h>
+#include <ns3/mcptt-ptt-app.h>
+#include <ns3/node.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("McpttPttAppCallsTest");
+
+namespace psc
+{
+namespace tests
+{
+
+/**
+ * A call machine of a private call with a given peer.
+ */
+class TestPrivateCallMachine : public McpttCallMachineNull
+{
+  public:
+    TestPrivateCallMachine();
+    bool IsPrivateCall(uint32_t userId = 0) const override;
+    void SetPeerUserId(uint32_t peerUserId);
+
+  private:
+    uint32_t m_peerUserId;
+};
+
+class McpttPttAppCallsTestCase : public TestCase
+{
+  public:
+    McpttPttAppCallsTestCase(const std::string& name);
+
+  protected:
+    virtual Ptr<McpttCall> AddCall(Ptr<McpttCallMachine> callMachine, uint16_t callId);
+    void DoSetup() override;
+    void DoTeardown() override;
+
+    Ptr<McpttPttApp> m_app;
+};
+
+class McpttPttAppGetCallTest : public McpttPttAppCallsTestCase
+{
+  public:
+    McpttPttAppGetCallTest();
+    void DoRun() override;
+};
+
+class McpttPttAppHasGrpCallForTest : public McpttPttAppCallsTestCase
+{
+  public:
+    McpttPttAppHasGrpCallForTest();
+    void DoRun() override;
+};
+
+class McpttPttAppHasPrivateCallForTest : public McpttPttAppCallsTestCase
+{
+  public:
+    McpttPttAppHasPrivateCallForTest();
+    void DoRun() override;
+};
+
+class McpttPttAppCallsTestSuite : public TestSuite
+{
+  public:
+    McpttPttAppCallsTestSuite();
+};
+
+/***************************************************************
+ *  Implementation of the code declared above.
+ ***************************************************************/
+
+static McpttPttAppCallsTestSuite suite;
+
+TestPrivateCallMachine::TestPrivateCallMachine()
+    : McpttCallMachineNull(),
+      m_peerUserId(0)
+{
+}
+
+bool
+TestPrivateCallMachine::IsPrivateCall(uint32_t userId) const
+{
+    return userId == 0 || userId == m_peerUserId;
+}
+
+void
+TestPrivateCallMachine::SetPeerUserId(uint32_t peerUserId)
+{
+    m_peerUserId = peerUserId;
+}
+
+McpttPttAppCallsTestCase::McpttPttAppCallsTestCase(const std::string& name)
+    : TestCase(name),
+      m_app(nullptr)
+{
+}
+
+Ptr<McpttCall>
+McpttPttAppCallsTestCase::AddCall(Ptr<McpttCallMachine> callMachine, uint16_t callId)
+{
+    Ptr<McpttCall> call = m_app->AllocateCall(McpttCall::NetworkCallType::OFF_NETWORK,
+                                              callMachine,
+                                              CreateObject<McpttFloorParticipantNull>());
+    call->SetCallId(callId);
+    m_app->AddCall(call);
+
+    return call;
+}
+
+void
+McpttPttAppCallsTestCase::DoSetup()
+{
+    // The application is never started, the calls are only added to it
+    Ptr<Node> node = CreateObject<Node>();
+    m_app = CreateObject<McpttPttApp>();
+    node->AddApplication(m_app);
+}
+
+void
+McpttPttAppCallsTestCase::DoTeardown()
+{
+    m_app = nullptr;
+    Simulator::Destroy();
+}
+
+McpttPttAppGetCallTest::McpttPttAppGetCallTest()
+    : McpttPttAppCallsTestCase("GetCall")
+{
+}
+
+void
+McpttPttAppGetCallTest::DoRun()
+{
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(0), nullptr, "A call was found without calls.");
+
+    Ptr<McpttCall> call5 = AddCall(CreateObject<McpttCallMachineNull>(), 5);
+    Ptr<McpttCall> call2 = AddCall(CreateObject<McpttCallMachineNull>(), 2);
+    Ptr<McpttCall> call9 = AddCall(CreateObject<McpttCallMachineNull>(), 9);
+
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(2), call2, "Call 2 was not found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(5), call5, "Call 5 was not found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(9), call9, "Call 9 was not found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(0), nullptr, "Call 0 was found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(3), nullptr, "Call 3 was found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(10), nullptr, "Call 10 was found.");
+
+    // As with a map, the call first added with an ID is kept
+    AddCall(CreateObject<McpttCallMachineNull>(), 5);
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(5), call5, "Call 5 was replaced.");
+
+    const McpttPttApp::CallTable& calls = m_app->GetCalls();
+    NS_TEST_ASSERT_MSG_EQ(calls.size(), 3, "The calls were not all kept once.");
+    NS_TEST_ASSERT_MSG_EQ(calls[0].first, 2, "The calls are not ordered by call ID.");
+    NS_TEST_ASSERT_MSG_EQ(calls[1].first, 5, "The calls are not ordered by call ID.");
+    NS_TEST_ASSERT_MSG_EQ(calls[2].first, 9, "The calls are not ordered by call ID.");
+
+    m_app->RecycleCall(5);
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(5), nullptr, "Call 5 was found once recycled.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->GetCall(9), call9, "Call 9 was not found.");
+}
+
+McpttPttAppHasGrpCallForTest::McpttPttAppHasGrpCallForTest()
+    : McpttPttAppCallsTestCase("HasGrpCallFor")
+{
+}
+
+void
+McpttPttAppHasGrpCallForTest::DoRun()
+{
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(0), false, "A group call was found without calls.");
+
+    AddCall(CreateObject<McpttCallMachineNull>(), 0);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(0),
+                          false,
+                          "A call that is not a group call was found.");
+
+    // The calls are found as soon as they are added, before they are started
+    Ptr<McpttCallMachine> callMachine =
+        CreateObjectWithAttributes<McpttCallMachineGrpBasic>("GroupId", UintegerValue(1));
+    AddCall(callMachine, 1);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(0), true, "No group call was found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(1), true, "The call of group 1 was not found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(2), false, "A call of group 2 was found.");
+
+    // The group ID of a call can change after the call is added
+    callMachine->SetAttribute("GroupId", UintegerValue(2));
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(1), false, "The old group of the call was kept.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(2), true, "The call of group 2 was not found.");
+
+    AddCall(CreateObjectWithAttributes<McpttCallMachineGrpBasic>("GroupId", UintegerValue(2)), 2);
+    m_app->RecycleCall(1);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(2),
+                          true,
+                          "The other call of group 2 was not found.");
+    m_app->RecycleCall(2);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(2), false, "A recycled call was found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasGrpCallFor(0), false, "A recycled call was found.");
+}
+
+McpttPttAppHasPrivateCallForTest::McpttPttAppHasPrivateCallForTest()
+    : McpttPttAppCallsTestCase("HasPrivateCallFor")
+{
+}
+
+void
+McpttPttAppHasPrivateCallForTest::DoRun()
+{
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(7),
+                          false,
+                          "A private call was found without calls.");
+
+    AddCall(CreateObjectWithAttributes<McpttCallMachineGrpBasic>("GroupId", UintegerValue(7)), 0);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(7), false, "A group call was found.");
+
+    // The peer of a private call may be set after the call is added
+    Ptr<TestPrivateCallMachine> callMachine = CreateObject<TestPrivateCallMachine>();
+    AddCall(callMachine, 1);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(7), false, "A call with user 7 was found.");
+    callMachine->SetPeerUserId(7);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(7), true, "The call with user 7 was not found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(8), false, "A call with user 8 was found.");
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(0), true, "No private call was found.");
+
+    m_app->RecycleCall(1);
+    NS_TEST_ASSERT_MSG_EQ(m_app->HasPrivateCallFor(7), false, "A recycled call was found.");
+}
+
+McpttPttAppCallsTestSuite::McpttPttAppCallsTestSuite()
+    : TestSuite("mcptt-ptt-app-calls", TestSuite::Type::UNIT)
+{
+    AddTestCase(new McpttPttAppGetCallTest(), TestCase::Duration::QUICK);
+    AddTestCase(new McpttPttAppHasGrpCallForTest(), TestCase::Duration::QUICK);
+    AddTestCase(new McpttPttAppHasPrivateCallForTest(), TestCase::Duration::QUICK);
+}
+
+} // namespace tests
+} // namespace psc
+} // namespace ns3
@@ -0,0 +1,317 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+/**
+ * \file psc-cdf-random-variable-test.cc
+ * \ingroup psc-tests
+ *
+ * PscCdfTable/PscCdfRandomVariable test suite
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/log.h>
+#include <ns3/psc-module.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("PscCdfRandomVariableTestSuite");
+
+/**
+ * \ingroup psc-tests
+ * \defgroup psc-cdf-random-variable-tests Tests for PscCdfRandomVariable
+ */
+
+namespace ns3
+{
+namespace tests
+{
+
+using psc::McpttPusherOrchestratorSessionCdf;
+using psc::McpttPusherOrchestratorSpurtCdf;
+using psc::PscCdfRandomVariable;
+using psc::PscCdfTable;
+using psc::PscVideoStreamingDistributions;
+
+/**
+ * \ingroup psc-cdf-random-variable-tests
+ * Checks the values returned by a table for known probabilities
+ */
+class PscCdfTableTestCase : public TestCase
+{
+  public:
+    PscCdfTableTestCase();
+    void DoRun() override;
+};
+
+PscCdfTableTestCase::PscCdfTableTestCase()
+    : TestCase("PSC CDF Random Variable Test Case - Table lookup")
+{
+}
+
+void
+PscCdfTableTestCase::DoRun()
+{
+    // Unsorted, with a duplicated probability (the last one must be kept)
+    std::vector<std::pair<double, double>> points = {{30, 1.0},
+                                                     {10, 0.25},
+                                                     {20, 0.5},
+                                                     {25, 0.5},
+                                                     {5, 0.1}};
+    Ptr<PscCdfTable> table = Create<PscCdfTable>(points);
+
+    NS_TEST_ASSERT_MSG_EQ(table->GetSize(), 4, "Duplicated probability was not removed");
+    NS_TEST_ASSERT_MSG_EQ(table->GetMin(), 5, "Unexpected minimum value");
+    NS_TEST_ASSERT_MSG_EQ(table->GetMax(), 30, "Unexpected maximum value");
+
+    // Below the first and above the last probability
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(0.0, true), 5, "Unexpected value below the first point");
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(0.1, false), 5, "Unexpected value at the first point");
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(1.0, true), 30, "Unexpected value at the last point");
+
+    // Without interpolation the value of the first point above is returned
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(0.2, false), 10, "Unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(0.25, false), 25, "Unexpected value at a point");
+    NS_TEST_ASSERT_MSG_EQ(table->Sample(0.75, false), 30, "Unexpected value");
+
+    // With interpolation
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->Sample(0.175, true), 7.5, 1e-9, "Unexpected value");
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->Sample(0.25, true), 10, 1e-9, "Unexpected value at a point");
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->Sample(0.75, true), 27.5, 1e-9, "Unexpected value");
+}
+
+/**
+ * \ingroup psc-cdf-random-variable-tests
+ * Compares the distribution of the values generated by a
+ * PscCdfRandomVariable with the ones of an EmpiricalRandomVariable built from
+ * the same CDF points
+ */
+class PscCdfRandomVariableDistributionTestCase : public TestCase
+{
+  public:
+    PscCdfRandomVariableDistributionTestCase(const std::string& name,
+                                             const std::vector<std::pair<double, double>>& points,
+                                             bool interpolate);
+    void DoRun() override;
+
+  private:
+    /**
+     * Draws samples from a random variable and sorts them.
+     * \param rv The random variable.
+     * \returns The sorted samples.
+     */
+    std::vector<double> Draw(Ptr<RandomVariableStream> rv) const;
+
+    std::vector<std::pair<double, double>> m_points; //!< The CDF points (value, probability).
+    bool m_interpolate;                              //!< The interpolation mode.
+    static const uint32_t SAMPLES = 100000;          //!< The number of samples drawn.
+};
+
+PscCdfRandomVariableDistributionTestCase::PscCdfRandomVariableDistributionTestCase(
+    const std::string& name,
+    const std::vector<std::pair<double, double>>& points,
+    bool interpolate)
+    : TestCase("PSC CDF Random Variable Test Case - Distribution " + name),
+      m_points(points),
+      m_interpolate(interpolate)
+{
+}
+
+std::vector<double>
+PscCdfRandomVariableDistributionTestCase::Draw(Ptr<RandomVariableStream> rv) const
+{
+    std::vector<double> samples(SAMPLES);
+    for (auto& sample : samples)
+    {
+        sample = rv->GetValue();
+    }
+    std::sort(samples.begin(), samples.end());
+
+    return samples;
+}
+
+void
+PscCdfRandomVariableDistributionTestCase::DoRun()
+{
+    Ptr<EmpiricalRandomVariable> erv = CreateObject<EmpiricalRandomVariable>();
+    erv->SetInterpolate(m_interpolate);
+    Ptr<PscCdfRandomVariable> crv = CreateObject<PscCdfRandomVariable>();
+    crv->SetInterpolate(m_interpolate);
+    for (const auto& point : m_points)
+    {
+        erv->CDF(point.first, point.second);
+        crv->CDF(point.first, point.second);
+    }
+    erv->SetStream(1);
+    crv->SetStream(2);
+
+    std::vector<double> expected = Draw(erv);
+    std::vector<double> actual = Draw(crv);
+
+    double range = crv->GetTable()->GetMax() - crv->GetTable()->GetMin();
+    for (auto quantile : {0.05, 0.25, 0.5, 0.75, 0.95})
+    {
+        auto index = static_cast<std::size_t>(quantile * SAMPLES);
+        NS_TEST_ASSERT_MSG_EQ_TOL(actual[index],
+                                  expected[index],
+                                  0.02 * range,
+                                  "Quantile " << quantile << " differs");
+    }
+
+    double expectedSum = 0;
+    double actualSum = 0;
+    for (uint32_t i = 0; i < SAMPLES; i++)
+    {
+        expectedSum += expected[i];
+        actualSum += actual[i];
+    }
+    NS_TEST_ASSERT_MSG_EQ_TOL(actualSum / SAMPLES,
+                              expectedSum / SAMPLES,
+                              0.02 * expectedSum / SAMPLES,
+                              "Mean differs");
+
+    // With the same stream both variables see the same uniform draws and must
+    // produce the same values
+    erv->SetStream(3);
+    crv->SetStream(3);
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(crv->GetValue(),
+                                  erv->GetValue(),
+                                  1e-9,
+                                  "Values differ for the same uniform draw");
+    }
+}
+
+/**
+ * \ingroup psc-cdf-random-variable-tests
+ * Checks that variables sharing a table only share the table, and that the
+ * values generated are determined by the stream assigned
+ */
+class PscCdfRandomVariableStreamTestCase : public TestCase
+{
+  public:
+    PscCdfRandomVariableStreamTestCase();
+    void DoRun() override;
+};
+
+PscCdfRandomVariableStreamTestCase::PscCdfRandomVariableStreamTestCase()
+    : TestCase("PSC CDF Random Variable Test Case - Streams")
+{
+}
+
+void
+PscCdfRandomVariableStreamTestCase::DoRun()
+{
+    Ptr<const PscCdfTable> table = Create<PscCdfTable>(McpttPusherOrchestratorSpurtCdf::CDF_POINTS);
+
+    Ptr<PscCdfRandomVariable> first = CreateObject<PscCdfRandomVariable>();
+    Ptr<PscCdfRandomVariable> second = CreateObject<PscCdfRandomVariable>();
+    Ptr<PscCdfRandomVariable> third = CreateObject<PscCdfRandomVariable>();
+    first->SetTable(table);
+    second->SetTable(table);
+    third->SetTable(table);
+    first->SetStream(10);
+    second->SetStream(10);
+    third->SetStream(11);
+
+    NS_TEST_ASSERT_MSG_EQ(first->GetTable(), table, "Table is not shared");
+
+    bool different = false;
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        double value = first->GetValue();
+        NS_TEST_ASSERT_MSG_EQ(second->GetValue(), value, "Same stream must give same values");
+        different |= (third->GetValue() != value);
+    }
+    NS_TEST_ASSERT_MSG_EQ(different, true, "Different streams must give different values");
+}
+
+/**
+ * Converts a distribution map into (value, probability) pairs.
+ * \param distribution The distribution.
+ * \returns The CDF points.
+ */
+template <typename T>
+std::vector<std::pair<double, double>>
+ToPoints(const std::map<double, T>& distribution)
+{
+    std::vector<std::pair<double, double>> points;
+    for (const auto& entry : distribution)
+    {
+        points.emplace_back(entry.second, entry.first);
+    }
+
+    return points;
+}
+
+/**
+ * \ingroup psc-cdf-random-variable-tests
+ */
+class PscCdfRandomVariableTestSuite : public TestSuite
+{
+  public:
+    PscCdfRandomVariableTestSuite();
+};
+
+PscCdfRandomVariableTestSuite::PscCdfRandomVariableTestSuite()
+    : TestSuite("psc-cdf-random-variable", TestSuite::Type::UNIT)
+{
+    AddTestCase(new PscCdfTableTestCase());
+    AddTestCase(
+        new PscCdfRandomVariableDistributionTestCase("spurt",
+                                                     McpttPusherOrchestratorSpurtCdf::CDF_POINTS,
+                                                     true));
+    AddTestCase(
+        new PscCdfRandomVariableDistributionTestCase("session",
+                                                     McpttPusherOrchestratorSessionCdf::CDF_POINTS,
+                                                     false));
+    AddTestCase(new PscCdfRandomVariableDistributionTestCase(
+        "1080p-bright size",
+        ToPoints(PscVideoStreamingDistributions::GetSizeDistribution("1080p-bright")),
+        true));
+    AddTestCase(new PscCdfRandomVariableDistributionTestCase(
+        "720p-dark interval",
+        ToPoints(PscVideoStreamingDistributions::GetIntervalDistribution("720p-dark")),
+        true));
+    AddTestCase(new PscCdfRandomVariableStreamTestCase());
+}
+
+/**
+ * \ingroup psc-cdf-random-variable-tests
+ */
+static PscCdfRandomVariableTestSuite g_pscCdfRandomVariableTestSuite;
+
+} // namespace tests
+} // namespace ns3
@@ -0,0 +1,705 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+/**
+ * \file psc-performance-test.cc
+ * \ingroup psc-tests
+ *
+ * Performance test suite for the MCPTT, video streaming, HTTP and UAV models.
+ *
+ * Each test case runs a large scenario and records the wall-clock time of
+ * the simulation, the number of events and the events per second it ran, and
+ * the peak resident set size of the process during the simulation. The
+ * results are compared with the committed baseline
+ * (test/psc-performance-baseline.json), and a test case fails if it runs
+ * more events than its baseline by more than the tolerance (25% by default).
+ * A test case with no number of events in the baseline is not compared,
+ * only recorded, until its results are copied to the baseline. The number of events
+ * does not depend on the machine, unlike the other figures, so the wall-clock
+ * time, events per second and peak resident set size are only checked in
+ * the same way when the baseline has them.
+ *
+ * The results of all the test cases run so far are written to
+ * psc-performance-results.json, in the temporary directory of each test case
+ * and in the same format as the baseline, so that they can be tracked over
+ * time, and copied over the baseline to refresh it after an intended change
+ * or on a new reference machine. The following environment variables
+ * override the defaults:
+ *
+ * - PSC_PERFORMANCE_BASELINE: the baseline file
+ * - PSC_PERFORMANCE_RESULTS: the results file
+ * - PSC_PERFORMANCE_TOLERANCE: the tolerance, as a fraction of the baseline
+ *
+ * The wall-clock times and events per second of the baseline are only
+ * meaningful on the machine where they were recorded.
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/csma-module.h>
+#include <ns3/energy-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/mobility-module.h>
+#include <ns3/network-module.h>
+#include <ns3/psc-module.h>
+#include <ns3/system-wall-clock-ms.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("PscPerformanceTestSuite");
+
+/**
+ * \ingroup psc-tests
+ * \defgroup psc-performance-tests Performance tests for the PSC models
+ */
+
+namespace ns3
+{
+namespace tests
+{
+
+using namespace psc;
+
+/**
+ * \ingroup psc-performance-tests
+ * Performance figures of one test case
+ */
+struct PscPerformanceResult
+{
+    std::string id;            //!< Identifier of the test case
+    double wallSeconds{0};     //!< Wall-clock time of the simulation
+    uint64_t events{0};        //!< Number of events executed
+    double eventsPerSecond{0}; //!< Events executed per wall-clock second
+    uint64_t peakRssKb{0};     //!< Peak resident set size, 0 if unknown
+};
+
+/**
+ * \ingroup psc-performance-tests
+ * Gets a setting from the environment
+ * \param name The name of the environment variable
+ * \param defaultValue The value to use if the variable is not set
+ * \returns The setting
+ */
+static std::string
+GetPerformanceSetting(const std::string& name, const std::string& defaultValue)
+{
+    const char* value = std::getenv(name.c_str());
+    return value ? std::string(value) : defaultValue;
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Serializes a result as a one-line JSON object
+ * \param result The result
+ * \returns The JSON object
+ */
+static std::string
+ToJson(const PscPerformanceResult& result)
+{
+    std::ostringstream out;
+    out << "{\"id\": \"" << result.id << "\", \"wallSeconds\": " << result.wallSeconds
+        << ", \"events\": " << result.events << ", \"eventsPerSecond\": " << result.eventsPerSecond
+        << ", \"peakRssKb\": " << result.peakRssKb << "}";
+    return out.str();
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Reads a number from a one-line JSON object written by ToJson
+ * \param line The JSON object
+ * \param key The key of the number
+ * \param value The number read
+ * \returns True if the key was found
+ */
+static bool
+ReadJsonNumber(const std::string& line, const std::string& key, double& value)
+{
+    std::string pattern = "\"" + key + "\": ";
+    auto pos = line.find(pattern);
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+    value = std::strtod(line.c_str() + pos + pattern.size(), nullptr);
+    return true;
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Looks up the baseline of a test case. The file is expected to have one
+ * result per line, as written by the test suite, and the figures missing
+ * from the line of the test case are left at zero.
+ * \param filename The baseline file
+ * \param id The identifier of the test case
+ * \param baseline The baseline found
+ * \returns True if the test case has a baseline
+ */
+static bool
+ReadBaseline(const std::string& filename, const std::string& id, PscPerformanceResult& baseline)
+{
+    std::ifstream in(filename);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.find("\"id\": \"" + id + "\"") == std::string::npos)
+        {
+            continue;
+        }
+        double events = 0;
+        double peakRssKb = 0;
+        baseline.id = id;
+        ReadJsonNumber(line, "wallSeconds", baseline.wallSeconds);
+        ReadJsonNumber(line, "events", events);
+        ReadJsonNumber(line, "eventsPerSecond", baseline.eventsPerSecond);
+        ReadJsonNumber(line, "peakRssKb", peakRssKb);
+        baseline.events = static_cast<uint64_t>(events);
+        baseline.peakRssKb = static_cast<uint64_t>(peakRssKb);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Resets the peak resident set size of the process, where supported (Linux)
+ */
+static void
+ResetPeakRss()
+{
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Gets the peak resident set size of the process since the last reset
+ * \returns The peak resident set size, in kB, or 0 if it is not supported
+ */
+static uint64_t
+GetPeakRssKb()
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind("VmHWM:", 0) == 0)
+        {
+            return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+    }
+#endif
+    return 0;
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Base class of the performance test cases. Derived classes build their
+ * scenario in BuildScenario, and this class runs it, measures it, and checks
+ * it against the baseline.
+ */
+class PscPerformanceTestCase : public TestCase
+{
+  public:
+    /**
+     * Creates a performance test case
+     * \param id The identifier of the test case in the baseline and results
+     * \param description The description of the test case
+     * \param stopTime The simulation time to run the scenario for
+     */
+    PscPerformanceTestCase(const std::string& id, const std::string& description, Time stopTime);
+
+  protected:
+    /**
+     * Builds the scenario to measure
+     */
+    virtual void BuildScenario() = 0;
+
+  private:
+    void DoRun() override;
+
+    std::string m_id; //!< Identifier of the test case
+    Time m_stopTime;  //!< Simulation time to run the scenario for
+
+    static std::vector<PscPerformanceResult> s_results; //!< Results of the test cases run
+};
+
+std::vector<PscPerformanceResult> PscPerformanceTestCase::s_results;
+
+PscPerformanceTestCase::PscPerformanceTestCase(const std::string& id,
+                                               const std::string& description,
+                                               Time stopTime)
+    : TestCase("PSC Performance Test Case - " + description),
+      m_id(id),
+      m_stopTime(stopTime)
+{
+}
+
+void
+PscPerformanceTestCase::DoRun()
+{
+    SetDataDir(NS_TEST_SOURCEDIR);
+
+    BuildScenario();
+
+    ResetPeakRss();
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Stop(m_stopTime);
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    PscPerformanceResult result;
+    result.id = m_id;
+    result.wallSeconds = elapsedMs / 1000.0;
+    result.events = Simulator::GetEventCount();
+    result.eventsPerSecond = result.events / std::max(result.wallSeconds, 0.001);
+    result.peakRssKb = GetPeakRssKb();
+    Simulator::Destroy();
+
+    NS_LOG_INFO(ToJson(result));
+    NS_TEST_ASSERT_MSG_GT(result.events, 0, "The scenario did not run any event");
+
+    // Rewrite the whole file, so that it is complete whichever test cases are run
+    s_results.push_back(result);
+    std::ofstream out(
+        GetPerformanceSetting("PSC_PERFORMANCE_RESULTS",
+                              CreateTempDirFilename("psc-performance-results.json")));
+    out << "{\n  \"suite\": \"psc-performance\",\n  \"results\": [\n";
+    for (size_t i = 0; i < s_results.size(); i++)
+    {
+        out << "    " << ToJson(s_results[i]) << (i + 1 < s_results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    out.close();
+
+    PscPerformanceResult baseline;
+    std::string baselineFile =
+        GetPerformanceSetting("PSC_PERFORMANCE_BASELINE",
+                              CreateDataDirFilename("psc-performance-baseline.json"));
+    if (!ReadBaseline(baselineFile, m_id, baseline) || baseline.events == 0)
+    {
+        // Nothing to compare with until the results are recorded in the baseline
+        NS_LOG_WARN("No number of events for " << m_id << " in " << baselineFile
+                                               << ", skipping the comparison");
+        return;
+    }
+
+    double tolerance = std::stod(GetPerformanceSetting("PSC_PERFORMANCE_TOLERANCE", "0.25"));
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(result.events,
+                                baseline.events * (1 + tolerance),
+                                "Number of events above the baseline of " << m_id);
+    // The other figures depend on the machine, so they are only checked
+    // when they were recorded on this one
+    if (baseline.wallSeconds > 0)
+    {
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(result.wallSeconds,
+                                    baseline.wallSeconds * (1 + tolerance),
+                                    "Wall-clock time above the baseline of " << m_id);
+    }
+    if (baseline.eventsPerSecond > 0)
+    {
+        NS_TEST_EXPECT_MSG_GT_OR_EQ(result.eventsPerSecond,
+                                    baseline.eventsPerSecond / (1 + tolerance),
+                                    "Events per second below the baseline of " << m_id);
+    }
+    if (result.peakRssKb > 0 && baseline.peakRssKb > 0)
+    {
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(result.peakRssKb,
+                                    baseline.peakRssKb * (1 + tolerance),
+                                    "Peak RSS above the baseline of " << m_id);
+    }
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Installs the MCPTT clients of a group on nodes, with automatic pushers
+ * \param nodes The nodes
+ * \param start The start time of the applications
+ * \param stop The stop time of the applications
+ * \returns The applications
+ */
+static ApplicationContainer
+InstallMcpttClients(NodeContainer& nodes, Time start, Time stop)
+{
+    McpttHelper helper;
+    helper.SetPttApp("ns3::psc::McpttPttApp", "PushOnStart", BooleanValue(false));
+    helper.SetMediaSrc("ns3::psc::McpttMediaSrc",
+                       "Bytes",
+                       UintegerValue(60),
+                       "DataRate",
+                       DataRateValue(DataRate("24kb/s")));
+    helper.SetPusher("ns3::psc::McpttPusher", "Automatic", BooleanValue(true));
+    helper.SetPusherPttInterarrivalTimeVariable("ns3::NormalRandomVariable",
+                                                "Mean",
+                                                DoubleValue(5.0),
+                                                "Variance",
+                                                DoubleValue(2.0));
+    helper.SetPusherPttDurationVariable("ns3::NormalRandomVariable",
+                                        "Mean",
+                                        DoubleValue(5.0),
+                                        "Variance",
+                                        DoubleValue(2.0));
+    ApplicationContainer apps = helper.Install(nodes);
+    apps.Start(start);
+    apps.Stop(stop);
+    return apps;
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Builds a CSMA LAN with an IPv4 stack between nodes
+ * \param nodes The nodes
+ * \param dataRate The data rate of the LAN
+ * \returns The interfaces of the nodes
+ */
+static Ipv4InterfaceContainer
+BuildLan(NodeContainer& nodes, const std::string& dataRate)
+{
+    CsmaHelper csma;
+    csma.SetChannelAttribute("DataRate", StringValue(dataRate));
+    csma.SetChannelAttribute("Delay", TimeValue(MicroSeconds(1)));
+    NetDeviceContainer devices = csma.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.0.0", "255.255.0.0");
+    return address.Assign(devices);
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * A large on-network group call, with the users and the server on one LAN
+ */
+class PscPerformanceTestCaseMcpttOnNetwork : public PscPerformanceTestCase
+{
+    const uint32_t USERS{200};
+    const Time START{Seconds(2)};
+    const Time STOP{Seconds(62)};
+
+  public:
+    PscPerformanceTestCaseMcpttOnNetwork();
+
+  protected:
+    void BuildScenario() override;
+
+  private:
+    NodeContainer m_nodes; //!< The server (first) and the users
+};
+
+PscPerformanceTestCaseMcpttOnNetwork::PscPerformanceTestCaseMcpttOnNetwork()
+    : PscPerformanceTestCase("mcptt-on-network-group-call",
+                             "MCPTT on-network group call of 200 users",
+                             Seconds(64))
+{
+}
+
+void
+PscPerformanceTestCaseMcpttOnNetwork::BuildScenario()
+{
+    m_nodes.Create(USERS + 1);
+    Ipv4InterfaceContainer interfaces = BuildLan(m_nodes, "100Mbps");
+
+    McpttServerHelper serverHelper;
+    Ptr<McpttServerApp> serverApp = serverHelper.Install(m_nodes.Get(0));
+    serverApp->SetLocalAddress(interfaces.GetAddress(0));
+    serverApp->SetStartTime(START);
+    serverApp->SetStopTime(STOP);
+
+    NodeContainer users;
+    for (uint32_t i = 1; i <= USERS; i++)
+    {
+        users.Add(m_nodes.Get(i));
+    }
+    ApplicationContainer clientApps = InstallMcpttClients(users, START, STOP);
+    for (uint32_t i = 0; i < clientApps.GetN(); i++)
+    {
+        DynamicCast<McpttPttApp>(clientApps.Get(i))->SetLocalAddress(interfaces.GetAddress(i + 1));
+    }
+
+    McpttCallHelper callHelper;
+    callHelper.SetArbitrator("ns3::psc::McpttOnNetworkFloorArbitrator",
+                             "AckRequired",
+                             BooleanValue(false),
+                             "AudioCutIn",
+                             BooleanValue(false),
+                             "DualFloorSupported",
+                             BooleanValue(false),
+                             "QueueingSupported",
+                             BooleanValue(true));
+    callHelper.SetTowardsParticipant("ns3::psc::McpttOnNetworkFloorTowardsParticipant",
+                                     "ReceiveOnly",
+                                     BooleanValue(false));
+    callHelper.SetParticipant("ns3::psc::McpttOnNetworkFloorParticipant",
+                              "AckRequired",
+                              BooleanValue(false),
+                              "GenMedia",
+                              BooleanValue(true));
+    callHelper.SetServerCall("ns3::psc::McpttServerCall",
+                             "AmbientListening",
+                             BooleanValue(false),
+                             "TemporaryGroup",
+                             BooleanValue(false));
+    callHelper.AddCall(clientApps,
+                       serverApp,
+                       1,
+                       McpttCallMsgFieldCallType::BASIC_GROUP,
+                       START,
+                       STOP);
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * A large off-network group call on a broadcast LAN
+ */
+class PscPerformanceTestCaseMcpttOffNetwork : public PscPerformanceTestCase
+{
+    const uint32_t USERS{200};
+    const Time START{Seconds(2)};
+    const Time STOP{Seconds(62)};
+
+  public:
+    PscPerformanceTestCaseMcpttOffNetwork();
+
+  protected:
+    void BuildScenario() override;
+
+  private:
+    NodeContainer m_nodes; //!< The users
+};
+
+PscPerformanceTestCaseMcpttOffNetwork::PscPerformanceTestCaseMcpttOffNetwork()
+    : PscPerformanceTestCase("mcptt-off-network-group-call",
+                             "MCPTT off-network group call of 200 users",
+                             Seconds(64))
+{
+}
+
+void
+PscPerformanceTestCaseMcpttOffNetwork::BuildScenario()
+{
+    m_nodes.Create(USERS);
+    BuildLan(m_nodes, "100Mbps");
+
+    ApplicationContainer clientApps = InstallMcpttClients(m_nodes, START, STOP);
+
+    McpttCallHelper callHelper;
+    callHelper.ConfigureOffNetworkBasicGrpCall(clientApps, Ipv4Address("255.255.255.255"), USERS);
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Many video streams sent to a single receiver
+ */
+class PscPerformanceTestCaseVideoFanIn : public PscPerformanceTestCase
+{
+    const uint32_t SENDERS{50};
+    const Time START{Seconds(1)};
+    const Time STOP{Seconds(31)};
+
+  public:
+    PscPerformanceTestCaseVideoFanIn();
+
+  protected:
+    void BuildScenario() override;
+
+  private:
+    NodeContainer m_nodes; //!< The receiver (first) and the senders
+};
+
+PscPerformanceTestCaseVideoFanIn::PscPerformanceTestCaseVideoFanIn()
+    : PscPerformanceTestCase("video-streaming-fan-in",
+                             "Video streaming from 50 senders to one receiver",
+                             Seconds(32))
+{
+}
+
+void
+PscPerformanceTestCaseVideoFanIn::BuildScenario()
+{
+    m_nodes.Create(SENDERS + 1);
+    Ipv4InterfaceContainer interfaces = BuildLan(m_nodes, "10Gbps");
+
+    Ptr<PscVideoStreamingReceiver> receiver = CreateObject<PscVideoStreamingReceiver>();
+    receiver->SetStartTime(Seconds(0));
+    receiver->SetStopTime(STOP + Seconds(1));
+    m_nodes.Get(0)->AddApplication(receiver);
+
+    for (uint32_t i = 1; i <= SENDERS; i++)
+    {
+        Ptr<PscVideoStreaming> sender = CreateObject<PscVideoStreaming>();
+        sender->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(0)));
+        sender->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+        sender->SetStartTime(START);
+        sender->SetStopTime(STOP);
+        m_nodes.Get(i)->AddApplication(sender);
+    }
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * Many HTTP clients loading pages from a single server
+ */
+class PscPerformanceTestCaseHttpLoad : public PscPerformanceTestCase
+{
+    const uint32_t CLIENTS{100};
+    const Time START{Seconds(1)};
+    const Time STOP{Seconds(301)};
+
+  public:
+    PscPerformanceTestCaseHttpLoad();
+
+  protected:
+    void BuildScenario() override;
+
+  private:
+    NodeContainer m_nodes; //!< The server (first) and the clients
+};
+
+PscPerformanceTestCaseHttpLoad::PscPerformanceTestCaseHttpLoad()
+    : PscPerformanceTestCase("intel-http-load",
+                             "Intel HTTP load of 100 clients on one server",
+                             Seconds(302))
+{
+}
+
+void
+PscPerformanceTestCaseHttpLoad::BuildScenario()
+{
+    m_nodes.Create(CLIENTS + 1);
+    Ipv4InterfaceContainer interfaces = BuildLan(m_nodes, "1Gbps");
+
+    IntelHttpServerHelper serverHelper;
+    ApplicationContainer serverApps = serverHelper.Install(m_nodes.Get(0));
+    serverApps.Start(Seconds(0));
+    serverApps.Stop(STOP);
+
+    NodeContainer clients;
+    for (uint32_t i = 1; i <= CLIENTS; i++)
+    {
+        clients.Add(m_nodes.Get(i));
+    }
+    IntelHttpClientHelper clientHelper(interfaces.GetAddress(0));
+    ApplicationContainer clientApps = clientHelper.Install(clients);
+    clientApps.Start(START);
+    clientApps.Stop(STOP);
+}
+
+/**
+ * \ingroup psc-performance-tests
+ * A fleet of UAVs changing course every second, with the mobility energy model
+ */
+class PscPerformanceTestCaseUavFleet : public PscPerformanceTestCase
+{
+    const uint32_t UAVS{1000};
+    const uint32_t COURSE_CHANGES{600};
+
+  public:
+    PscPerformanceTestCaseUavFleet();
+
+  protected:
+    void BuildScenario() override;
+
+  private:
+    NodeContainer m_nodes; //!< The UAVs
+};
+
+PscPerformanceTestCaseUavFleet::PscPerformanceTestCaseUavFleet()
+    : PscPerformanceTestCase("uav-fleet", "Fleet of 1000 UAVs", Seconds(601))
+{
+}
+
+void
+PscPerformanceTestCaseUavFleet::BuildScenario()
+{
+    // Climb, cruise, hover and descend, in turns
+    const std::vector<Vector> velocities{{0, 0, 1}, {5, 0, 0}, {0, 0, 0}, {0, 0, -1}};
+
+    m_nodes.Create(UAVS);
+
+    UavMobilityEnergyModelHelper helper;
+    helper.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+    helper.SetEnergySource("ns3::BasicEnergySource",
+                           "BasicEnergySourceInitialEnergyJ",
+                           DoubleValue(1e6));
+    helper.Install(m_nodes);
+
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        Ptr<ConstantVelocityMobilityModel> mobility =
+            m_nodes.Get(i)->GetObject<ConstantVelocityMobilityModel>();
+        for (uint32_t t = 0; t < COURSE_CHANGES; t++)
+        {
+            // Spread the UAVs over the second
+            Simulator::Schedule(Seconds(t) + MicroSeconds(i),
+                                &ConstantVelocityMobilityModel::SetVelocity,
+                                mobility,
+                                velocities[(t + i) % velocities.size()]);
+        }
+    }
+}
+
+/**
+ * \ingroup psc-performance-tests
+ */
+class PscPerformanceTestSuite : public TestSuite
+{
+  public:
+    PscPerformanceTestSuite();
+};
+
+PscPerformanceTestSuite::PscPerformanceTestSuite()
+    : TestSuite("psc-performance", TestSuite::Type::PERFORMANCE)
+{
+    AddTestCase(new PscPerformanceTestCaseMcpttOnNetwork(), TestCase::Duration::EXTENSIVE);
+    AddTestCase(new PscPerformanceTestCaseMcpttOffNetwork(), TestCase::Duration::EXTENSIVE);
+    AddTestCase(new PscPerformanceTestCaseVideoFanIn(), TestCase::Duration::EXTENSIVE);
+    AddTestCase(new PscPerformanceTestCaseHttpLoad(), TestCase::Duration::EXTENSIVE);
+    AddTestCase(new PscPerformanceTestCaseUavFleet(), TestCase::Duration::EXTENSIVE);
+}
+
+/**
+ * \ingroup psc-performance-tests
+ */
+static PscPerformanceTestSuite g_pscPerformanceTestSuite;
+
+} // namespace tests
+} // namespace ns3
@@ -0,0 +1,803 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+/**
+ * \file psc-video-streaming-test.cc
+ * \ingroup psc-tests
+ *
+ * PscVideoStreaming test suite
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/log.h>
+#include <ns3/network-module.h>
+#include <ns3/point-to-point-module.h>
+#include <ns3/psc-module.h>
+#include <ns3/test.h>
+
+#include <fstream>
+#include <list>
+#include <set>
+
+NS_LOG_COMPONENT_DEFINE("PscVideoStreamingTestSuite");
+
+/**
+ * \ingroup psc-tests
+ * \defgroup psc-video-streaming-tests Tests for PscVideoStreaming
+ */
+
+namespace ns3
+{
+namespace tests
+{
+
+using psc::PscVideoFrameTrace;
+using psc::PscVideoStreaming;
+using psc::PscVideoStreamingDistribution;
+using psc::PscVideoStreamingDistributions;
+using psc::PscVideoStreamingReceiver;
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that built-in distributions and their tables are built once and shared
+ */
+class PscVideoStreamingTestCaseSharedDistribution : public TestCase
+{
+  public:
+    PscVideoStreamingTestCaseSharedDistribution();
+    void DoRun() override;
+};
+
+PscVideoStreamingTestCaseSharedDistribution::PscVideoStreamingTestCaseSharedDistribution()
+    : TestCase("PSC Video Streaming Test Case - Shared built-in distribution")
+{
+}
+
+void
+PscVideoStreamingTestCaseSharedDistribution::DoRun()
+{
+    Ptr<const PscVideoStreamingDistribution> first =
+        PscVideoStreamingDistributions::Get("720p-dark");
+    Ptr<const PscVideoStreamingDistribution> second =
+        PscVideoStreamingDistributions::Get("720p-dark");
+    Ptr<const PscVideoStreamingDistribution> other =
+        PscVideoStreamingDistributions::Get("720p-bright");
+
+    NS_TEST_ASSERT_MSG_EQ(first, second, "Distribution is not shared");
+    NS_TEST_ASSERT_MSG_NE(first, other, "Different distributions must not be shared");
+
+    NS_TEST_ASSERT_MSG_EQ((first->GetSizeDistribution() ==
+                           PscVideoStreamingDistributions::GetSizeDistribution("720p-dark")),
+                          true,
+                          "Size distribution differs from the built-in one");
+    NS_TEST_ASSERT_MSG_EQ((first->GetIntervalDistribution() ==
+                           PscVideoStreamingDistributions::GetIntervalDistribution("720p-dark")),
+                          true,
+                          "Interval distribution differs from the built-in one");
+
+    PscVideoStreamingDistribution::Tables tables = first->GetTables(90);
+    PscVideoStreamingDistribution::Tables sameTables = second->GetTables(90);
+    PscVideoStreamingDistribution::Tables otherTables = first->GetTables(0);
+
+    NS_TEST_ASSERT_MSG_EQ(tables.size, sameTables.size, "Size table is not shared");
+    NS_TEST_ASSERT_MSG_EQ(tables.interval, sameTables.interval, "Interval table is not shared");
+    NS_TEST_ASSERT_MSG_EQ(tables.sizeBoost, sameTables.sizeBoost, "Boost table is not shared");
+    NS_TEST_ASSERT_MSG_EQ(tables.intervalBoost,
+                          sameTables.intervalBoost,
+                          "Boost table is not shared");
+    NS_TEST_ASSERT_MSG_NE(tables.sizeBoost,
+                          otherTables.sizeBoost,
+                          "Boost tables for different percentiles must not be shared");
+
+    // During boost only the top 10 % of the sizes can be drawn
+    NS_TEST_ASSERT_MSG_EQ_TOL(tables.sizeBoost->Sample(0, true),
+                              tables.size->Sample(0.9, true),
+                              1,
+                              "Unexpected smallest boost size");
+    NS_TEST_ASSERT_MSG_EQ(tables.sizeBoost->GetMax(),
+                          tables.size->GetMax(),
+                          "Unexpected largest boost size");
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that custom distribution files are read once and shared
+ */
+class PscVideoStreamingTestCaseSharedCustomDistribution : public TestCase
+{
+  public:
+    PscVideoStreamingTestCaseSharedCustomDistribution();
+    void DoRun() override;
+};
+
+PscVideoStreamingTestCaseSharedCustomDistribution::
+    PscVideoStreamingTestCaseSharedCustomDistribution()
+    : TestCase("PSC Video Streaming Test Case - Shared custom distribution")
+{
+}
+
+void
+PscVideoStreamingTestCaseSharedCustomDistribution::DoRun()
+{
+    std::string sizeFile = CreateTempDirFilename("size.txt");
+    std::string intervalFile = CreateTempDirFilename("interval.txt");
+
+    std::ofstream size(sizeFile);
+    size << "0.25\n100\n200\n300\n400\n500\n";
+    size.close();
+    std::ofstream interval(intervalFile);
+    interval << "0.5\n10.5\n20.5\n30.5\n";
+    interval.close();
+
+    Ptr<const PscVideoStreamingDistribution> first =
+        PscVideoStreamingDistributions::Load(sizeFile, intervalFile);
+    Ptr<const PscVideoStreamingDistribution> second =
+        PscVideoStreamingDistributions::Load(sizeFile, intervalFile);
+
+    NS_TEST_ASSERT_MSG_EQ(first, second, "Distribution is not shared");
+
+    std::map<double, uint32_t> expectedSize = {{0, 100},
+                                               {0.25, 200},
+                                               {0.5, 300},
+                                               {0.75, 400},
+                                               {1, 500}};
+    std::map<double, double> expectedInterval = {{0, 10.5}, {0.5, 20.5}, {1, 30.5}};
+    NS_TEST_ASSERT_MSG_EQ((first->GetSizeDistribution() == expectedSize),
+                          true,
+                          "Unexpected size distribution");
+    NS_TEST_ASSERT_MSG_EQ((first->GetIntervalDistribution() == expectedInterval),
+                          true,
+                          "Unexpected interval distribution");
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that CDF files converted to the binary format load the same
+ * distribution as the original text files
+ */
+class PscVideoStreamingTestCaseBinaryDistribution : public TestCase
+{
+  public:
+    PscVideoStreamingTestCaseBinaryDistribution();
+    void DoRun() override;
+};
+
+PscVideoStreamingTestCaseBinaryDistribution::PscVideoStreamingTestCaseBinaryDistribution()
+    : TestCase("PSC Video Streaming Test Case - Binary custom distribution")
+{
+}
+
+void
+PscVideoStreamingTestCaseBinaryDistribution::DoRun()
+{
+    std::string sizeFile = CreateTempDirFilename("size.txt");
+    std::string intervalFile = CreateTempDirFilename("interval.txt");
+    std::string sizeBinFile = CreateTempDirFilename("size.bin");
+    std::string intervalBinFile = CreateTempDirFilename("interval.bin");
+
+    // A step that is not exactly representable, to check that the
+    // probabilities are computed in the same way for both formats
+    std::ofstream size(sizeFile);
+    size << "0.1\n";
+    for (uint32_t i = 0; i <= 10; i++)
+    {
+        size << 1000 + 100 * i * i << "\n";
+    }
+    size.close();
+    std::ofstream interval(intervalFile);
+    interval << "0.2\n0.5\n16.6\n16.7\n33.3\n33.4\n120.25\n";
+    interval.close();
+
+    PscVideoStreamingDistributions::ConvertToBinary(sizeFile, sizeBinFile);
+    PscVideoStreamingDistributions::ConvertToBinary(intervalFile, intervalBinFile);
+
+    NS_TEST_ASSERT_MSG_EQ(PscVideoStreamingDistributions::IsBinaryFile(sizeFile),
+                          false,
+                          "Text file detected as binary");
+    NS_TEST_ASSERT_MSG_EQ(PscVideoStreamingDistributions::IsBinaryFile(sizeBinFile),
+                          true,
+                          "Binary file not detected");
+
+    Ptr<const PscVideoStreamingDistribution> text =
+        PscVideoStreamingDistributions::Load(sizeFile, intervalFile);
+    Ptr<const PscVideoStreamingDistribution> binary =
+        PscVideoStreamingDistributions::Load(sizeBinFile, intervalBinFile);
+
+    NS_TEST_ASSERT_MSG_EQ((text->GetSizeDistribution() == binary->GetSizeDistribution()),
+                          true,
+                          "Size distributions differ");
+    NS_TEST_ASSERT_MSG_EQ((text->GetIntervalDistribution() == binary->GetIntervalDistribution()),
+                          true,
+                          "Interval distributions differ");
+    NS_TEST_ASSERT_MSG_EQ(binary,
+                          PscVideoStreamingDistributions::Load(sizeBinFile, intervalBinFile),
+                          "Binary distribution is not shared");
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that frames are fragmented into packet trains, optionally paced, and
+ * that the per-frame trace reports every fragment
+ */
+class PscVideoStreamingTestCaseFrameTrain : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param fragmentInterval The FragmentInterval attribute of the application
+     */
+    PscVideoStreamingTestCaseFrameTrain(Time fragmentInterval);
+    void DoRun() override;
+
+    void Tx(Ptr<const Packet> p);
+    void TxFrame(uint32_t fragments, uint32_t bytes);
+
+  private:
+    Time m_fragmentInterval;                //!< Time between fragments
+    std::vector<Time> m_txTimes;            //!< Times at which the fragments were sent
+    std::vector<uint32_t> m_txSizes;        //!< Sizes of the fragments sent
+    std::vector<uint32_t> m_frameFragments; //!< Fragments reported for each frame
+    std::vector<uint32_t> m_frameBytes;     //!< Bytes reported for each frame
+};
+
+PscVideoStreamingTestCaseFrameTrain::PscVideoStreamingTestCaseFrameTrain(Time fragmentInterval)
+    : TestCase("PSC Video Streaming Test Case - Frame train with fragment interval " +
+               std::to_string(fragmentInterval.GetMilliSeconds()) + " ms"),
+      m_fragmentInterval(fragmentInterval)
+{
+}
+
+void
+PscVideoStreamingTestCaseFrameTrain::Tx(Ptr<const Packet> p)
+{
+    m_txTimes.push_back(Simulator::Now());
+    m_txSizes.push_back(p->GetSize());
+}
+
+void
+PscVideoStreamingTestCaseFrameTrain::TxFrame(uint32_t fragments, uint32_t bytes)
+{
+    m_frameFragments.push_back(fragments);
+    m_frameBytes.push_back(bytes);
+}
+
+void
+PscVideoStreamingTestCaseFrameTrain::DoRun()
+{
+    // Constant frame size and interval, so that every frame is the same
+    std::string sizeFile = CreateTempDirFilename("frame-size.txt");
+    std::string intervalFile = CreateTempDirFilename("frame-interval.txt");
+
+    std::ofstream size(sizeFile);
+    size << "1\n4000\n4000\n";
+    size.close();
+    std::ofstream interval(intervalFile);
+    interval << "1\n1000\n1000\n";
+    interval.close();
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    Ptr<PscVideoStreaming> app = CreateObject<PscVideoStreaming>();
+    app->ReadCustomDistribution(sizeFile, intervalFile);
+    app->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(1)));
+    app->SetAttribute("BoostLengthPacketCount", UintegerValue(0));
+    app->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+    app->SetAttribute("FragmentInterval", TimeValue(m_fragmentInterval));
+    app->SetStartTime(Seconds(1));
+    app->SetStopTime(Seconds(3.5));
+    nodes.Get(0)->AddApplication(app);
+
+    app->TraceConnectWithoutContext("Tx",
+                                    MakeCallback(&PscVideoStreamingTestCaseFrameTrain::Tx, this));
+    app->TraceConnectWithoutContext(
+        "TxFrame",
+        MakeCallback(&PscVideoStreamingTestCaseFrameTrain::TxFrame, this));
+
+    Simulator::Stop(Seconds(4));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // Frames at 1, 2 and 3 s, each one of 1500 + 1500 + 1000 bytes
+    NS_TEST_ASSERT_MSG_EQ(m_frameFragments.size(), 3, "Unexpected number of frames");
+    for (std::size_t i = 0; i < m_frameFragments.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_frameFragments[i], 3, "Unexpected number of fragments");
+        NS_TEST_ASSERT_MSG_EQ(m_frameBytes[i], 4000, "Unexpected frame size");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m_txTimes.size(), 9, "Unexpected number of fragments sent");
+    for (std::size_t i = 0; i < m_txTimes.size(); i++)
+    {
+        Time expected = Seconds(1 + i / 3) + m_fragmentInterval * static_cast<int64_t>(i % 3);
+        NS_TEST_ASSERT_MSG_EQ(m_txTimes[i], expected, "Unexpected fragment time");
+        NS_TEST_ASSERT_MSG_EQ(m_txSizes[i], (i % 3 == 2 ? 1000 : 1500), "Unexpected fragment size");
+    }
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks the loss and frame completeness measured by the receiver when some
+ * of the packets of a stream are dropped
+ */
+class PscVideoStreamingTestCaseReceiver : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param drops Indexes (in reception order) of the packets to drop
+     * \param completeFrames Expected number of frames received without losses
+     */
+    PscVideoStreamingTestCaseReceiver(std::list<uint32_t> drops, uint64_t completeFrames);
+    void DoRun() override;
+
+    void RxFrame(const Address& sender, uint32_t fragments, bool complete, Time delay);
+
+  private:
+    std::list<uint32_t> m_drops; //!< Packets to drop
+    uint64_t m_completeFrames;   //!< Expected number of complete frames
+    uint64_t m_rxFrames;         //!< Frames reported by the RxFrame trace
+    uint64_t m_rxComplete;       //!< Complete frames reported by the RxFrame trace
+};
+
+PscVideoStreamingTestCaseReceiver::PscVideoStreamingTestCaseReceiver(std::list<uint32_t> drops,
+                                                                     uint64_t completeFrames)
+    : TestCase("PSC Video Streaming Test Case - Receiver with " + std::to_string(drops.size()) +
+               " packets dropped, " + std::to_string(completeFrames) + " complete frames"),
+      m_drops(drops),
+      m_completeFrames(completeFrames),
+      m_rxFrames(0),
+      m_rxComplete(0)
+{
+}
+
+void
+PscVideoStreamingTestCaseReceiver::RxFrame(const Address& /* sender */,
+                                           uint32_t /* fragments */,
+                                           bool complete,
+                                           Time delay)
+{
+    m_rxFrames++;
+    m_rxComplete += complete ? 1 : 0;
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(delay, MilliSeconds(1), "Frame delay below the link delay");
+}
+
+void
+PscVideoStreamingTestCaseReceiver::DoRun()
+{
+    // Frames at 1, 2 and 3 s, each one of 1500 + 1500 + 1000 bytes
+    std::string sizeFile = CreateTempDirFilename("receiver-size.txt");
+    std::string intervalFile = CreateTempDirFilename("receiver-interval.txt");
+
+    std::ofstream size(sizeFile);
+    size << "1\n4000\n4000\n";
+    size.close();
+    std::ofstream interval(intervalFile);
+    interval << "1\n1000\n1000\n";
+    interval.close();
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("100Mbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("1ms"));
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    Ptr<ReceiveListErrorModel> errorModel = CreateObject<ReceiveListErrorModel>();
+    errorModel->SetList(m_drops);
+    devices.Get(1)->SetAttribute("ReceiveErrorModel", PointerValue(errorModel));
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    Ptr<PscVideoStreaming> sender = CreateObject<PscVideoStreaming>();
+    sender->ReadCustomDistribution(sizeFile, intervalFile);
+    sender->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(1)));
+    sender->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+    sender->SetStartTime(Seconds(1));
+    sender->SetStopTime(Seconds(3.5));
+    nodes.Get(0)->AddApplication(sender);
+
+    Ptr<PscVideoStreamingReceiver> receiver = CreateObject<PscVideoStreamingReceiver>();
+    receiver->SetStartTime(Seconds(0));
+    receiver->SetStopTime(Seconds(4));
+    nodes.Get(1)->AddApplication(receiver);
+
+    receiver->TraceConnectWithoutContext(
+        "RxFrame",
+        MakeCallback(&PscVideoStreamingTestCaseReceiver::RxFrame, this));
+
+    Simulator::Stop(Seconds(5));
+    Simulator::Run();
+
+    PscVideoStreamingReceiver::Stats stats = receiver->GetTotalStats();
+
+    NS_TEST_ASSERT_MSG_EQ(receiver->GetStreamCount(), 1, "Unexpected number of streams");
+    NS_TEST_ASSERT_MSG_EQ(stats.rxPackets, 9 - m_drops.size(), "Unexpected packets received");
+    NS_TEST_ASSERT_MSG_EQ(stats.lostPackets, m_drops.size(), "Unexpected packets lost");
+    NS_TEST_ASSERT_MSG_EQ(stats.expectedPackets, 9, "Unexpected packets expected");
+    NS_TEST_ASSERT_MSG_EQ(stats.reorderedPackets, 0, "Unexpected packets reordered");
+    NS_TEST_ASSERT_MSG_EQ(stats.rxFrames, 3, "Unexpected number of frames");
+    NS_TEST_ASSERT_MSG_EQ(stats.completeFrames, m_completeFrames, "Unexpected complete frames");
+    NS_TEST_ASSERT_MSG_EQ(m_rxFrames, 3, "Unexpected number of frames traced");
+    NS_TEST_ASSERT_MSG_EQ(m_rxComplete, m_completeFrames, "Unexpected complete frames traced");
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(stats.minDelay, MilliSeconds(1), "Delay below the link delay");
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(stats.GetMeanDelay(), stats.minDelay, "Unexpected mean delay");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that frame traces are shared and replayed with the sizes and times
+ * indicated in the trace
+ */
+class PscVideoStreamingTestCaseFrameTrace : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param loop The FrameTraceLoop attribute of the application
+     */
+    PscVideoStreamingTestCaseFrameTrace(bool loop);
+    void DoRun() override;
+
+    void TxFrame(uint32_t fragments, uint32_t bytes);
+
+  private:
+    bool m_loop;                        //!< Replay the trace in a loop
+    std::vector<Time> m_frameTimes;     //!< Times at which the frames were sent
+    std::vector<uint32_t> m_frameBytes; //!< Bytes sent for each frame
+};
+
+PscVideoStreamingTestCaseFrameTrace::PscVideoStreamingTestCaseFrameTrace(bool loop)
+    : TestCase(std::string("PSC Video Streaming Test Case - Frame trace") +
+               (loop ? " in a loop" : "")),
+      m_loop(loop)
+{
+}
+
+void
+PscVideoStreamingTestCaseFrameTrace::TxFrame(uint32_t /* fragments */, uint32_t bytes)
+{
+    m_frameTimes.push_back(Simulator::Now());
+    m_frameBytes.push_back(bytes);
+}
+
+void
+PscVideoStreamingTestCaseFrameTrace::DoRun()
+{
+    std::string textFile = CreateTempDirFilename("frames.txt");
+    std::string traceFile = CreateTempDirFilename("frames.bin");
+
+    std::ofstream text(textFile);
+    text << "0 100\n0.04 3000\n0.1 500\n";
+    text.close();
+
+    PscVideoFrameTrace::ConvertFromText(textFile, traceFile);
+
+    Ptr<const PscVideoFrameTrace> trace = PscVideoFrameTrace::Load(traceFile);
+    NS_TEST_ASSERT_MSG_EQ(trace, PscVideoFrameTrace::Load(traceFile), "Trace is not shared");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetFrameCount(), 3, "Unexpected number of frames");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetFrame(1).timestamp, MilliSeconds(40), "Unexpected timestamp");
+    NS_TEST_ASSERT_MSG_EQ(trace->GetFrame(1).size, 3000, "Unexpected size");
+    // The interval from the last frame to the first one is the mean one
+    NS_TEST_ASSERT_MSG_EQ(trace->GetInterval(2), MilliSeconds(50), "Unexpected loop interval");
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    Ptr<PscVideoStreaming> app = CreateObject<PscVideoStreaming>();
+    app->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(1)));
+    app->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+    app->SetAttribute("FrameTrace", StringValue(traceFile));
+    app->SetAttribute("FrameTraceLoop", BooleanValue(m_loop));
+    app->SetStartTime(Seconds(1));
+    app->SetStopTime(Seconds(1.2));
+    nodes.Get(0)->AddApplication(app);
+
+    app->TraceConnectWithoutContext(
+        "TxFrame",
+        MakeCallback(&PscVideoStreamingTestCaseFrameTrace::TxFrame, this));
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::vector<Time> expectedTimes = {Seconds(1), Seconds(1.04), Seconds(1.1)};
+    std::vector<uint32_t> expectedBytes = {100, 3000, 500};
+    if (m_loop)
+    {
+        expectedTimes.push_back(Seconds(1.15));
+        expectedTimes.push_back(Seconds(1.19));
+        expectedBytes.push_back(100);
+        expectedBytes.push_back(3000);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m_frameTimes.size(), expectedTimes.size(), "Unexpected frame count");
+    for (std::size_t i = 0; i < m_frameTimes.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_frameTimes[i], expectedTimes[i], "Unexpected frame time");
+        NS_TEST_ASSERT_MSG_EQ(m_frameBytes[i], expectedBytes[i], "Unexpected frame size");
+    }
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that a frame trace with a single frame is replayed in a loop, with
+ * the timestamp of the frame as the interval
+ */
+class PscVideoStreamingTestCaseSingleFrameTrace : public TestCase
+{
+  public:
+    PscVideoStreamingTestCaseSingleFrameTrace();
+    void DoRun() override;
+
+    void TxFrame(uint32_t fragments, uint32_t bytes);
+
+  private:
+    std::vector<Time> m_frameTimes;     //!< Times at which the frames were sent
+    std::vector<uint32_t> m_frameBytes; //!< Bytes sent for each frame
+};
+
+PscVideoStreamingTestCaseSingleFrameTrace::PscVideoStreamingTestCaseSingleFrameTrace()
+    : TestCase("PSC Video Streaming Test Case - Single frame trace in a loop")
+{
+}
+
+void
+PscVideoStreamingTestCaseSingleFrameTrace::TxFrame(uint32_t /* fragments */, uint32_t bytes)
+{
+    m_frameTimes.push_back(Simulator::Now());
+    m_frameBytes.push_back(bytes);
+}
+
+void
+PscVideoStreamingTestCaseSingleFrameTrace::DoRun()
+{
+    std::string textFile = CreateTempDirFilename("single-frame.txt");
+    std::string traceFile = CreateTempDirFilename("single-frame.bin");
+
+    std::ofstream text(textFile);
+    text << "0.02 700\n";
+    text.close();
+
+    PscVideoFrameTrace::ConvertFromText(textFile, traceFile);
+    Ptr<const PscVideoFrameTrace> trace = PscVideoFrameTrace::Load(traceFile);
+    NS_TEST_ASSERT_MSG_EQ(trace->GetInterval(0), MilliSeconds(20), "Unexpected loop interval");
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    Ptr<PscVideoStreaming> app = CreateObject<PscVideoStreaming>();
+    app->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(1)));
+    app->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+    app->SetAttribute("FrameTrace", StringValue(traceFile));
+    app->SetAttribute("FrameTraceLoop", BooleanValue(true));
+    app->SetStartTime(Seconds(1));
+    app->SetStopTime(Seconds(1.07));
+    nodes.Get(0)->AddApplication(app);
+
+    app->TraceConnectWithoutContext(
+        "TxFrame",
+        MakeCallback(&PscVideoStreamingTestCaseSingleFrameTrace::TxFrame, this));
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::vector<Time> expectedTimes = {Seconds(1), Seconds(1.02), Seconds(1.04), Seconds(1.06)};
+    NS_TEST_ASSERT_MSG_EQ(m_frameTimes.size(), expectedTimes.size(), "Unexpected frame count");
+    for (std::size_t i = 0; i < m_frameTimes.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_frameTimes[i], expectedTimes[i], "Unexpected frame time");
+        NS_TEST_ASSERT_MSG_EQ(m_frameBytes[i], 700, "Unexpected frame size");
+    }
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ * Checks that applications replaying a frame trace from a random frame start
+ * at different frames, and then replay the trace in order from there
+ */
+class PscVideoStreamingTestCaseFrameTraceRandomStart : public TestCase
+{
+  public:
+    PscVideoStreamingTestCaseFrameTraceRandomStart();
+    void DoRun() override;
+
+    void TxFrame(uint32_t app, uint32_t fragments, uint32_t bytes);
+
+  private:
+    const uint32_t FRAMES{10};                       //!< Frames of the trace
+    const uint32_t APPS{8};                          //!< Applications replaying the trace
+    std::vector<std::vector<Time>> m_frameTimes;     //!< Times of the frames of each app
+    std::vector<std::vector<uint32_t>> m_frameBytes; //!< Bytes of the frames of each app
+};
+
+PscVideoStreamingTestCaseFrameTraceRandomStart::PscVideoStreamingTestCaseFrameTraceRandomStart()
+    : TestCase("PSC Video Streaming Test Case - Frame trace from a random frame")
+{
+}
+
+void
+PscVideoStreamingTestCaseFrameTraceRandomStart::TxFrame(uint32_t app,
+                                                        uint32_t /* fragments */,
+                                                        uint32_t bytes)
+{
+    m_frameTimes[app].push_back(Simulator::Now());
+    m_frameBytes[app].push_back(bytes);
+}
+
+void
+PscVideoStreamingTestCaseFrameTraceRandomStart::DoRun()
+{
+    std::string textFile = CreateTempDirFilename("random-start.txt");
+    std::string traceFile = CreateTempDirFilename("random-start.bin");
+
+    // Frame i is sent at 10 ms * i and has a size of 100 * (i + 1) bytes
+    std::ofstream text(textFile);
+    for (uint32_t i = 0; i < FRAMES; i++)
+    {
+        text << 0.01 * i << " " << 100 * (i + 1) << "\n";
+    }
+    text.close();
+    PscVideoFrameTrace::ConvertFromText(textFile, traceFile);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = address.Assign(devices);
+
+    m_frameTimes.resize(APPS);
+    m_frameBytes.resize(APPS);
+    int64_t stream = 1;
+    for (uint32_t i = 0; i < APPS; i++)
+    {
+        Ptr<PscVideoStreaming> app = CreateObject<PscVideoStreaming>();
+        app->SetAttribute("ReceiverAddress", AddressValue(interfaces.GetAddress(1)));
+        app->SetAttribute("MaxUdpPayloadSize", UintegerValue(1500));
+        app->SetAttribute("FrameTrace", StringValue(traceFile));
+        app->SetAttribute("FrameTraceRandomStart", BooleanValue(true));
+        app->SetStartTime(Seconds(1));
+        app->SetStopTime(Seconds(1.045));
+        stream += app->AssignStreams(stream);
+        nodes.Get(0)->AddApplication(app);
+
+        app->TraceConnectWithoutContext(
+            "TxFrame",
+            MakeCallback(&PscVideoStreamingTestCaseFrameTraceRandomStart::TxFrame, this).Bind(i));
+    }
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::set<uint32_t> firstFrames;
+    for (uint32_t i = 0; i < APPS; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_frameBytes[i].size(), 5, "Unexpected frame count");
+        firstFrames.insert(m_frameBytes[i].front());
+        for (std::size_t j = 1; j < m_frameBytes[i].size(); j++)
+        {
+            // The frames follow the order of the trace, back to the first
+            // frame after the last one
+            uint32_t expectedBytes = m_frameBytes[i][j - 1] % (100 * FRAMES) + 100;
+            NS_TEST_ASSERT_MSG_EQ(m_frameBytes[i][j], expectedBytes, "Unexpected frame size");
+            NS_TEST_ASSERT_MSG_EQ(m_frameTimes[i][j] - m_frameTimes[i][j - 1],
+                                  MilliSeconds(10),
+                                  "Unexpected frame interval");
+        }
+    }
+    NS_TEST_ASSERT_MSG_GT(firstFrames.size(), 1, "All the applications started at the same frame");
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ */
+class PscVideoStreamingTestSuite : public TestSuite
+{
+  public:
+    PscVideoStreamingTestSuite();
+};
+
+PscVideoStreamingTestSuite::PscVideoStreamingTestSuite()
+    : TestSuite("psc-video-streaming", TestSuite::Type::UNIT)
+{
+    AddTestCase(new PscVideoStreamingTestCaseSharedDistribution());
+    AddTestCase(new PscVideoStreamingTestCaseSharedCustomDistribution());
+    AddTestCase(new PscVideoStreamingTestCaseBinaryDistribution());
+    AddTestCase(new PscVideoStreamingTestCaseFrameTrain(Seconds(0)));
+    AddTestCase(new PscVideoStreamingTestCaseFrameTrain(MilliSeconds(10)));
+    AddTestCase(new PscVideoStreamingTestCaseFrameTrace(false));
+    AddTestCase(new PscVideoStreamingTestCaseFrameTrace(true));
+    AddTestCase(new PscVideoStreamingTestCaseSingleFrameTrace());
+    AddTestCase(new PscVideoStreamingTestCaseFrameTraceRandomStart());
+    AddTestCase(new PscVideoStreamingTestCaseReceiver({}, 3));
+    // A fragment in the middle of the second frame
+    AddTestCase(new PscVideoStreamingTestCaseReceiver({4}, 2));
+    // The first fragment of the second frame, which can't be told apart from
+    // the last fragment of the first frame
+    AddTestCase(new PscVideoStreamingTestCaseReceiver({3}, 1));
+}
+
+/**
+ * \ingroup psc-video-streaming-tests
+ */
+static PscVideoStreamingTestSuite g_pscVideoStreamingTestSuite;
+
+} // namespace tests
+} // namespace ns3
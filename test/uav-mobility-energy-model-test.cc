@@ -49,6 +49,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 NS_LOG_COMPONENT_DEFINE("UavMobilityEnergyModelTestSuite");
 
@@ -1186,6 +1187,367 @@ UavMobilityEnergyModelTestCaseVelocityTraces::CurrentTrace(double oldCurrent,
     m_currentVelocity = velocity;
 }
 
+/**
+ * \ingroup uav-mobility-energy-model-tests
+ * Tests that the models in a fleet energy manager consume the same energy
+ * as the standalone models with the same movements
+ */
+class UavMobilityEnergyModelTestCaseFleetEnergyManager : public TestCase
+{
+  public:
+    UavMobilityEnergyModelTestCaseFleetEnergyManager();
+    void DoRun() override;
+};
+
+UavMobilityEnergyModelTestCaseFleetEnergyManager::UavMobilityEnergyModelTestCaseFleetEnergyManager()
+    : TestCase("UAV Mobility Energy Model Test Case - Fleet Energy Manager")
+{
+}
+
+void
+UavMobilityEnergyModelTestCaseFleetEnergyManager::DoRun()
+{
+    const uint32_t UAVS = 4;
+    const double INITIAL_ENERGY = 1000000;
+    const double VOLTAGE = 11;
+    const std::vector<Vector> VELOCITIES{Vector(1, 0, 0),
+                                         Vector(0, 0, 2),
+                                         Vector(0, 0, -1),
+                                         Vector(2, 1, 0.5),
+                                         Vector(0, 0, 0)};
+
+    Ptr<psc::UavFleetEnergyManager> fleet = CreateObject<psc::UavFleetEnergyManager>();
+    fleet->SetAttribute("SyncInterval", TimeValue(Seconds(1)));
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+
+    std::vector<Ptr<UavMobilityEnergyModel>> standaloneModels;
+    std::vector<Ptr<UavMobilityEnergyModel>> fleetModels;
+    std::vector<Ptr<energy::BasicEnergySource>> standaloneSources;
+    std::vector<Ptr<energy::BasicEnergySource>> fleetSources;
+    for (uint32_t i = 0; i < 2 * UAVS; i++)
+    {
+        const bool inFleet = i >= UAVS;
+        Ptr<Node> node = CreateObject<Node>();
+        mobility.Install(node);
+        Ptr<ConstantVelocityMobilityModel> mobilityModel =
+            node->GetObject<ConstantVelocityMobilityModel>();
+
+        Ptr<energy::BasicEnergySource> energySource = CreateObject<energy::BasicEnergySource>();
+        node->AggregateObject(energySource);
+        energySource->SetInitialEnergy(INITIAL_ENERGY);
+        energySource->SetSupplyVoltage(VOLTAGE);
+        energySource->SetNode(node);
+
+        Ptr<UavMobilityEnergyModel> model = CreateObject<UavMobilityEnergyModel>();
+        node->AggregateObject(model);
+        model->Init(node, energySource);
+        if (inFleet)
+        {
+            model->SetFleetEnergyManager(fleet);
+            fleetModels.push_back(model);
+            fleetSources.push_back(energySource);
+        }
+        else
+        {
+            standaloneModels.push_back(model);
+            standaloneSources.push_back(energySource);
+        }
+
+        // Same movements for the same UAV in and out of the fleet
+        for (std::size_t k = 0; k < VELOCITIES.size(); k++)
+        {
+            Simulator::Schedule(Seconds(0.35 * (k + 1) + 0.1 * (i % UAVS)),
+                                &ConstantVelocityMobilityModel::SetVelocity,
+                                mobilityModel,
+                                VELOCITIES[k]);
+        }
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(fleet->GetN(), UAVS, "All the fleet models should have been added");
+
+    Simulator::Stop(Seconds(4.5));
+    Simulator::Run();
+
+    double standaloneTotal = 0;
+    for (uint32_t i = 0; i < UAVS; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(fleetModels[i]->GetTotalEnergyConsumption(),
+                              standaloneModels[i]->GetTotalEnergyConsumption(),
+                              "The energy consumed in the fleet should be identical");
+        NS_TEST_ASSERT_MSG_EQ(fleetModels[i]->GetState(),
+                              fleet->GetState(i),
+                              "The fleet should track the state of the model");
+        NS_TEST_ASSERT_MSG_EQ_TOL(fleetSources[i]->GetRemainingEnergy(),
+                                  standaloneSources[i]->GetRemainingEnergy(),
+                                  1e-6,
+                                  "The source should be charged the same energy");
+        standaloneTotal += standaloneModels[i]->GetTotalEnergyConsumption();
+    }
+    NS_TEST_ASSERT_MSG_GT(standaloneTotal, 0, "The UAVs should have consumed energy");
+    NS_TEST_ASSERT_MSG_EQ_TOL(fleet->GetTotalEnergyConsumption(),
+                              standaloneTotal,
+                              1e-6,
+                              "The fleet total should be the sum of the models");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup uav-mobility-energy-model-tests
+ * Tests that the energy sources of the models in a fleet energy manager
+ * are charged the energy consumed up to the time they are queried, and that
+ * the manager only syncs while it has models
+ */
+class UavMobilityEnergyModelTestCaseFleetSourceQuery : public TestCase
+{
+  public:
+    UavMobilityEnergyModelTestCaseFleetSourceQuery();
+    void DoRun() override;
+};
+
+UavMobilityEnergyModelTestCaseFleetSourceQuery::UavMobilityEnergyModelTestCaseFleetSourceQuery()
+    : TestCase("UAV Mobility Energy Model Test Case - Fleet Source Query")
+{
+}
+
+void
+UavMobilityEnergyModelTestCaseFleetSourceQuery::DoRun()
+{
+    const uint32_t UAVS = 2;
+    const double INITIAL_ENERGY = 1000000;
+    const double VOLTAGE = 11;
+
+    Ptr<psc::UavFleetEnergyManager> fleet = CreateObject<psc::UavFleetEnergyManager>();
+    fleet->SetAttribute("SyncInterval", TimeValue(Seconds(1)));
+
+    // An empty fleet has no sync points, so the simulation ends right away
+    Simulator::Run();
+    NS_TEST_ASSERT_MSG_EQ(Simulator::Now(), Seconds(0), "An empty fleet should not sync");
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+
+    std::vector<Ptr<UavMobilityEnergyModel>> models;
+    std::vector<Ptr<energy::BasicEnergySource>> sources;
+    for (uint32_t i = 0; i < UAVS; i++)
+    {
+        Ptr<Node> node = CreateObject<Node>();
+        mobility.Install(node);
+        Ptr<ConstantVelocityMobilityModel> mobilityModel =
+            node->GetObject<ConstantVelocityMobilityModel>();
+
+        Ptr<energy::BasicEnergySource> energySource = CreateObject<energy::BasicEnergySource>();
+        node->AggregateObject(energySource);
+        energySource->SetInitialEnergy(INITIAL_ENERGY);
+        energySource->SetSupplyVoltage(VOLTAGE);
+        energySource->SetNode(node);
+
+        Ptr<UavMobilityEnergyModel> model = CreateObject<UavMobilityEnergyModel>();
+        node->AggregateObject(model);
+        model->Init(node, energySource);
+        model->SetHoverCurrent(0);
+        model->SetFleetEnergyManager(fleet);
+        models.push_back(model);
+        sources.push_back(energySource);
+
+        // Same movements for both UAVs, with several current changes
+        // between two sync points, and no current right after a sync point
+        Simulator::Schedule(Seconds(0.3),
+                            &ConstantVelocityMobilityModel::SetVelocity,
+                            mobilityModel,
+                            Vector(1, 0, 0));
+        Simulator::Schedule(Seconds(0.6),
+                            &ConstantVelocityMobilityModel::SetVelocity,
+                            mobilityModel,
+                            Vector(0, 0, 2));
+        Simulator::Schedule(Seconds(1),
+                            &ConstantVelocityMobilityModel::SetVelocity,
+                            mobilityModel,
+                            Vector(0, 0, 0));
+    }
+
+    // Only query the source of the second UAV, between the sync points. It
+    // should have been charged all the energy consumed, and never recharged
+    double previousEnergy = INITIAL_ENERGY;
+    for (double time : {0.2, 0.5, 0.8, 1.2, 1.5, 2.5})
+    {
+        Simulator::Schedule(Seconds(time), [this, &models, &sources, &previousEnergy]() {
+            double remainingEnergy = sources[1]->GetRemainingEnergy();
+            NS_TEST_EXPECT_MSG_EQ_TOL(remainingEnergy,
+                                      INITIAL_ENERGY - models[1]->GetTotalEnergyConsumption(),
+                                      1e-6,
+                                      "The source should be charged the energy consumed so far");
+            NS_TEST_EXPECT_MSG_LT_OR_EQ(remainingEnergy,
+                                        previousEnergy,
+                                        "The source should never be recharged");
+            previousEnergy = remainingEnergy;
+        });
+    }
+
+    Simulator::Stop(Seconds(3.5));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(models[1]->GetTotalEnergyConsumption(),
+                          models[0]->GetTotalEnergyConsumption(),
+                          "Both UAVs should have consumed the same energy");
+    NS_TEST_ASSERT_MSG_GT(models[0]->GetTotalEnergyConsumption(),
+                          0,
+                          "The UAVs should have consumed energy");
+    NS_TEST_ASSERT_MSG_EQ_TOL(sources[1]->GetRemainingEnergy(),
+                              sources[0]->GetRemainingEnergy(),
+                              1e-6,
+                              "Querying the source should not change the energy drawn");
+    NS_TEST_ASSERT_MSG_LT(sources[0]->GetRemainingEnergy(),
+                          INITIAL_ENERGY,
+                          "The sources should have been charged");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup uav-mobility-energy-model-tests
+ * Tests that the depletion of the energy source is detected at the exact
+ * time it happens, without relying on the periodic updates of the source
+ */
+class UavMobilityEnergyModelTestCaseExactEnergyDepletion : public TestCase
+{
+    const double INITIAL_ENERGY = 10000;
+    const double VOLTAGE = 11;
+    const double HOVER_COST = 210;
+    const double MOVE_COST = 220;
+    const double OTHER_COST = 20;
+    const double THRESHOLD = 0.5;
+    Time m_depletionTime; //!< Time the EnergyDepleted trace was called
+
+  public:
+    UavMobilityEnergyModelTestCaseExactEnergyDepletion();
+    void DoRun() override;
+    void LowEnergy(Ptr<const UavMobilityEnergyModel> model);
+
+    /**
+     * Runs a simulation in which the energy source depletes
+     *
+     * \param exactDepletion Value of the ExactEnergyDepletion attribute
+     * \param updateInterval Interval between the periodic updates of the source
+     * \param otherCurrent Current of another model of the source, from the start
+     * \return The time the EnergyDepleted trace was called
+     */
+    Time RunDepletion(bool exactDepletion, Time updateInterval, double otherCurrent);
+};
+
+UavMobilityEnergyModelTestCaseExactEnergyDepletion::
+    UavMobilityEnergyModelTestCaseExactEnergyDepletion()
+    : TestCase("UAV Mobility Energy Model Test Case - Exact Energy Depletion")
+{
+}
+
+void
+UavMobilityEnergyModelTestCaseExactEnergyDepletion::DoRun()
+{
+    // Hover from 1 s to 2 s, then move at 1 m/s until the threshold is crossed
+    const double HOVER_ENERGY = VOLTAGE * HOVER_COST;
+    const double EXPECTED_DEPLETION_TIME =
+        2 + (INITIAL_ENERGY * (1 - THRESHOLD) - HOVER_ENERGY) / (VOLTAGE * MOVE_COST);
+
+    Time exactTime = RunDepletion(true, Seconds(1000), 0);
+    Time polledTime = RunDepletion(false, MilliSeconds(1), 0);
+
+    NS_TEST_ASSERT_MSG_EQ_TOL(exactTime.GetSeconds(),
+                              EXPECTED_DEPLETION_TIME,
+                              1e-8,
+                              "The depletion should be detected when it happens");
+    NS_TEST_ASSERT_MSG_EQ_TOL(exactTime.GetSeconds(),
+                              polledTime.GetSeconds(),
+                              1e-3,
+                              "The depletion time should match fine-grained polling");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(exactTime,
+                                polledTime,
+                                "Polling should not detect the depletion earlier");
+
+    // Same, with another model drawing from the source since the start
+    const double EXPECTED_SHARED_DEPLETION_TIME =
+        2 + (INITIAL_ENERGY * (1 - THRESHOLD) - HOVER_ENERGY - 2 * VOLTAGE * OTHER_COST) /
+                (VOLTAGE * (MOVE_COST + OTHER_COST));
+
+    Time sharedExactTime = RunDepletion(true, Seconds(1000), OTHER_COST);
+    Time sharedPolledTime = RunDepletion(false, MilliSeconds(1), OTHER_COST);
+
+    NS_TEST_ASSERT_MSG_EQ_TOL(sharedExactTime.GetSeconds(),
+                              EXPECTED_SHARED_DEPLETION_TIME,
+                              1e-8,
+                              "The depletion should account for the other model");
+    NS_TEST_ASSERT_MSG_EQ_TOL(sharedExactTime.GetSeconds(),
+                              sharedPolledTime.GetSeconds(),
+                              1e-3,
+                              "The depletion time should match fine-grained polling");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(sharedExactTime,
+                                sharedPolledTime,
+                                "Polling should not detect the depletion earlier");
+}
+
+Time
+UavMobilityEnergyModelTestCaseExactEnergyDepletion::RunDepletion(bool exactDepletion,
+                                                                 Time updateInterval,
+                                                                 double otherCurrent)
+{
+    m_depletionTime = Time(0);
+
+    Ptr<Node> node = CreateObject<Node>();
+
+    // Be sure to attach the mobility model first
+    AttachMockMobility(node);
+
+    Ptr<energy::BasicEnergySource> energySource = CreateObject<energy::BasicEnergySource>();
+    node->AggregateObject(energySource);
+    energySource->SetNode(node);
+    energySource->SetSupplyVoltage(VOLTAGE);
+    energySource->SetInitialEnergy(INITIAL_ENERGY);
+    energySource->SetAttribute("BasicEnergyLowBatteryThreshold", DoubleValue(THRESHOLD));
+    energySource->SetAttribute("PeriodicEnergyUpdateInterval", TimeValue(updateInterval));
+
+    Ptr<UavMobilityEnergyModel> model = CreateObject<UavMobilityEnergyModel>();
+    model->SetAttribute("ExactEnergyDepletion", BooleanValue(exactDepletion));
+    model->SetHoverCurrent(HOVER_COST);
+    model->SetMoveEnergyConversionFactor(MOVE_COST);
+    model->Init(node, energySource);
+    node->AggregateObject(model);
+
+    model->TraceConnectWithoutContext(
+        "EnergyDepleted",
+        MakeCallback(&UavMobilityEnergyModelTestCaseExactEnergyDepletion::LowEnergy, this));
+
+    if (otherCurrent > 0)
+    {
+        Ptr<energy::SimpleDeviceEnergyModel> other =
+            CreateObject<energy::SimpleDeviceEnergyModel>();
+        other->SetNode(node);
+        other->SetEnergySource(energySource);
+        energySource->AppendDeviceEnergyModel(other);
+        Simulator::Schedule(Seconds(0),
+                            &energy::SimpleDeviceEnergyModel::SetCurrentA,
+                            other,
+                            otherCurrent);
+    }
+
+    Simulator::Schedule(Seconds(1), &UavMobilityEnergyModel::Hover, model);
+    Simulator::Schedule(Seconds(2), &UavMobilityEnergyModel::Move, model, Vector(1, 0, 0));
+    Simulator::Stop(Seconds(4));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_GT(m_depletionTime, Time(0), "The energy source should deplete");
+    return m_depletionTime;
+}
+
+void
+UavMobilityEnergyModelTestCaseExactEnergyDepletion::LowEnergy(
+    Ptr<const UavMobilityEnergyModel> model)
+{
+    m_depletionTime = Simulator::Now();
+}
+
 /**
  * \ingroup uav-mobility-energy-model-tests
  */
@@ -1212,6 +1574,9 @@ UavMobilityEnergyModelTestSuite::UavMobilityEnergyModelTestSuite()
     AddTestCase(new UavMobilityEnergyModelTestCaseAttributeEnergySource());
     AddTestCase(new UavMobilityEnergyModelTestCaseFixedStateChangeSpeed());
     AddTestCase(new UavMobilityEnergyModelTestCaseVelocityTraces());
+    AddTestCase(new UavMobilityEnergyModelTestCaseFleetEnergyManager());
+    AddTestCase(new UavMobilityEnergyModelTestCaseFleetSourceQuery());
+    AddTestCase(new UavMobilityEnergyModelTestCaseExactEnergyDepletion());
 }
 
 /**
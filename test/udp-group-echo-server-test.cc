@@ -0,0 +1,505 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+/**
+ * \file udp-group-echo-server-test.cc
+ * \ingroup psc-tests
+ *
+ * UdpGroupEchoServer test suite
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/log.h>
+#include <ns3/point-to-point-module.h>
+#include <ns3/psc-module.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("UdpGroupEchoServerTestSuite");
+
+/**
+ * \ingroup psc-tests
+ * \defgroup udp-group-echo-server-tests Tests for UdpGroupEchoServer
+ */
+
+namespace ns3
+{
+namespace tests
+{
+
+using psc::UdpGroupEchoServer;
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Base class of the test cases, with a server on one node and a number of
+ * clients on another node, each client being a socket bound to its own port.
+ */
+class UdpGroupEchoServerBaseTestCase : public TestCase
+{
+  public:
+    UdpGroupEchoServerBaseTestCase(const std::string& name);
+    ~UdpGroupEchoServerBaseTestCase() override = default;
+
+  protected:
+    const uint16_t SERVER_PORT{9};
+    const uint16_t FIRST_CLIENT_PORT{1001};
+    const Time STOP_TIME{Seconds(10)};
+
+    /**
+     * Creates the sockets of the clients.
+     * \param count The number of clients.
+     */
+    void CreateClients(uint32_t count);
+    /**
+     * Schedules the transmission of a packet from a client to the server.
+     * \param client The index of the client.
+     * \param time The time of the transmission.
+     * \param serverPort The port of the server to send the packet to.
+     */
+    void Send(uint32_t client, Time time, uint16_t serverPort);
+    /**
+     * Schedules the transmission of a packet from a client to the port of
+     * the first group of the server.
+     * \param client The index of the client.
+     * \param time The time of the transmission.
+     */
+    void Send(uint32_t client, Time time);
+    /**
+     * Gets the clients that received the echoes of a packet sent at a given
+     * time, in the order they received them.
+     * \param time The time at which the packet was sent.
+     * \return The indexes of the clients.
+     */
+    std::vector<uint32_t> GetRecipients(Time time) const;
+    /**
+     * Gets the address of a client.
+     * \param client The index of the client.
+     * \return The address.
+     */
+    Address GetClientAddress(uint32_t client) const;
+    /**
+     * Checks the size of a group at a given time.
+     * \param time The time of the check.
+     * \param group The index of the group.
+     * \param size The expected size of the group.
+     */
+    void CheckGroupSize(Time time, uint32_t group, uint32_t size);
+
+    NodeContainer nodes;
+    Ipv4InterfaceContainer interfaces;
+    Ptr<UdpGroupEchoServer> server;
+
+  private:
+    void DoSetup() override;
+    /**
+     * Receives the echoes on the socket of a client.
+     * \param client The index of the client.
+     * \param socket The socket.
+     */
+    void ReceiveEcho(uint32_t client, Ptr<Socket> socket);
+
+    std::vector<Ptr<Socket>> m_clients;               //!< The sockets of the clients
+    std::vector<std::pair<Time, uint32_t>> m_echoes; //!< Time and client of each echo
+};
+
+UdpGroupEchoServerBaseTestCase::UdpGroupEchoServerBaseTestCase(const std::string& name)
+    : TestCase(name)
+{
+}
+
+void
+UdpGroupEchoServerBaseTestCase::DoSetup()
+{
+    nodes.Create(2);
+
+    PointToPointHelper pointToPoint;
+    pointToPoint.SetDeviceAttribute("DataRate", StringValue("100Mbps"));
+    pointToPoint.SetChannelAttribute("Delay", StringValue("1ms"));
+    NetDeviceContainer devices = pointToPoint.Install(nodes);
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    interfaces = address.Assign(devices);
+
+    server = CreateObject<UdpGroupEchoServer>();
+    server->SetAttribute("Port", UintegerValue(SERVER_PORT));
+    server->SetStartTime(Seconds(0));
+    server->SetStopTime(STOP_TIME);
+    nodes.Get(0)->AddApplication(server);
+}
+
+void
+UdpGroupEchoServerBaseTestCase::CreateClients(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Ptr<Socket> socket = Socket::CreateSocket(nodes.Get(1), UdpSocketFactory::GetTypeId());
+        socket->Bind(InetSocketAddress(Ipv4Address::GetAny(), FIRST_CLIENT_PORT + i));
+        socket->SetRecvCallback(
+            MakeCallback(&UdpGroupEchoServerBaseTestCase::ReceiveEcho, this).Bind(i));
+        m_clients.push_back(socket);
+    }
+}
+
+void
+UdpGroupEchoServerBaseTestCase::Send(uint32_t client, Time time, uint16_t serverPort)
+{
+    Ptr<Socket> socket = m_clients[client];
+    InetSocketAddress destination(interfaces.GetAddress(0), serverPort);
+    Simulator::Schedule(time, [socket, destination]() {
+        socket->SendTo(Create<Packet>(100), 0, destination);
+    });
+}
+
+void
+UdpGroupEchoServerBaseTestCase::Send(uint32_t client, Time time)
+{
+    Send(client, time, SERVER_PORT);
+}
+
+void
+UdpGroupEchoServerBaseTestCase::ReceiveEcho(uint32_t client, Ptr<Socket> socket)
+{
+    Address from;
+    while (socket->RecvFrom(from))
+    {
+        m_echoes.emplace_back(Simulator::Now(), client);
+    }
+}
+
+std::vector<uint32_t>
+UdpGroupEchoServerBaseTestCase::GetRecipients(Time time) const
+{
+    // The echoes arrive a few milliseconds after the packet is sent, and the
+    // packets of the test cases are sent at least 100 ms apart
+    std::vector<uint32_t> recipients;
+    for (const auto& [echoTime, client] : m_echoes)
+    {
+        if (echoTime >= time && echoTime < time + MilliSeconds(100))
+        {
+            recipients.push_back(client);
+        }
+    }
+    return recipients;
+}
+
+Address
+UdpGroupEchoServerBaseTestCase::GetClientAddress(uint32_t client) const
+{
+    return InetSocketAddress(interfaces.GetAddress(1), FIRST_CLIENT_PORT + client);
+}
+
+void
+UdpGroupEchoServerBaseTestCase::CheckGroupSize(Time time, uint32_t group, uint32_t size)
+{
+    Simulator::Schedule(time, [this, group, size]() {
+        NS_TEST_EXPECT_MSG_EQ(server->GetGroupSize(group),
+                              size,
+                              "Unexpected size of group " << group << " at "
+                                                          << Simulator::Now().As(Time::S));
+    });
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Checks that, without session expiration, the echoes are sent to the
+ * clients in the order in which they first contacted the server.
+ */
+class UdpGroupEchoServerTestCaseEchoOrder : public UdpGroupEchoServerBaseTestCase
+{
+  public:
+    UdpGroupEchoServerTestCaseEchoOrder();
+    void DoRun() override;
+};
+
+UdpGroupEchoServerTestCaseEchoOrder::UdpGroupEchoServerTestCaseEchoOrder()
+    : UdpGroupEchoServerBaseTestCase("UDP Group Echo Server Test Case - Echo order")
+{
+}
+
+void
+UdpGroupEchoServerTestCaseEchoOrder::DoRun()
+{
+    server->SetAttribute("Mode", EnumValue(UdpGroupEchoServer::INF_SESSION));
+    CreateClients(3);
+
+    Send(2, Seconds(1));
+    Send(0, Seconds(1.1));
+    Send(1, Seconds(1.2));
+    Send(0, Seconds(2));
+    CheckGroupSize(Seconds(3), 0, 3);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(1)) == std::vector<uint32_t>{2}),
+                          true,
+                          "The first client should only echo to itself");
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(2)) == std::vector<uint32_t>{2, 0, 1}),
+                          true,
+                          "The echoes should follow the order in which the clients joined");
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Checks that a client that sends several packets is only registered once.
+ */
+class UdpGroupEchoServerTestCaseReRegistration : public UdpGroupEchoServerBaseTestCase
+{
+  public:
+    UdpGroupEchoServerTestCaseReRegistration();
+    void DoRun() override;
+};
+
+UdpGroupEchoServerTestCaseReRegistration::UdpGroupEchoServerTestCaseReRegistration()
+    : UdpGroupEchoServerBaseTestCase("UDP Group Echo Server Test Case - Re-registration")
+{
+}
+
+void
+UdpGroupEchoServerTestCaseReRegistration::DoRun()
+{
+    server->SetAttribute("Mode", EnumValue(UdpGroupEchoServer::INF_SESSION));
+    CreateClients(2);
+
+    Send(0, Seconds(1));
+    Send(0, Seconds(1.5));
+    Send(0, Seconds(2));
+    CheckGroupSize(Seconds(2.2), 0, 1);
+    Send(1, Seconds(2.5));
+    CheckGroupSize(Seconds(2.7), 0, 2);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    for (double time : {1.0, 1.5, 2.0})
+    {
+        NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(time)) == std::vector<uint32_t>{0}),
+                              true,
+                              "The client should get a single echo at " << time << " s");
+    }
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(2.5)) == std::vector<uint32_t>{0, 1}),
+                          true,
+                          "Each client should get a single echo");
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Checks that the clients that have not been heard from within the timeout
+ * are removed from the group, and that they can join it again.
+ */
+class UdpGroupEchoServerTestCaseExpiry : public UdpGroupEchoServerBaseTestCase
+{
+  public:
+    UdpGroupEchoServerTestCaseExpiry();
+    void DoRun() override;
+};
+
+UdpGroupEchoServerTestCaseExpiry::UdpGroupEchoServerTestCaseExpiry()
+    : UdpGroupEchoServerBaseTestCase("UDP Group Echo Server Test Case - Session expiry")
+{
+}
+
+void
+UdpGroupEchoServerTestCaseExpiry::DoRun()
+{
+    server->SetAttribute("Mode", EnumValue(UdpGroupEchoServer::TIMEOUT_LIMITED));
+    server->SetAttribute("Timeout", TimeValue(Seconds(1)));
+    CreateClients(3);
+
+    Send(0, Seconds(1));
+    Send(1, Seconds(1.5));
+    // The session of client 0 expired at 2 s
+    Send(2, Seconds(2.2));
+    CheckGroupSize(Seconds(2.25), 0, 2);
+    // Client 0 joins again, while the session of client 1 is still active
+    Send(0, Seconds(2.3));
+    CheckGroupSize(Seconds(2.35), 0, 3);
+    // Only client 2, which sends the packet, is active
+    Send(2, Seconds(4));
+    CheckGroupSize(Seconds(4.05), 0, 1);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    auto recipients = [this](double time) {
+        std::vector<uint32_t> clients = GetRecipients(Seconds(time));
+        return std::multiset<uint32_t>(clients.begin(), clients.end());
+    };
+    NS_TEST_ASSERT_MSG_EQ((recipients(1.5) == std::multiset<uint32_t>{0, 1}),
+                          true,
+                          "Both clients should be active at 1.5 s");
+    NS_TEST_ASSERT_MSG_EQ((recipients(2.2) == std::multiset<uint32_t>{1, 2}),
+                          true,
+                          "The expired client should not get the echo at 2.2 s");
+    NS_TEST_ASSERT_MSG_EQ((recipients(2.3) == std::multiset<uint32_t>{0, 1, 2}),
+                          true,
+                          "The client that joined again should get the echo at 2.3 s");
+    NS_TEST_ASSERT_MSG_EQ((recipients(4) == std::multiset<uint32_t>{2}),
+                          true,
+                          "Only the sender should be active at 4 s");
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Checks that nothing is echoed when the table of clients is empty once the
+ * expired sessions are removed, which happens with a null timeout.
+ */
+class UdpGroupEchoServerTestCaseEmptyTable : public UdpGroupEchoServerBaseTestCase
+{
+  public:
+    UdpGroupEchoServerTestCaseEmptyTable();
+    void DoRun() override;
+};
+
+UdpGroupEchoServerTestCaseEmptyTable::UdpGroupEchoServerTestCaseEmptyTable()
+    : UdpGroupEchoServerBaseTestCase("UDP Group Echo Server Test Case - Empty table")
+{
+}
+
+void
+UdpGroupEchoServerTestCaseEmptyTable::DoRun()
+{
+    server->SetAttribute("Mode", EnumValue(UdpGroupEchoServer::TIMEOUT_LIMITED));
+    server->SetAttribute("Timeout", TimeValue(Seconds(0)));
+    CreateClients(2);
+
+    CheckGroupSize(Seconds(0.5), 0, 0);
+    Send(0, Seconds(1));
+    Send(1, Seconds(1.5));
+    CheckGroupSize(Seconds(2), 0, 0);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(GetRecipients(Seconds(1)).empty(), true, "No echo expected");
+    NS_TEST_ASSERT_MSG_EQ(GetRecipients(Seconds(1.5)).empty(), true, "No echo expected");
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ *
+ * Checks that the groups are served independently, on their own ports, and
+ * that the clients added to a group before the server starts get its echoes.
+ */
+class UdpGroupEchoServerTestCaseGroups : public UdpGroupEchoServerBaseTestCase
+{
+  public:
+    UdpGroupEchoServerTestCaseGroups();
+    void DoRun() override;
+};
+
+UdpGroupEchoServerTestCaseGroups::UdpGroupEchoServerTestCaseGroups()
+    : UdpGroupEchoServerBaseTestCase("UDP Group Echo Server Test Case - Groups")
+{
+}
+
+void
+UdpGroupEchoServerTestCaseGroups::DoRun()
+{
+    server->SetAttribute("Mode", EnumValue(UdpGroupEchoServer::INF_SESSION));
+    server->SetAttribute("Groups", UintegerValue(2));
+    CreateClients(3);
+
+    NS_TEST_ASSERT_MSG_EQ(server->GetGroupSize(0), 0, "No client expected before any is added");
+    server->AddClient(GetClientAddress(2), 1);
+    NS_TEST_ASSERT_MSG_EQ(server->GetGroupCount(), 2, "Unexpected number of groups");
+    NS_TEST_ASSERT_MSG_EQ(server->GetGroupSize(0), 0, "Unexpected size of group 0");
+    NS_TEST_ASSERT_MSG_EQ(server->GetGroupSize(1), 1, "Unexpected size of group 1");
+
+    Send(0, Seconds(1), SERVER_PORT);
+    CheckGroupSize(Seconds(1.5), 0, 1);
+    CheckGroupSize(Seconds(1.5), 1, 1);
+    Send(1, Seconds(2), SERVER_PORT + 1);
+    CheckGroupSize(Seconds(2.5), 0, 1);
+    CheckGroupSize(Seconds(2.5), 1, 2);
+    Send(0, Seconds(3), SERVER_PORT);
+
+    Simulator::Stop(STOP_TIME);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(1)) == std::vector<uint32_t>{0}),
+                          true,
+                          "Only the client of group 0 should get the echo");
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(2)) == std::vector<uint32_t>{2, 1}),
+                          true,
+                          "The added client and the sender should get the echo of group 1");
+    NS_TEST_ASSERT_MSG_EQ((GetRecipients(Seconds(3)) == std::vector<uint32_t>{0}),
+                          true,
+                          "The clients of group 1 should not get the echoes of group 0");
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ */
+class UdpGroupEchoServerTestSuite : public TestSuite
+{
+  public:
+    UdpGroupEchoServerTestSuite();
+};
+
+UdpGroupEchoServerTestSuite::UdpGroupEchoServerTestSuite()
+    : TestSuite("udp-group-echo-server", TestSuite::Type::UNIT)
+{
+    AddTestCase(new UdpGroupEchoServerTestCaseEchoOrder());
+    AddTestCase(new UdpGroupEchoServerTestCaseReRegistration());
+    AddTestCase(new UdpGroupEchoServerTestCaseExpiry());
+    AddTestCase(new UdpGroupEchoServerTestCaseEmptyTable());
+    AddTestCase(new UdpGroupEchoServerTestCaseGroups());
+}
+
+/**
+ * \ingroup udp-group-echo-server-tests
+ */
+static UdpGroupEchoServerTestSuite g_udpGroupEchoServerTestSuite;
+
+} // namespace tests
+} // namespace ns3